@@ -43,6 +43,8 @@ cp libinjection/c/libinjection.h ModSecurity/apache2/libinjection
 cp libinjection/c/libinjection_sqli.c ModSecurity/apache2/libinjection
 cp libinjection/c/libinjection_sqli.h ModSecurity/apache2/libinjection
 cp libinjection/c/libinjection_sqli_data.h ModSecurity/apache2/libinjection
+cp libinjection/c/libinjection_charclass.h ModSecurity/apache2/libinjection
+cp libinjection/c/libinjection_shape_stats.h ModSecurity/apache2/libinjection
 
 
 #
@@ -62,6 +64,8 @@ git add apache2/libinjection/libinjection.h
 git add apache2/libinjection/libinjection_sqli.h
 git add apache2/libinjection/libinjection_sqli.c
 git add apache2/libinjection/libinjection_sqli_data.h
+git add apache2/libinjection/libinjection_charclass.h
+git add apache2/libinjection/libinjection_shape_stats.h
 
 # this file seems to get modified, reset just to be safe
 git checkout standalone/Makefile.in
@@ -22,6 +22,15 @@ import tornado.wsgi
 import tornado.escape
 import tornado.options
 
+# the contexts of libinjection.is_sqli_report, in order
+REPORT_CONTEXTS = [
+    ('unquoted', 'ansi'),
+    ('unquoted', 'mysql'),
+    ('single', 'ansi'),
+    ('single', 'mysql'),
+    ('double', 'mysql'),
+]
+
 def breakapart(s):
     """ attempts to add spaces in a SQLi so it renders nicely on the webpage
     """
@@ -233,6 +242,7 @@ class NullHandler(tornado.web.RequestHandler):
         qssqli = False
 
         sqlstate = libinjection.sqli_state()
+        report = libinjection.sqli_report()
 
         allfp = {}
         for name,values in self.request.arguments.iteritems():
@@ -246,25 +256,10 @@ class NullHandler(tornado.web.RequestHandler):
             if len(val) == 0:
                 continue
             libinjection.sqli_init(sqlstate, val, 0)
-            pat = libinjection.sqli_fingerprint(sqlstate, libinjection.FLAG_QUOTE_NONE | libinjection.FLAG_SQL_ANSI)
-            issqli = bool(libinjection.sqli_blacklist(sqlstate) and libinjection.sqli_not_whitelist(sqlstate))
-            fps.append(['unquoted', 'ansi', issqli, pat])
-
-            pat = libinjection.sqli_fingerprint(sqlstate, libinjection.FLAG_QUOTE_NONE | libinjection.FLAG_SQL_MYSQL)
-            issqli = bool(libinjection.sqli_blacklist(sqlstate) and libinjection.sqli_not_whitelist(sqlstate))
-            fps.append(['unquoted', 'mysql', issqli, pat])
-
-            pat = libinjection.sqli_fingerprint(sqlstate, libinjection.FLAG_QUOTE_SINGLE | libinjection.FLAG_SQL_ANSI)
-            issqli = bool(libinjection.sqli_blacklist(sqlstate) and libinjection.sqli_not_whitelist(sqlstate))
-            fps.append(['single', 'ansi', issqli, pat])
-
-            pat = libinjection.sqli_fingerprint(sqlstate, libinjection.FLAG_QUOTE_SINGLE | libinjection.FLAG_SQL_MYSQL)
-            issqli = bool(libinjection.sqli_blacklist(sqlstate) and libinjection.sqli_not_whitelist(sqlstate))
-            fps.append(['single', 'mysql', issqli, pat])
-
-            pat = libinjection.sqli_fingerprint(sqlstate, libinjection.FLAG_QUOTE_DOUBLE | libinjection.FLAG_SQL_MYSQL)
-            issqli = bool(libinjection.sqli_blacklist(sqlstate) and libinjection.sqli_not_whitelist(sqlstate))
-            fps.append(['double', 'mysql', issqli, pat])
+            libinjection.is_sqli_report(sqlstate, report)
+            for i, (quote, dialect) in enumerate(REPORT_CONTEXTS):
+                context = libinjection.sqli_get_context(report, i)
+                fps.append([quote, dialect, bool(context.issqli), context.fingerprint])
 
             allfp[name] = {
                 'value': breakify(breakapart(val)),
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+#
+#  Copyright 2026 LibInjection Project
+#  BSD License -- see COPYING.txt for details
+#
+
+"""
+Converts html5_states.txt to a C header (.h) file for the table driven
+core of libinjection_html5.c
+"""
+
+import sys
+
+from sqlparse2c import print_byte_classes
+
+# h5_action_t in libinjection_html5.c
+ACTIONS = ('error', 'stop', 'stop_in', 'go', 'go_close', 'go_open', 'text',
+           'text_rest', 'emit', 'emit_before', 'emit_rest', 'emit_all',
+           'emit_tag_name', 'emit_gt', 'emit_close_gt', 'emit_self_close',
+           'emit_lt')
+
+# enum html5_type in libinjection_html5.h
+TOKENS = ('DATA_TEXT', 'TAG_NAME_OPEN', 'TAG_NAME_CLOSE',
+          'TAG_NAME_SELFCLOSE', 'TAG_DATA', 'TAG_CLOSE', 'ATTR_NAME',
+          'ATTR_VALUE', 'TAG_COMMENT', 'DOCTYPE')
+
+
+def fail(lineno, msg):
+    """ reports an error in html5_states.txt and exits """
+    sys.stderr.write("ERROR: html5_states.txt:%d: %s\n" % (lineno, msg))
+    sys.exit(1)
+
+
+def parse_byte(lineno, text):
+    """ a character or 0xNN """
+    if len(text) == 1:
+        return ord(text)
+    if text.startswith('0x'):
+        return int(text, 16)
+    return fail(lineno, "bad byte %s" % (text,))
+
+
+def parse_bytes(lineno, text):
+    """ a byte or a FIRST-LAST range of them """
+    if len(text) > 1 and '-' in text:
+        first, last = text.split('-', 1)
+        return range(parse_byte(lineno, first), parse_byte(lineno, last) + 1)
+    return [parse_byte(lineno, text)]
+
+
+def read_states(lines):
+    """
+    html5_states.txt to a list of class names, a byte -> class map, a
+    list of (scan, [class names]) and a list of
+    (state, {class: (action, skip, next, token)}), see that file for
+    the syntax
+    """
+    classes = []
+    byte_classes = {}
+    scans = []
+    states = []
+    for lineno, line in enumerate(lines, 1):
+        line = line.split('#', 1)[0].split()
+        if not line:
+            continue
+        if line[0] == 'class' and len(line) > 2:
+            if line[1] in classes or line[1] in ('OTHER', 'EOF'):
+                fail(lineno, "class %s listed twice" % (line[1],))
+            for text in line[2:]:
+                for byte in parse_bytes(lineno, text):
+                    if byte in byte_classes:
+                        fail(lineno, "byte 0x%02X in two classes" % (byte,))
+                    byte_classes[byte] = len(classes)
+            classes.append(line[1])
+        elif line[0] == 'scan' and len(line) > 2:
+            for name in line[2:]:
+                if name not in classes:
+                    fail(lineno, "no class %s" % (name,))
+            scans.append((line[1], line[2:]))
+        elif line[0] == 'state' and len(line) == 2:
+            states.append((line[1], {}, lineno))
+        elif states and 2 <= len(line) <= 4:
+            action, skip = (line[1].split('+', 1) + ['0'])[:2]
+            if action not in ACTIONS or not skip.isdigit():
+                fail(lineno, "bad action %s" % (line[1],))
+            moves = states[-1][1]
+            for name in line[0].split(','):
+                if name in moves:
+                    fail(lineno, "class %s listed twice" % (name,))
+                moves[name] = (action, int(skip), line[2:3], line[3:4],
+                               lineno)
+        else:
+            fail(lineno, "bad line")
+    classes += ['OTHER', 'EOF']
+    return classes, byte_classes, scans, states
+
+
+def check_states(classes, states):
+    """ every transition is to a state and emits a known token """
+    names = [name for name, _, _ in states]
+    for name, moves, lineno in states:
+        if names.count(name) > 1:
+            fail(lineno, "state %s listed twice" % (name,))
+        for cname, (action, _, nxt, token, mline) in moves.items():
+            if cname != '*' and cname not in classes:
+                fail(mline, "no class %s" % (cname,))
+            if nxt and nxt[0] not in names:
+                fail(mline, "no state %s" % (nxt[0],))
+            if token and token[0] not in TOKENS:
+                fail(mline, "no token type %s" % (token[0],))
+            if not nxt and action not in ('error', 'stop'):
+                fail(mline, "%s needs a state" % (action,))
+            if not token and (action.startswith('emit') or
+                              action.startswith('text')):
+                fail(mline, "%s needs a token type" % (action,))
+
+
+def print_enum(name, prefix, values):
+    """ an enum of values """
+    print("enum %s {" % (name,))
+    for n, v in enumerate(values):
+        print("    %s%s%s" % (prefix, v, "," if n < len(values) - 1 else ""))
+    print("};")
+
+
+def print_transitions(classes, states):
+    """ h5_transitions[state][class] """
+    print("static const h5_transition_t h5_transitions[][H5_CLASSES] = {")
+    for name, moves, _ in states:
+        print("    /* %s */" % (name,))
+        for i, cname in enumerate(classes):
+            action, skip, nxt, token, _ = moves.get(
+                cname, moves.get('*', ('stop', 0, [], [], 0)))
+            entry = "{H5_%s, %d, %s, %s}" % (
+                action.upper(), skip,
+                "H5_STATE_" + nxt[0] if nxt else "0",
+                token[0] if token else "0")
+            head = "    {" if i == 0 else "     "
+            tail = "}," if i == len(classes) - 1 else ","
+            print(head + entry + tail)
+    print("};")
+
+
+def main():
+    """ main routine """
+    classes, byte_classes, scans, states = read_states(sys.stdin)
+    check_states(classes, states)
+
+    print("""/**
+ * Generated by html52c.py from html5_states.txt, do not edit
+ */
+#ifndef LIBINJECTION_HTML5_DATA_H
+#define LIBINJECTION_HTML5_DATA_H
+
+#include "libinjection_charclass.h"
+""")
+    # the bytes of each scan's classes, as char_class_t h5_NAME
+    print_byte_classes("h5_", [
+        (name, set(b for b, c in byte_classes.items()
+                   if classes[c] in names))
+        for name, names in scans])
+    print()
+    # h5_state_t.state, in both cores
+    print_enum("h5_state_id", "H5_STATE_", [name for name, _, _ in states])
+    print()
+    print("#define H5_STATES %d" % (len(states),))
+    print()
+    print("#ifdef LIBINJECTION_HTML5_STATE_TABLE")
+    print_enum("h5_class", "H5_CLASS_", classes)
+    print()
+    print("#define H5_CLASSES %d" % (len(classes),))
+    print("""
+typedef struct {
+    unsigned char action; /* h5_action_t */
+    unsigned char skip;   /* bytes the go actions step over */
+    unsigned char next;   /* enum h5_state_id */
+    unsigned char token;  /* enum html5_type */
+} h5_transition_t;
+""")
+    other = classes.index('OTHER')
+    # the class of each byte
+    print("static const unsigned char h5_byte_classes[256] = {")
+    for row in range(0, 256, 16):
+        print("    " + " ".join("%d," % (byte_classes.get(b, other),)
+                                for b in range(row, row + 16)))
+    print("};")
+    print()
+    print_transitions(classes, states)
+    print("#endif")
+    print()
+    print("#endif")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
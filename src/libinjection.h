@@ -54,6 +54,45 @@ const char *libinjection_version(void);
 injection_result_t libinjection_sqli(const char *s, size_t slen,
                                      char fingerprint[]);
 
+/*
+ * Bytes per fingerprint in libinjection_sqli_batch's fingerprints
+ */
+#define LIBINJECTION_SQLI_FINGERPRINT_SIZE 8
+
+/**
+ * libinjection_sqli on n inputs, with the results in arrays.  Cheaper
+ * than calling libinjection_sqli n times: one state is reused for all
+ * of them, and the next input is fetched while one is checked.
+ *
+ * \param[in] ptrs  the inputs, as for libinjection_sqli
+ * \param[in] lens  their lengths
+ * \param[in] n  number of inputs
+ * \param[out] results  n verdicts, 1 if SQLi, 0 if benign
+ * \param[out] fingerprints  NULL, or n * LIBINJECTION_SQLI_FINGERPRINT_SIZE
+ * chars: the fingerprint of input i is the c-string at
+ * fingerprints + i * LIBINJECTION_SQLI_FINGERPRINT_SIZE, empty if benign.
+ * \return number of inputs that are SQLi
+ */
+size_t libinjection_sqli_batch(const char **ptrs, const size_t *lens,
+                               size_t n, injection_result_t *results,
+                               char *fingerprints);
+
+/*
+ * How often the shape check at the front of libinjection_is_sqli and
+ * libinjection_xss answered FALSE without tokenizing: benign of calls.
+ * Only counted in a build with LIBINJECTION_SHAPE_STATS defined
+ * (./configure --enable-shape-stats), which needs GCC or clang: all
+ * threads share the counters and add to them with atomic increments,
+ * a cost on every call.  Otherwise they read as zero.
+ */
+struct libinjection_shape_stats {
+    unsigned long calls;
+    unsigned long benign;
+};
+
+void libinjection_sqli_shape_stats(struct libinjection_shape_stats *stats);
+void libinjection_xss_shape_stats(struct libinjection_shape_stats *stats);
+
 /** ALPHA version of xss detector.
  *
  * NOT DONE.
@@ -0,0 +1,275 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * https://github.com/libinjection/libinjection
+ *
+ * Byte class scanning shared by the tokenizers.  Internal to the library.
+ *
+ * A class is a set of bytes, given twice:
+ *   - as a bit in a 256 entry lookup table, used one byte at a time
+ *   - as a short list of byte ranges, used to test 16 or 32 bytes at
+ *     a time with SSE2, AVX2 or NEON compares
+ *
+ * Both must describe the same set.  The SIMD kernels are picked at
+ * compile time (-msse2 is the x86-64 default, -mavx2 or -march=native
+ * for AVX2, aarch64 always has NEON).  Without any of them, or on
+ * compilers without __builtin_ctz, only the table is used.
+ */
+
+#ifndef LIBINJECTION_CHARCLASS_H
+#define LIBINJECTION_CHARCLASS_H
+
+#include <stddef.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LIBINJECTION_CHARCLASS_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define LIBINJECTION_CHARCLASS_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LIBINJECTION_CHARCLASS_NEON
+#endif
+#endif
+
+/* not every tokenizer uses every helper below */
+#if defined(__GNUC__) || defined(__clang__)
+#define CHAR_CLASS_UNUSED __attribute__((unused))
+#else
+#define CHAR_CLASS_UNUSED
+#endif
+
+/* more ranges than this are not worth vectorizing */
+#define CHAR_CLASS_MAX_RANGES 12
+
+typedef struct {
+    unsigned char lo;
+    unsigned char hi;
+} char_range_t;
+
+typedef struct {
+    const unsigned char *map; /* 256 entries */
+    unsigned char bit;
+    const char_range_t *ranges;
+    size_t nranges;
+} char_class_t;
+
+CHAR_CLASS_UNUSED
+static int char_class_has(const char_class_t *cc, char ch) {
+    return (cc->map[(unsigned char)ch] & cc->bit) != 0;
+}
+
+/*
+ * Offset of the first byte that is (in_class != 0) or is not
+ * (in_class == 0) a member of cc, or len if there is none.
+ */
+CHAR_CLASS_UNUSED
+static size_t char_class_find(const char *s, size_t len,
+                              const char_class_t *cc, int in_class) {
+    size_t i = 0;
+    unsigned int bits;
+    size_t k;
+
+#if defined(LIBINJECTION_CHARCLASS_AVX2)
+    __m256i lo[CHAR_CLASS_MAX_RANGES];
+    __m256i span[CHAR_CLASS_MAX_RANGES];
+    __m256i x;
+    __m256i t;
+    __m256i m;
+
+    if (len >= 32 && cc->nranges <= CHAR_CLASS_MAX_RANGES) {
+        for (k = 0; k < cc->nranges; ++k) {
+            lo[k] = _mm256_set1_epi8((char)cc->ranges[k].lo);
+            span[k] = _mm256_set1_epi8(
+                (char)(cc->ranges[k].hi - cc->ranges[k].lo));
+        }
+        for (; i + 32 <= len; i += 32) {
+            x = _mm256_loadu_si256((const __m256i *)(const void *)(s + i));
+            m = _mm256_setzero_si256();
+            for (k = 0; k < cc->nranges; ++k) {
+                /* lo <= x <= hi  is  (x - lo) <= (hi - lo) unsigned */
+                t = _mm256_sub_epi8(x, lo[k]);
+                m = _mm256_or_si256(
+                    m, _mm256_cmpeq_epi8(_mm256_min_epu8(t, span[k]), t));
+            }
+            bits = (unsigned int)_mm256_movemask_epi8(m);
+            if (!in_class) {
+                bits = ~bits;
+            }
+            if (bits != 0) {
+                return i + (size_t)__builtin_ctz(bits);
+            }
+        }
+    }
+#elif defined(LIBINJECTION_CHARCLASS_SSE2)
+    __m128i lo[CHAR_CLASS_MAX_RANGES];
+    __m128i span[CHAR_CLASS_MAX_RANGES];
+    __m128i x;
+    __m128i t;
+    __m128i m;
+
+    if (len >= 16 && cc->nranges <= CHAR_CLASS_MAX_RANGES) {
+        for (k = 0; k < cc->nranges; ++k) {
+            lo[k] = _mm_set1_epi8((char)cc->ranges[k].lo);
+            span[k] =
+                _mm_set1_epi8((char)(cc->ranges[k].hi - cc->ranges[k].lo));
+        }
+        for (; i + 16 <= len; i += 16) {
+            x = _mm_loadu_si128((const __m128i *)(const void *)(s + i));
+            m = _mm_setzero_si128();
+            for (k = 0; k < cc->nranges; ++k) {
+                /* lo <= x <= hi  is  (x - lo) <= (hi - lo) unsigned */
+                t = _mm_sub_epi8(x, lo[k]);
+                m = _mm_or_si128(
+                    m, _mm_cmpeq_epi8(_mm_min_epu8(t, span[k]), t));
+            }
+            bits = (unsigned int)_mm_movemask_epi8(m);
+            if (!in_class) {
+                bits = ~bits & 0xFFFFU;
+            }
+            if (bits != 0) {
+                return i + (size_t)__builtin_ctz(bits);
+            }
+        }
+    }
+#elif defined(LIBINJECTION_CHARCLASS_NEON)
+    uint8x16_t lo[CHAR_CLASS_MAX_RANGES];
+    uint8x16_t span[CHAR_CLASS_MAX_RANGES];
+    uint8x16_t x;
+    uint8x16_t m;
+    unsigned long long nibbles;
+
+    (void)bits;
+    if (len >= 16 && cc->nranges <= CHAR_CLASS_MAX_RANGES) {
+        for (k = 0; k < cc->nranges; ++k) {
+            lo[k] = vdupq_n_u8(cc->ranges[k].lo);
+            span[k] = vdupq_n_u8((unsigned char)(cc->ranges[k].hi -
+                                                 cc->ranges[k].lo));
+        }
+        for (; i + 16 <= len; i += 16) {
+            x = vld1q_u8((const unsigned char *)s + i);
+            m = vdupq_n_u8(0);
+            for (k = 0; k < cc->nranges; ++k) {
+                m = vorrq_u8(m, vcleq_u8(vsubq_u8(x, lo[k]), span[k]));
+            }
+            if (!in_class) {
+                m = vmvnq_u8(m);
+            }
+            /* no movemask on NEON: narrow to 4 bits per byte */
+            nibbles = vget_lane_u64(
+                vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)),
+                0);
+            if (nibbles != 0) {
+                return i + (size_t)(__builtin_ctzll(nibbles) >> 2);
+            }
+        }
+    }
+#else
+    (void)bits;
+    (void)k;
+#endif
+
+    for (; i < len; ++i) {
+        if (char_class_has(cc, s[i]) == (in_class != 0)) {
+            return i;
+        }
+    }
+    return len;
+}
+
+/*
+ * Length of the prefix made only of bytes in cc
+ */
+CHAR_CLASS_UNUSED
+static size_t char_class_span(const char *s, size_t len,
+                              const char_class_t *cc) {
+    return char_class_find(s, len, cc, 0);
+}
+
+/*
+ * Length of the prefix made only of bytes not in cc
+ */
+CHAR_CLASS_UNUSED
+static size_t char_class_cspan(const char *s, size_t len,
+                               const char_class_t *cc) {
+    return char_class_find(s, len, cc, 1);
+}
+
+/*
+ * Offset of the first byte equal to a or b, or len if there is none.
+ * For sets only known at run time, such as the closing quote.
+ */
+CHAR_CLASS_UNUSED
+static size_t char_find2(const char *s, size_t len, char a, char b) {
+    size_t i = 0;
+
+#if defined(LIBINJECTION_CHARCLASS_AVX2)
+    __m256i va;
+    __m256i vb;
+    __m256i x;
+    unsigned int bits;
+
+    if (len >= 32) {
+        va = _mm256_set1_epi8(a);
+        vb = _mm256_set1_epi8(b);
+        for (; i + 32 <= len; i += 32) {
+            x = _mm256_loadu_si256((const __m256i *)(const void *)(s + i));
+            bits = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(
+                _mm256_cmpeq_epi8(x, va), _mm256_cmpeq_epi8(x, vb)));
+            if (bits != 0) {
+                return i + (size_t)__builtin_ctz(bits);
+            }
+        }
+    }
+#elif defined(LIBINJECTION_CHARCLASS_SSE2)
+    __m128i va;
+    __m128i vb;
+    __m128i x;
+    unsigned int bits;
+
+    if (len >= 16) {
+        va = _mm_set1_epi8(a);
+        vb = _mm_set1_epi8(b);
+        for (; i + 16 <= len; i += 16) {
+            x = _mm_loadu_si128((const __m128i *)(const void *)(s + i));
+            bits = (unsigned int)_mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb)));
+            if (bits != 0) {
+                return i + (size_t)__builtin_ctz(bits);
+            }
+        }
+    }
+#elif defined(LIBINJECTION_CHARCLASS_NEON)
+    uint8x16_t va;
+    uint8x16_t vb;
+    uint8x16_t x;
+    unsigned long long nibbles;
+
+    if (len >= 16) {
+        va = vdupq_n_u8((unsigned char)a);
+        vb = vdupq_n_u8((unsigned char)b);
+        for (; i + 16 <= len; i += 16) {
+            x = vld1q_u8((const unsigned char *)s + i);
+            x = vorrq_u8(vceqq_u8(x, va), vceqq_u8(x, vb));
+            nibbles = vget_lane_u64(
+                vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(x), 4)),
+                0);
+            if (nibbles != 0) {
+                return i + (size_t)(__builtin_ctzll(nibbles) >> 2);
+            }
+        }
+    }
+#endif
+
+    for (; i < len; ++i) {
+        if (s[i] == a || s[i] == b) {
+            return i;
+        }
+    }
+    return len;
+}
+
+#endif /* LIBINJECTION_CHARCLASS_H */
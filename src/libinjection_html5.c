@@ -1,4 +1,5 @@
 #include "libinjection_html5.h"
+#include "libinjection_charclass.h"
 
 #include <string.h>
 
@@ -24,6 +25,7 @@
 #define CHAR_RIGHTB 93
 #define CHAR_TICK 96
 
+#ifndef LIBINJECTION_HTML5_STATE_TABLE
 /* prototypes */
 
 static int h5_skip_white(h5_state_t *hs);
@@ -56,6 +58,37 @@ static int h5_state_markup_declaration_open(h5_state_t *hs);
 
 /* 8.2.4.52 */
 static int h5_state_doctype(h5_state_t *hs);
+#endif
+
+#ifdef LIBINJECTION_HTML5_STATE_TABLE
+/* what a transition does */
+typedef enum {
+    H5_ERROR,           /* not initialized */
+    H5_STOP,            /* no more tokens */
+    H5_STOP_IN,         /* no more tokens, and stay in the next state */
+    H5_GO,              /* skip bytes and go to the next state */
+    H5_GO_CLOSE,        /* H5_GO into a close tag */
+    H5_GO_OPEN,         /* H5_GO out of a close tag */
+    H5_TEXT,            /* text up to the byte, skipping it, if any */
+    H5_TEXT_REST,       /* text up to the end, if any */
+    H5_EMIT,            /* token up to the byte, skipping it */
+    H5_EMIT_BEFORE,     /* token up to the byte, read again next */
+    H5_EMIT_REST,       /* token up to the end */
+    H5_EMIT_ALL,        /* token up to the end, skipping to it */
+    H5_EMIT_TAG_NAME,   /* tag name before '>', or TAG_CLOSE */
+    H5_EMIT_GT,         /* the '>' */
+    H5_EMIT_CLOSE_GT,   /* the '>', which ends a close tag */
+    H5_EMIT_SELF_CLOSE, /* the "/>" */
+    H5_EMIT_LT          /* the '<' before a byte no tag starts with */
+} h5_action_t;
+#endif
+
+/*
+ * The byte classes the states scan for with char_class_find(), see
+ * libinjection_charclass.h, and the table driven core's classes and
+ * transitions, generated by html52c.py from html5_states.txt
+ */
+#include "libinjection_html5_data.h"
 
 /**
  * public function
@@ -68,31 +101,60 @@ void libinjection_h5_init(h5_state_t *hs, const char *s, size_t len,
 
     switch (flags) {
     case DATA_STATE:
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         break;
     case VALUE_NO_QUOTE:
-        hs->state = h5_state_before_attribute_name;
+        hs->state = H5_STATE_BEFORE_ATTR_NAME;
         break;
     case VALUE_SINGLE_QUOTE:
-        hs->state = h5_state_attribute_value_single_quote;
+        hs->state = H5_STATE_VALUE_SINGLE;
         break;
     case VALUE_DOUBLE_QUOTE:
-        hs->state = h5_state_attribute_value_double_quote;
+        hs->state = H5_STATE_VALUE_DOUBLE;
         break;
     case VALUE_BACK_QUOTE:
-        hs->state = h5_state_attribute_value_back_quote;
+        hs->state = H5_STATE_VALUE_BACK;
         break;
     }
 }
 
+#ifndef LIBINJECTION_HTML5_STATE_TABLE
+
+/* the function for each enum h5_state_id */
+static const ptr_html5_state h5_states[H5_STATES] = {
+    NULL,
+    h5_state_data,
+    h5_state_tag_open,
+    h5_state_end_tag_open,
+    h5_state_tag_name,
+    h5_state_tag_name_close,
+    h5_state_before_attribute_name,
+    h5_state_attribute_name,
+    h5_state_after_attribute_name,
+    h5_state_before_attribute_value,
+    h5_state_attribute_value_double_quote,
+    h5_state_attribute_value_single_quote,
+    h5_state_attribute_value_back_quote,
+    h5_state_attribute_value_no_quote,
+    h5_state_after_attribute_value_quoted_state,
+    h5_state_self_closing_start_tag,
+    h5_state_bogus_comment,
+    h5_state_bogus_comment2,
+    h5_state_markup_declaration_open,
+    h5_state_comment,
+    h5_state_cdata,
+    h5_state_doctype,
+    h5_state_eof};
+
 /**
  * public function
  */
 injection_result_t libinjection_h5_next(h5_state_t *hs) {
-    if (hs == NULL || hs->state == NULL) {
+    if (hs == NULL || hs->state <= H5_STATE_NONE ||
+        hs->state >= H5_STATES) {
         return LIBINJECTION_RESULT_ERROR;
     }
-    return (*hs->state)(hs);
+    return (*h5_states[hs->state])(hs);
 }
 
 /**
@@ -107,27 +169,19 @@ static int h5_is_white(char ch) {
      * \v = vertical tab = 0x0B
      * \f = form feed = 0x0C
      * \r = cr  = 0x0D
+     * and NUL, as strchr(" \t\n\v\f\r", ch) used to find it too
      */
-    return strchr(" \t\n\v\f\r", ch) != NULL;
+    return char_class_has(&h5_white, ch);
 }
 
 static int h5_skip_white(h5_state_t *hs) {
-    char ch;
-    while (hs->pos < hs->len) {
-        ch = hs->s[hs->pos];
-        switch (ch) {
-        case 0x00: /* IE only */
-        case 0x20:
-        case 0x09:
-        case 0x0A:
-        case 0x0B: /* IE only */
-        case 0x0C:
-        case 0x0D: /* IE only */
-            hs->pos += 1;
-            break;
-        default:
-            return ch;
-        }
+    /* 0x00, 0x0B and 0x0D are IE only */
+    if (hs->pos >= hs->len) {
+        return CHAR_EOF;
+    }
+    hs->pos += char_class_span(hs->s + hs->pos, hs->len - hs->pos, &h5_white);
+    if (hs->pos < hs->len) {
+        return hs->s[hs->pos];
     }
     return CHAR_EOF;
 }
@@ -150,7 +204,7 @@ static injection_result_t h5_state_data(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = hs->len - hs->pos;
         hs->token_type = DATA_TEXT;
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
         if (hs->token_len == 0) {
             return 0;
         }
@@ -159,7 +213,7 @@ static injection_result_t h5_state_data(h5_state_t *hs) {
         hs->token_type = DATA_TEXT;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->pos = (size_t)(idx - hs->s) + 1;
-        hs->state = h5_state_tag_open;
+        hs->state = H5_STATE_TAG_OPEN;
         if (hs->token_len == 0) {
             return h5_state_tag_open(hs);
         }
@@ -206,7 +260,7 @@ static int h5_state_tag_open(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos - 1;
         hs->token_len = 1;
         hs->token_type = DATA_TEXT;
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         return 1;
     }
 }
@@ -242,9 +296,9 @@ static int h5_state_tag_name_close(h5_state_t *hs) {
     hs->token_type = TAG_NAME_CLOSE;
     hs->pos += 1;
     if (hs->pos < hs->len) {
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
     } else {
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
     }
 
     return 1;
@@ -260,25 +314,29 @@ static int h5_state_tag_name(h5_state_t *hs) {
     TRACE();
     pos = hs->pos;
     while (pos < hs->len) {
+        /*
+         * special non-standard case: allow nulls in tag name, some old
+         * browsers apparently allow and ignore them.  So only white
+         * space other than NUL, '/' and '>' end it.
+         */
+        pos += char_class_cspan(hs->s + pos, hs->len - pos, &h5_tag_name_end);
+        if (pos == hs->len) {
+            break;
+        }
         ch = hs->s[pos];
-        if (ch == 0) {
-            /* special non-standard case */
-            /* allow nulls in tag name   */
-            /* some old browsers apparently allow and ignore them */
-            pos += 1;
-        } else if (h5_is_white(ch)) {
+        if (h5_is_white(ch)) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = TAG_NAME_OPEN;
             hs->pos = pos + 1;
-            hs->state = h5_state_before_attribute_name;
+            hs->state = H5_STATE_BEFORE_ATTR_NAME;
             return 1;
         } else if (ch == CHAR_SLASH) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = TAG_NAME_OPEN;
             hs->pos = pos + 1;
-            hs->state = h5_state_self_closing_start_tag;
+            hs->state = H5_STATE_SELF_CLOSING;
             return 1;
         } else if (ch == CHAR_GT) {
             hs->token_start = hs->s + hs->pos;
@@ -287,22 +345,20 @@ static int h5_state_tag_name(h5_state_t *hs) {
                 hs->pos = pos + 1;
                 hs->is_close = 0;
                 hs->token_type = TAG_CLOSE;
-                hs->state = h5_state_data;
+                hs->state = H5_STATE_DATA;
             } else {
                 hs->pos = pos;
                 hs->token_type = TAG_NAME_OPEN;
-                hs->state = h5_state_tag_name_close;
+                hs->state = H5_STATE_TAG_NAME_CLOSE;
             }
             return 1;
-        } else {
-            pos += 1;
         }
     }
 
     hs->token_start = hs->s + hs->pos;
     hs->token_len = hs->len - hs->pos;
     hs->token_type = TAG_NAME_OPEN;
-    hs->state = h5_state_eof;
+    hs->state = H5_STATE_EOF;
     return 1;
 }
 
@@ -339,7 +395,7 @@ tail_call:;
         return h5_state_self_closing_start_tag(hs);
     }
     case CHAR_GT: {
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         hs->token_start = hs->s + hs->pos;
         hs->token_len = 1;
         hs->token_type = TAG_NAME_CLOSE;
@@ -358,45 +414,46 @@ static int h5_state_attribute_name(h5_state_t *hs) {
 
     TRACE();
     pos = hs->pos + 1;
-    while (pos < hs->len) {
+    if (pos < hs->len) {
+        pos += char_class_cspan(hs->s + pos, hs->len - pos, &h5_attr_name_end);
+    }
+    if (pos < hs->len) {
         ch = hs->s[pos];
         if (h5_is_white(ch)) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = ATTR_NAME;
-            hs->state = h5_state_after_attribute_name;
+            hs->state = H5_STATE_AFTER_ATTR_NAME;
             hs->pos = pos + 1;
             return 1;
         } else if (ch == CHAR_SLASH) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = ATTR_NAME;
-            hs->state = h5_state_self_closing_start_tag;
+            hs->state = H5_STATE_SELF_CLOSING;
             hs->pos = pos + 1;
             return 1;
         } else if (ch == CHAR_EQUALS) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = ATTR_NAME;
-            hs->state = h5_state_before_attribute_value;
+            hs->state = H5_STATE_BEFORE_ATTR_VALUE;
             hs->pos = pos + 1;
             return 1;
         } else if (ch == CHAR_GT) {
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->token_type = ATTR_NAME;
-            hs->state = h5_state_tag_name_close;
+            hs->state = H5_STATE_TAG_NAME_CLOSE;
             hs->pos = pos;
             return 1;
-        } else {
-            pos += 1;
         }
     }
     /* EOF */
     hs->token_start = hs->s + hs->pos;
     hs->token_len = hs->len - hs->pos;
     hs->token_type = ATTR_NAME;
-    hs->state = h5_state_eof;
+    hs->state = H5_STATE_EOF;
     hs->pos = hs->len;
     return 1;
 }
@@ -440,7 +497,7 @@ static int h5_state_before_attribute_value(h5_state_t *hs) {
     c = h5_skip_white(hs);
 
     if (c == CHAR_EOF) {
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
         return 0;
     }
 
@@ -475,12 +532,12 @@ static int h5_state_attribute_value_quote(h5_state_t *hs, char qchar) {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = hs->len - hs->pos;
         hs->token_type = ATTR_VALUE;
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
     } else {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->token_type = ATTR_VALUE;
-        hs->state = h5_state_after_attribute_value_quoted_state;
+        hs->state = H5_STATE_AFTER_VALUE;
         hs->pos += hs->token_len + 1;
     }
     return 1;
@@ -507,28 +564,30 @@ static int h5_state_attribute_value_no_quote(h5_state_t *hs) {
 
     TRACE();
     pos = hs->pos;
-    while (pos < hs->len) {
+    if (pos < hs->len) {
+        pos += char_class_cspan(hs->s + pos, hs->len - pos, &h5_value_end);
+    }
+    if (pos < hs->len) {
         ch = hs->s[pos];
         if (h5_is_white(ch)) {
             hs->token_type = ATTR_VALUE;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->pos = pos + 1;
-            hs->state = h5_state_before_attribute_name;
+            hs->state = H5_STATE_BEFORE_ATTR_NAME;
             return 1;
         } else if (ch == CHAR_GT) {
             hs->token_type = ATTR_VALUE;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = pos - hs->pos;
             hs->pos = pos;
-            hs->state = h5_state_tag_name_close;
+            hs->state = H5_STATE_TAG_NAME_CLOSE;
             return 1;
         }
-        pos += 1;
     }
     TRACE();
     /* EOF */
-    hs->state = h5_state_eof;
+    hs->state = H5_STATE_EOF;
     hs->token_start = hs->s + hs->pos;
     hs->token_len = hs->len - hs->pos;
     hs->token_type = ATTR_VALUE;
@@ -557,7 +616,7 @@ static int h5_state_after_attribute_value_quoted_state(h5_state_t *hs) {
         hs->token_len = 1;
         hs->token_type = TAG_NAME_CLOSE;
         hs->pos += 1;
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         return 1;
     } else {
         return h5_state_before_attribute_name(hs);
@@ -582,7 +641,7 @@ static int h5_state_self_closing_start_tag(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos - 1;
         hs->token_len = 2;
         hs->token_type = TAG_NAME_SELFCLOSE;
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         hs->pos += 1;
         return 1;
     } else {
@@ -602,12 +661,12 @@ static int h5_state_bogus_comment(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = hs->len - hs->pos;
         hs->pos = hs->len;
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
     } else {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->pos = (size_t)(idx - hs->s) + 1;
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
     }
 
     hs->token_type = TAG_COMMENT;
@@ -630,7 +689,7 @@ static int h5_state_bogus_comment2(h5_state_t *hs) {
             hs->token_len = hs->len - hs->pos;
             hs->pos = hs->len;
             hs->token_type = TAG_COMMENT;
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             return 1;
         }
 
@@ -643,7 +702,7 @@ static int h5_state_bogus_comment2(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->pos = (size_t)(idx - hs->s) + 2;
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         hs->token_type = TAG_COMMENT;
         return 1;
     }
@@ -710,7 +769,7 @@ static int h5_state_comment(h5_state_t *hs) {
 
         /* did not find anything or has less than 3 chars left */
         if (idx == NULL || idx > hs->s + hs->len - 3) {
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = hs->len - hs->pos;
             hs->token_type = TAG_COMMENT;
@@ -723,7 +782,7 @@ static int h5_state_comment(h5_state_t *hs) {
             offset += 1;
         }
         if (idx + offset == end) {
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = hs->len - hs->pos;
             hs->token_type = TAG_COMMENT;
@@ -743,7 +802,7 @@ static int h5_state_comment(h5_state_t *hs) {
             offset += 1;
         }
         if (idx + offset == end) {
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = hs->len - hs->pos;
             hs->token_type = TAG_COMMENT;
@@ -753,7 +812,7 @@ static int h5_state_comment(h5_state_t *hs) {
 
         offset += 1;
         if (idx + offset == end) {
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = hs->len - hs->pos;
             hs->token_type = TAG_COMMENT;
@@ -771,7 +830,7 @@ static int h5_state_comment(h5_state_t *hs) {
         hs->token_start = hs->s + hs->pos;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->pos = (size_t)(idx + offset - hs->s);
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         hs->token_type = TAG_COMMENT;
         return 1;
     }
@@ -788,13 +847,13 @@ static int h5_state_cdata(h5_state_t *hs) {
 
         /* did not find anything or has less than 3 chars left */
         if (idx == NULL || idx > hs->s + hs->len - 3) {
-            hs->state = h5_state_eof;
+            hs->state = H5_STATE_EOF;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = hs->len - hs->pos;
             hs->token_type = DATA_TEXT;
             return 1;
         } else if (*(idx + 1) == CHAR_RIGHTB && *(idx + 2) == CHAR_GT) {
-            hs->state = h5_state_data;
+            hs->state = H5_STATE_DATA;
             hs->token_start = hs->s + hs->pos;
             hs->token_len = (size_t)(idx - hs->s) - hs->pos;
             hs->pos = (size_t)(idx - hs->s) + 3;
@@ -819,12 +878,351 @@ static int h5_state_doctype(h5_state_t *hs) {
 
     idx = (const char *)memchr(hs->s + hs->pos, CHAR_GT, hs->len - hs->pos);
     if (idx == NULL) {
-        hs->state = h5_state_eof;
+        hs->state = H5_STATE_EOF;
         hs->token_len = hs->len - hs->pos;
     } else {
-        hs->state = h5_state_data;
+        hs->state = H5_STATE_DATA;
         hs->token_len = (size_t)(idx - hs->s) - hs->pos;
         hs->pos = (size_t)(idx - hs->s) + 1;
     }
     return 1;
 }
+
+#else
+
+/*
+ * The table driven core.  The states are the rows of h5_transitions,
+ * generated by html52c.py from html5_states.txt, and
+ * libinjection_h5_next runs them in one loop instead of a function per
+ * state that calls the next.  Each turn the state scans to the byte it
+ * decides on, the class of that byte picks the transition, and the
+ * transition's action moves on, emits a token or stops.
+ *
+ * hs->state and hs->pos are left as the functions above leave them,
+ * so the two cores are interchangeable; test-html5-tokens.sh checks
+ * they give the same tokens.
+ */
+
+static void h5_emit(h5_state_t *hs, size_t start, size_t len, int type) {
+    hs->token_start = hs->s + start;
+    hs->token_len = len;
+    hs->token_type = (enum html5_type)type;
+}
+
+/*
+ * Offset of the first ch from pos on, or len if there is none
+ */
+static size_t h5_find(const char *s, size_t len, size_t pos, int ch) {
+    const char *idx = (const char *)memchr(s + pos, ch, len - pos);
+
+    return idx != NULL ? (size_t)(idx - s) : len;
+}
+
+/*
+ * The quote a quoted attribute value state ends at
+ */
+static int h5_quote(int state) {
+    if (state == H5_STATE_VALUE_DOUBLE) {
+        return CHAR_DOUBLE;
+    } else if (state == H5_STATE_VALUE_SINGLE) {
+        return CHAR_SINGLE;
+    }
+    return CHAR_TICK;
+}
+
+/*
+ * TRUE if "DOCTYPE" (any case), "[CDATA[" or "--" starts s
+ */
+static int h5_is_declaration(const char *s, size_t len) {
+    if (len >= 7 && (s[0] == 'D' || s[0] == 'd') &&
+        (s[1] == 'O' || s[1] == 'o') && (s[2] == 'C' || s[2] == 'c') &&
+        (s[3] == 'T' || s[3] == 't') && (s[4] == 'Y' || s[4] == 'y') &&
+        (s[5] == 'P' || s[5] == 'p') && (s[6] == 'E' || s[6] == 'e')) {
+        return 1;
+    }
+    if (len >= 7 && memcmp(s, "[CDATA[", 7) == 0) {
+        return 1;
+    }
+    return len >= 2 && s[0] == CHAR_DASH && s[1] == CHAR_DASH;
+}
+
+/*
+ * The scans below return the offset of the last byte of the closing
+ * sequence and set *end to where the token before it ends, or return
+ * len and set *end to len if there is none.
+ */
+
+/* "%>" */
+static size_t h5_bogus_comment2_end(const char *s, size_t len, size_t pos,
+                                    size_t *end) {
+    const char *idx;
+
+    *end = len;
+    while (1) {
+        idx = (const char *)memchr(s + pos, CHAR_PERCENT, len - pos);
+        if (idx == NULL || (size_t)(idx - s) + 1 >= len) {
+            return len;
+        }
+        pos = (size_t)(idx - s) + 1;
+        if (s[pos] == CHAR_GT) {
+            *end = pos - 1;
+            return pos;
+        }
+    }
+}
+
+/* "-->" or "-!>", with any NULs after the first '-' */
+static size_t h5_comment_end(const char *s, size_t len, size_t pos,
+                             size_t *end) {
+    const char *idx;
+    size_t i;
+
+    *end = len;
+    while (1) {
+        idx = (const char *)memchr(s + pos, CHAR_DASH, len - pos);
+        if (idx == NULL || (size_t)(idx - s) + 3 > len) {
+            return len;
+        }
+        pos = (size_t)(idx - s) + 1;
+        for (i = pos; i < len && s[i] == CHAR_NULL; ++i) {
+        }
+        if (i == len) {
+            return len;
+        }
+        if (s[i] != CHAR_DASH && s[i] != CHAR_BANG) {
+            continue;
+        }
+        if (i + 1 == len) {
+            return len;
+        }
+        if (s[i + 1] == CHAR_GT) {
+            *end = pos - 1;
+            return i + 1;
+        }
+    }
+}
+
+/* "]]>" */
+static size_t h5_cdata_end(const char *s, size_t len, size_t pos,
+                           size_t *end) {
+    const char *idx;
+
+    *end = len;
+    while (1) {
+        idx = (const char *)memchr(s + pos, CHAR_RIGHTB, len - pos);
+        if (idx == NULL || (size_t)(idx - s) + 3 > len) {
+            return len;
+        }
+        pos = (size_t)(idx - s) + 1;
+        if (s[pos] == CHAR_RIGHTB && s[pos + 1] == CHAR_GT) {
+            *end = pos - 1;
+            return pos + 1;
+        }
+    }
+}
+
+/**
+ * public function
+ */
+injection_result_t libinjection_h5_next(h5_state_t *hs) {
+    const h5_transition_t *move;
+    const char *s;
+    size_t len;
+    size_t pos;
+    size_t stop;
+    size_t end;
+    int state;
+    int cls;
+
+    if (hs == NULL || hs->state <= H5_STATE_NONE ||
+        hs->state >= H5_STATES) {
+        return LIBINJECTION_RESULT_ERROR;
+    }
+    s = hs->s;
+    len = hs->len;
+    pos = hs->pos;
+    state = hs->state;
+    while (1) {
+        TRACE();
+
+        /*
+         * scan to the byte the state decides on, stop, and to where
+         * its token would end, end
+         */
+        cls = -1;
+        switch (state) {
+        case H5_STATE_DATA:
+            if (len < pos) {
+                return LIBINJECTION_RESULT_ERROR;
+            }
+            stop = end = h5_find(s, len, pos, CHAR_LT);
+            break;
+        case H5_STATE_TAG_NAME:
+            stop = end =
+                pos + char_class_cspan(s + pos, len - pos, &h5_tag_name_end);
+            break;
+        case H5_STATE_TAG_NAME_CLOSE:
+            /* the '>' is at pos */
+            stop = end = pos + 1;
+            break;
+        case H5_STATE_BEFORE_ATTR_NAME:
+        case H5_STATE_AFTER_ATTR_NAME:
+        case H5_STATE_BEFORE_ATTR_VALUE:
+            /* 0x00, 0x0B and 0x0D are IE only */
+            if (pos < len) {
+                pos += char_class_span(s + pos, len - pos, &h5_white);
+            }
+            stop = end = pos;
+            /*
+             * h5_skip_white() returns the byte as a char, so where char
+             * is signed 0xFF is CHAR_EOF to the function core
+             */
+            if (pos < len && s[pos] == CHAR_EOF) {
+                cls = H5_CLASS_EOF;
+            }
+            break;
+        case H5_STATE_ATTR_NAME:
+            /* the first byte is part of the name, whatever it is */
+            stop = pos + 1;
+            if (stop < len) {
+                stop += char_class_cspan(s + stop, len - stop,
+                                         &h5_attr_name_end);
+            }
+            end = stop;
+            break;
+        case H5_STATE_VALUE_DOUBLE:
+        case H5_STATE_VALUE_SINGLE:
+        case H5_STATE_VALUE_BACK:
+            /* skip the opening quote, unless the input starts in the
+             * value */
+            if (pos > 0) {
+                pos += 1;
+            }
+            stop = end = h5_find(s, len, pos, h5_quote(state));
+            break;
+        case H5_STATE_VALUE_NO_QUOTE:
+            stop = end =
+                pos + char_class_cspan(s + pos, len - pos, &h5_value_end);
+            break;
+        case H5_STATE_BOGUS_COMMENT:
+        case H5_STATE_DOCTYPE:
+            stop = end = h5_find(s, len, pos, CHAR_GT);
+            break;
+        case H5_STATE_BOGUS_COMMENT2:
+            stop = h5_bogus_comment2_end(s, len, pos, &end);
+            break;
+        case H5_STATE_COMMENT:
+            stop = h5_comment_end(s, len, pos, &end);
+            break;
+        case H5_STATE_CDATA:
+            stop = h5_cdata_end(s, len, pos, &end);
+            break;
+        case H5_STATE_MARKUP_DECLARATION:
+            stop = end = pos;
+            if (!h5_is_declaration(s + pos, len - pos)) {
+                cls = H5_CLASS_OTHER;
+            }
+            break;
+        default:
+            /* the byte at pos */
+            stop = end = pos;
+            break;
+        }
+        if (cls < 0) {
+            cls = stop < len ? h5_byte_classes[(unsigned char)s[stop]]
+                             : H5_CLASS_EOF;
+        }
+
+        move = &h5_transitions[state][cls];
+        switch (move->action) {
+        case H5_STOP:
+            hs->pos = pos;
+            return LIBINJECTION_RESULT_FALSE;
+        case H5_STOP_IN:
+            hs->pos = pos;
+            hs->state = move->next;
+            return LIBINJECTION_RESULT_FALSE;
+        case H5_GO:
+            pos += move->skip;
+            state = move->next;
+            continue;
+        case H5_GO_CLOSE:
+            hs->is_close = 1;
+            pos += move->skip;
+            state = move->next;
+            continue;
+        case H5_GO_OPEN:
+            hs->is_close = 0;
+            pos += move->skip;
+            state = move->next;
+            continue;
+        case H5_TEXT:
+        case H5_TEXT_REST:
+            h5_emit(hs, pos, end - pos, move->token);
+            if (move->action == H5_TEXT) {
+                pos = stop + 1;
+            }
+            if (hs->token_len == 0) {
+                hs->state = move->next;
+                state = move->next;
+                continue;
+            }
+            break;
+        case H5_EMIT:
+            h5_emit(hs, pos, end - pos, move->token);
+            pos = stop + 1;
+            break;
+        case H5_EMIT_BEFORE:
+            h5_emit(hs, pos, end - pos, move->token);
+            pos = stop;
+            break;
+        case H5_EMIT_REST:
+            h5_emit(hs, pos, len - pos, move->token);
+            break;
+        case H5_EMIT_ALL:
+            h5_emit(hs, pos, len - pos, move->token);
+            pos = len;
+            break;
+        case H5_EMIT_TAG_NAME:
+            if (hs->is_close) {
+                h5_emit(hs, pos, end - pos, TAG_CLOSE);
+                hs->is_close = 0;
+                hs->pos = stop + 1;
+                hs->state = H5_STATE_DATA;
+                return LIBINJECTION_RESULT_TRUE;
+            }
+            h5_emit(hs, pos, end - pos, move->token);
+            pos = stop;
+            break;
+        case H5_EMIT_CLOSE_GT:
+            hs->is_close = 0;
+            h5_emit(hs, pos, 1, move->token);
+            pos += 1;
+            break;
+        case H5_EMIT_GT:
+            h5_emit(hs, pos, 1, move->token);
+            pos += 1;
+            break;
+        case H5_EMIT_SELF_CLOSE:
+            h5_emit(hs, pos - 1, 2, move->token);
+            pos += 1;
+            break;
+        case H5_EMIT_LT:
+            /* user input mistake in configuring state */
+            if (pos == 0) {
+                state = move->next;
+                continue;
+            }
+            h5_emit(hs, pos - 1, 1, move->token);
+            break;
+        case H5_ERROR:
+        default:
+            return LIBINJECTION_RESULT_ERROR;
+        }
+
+        hs->pos = pos;
+        hs->state = move->next;
+        return LIBINJECTION_RESULT_TRUE;
+    }
+}
+#endif
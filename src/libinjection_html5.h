@@ -40,7 +40,7 @@ typedef struct h5_state {
     size_t len;
     size_t pos;
     int is_close;
-    ptr_html5_state state;
+    int state; /* enum h5_state_id, see html5_states.txt */
     const char *token_start;
     size_t token_len;
     enum html5_type token_type;
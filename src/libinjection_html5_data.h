@@ -0,0 +1,554 @@
+/**
+ * Generated by html52c.py from html5_states.txt, do not edit
+ */
+#ifndef LIBINJECTION_HTML5_DATA_H
+#define LIBINJECTION_HTML5_DATA_H
+
+#include "libinjection_charclass.h"
+
+static const unsigned char h5_map[] = {
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const char_range_t h5_white_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x20},
+};
+static const char_class_t h5_white = {
+    h5_map, 0x01, h5_white_ranges, 3};
+
+static const char_range_t h5_tag_name_end_ranges[] = {
+    {0x09, 0x0D},
+    {0x20, 0x20},
+    {0x2F, 0x2F},
+    {0x3E, 0x3E},
+};
+static const char_class_t h5_tag_name_end = {
+    h5_map, 0x02, h5_tag_name_end_ranges, 4};
+
+static const char_range_t h5_attr_name_end_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x20},
+    {0x2F, 0x2F},
+    {0x3D, 0x3E},
+};
+static const char_class_t h5_attr_name_end = {
+    h5_map, 0x04, h5_attr_name_end_ranges, 5};
+
+static const char_range_t h5_value_end_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x20},
+    {0x3E, 0x3E},
+};
+static const char_class_t h5_value_end = {
+    h5_map, 0x08, h5_value_end_ranges, 4};
+
+enum h5_state_id {
+    H5_STATE_NONE,
+    H5_STATE_DATA,
+    H5_STATE_TAG_OPEN,
+    H5_STATE_END_TAG_OPEN,
+    H5_STATE_TAG_NAME,
+    H5_STATE_TAG_NAME_CLOSE,
+    H5_STATE_BEFORE_ATTR_NAME,
+    H5_STATE_ATTR_NAME,
+    H5_STATE_AFTER_ATTR_NAME,
+    H5_STATE_BEFORE_ATTR_VALUE,
+    H5_STATE_VALUE_DOUBLE,
+    H5_STATE_VALUE_SINGLE,
+    H5_STATE_VALUE_BACK,
+    H5_STATE_VALUE_NO_QUOTE,
+    H5_STATE_AFTER_VALUE,
+    H5_STATE_SELF_CLOSING,
+    H5_STATE_BOGUS_COMMENT,
+    H5_STATE_BOGUS_COMMENT2,
+    H5_STATE_MARKUP_DECLARATION,
+    H5_STATE_COMMENT,
+    H5_STATE_CDATA,
+    H5_STATE_DOCTYPE,
+    H5_STATE_EOF
+};
+
+#define H5_STATES 23
+
+#ifdef LIBINJECTION_HTML5_STATE_TABLE
+enum h5_class {
+    H5_CLASS_NUL,
+    H5_CLASS_WHITE,
+    H5_CLASS_BANG,
+    H5_CLASS_DQUOTE,
+    H5_CLASS_PERCENT,
+    H5_CLASS_SQUOTE,
+    H5_CLASS_DASH,
+    H5_CLASS_SLASH,
+    H5_CLASS_LT,
+    H5_CLASS_EQUALS,
+    H5_CLASS_GT,
+    H5_CLASS_QUESTION,
+    H5_CLASS_LBRACKET,
+    H5_CLASS_TICK,
+    H5_CLASS_LETTER,
+    H5_CLASS_OTHER,
+    H5_CLASS_EOF
+};
+
+#define H5_CLASSES 17
+
+typedef struct {
+    unsigned char action; /* h5_action_t */
+    unsigned char skip;   /* bytes the go actions step over */
+    unsigned char next;   /* enum h5_state_id */
+    unsigned char token;  /* enum html5_type */
+} h5_transition_t;
+
+static const unsigned char h5_byte_classes[256] = {
+    0, 15, 15, 15, 15, 15, 15, 15, 15, 1, 1, 1, 1, 1, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    1, 2, 3, 15, 15, 4, 15, 5, 15, 15, 15, 15, 15, 6, 15, 7,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 9, 10, 11,
+    15, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 12, 15, 15, 15, 15,
+    13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+};
+
+static const h5_transition_t h5_transitions[][H5_CLASSES] = {
+    /* NONE */
+    {{H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0},
+     {H5_ERROR, 0, 0, 0}},
+    /* DATA */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_TEXT, 0, H5_STATE_TAG_OPEN, DATA_TEXT},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_TEXT_REST, 0, H5_STATE_EOF, DATA_TEXT}},
+    /* TAG_OPEN */
+    {{H5_GO, 0, H5_STATE_TAG_NAME, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_GO, 1, H5_STATE_MARKUP_DECLARATION, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_GO, 1, H5_STATE_BOGUS_COMMENT2, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_GO_CLOSE, 1, H5_STATE_END_TAG_OPEN, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_GO, 1, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_GO, 0, H5_STATE_TAG_NAME, 0},
+     {H5_EMIT_LT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_STOP, 0, 0, 0}},
+    /* END_TAG_OPEN */
+    {{H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_DATA, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_TAG_NAME, 0},
+     {H5_GO_OPEN, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_STOP, 0, 0, 0}},
+    /* TAG_NAME */
+    {{H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_BEFORE_ATTR_NAME, TAG_NAME_OPEN},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_SELF_CLOSING, TAG_NAME_OPEN},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_TAG_NAME, 0, H5_STATE_TAG_NAME_CLOSE, TAG_NAME_OPEN},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, TAG_NAME_OPEN}},
+    /* TAG_NAME_CLOSE */
+    {{H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_EMIT_CLOSE_GT, 0, H5_STATE_EOF, TAG_NAME_CLOSE}},
+    /* BEFORE_ATTR_NAME */
+    {{H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 1, H5_STATE_SELF_CLOSING, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_EMIT_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_STOP, 0, 0, 0}},
+    /* ATTR_NAME */
+    {{H5_EMIT, 0, H5_STATE_AFTER_ATTR_NAME, ATTR_NAME},
+     {H5_EMIT, 0, H5_STATE_AFTER_ATTR_NAME, ATTR_NAME},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_SELF_CLOSING, ATTR_NAME},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_BEFORE_ATTR_VALUE, ATTR_NAME},
+     {H5_EMIT_BEFORE, 0, H5_STATE_TAG_NAME_CLOSE, ATTR_NAME},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_ALL, 0, H5_STATE_EOF, ATTR_NAME}},
+    /* AFTER_ATTR_NAME */
+    {{H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 1, H5_STATE_SELF_CLOSING, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 1, H5_STATE_BEFORE_ATTR_VALUE, 0},
+     {H5_GO, 0, H5_STATE_TAG_NAME_CLOSE, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_ATTR_NAME, 0},
+     {H5_STOP, 0, 0, 0}},
+    /* BEFORE_ATTR_VALUE */
+    {{H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_DOUBLE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_SINGLE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_BACK, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_GO, 0, H5_STATE_VALUE_NO_QUOTE, 0},
+     {H5_STOP_IN, 0, H5_STATE_EOF, 0}},
+    /* VALUE_DOUBLE */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_AFTER_VALUE, ATTR_VALUE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, ATTR_VALUE}},
+    /* VALUE_SINGLE */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_AFTER_VALUE, ATTR_VALUE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, ATTR_VALUE}},
+    /* VALUE_BACK */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_AFTER_VALUE, ATTR_VALUE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, ATTR_VALUE}},
+    /* VALUE_NO_QUOTE */
+    {{H5_EMIT, 0, H5_STATE_BEFORE_ATTR_NAME, ATTR_VALUE},
+     {H5_EMIT, 0, H5_STATE_BEFORE_ATTR_NAME, ATTR_VALUE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_BEFORE, 0, H5_STATE_TAG_NAME_CLOSE, ATTR_VALUE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, ATTR_VALUE}},
+    /* AFTER_VALUE */
+    {{H5_GO, 1, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 1, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 1, H5_STATE_SELF_CLOSING, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_EMIT_GT, 0, H5_STATE_DATA, TAG_NAME_CLOSE},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_STOP, 0, 0, 0}},
+    /* SELF_CLOSING */
+    {{H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_EMIT_SELF_CLOSE, 0, H5_STATE_DATA, TAG_NAME_SELFCLOSE},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_GO, 0, H5_STATE_BEFORE_ATTR_NAME, 0},
+     {H5_STOP, 0, 0, 0}},
+    /* BOGUS_COMMENT */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_DATA, TAG_COMMENT},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_ALL, 0, H5_STATE_EOF, TAG_COMMENT}},
+    /* BOGUS_COMMENT2 */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_DATA, TAG_COMMENT},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_ALL, 0, H5_STATE_EOF, TAG_COMMENT}},
+    /* MARKUP_DECLARATION */
+    {{H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 2, H5_STATE_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 7, H5_STATE_CDATA, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_DOCTYPE, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0},
+     {H5_GO, 0, H5_STATE_BOGUS_COMMENT, 0}},
+    /* COMMENT */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_DATA, TAG_COMMENT},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, TAG_COMMENT}},
+    /* CDATA */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_DATA, DATA_TEXT},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, DATA_TEXT}},
+    /* DOCTYPE */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT, 0, H5_STATE_DATA, DOCTYPE},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_EMIT_REST, 0, H5_STATE_EOF, DOCTYPE}},
+    /* EOF */
+    {{H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0},
+     {H5_STOP, 0, 0, 0}},
+};
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * https://github.com/libinjection/libinjection
+ *
+ * Counters of the shape fast paths of libinjection_is_sqli and
+ * libinjection_xss, built with -DLIBINJECTION_SHAPE_STATS.  Internal
+ * to the library; see libinjection_sqli_shape_stats.
+ */
+
+#ifndef LIBINJECTION_SHAPE_STATS_H
+#define LIBINJECTION_SHAPE_STATS_H
+
+#ifdef LIBINJECTION_SHAPE_STATS
+/*
+ * All threads count into the same counters, so they are updated
+ * atomically
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SHAPE_STATS_ADD(n) ((void)__atomic_fetch_add(&(n), 1, __ATOMIC_RELAXED))
+#define SHAPE_STATS_READ(n) __atomic_load_n(&(n), __ATOMIC_RELAXED)
+#else
+#error "LIBINJECTION_SHAPE_STATS needs the GCC or clang __atomic builtins"
+#endif
+#endif
+
+#endif /* LIBINJECTION_SHAPE_STATS_H */
@@ -19,6 +19,7 @@
 
 #include "libinjection.h"
 #include "libinjection_sqli.h"
+#include "libinjection_shape_stats.h"
 #include "libinjection_sqli_data.h"
 
 #ifdef __clang_analyzer__
@@ -28,6 +29,7 @@
 
 #define LIBINJECTION_SQLI_TOKEN_SIZE sizeof(((stoken_t *)(0))->val)
 #define LIBINJECTION_SQLI_MAX_TOKENS 5
+#define LIBINJECTION_SQLI_REPLAY_TOKENS 16
 
 #ifndef TRUE
 #define TRUE 1
@@ -44,6 +46,13 @@
 /* faster than calling out to libc isdigit */
 #define ISDIGIT(a) ((unsigned)((a) - '0') <= 9)
 
+/* start loading the next input of a batch while this one is checked */
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p) ((void)(p))
+#endif
+
 #ifdef DEBUG
 #define FOLD_DEBUG                                                             \
     printf("%d \t more=%d  pos=%d left=%d\n", __LINE__, more, (int)pos,        \
@@ -90,8 +99,6 @@ typedef enum {
     TYPE_BACKSLASH = (int)'\\'
 } sqli_token_types;
 
-// prototype for is_backslash_escaped()
-static int is_backslash_escaped(const char *end, const char *start);
 
 /**
  * Initializes parsing state
@@ -154,43 +161,49 @@ static const char *my_memmem(const char *haystack, size_t hlen,
     return NULL;
 }
 
+/*
+ * First "--" at or after s, or NULL
+ */
+static const char *find_dash_dash(const char *s, size_t len) {
+    const char *end = s + len;
+    const char *p = s;
+
+    while ((p = (const char *)memchr(p, '-', (size_t)(end - p))) != NULL) {
+        if (p + 1 < end && p[1] == '-') {
+            return p;
+        }
+        p += 1;
+    }
+    return NULL;
+}
+
+static size_t offset_or_len(const char *s, size_t len, const char *p) {
+    return (p == NULL) ? len : (size_t)(p - s);
+}
+
 /** Find largest string containing certain characters.
  *
  * C Standard library 'strspn' only works for 'c-strings' (null terminated)
  * This works on arbitrary length.
  *
  * Performance notes:
- *   not critical
+ *   the classes are generated byte tables, scanned 16 or 32 bytes
+ *   at a time where SIMD is available.  See libinjection_charclass.h
  *
  * Porting notes:
  *   if accept is 'ABC', then this function would be similar to
  *   a_regexp.match(a_str, '[ABC]*'),
  */
-static size_t strlenspn(const char *s, size_t len, const char *accept) {
-    size_t i;
-    for (i = 0; i < len; ++i) {
-        /* likely we can do better by inlining this function
-         * but this works for now
-         */
-        if (strchr(accept, s[i]) == NULL) {
-            return i;
-        }
-    }
-    return len;
+static size_t strlenspn(const char *s, size_t len,
+                        const char_class_t *accept) {
+    return char_class_span(s, len, accept);
 }
 
-static size_t strlencspn(const char *s, size_t len, const char *accept) {
-    size_t i;
-    for (i = 0; i < len; ++i) {
-        /* likely we can do better by inlining this function
-         * but this works for now
-         */
-        if (strchr(accept, s[i]) != NULL) {
-            return i;
-        }
-    }
-    return len;
+static size_t strlencspn(const char *s, size_t len,
+                         const char_class_t *reject) {
+    return char_class_cspan(s, len, reject);
 }
+
 static int char_is_white(char ch) {
     /* ' '  space is 0x32
        '\t  0x09 \011 horizontal tab
@@ -201,7 +214,7 @@ static int char_is_white(char ch) {
             0x00 \000 null (oracle)
             0xa0 \240 is Latin-1
     */
-    return strchr(" \t\n\v\f\r\240\000", ch) != NULL;
+    return char_class_has(&sql_char_class_white, ch);
 }
 
 /* DANGER DANGER
@@ -240,43 +253,198 @@ static int cstrcasecmp(const char *a, const char *b, size_t n) {
  */
 static int streq(const char *a, const char *b) { return strcmp(a, b) == 0; }
 
-/**
- *
+/* FNV-1a hash of an ASCII upper-cased key.
  *
+ * Must match keyword_hash() in sqlparse2c.py
+ */
+static unsigned int keyword_hash(const char *key, size_t len) {
+    unsigned int h = 2166136261U;
+    size_t i;
+    char ch;
+
+    for (i = 0; i < len; ++i) {
+        ch = key[i];
+        if (ch >= 'a' && ch <= 'z') {
+            ch -= 0x20;
+        }
+        h = (h ^ (unsigned char)ch) * 16777619U;
+    }
+    return h;
+}
+
+/*
+ * Must match keyword_slot() in sqlparse2c.py
+ */
+static size_t keyword_slot(unsigned int h, unsigned int disp, size_t size) {
+    unsigned int x = h ^ disp;
+    x = (x ^ (x >> 16)) * 0x45d9f3bU;
+    x = (x ^ (x >> 16)) * 0x45d9f3bU;
+    x = x ^ (x >> 16);
+    return x % size;
+}
+
+/**
+ * sql_keywords is laid out by a minimal perfect hash generated
+ * by sqlparse2c.py: the key's hash picks a displacement, the
+ * displacement picks the only slot the key could be in.  So it's
+ * one hash and one compare.
  *
  * Porting Notes:
  *  given a mapping/hash of string to char
  *  this is just
  *    typecode = mapping[key.upper()]
  */
+static const keyword_t *lookup_keyword(const char *key, size_t len) {
+    unsigned int h;
+    const keyword_t *kw;
+
+    if (len == 0 || len >= LIBINJECTION_SQLI_TOKEN_SIZE) {
+        return NULL;
+    }
+
+    h = keyword_hash(key, len);
+    kw = &sql_keywords[keyword_slot(
+        h, sql_keywords_disp[h % sql_keywords_disp_sz], sql_keywords_sz)];
+
+    /* arg0 = upper case only, arg1 = mixed case */
+    if (cstrcasecmp(kw->word, key, len) == 0) {
+        return kw;
+    } else {
+        return NULL;
+    }
+}
+
+/*
+ * Words that are only there for their flags have type CHAR_NULL
+ */
+static char lookup_keyword_type(const char *key, size_t len) {
+    const keyword_t *kw = lookup_keyword(key, len);
+
+    return kw == NULL ? CHAR_NULL : kw->type;
+}
+
+/*
+ * What tokens keep in stoken_t.keyword: the slot + 1, KEYWORD_NONE if
+ * the value isn't in sql_keywords, 0 if it hasn't been looked up.
+ */
+#define KEYWORD_NONE 0xFFFFU
+static unsigned short keyword_id(const keyword_t *kw) {
+    return kw == NULL ? KEYWORD_NONE : (unsigned short)(kw - sql_keywords + 1);
+}
+
+#ifndef LIBINJECTION_SQLI_REFERENCE_MATCH
+static unsigned int popcount32(unsigned int x) {
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+    return (x * 0x01010101U) >> 24;
+}
+
+/*
+ * The generated fingerprint DFA (see fingerprint_dfa() in sqlparse2c.py)
+ * reads one token type per step, case-insensitively.  State 0 is the
+ * start, FINGERPRINT_DEAD means no fingerprint starts with the types
+ * read so far.
+ */
+#define FINGERPRINT_DEAD 0xFFFFU
+#define FINGERPRINT_ACCEPT 1U
+
+static unsigned int fingerprint_step(unsigned int state, char type) {
+    const unsigned int bit = 1U
+                             << sql_fingerprint_codes[(unsigned char)type];
+
+    if (bit == 1U || (sql_fingerprint_next[state] & bit) == 0) {
+        return FINGERPRINT_DEAD;
+    }
+    return sql_fingerprint_child[state] +
+           popcount32(sql_fingerprint_next[state] & (bit - 1) &
+                      ~FINGERPRINT_ACCEPT);
+}
+
+/**
+ * Runs the fingerprint through the DFA.  Returns the accepting state,
+ * which sql_fingerprint_guard has the whitelist guards of, or
+ * FINGERPRINT_DEAD.  A type that appears in no fingerprint is an
+ * immediate miss.
+ */
+static unsigned int fingerprint_state(const char *fp, size_t len) {
+    unsigned int state = 0;
+    size_t i;
+
+    if (len == 0 || len > LIBINJECTION_SQLI_MAX_TOKENS) {
+        return FINGERPRINT_DEAD;
+    }
+    for (i = 0; i < len; ++i) {
+        state = fingerprint_step(state, fp[i]);
+        if (state == FINGERPRINT_DEAD) {
+            return FINGERPRINT_DEAD;
+        }
+    }
+    return (sql_fingerprint_next[state] & FINGERPRINT_ACCEPT) != 0
+               ? state
+               : FINGERPRINT_DEAD;
+}
+
+/*
+ * Porting Notes:
+ *   this is just
+ *     fingerprint.upper() in fingerprints
+ */
+static int is_fingerprint(const char *fp, size_t len) {
+    return fingerprint_state(fp, len) != FINGERPRINT_DEAD;
+}
+
+#else
+/*
+ * Reference matcher: a binary search over the sorted, upper-cased
+ * fingerprints.  Gives the same answers as the DFA, test-sqli-dfa.sh
+ * checks that it does.
+ */
+static void fingerprint_upper(char *dst, const char *types, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        dst[i] = (types[i] >= 'a' && types[i] <= 'z')
+                     ? (char)(types[i] - 0x20)
+                     : types[i];
+    }
+    dst[len] = CHAR_NULL;
+}
 
-static char bsearch_keyword_type(const char *key, size_t len,
-                                 const keyword_t *keywords, size_t numb) {
-    size_t pos;
+/*
+ * index of the first fingerprint that is not less than key
+ */
+static size_t fingerprint_lower_bound(const char *key) {
     size_t left = 0;
-    size_t right = numb - 1;
+    size_t right = sql_fingerprint_list_sz;
+    size_t mid;
 
     while (left < right) {
-        pos = (left + right) >> 1;
-
-        /* arg0 = upper case only, arg1 = mixed case */
-        if (cstrcasecmp(keywords[pos].word, key, len) < 0) {
-            left = pos + 1;
+        mid = left + (right - left) / 2;
+        if (strcmp(sql_fingerprint_list[mid], key) < 0) {
+            left = mid + 1;
         } else {
-            right = pos;
+            right = mid;
         }
     }
-    if ((left == right) && cstrcasecmp(keywords[left].word, key, len) == 0) {
-        return keywords[left].type;
-    } else {
-        return CHAR_NULL;
-    }
+    return left;
 }
 
-static char is_keyword(const char *key, size_t len) {
-    return bsearch_keyword_type(key, len, sql_keywords, sql_keywords_sz);
+static int is_fingerprint(const char *fp, size_t len) {
+    char key[LIBINJECTION_SQLI_MAX_TOKENS + 1];
+    size_t i;
+
+    if (len == 0 || len > LIBINJECTION_SQLI_MAX_TOKENS) {
+        return FALSE;
+    }
+    fingerprint_upper(key, fp, len);
+    i = fingerprint_lower_bound(key);
+    return i < sql_fingerprint_list_sz &&
+           strcmp(sql_fingerprint_list[i], key) == 0;
 }
 
+#endif
+
 /* st_token methods
  *
  * The following functions manipulates the stoken_t type
@@ -293,39 +461,85 @@ static void st_assign_char(stoken_t *st, const char stype, size_t pos,
     st->type = (char)stype;
     st->pos = pos;
     st->len = 1;
+    st->keyword = 0;
     st->val[0] = value;
     st->val[1] = CHAR_NULL;
 }
 
-static void st_assign(stoken_t *st, const char stype, size_t pos, size_t len,
-                      const char *value) {
+/*
+ * Tokens from the input only record where they are.  val is copied
+ * out by st_value the first time something looks at it, which most
+ * tokens never need: an empty val with a non-zero len means "not
+ * copied yet".  Values that are not a slice of the input, such as
+ * merged words, are copied at once with st_assign_copy.
+ */
+static void st_assign(stoken_t *st, const char stype, size_t pos,
+                      size_t len) {
+    const size_t MSIZE = LIBINJECTION_SQLI_TOKEN_SIZE;
+    st->type = (char)stype;
+    st->pos = pos;
+    st->len = len < MSIZE ? len : (MSIZE - 1);
+    st->keyword = 0;
+    st->val[0] = CHAR_NULL;
+}
+
+static void st_assign_copy(stoken_t *st, const char stype, size_t pos,
+                           size_t len, const char *value) {
     const size_t MSIZE = LIBINJECTION_SQLI_TOKEN_SIZE;
     size_t last = len < MSIZE ? len : (MSIZE - 1);
     st->type = (char)stype;
     st->pos = pos;
     st->len = last;
+    st->keyword = 0;
     memcpy(st->val, value, last);
     st->val[last] = CHAR_NULL;
 }
 
+/*
+ * The token's len bytes, not necessarily null terminated
+ */
+static const char *st_chars(const struct libinjection_sqli_state *sf,
+                            const stoken_t *st) {
+    return st->val[0] == CHAR_NULL ? sf->s + st->pos : st->val;
+}
+
+/*
+ * The token's value as a c-string
+ */
+static const char *st_value(const struct libinjection_sqli_state *sf,
+                            stoken_t *st) {
+    if (st->val[0] == CHAR_NULL && st->len != 0) {
+        memcpy(st->val, sf->s + st->pos, st->len);
+        st->val[st->len] = CHAR_NULL;
+    }
+    return st->val;
+}
+
 static void st_copy(stoken_t *dest, const stoken_t *src) {
     memcpy(dest, src, sizeof(stoken_t));
 }
 
-static int st_is_arithmetic_op(const stoken_t *st) {
-    const char ch = st->val[0];
-    return (st->type == TYPE_OPERATOR && st->len == 1 &&
-            (ch == '*' || ch == '/' || ch == '-' || ch == '+' || ch == '%'));
+static int st_is_arithmetic_op(const struct libinjection_sqli_state *sf,
+                               const stoken_t *st) {
+    char ch;
+
+    if (st->type != TYPE_OPERATOR || st->len != 1) {
+        return FALSE;
+    }
+    ch = st_chars(sf, st)[0];
+    return (ch == '*' || ch == '/' || ch == '-' || ch == '+' || ch == '%');
 }
 
-static int st_is_unary_op(const stoken_t *st) {
-    const char *str = st->val;
+static int st_is_unary_op(const struct libinjection_sqli_state *sf,
+                          const stoken_t *st) {
+    const char *str;
     const size_t len = st->len;
 
     if (st->type != TYPE_OPERATOR) {
         return FALSE;
     }
 
+    str = st_chars(sf, st);
     switch (len) {
     case 1:
         return *str == '+' || *str == '-' || *str == '!' || *str == '~';
@@ -338,6 +552,25 @@ static int st_is_unary_op(const stoken_t *st) {
     }
 }
 
+/*
+ * Look up the first len bytes of a token.  The built-in lookup reads
+ * the input in place; one set by libinjection_sqli_callback is
+ * promised a c-string, so it gets the copied value.
+ */
+static char st_lookup_word(struct libinjection_sqli_state *sf, stoken_t *st,
+                           size_t len) {
+    const keyword_t *kw;
+
+    if (sf->lookup == libinjection_sqli_lookup_word) {
+        kw = lookup_keyword(sf->s + st->pos, len);
+        if (len == st->len) {
+            st->keyword = keyword_id(kw);
+        }
+        return kw == NULL ? CHAR_NULL : kw->type;
+    }
+    return sf->lookup(sf, LOOKUP_WORD, st_value(sf, st), len);
+}
+
 /* Parsers
  *
  *
@@ -345,7 +578,12 @@ static int st_is_unary_op(const stoken_t *st) {
 
 static size_t parse_white(struct libinjection_sqli_state
                               *sf) { // cppcheck-suppress constParameterCallback
-    return sf->pos + 1;
+    /*
+     * skip the whole run at once rather than going back through
+     * the tokenizer loop for every byte
+     */
+    return sf->pos + strlenspn(sf->s + sf->pos, sf->slen - sf->pos,
+                               &sql_char_class_blank);
 }
 
 static size_t parse_operator1(struct libinjection_sqli_state *sf) {
@@ -380,11 +618,11 @@ static size_t parse_eol_comment(struct libinjection_sqli_state *sf) {
     const char *endpos =
         (const char *)memchr((const void *)(cs + pos), '\n', slen - pos);
     if (endpos == NULL) {
-        st_assign(sf->current, TYPE_COMMENT, pos, slen - pos, cs + pos);
+        st_assign(sf->current, TYPE_COMMENT, pos, slen - pos);
         return slen;
     } else {
-        st_assign(sf->current, TYPE_COMMENT, pos, (size_t)(endpos - cs) - pos,
-                  cs + pos);
+        st_assign(sf->current, TYPE_COMMENT, pos,
+                  (size_t)(endpos - cs) - pos);
         return (size_t)((endpos - cs) + 1);
     }
 }
@@ -514,7 +752,7 @@ static size_t parse_slash(struct libinjection_sqli_state *sf) {
         ctype = TYPE_EVIL;
     }
 
-    st_assign(sf->current, ctype, pos, clen, cs + pos);
+    st_assign(sf->current, ctype, pos, clen);
     return pos + clen;
 }
 
@@ -527,7 +765,7 @@ static size_t parse_backslash(struct libinjection_sqli_state *sf) {
      * Weird MySQL alias for NULL, "\N" (capital N only)
      */
     if (pos + 1 < slen && cs[pos + 1] == 'N') {
-        st_assign(sf->current, TYPE_NUMBER, pos, 2, cs + pos);
+        st_assign(sf->current, TYPE_NUMBER, pos, 2);
         return pos + 2;
     } else {
         st_assign_char(sf->current, TYPE_BACKSLASH, pos, 1, cs[pos]);
@@ -550,13 +788,13 @@ static size_t parse_operator2(struct libinjection_sqli_state *sf) {
         /*
          * special 3-char operator
          */
-        st_assign(sf->current, TYPE_OPERATOR, pos, 3, cs + pos);
+        st_assign(sf->current, TYPE_OPERATOR, pos, 3);
         return pos + 3;
     }
 
     ch = sf->lookup(sf, LOOKUP_OPERATOR, cs + pos, 2);
     if (ch != CHAR_NULL) {
-        st_assign(sf->current, ch, pos, 2, cs + pos);
+        st_assign(sf->current, ch, pos, 2);
         return pos + 2;
     }
 
@@ -567,7 +805,7 @@ static size_t parse_operator2(struct libinjection_sqli_state *sf) {
 
     if (cs[pos] == ':') {
         /* ':' is not an operator */
-        st_assign(sf->current, TYPE_COLON, pos, 1, cs + pos);
+        st_assign(sf->current, TYPE_COLON, pos, 1);
         return pos + 1;
     } else {
         /*
@@ -577,36 +815,6 @@ static size_t parse_operator2(struct libinjection_sqli_state *sf) {
     }
 }
 
-/*
- * Ok!   "  \"   "  one backslash = escaped!
- *       " \\"   "  two backslash = not escaped!
- *       "\\\"   "  three backslash = escaped!
- */
-#ifndef __clang_analyzer__
-static int is_backslash_escaped(const char *end, const char *start) {
-    const char *ptr;
-    /* Code not to be analyzed by clang.
-     *
-     * Why we do this? Because there is a false positive here:
-     * libinjection_sqli.c:608:13: warning: Out of bound memory access (access
-     * exceeds upper limit of memory block) [alpha.security.ArrayBoundV2] if
-     * (*ptr
-     * != '\\') {
-     *           ^~~~
-     * Specifically, this function deals with non-null terminated char arrays.
-     * This can be added as prerequisite, and is not written clearly. But the
-     * math in the for below holds.
-     */
-    for (ptr = end; ptr >= start; ptr--) {
-        if (*ptr != '\\') {
-            break;
-        }
-    }
-    /* if number of backslashes is odd, it is escaped */
-    return (end - ptr) & 1;
-}
-#endif
-
 static size_t is_double_delim_escaped(const char *cur, const char *end) {
     return ((cur + 1) < end) && *(cur + 1) == *cur;
 }
@@ -618,14 +826,18 @@ static size_t is_double_delim_escaped(const char *cur, const char *end) {
  * ending quote isn't duplicated (i.e. escaped)
  * since it's the wrong char or EOL
  *
+ * Ok!   "  \"   "  one backslash = escaped!
+ *       " \\"   "  two backslash = not escaped!
+ *       "\\\"   "  three backslash = escaped!
  */
 static size_t parse_string_core(const char *cs, const size_t len, size_t pos,
                                 stoken_t *st, char delim, size_t offset) {
     /*
      * offset is to skip the perhaps first quote char
      */
-    const char *qpos = (const char *)memchr((const void *)(cs + pos + offset),
-                                            delim, len - pos - offset);
+    const size_t start = pos + offset;
+    size_t i = start;
+    size_t run;
 
     /*
      * then keep string open/close info
@@ -642,32 +854,43 @@ static size_t parse_string_core(const char *cs, const size_t len, size_t pos,
         st->str_open = CHAR_NULL;
     }
 
+    /*
+     * One forward pass: stop only on the delimiter or a backslash.
+     * An odd run of backslashes escapes the byte after it, so there
+     * is never a need to look back.
+     */
     while (TRUE) {
-        if (qpos == NULL) {
+        if (i < len) {
+            i += char_find2(cs + i, len - i, delim, '\\');
+        }
+        if (i >= len) {
             /*
              * string ended with no trailing quote
              * assign what we have
              */
-            st_assign(st, TYPE_STRING, pos + offset, len - pos - offset,
-                      cs + pos + offset);
+            st_assign(st, TYPE_STRING, start, len - start);
             st->str_close = CHAR_NULL;
             return len;
-        } else if (is_backslash_escaped(qpos - 1, cs + pos + offset)) {
-            /* keep going, move ahead one character */
-            qpos = (const char *)memchr((const void *)(qpos + 1), delim,
-                                        (size_t)((cs + len) - (qpos + 1)));
+        } else if (cs[i] == '\\') {
+            /*
+             * keep going, past the run of backslashes and, if the
+             * run is odd, the character it escapes
+             */
+            run = i;
+            while (i < len && cs[i] == '\\') {
+                i += 1;
+            }
+            i += (i - run) & 1;
             continue;
-        } else if (is_double_delim_escaped(qpos, cs + len)) {
+        } else if (is_double_delim_escaped(cs + i, cs + len)) {
             /* keep going, move ahead two characters */
-            qpos = (const char *)memchr((const void *)(qpos + 2), delim,
-                                        (size_t)((cs + len) - (qpos + 2)));
+            i += 2;
             continue;
         } else {
             /* hey it's a normal string */
-            st_assign(st, TYPE_STRING, pos + offset,
-                      (size_t)(qpos - (cs + pos + offset)), cs + pos + offset);
+            st_assign(st, TYPE_STRING, start, i - start);
             st->str_close = delim;
-            return (size_t)(qpos - cs + 1);
+            return i + 1;
         }
     }
 }
@@ -764,14 +987,13 @@ static size_t parse_qstring_core(struct libinjection_sqli_state *sf,
 
     strend = memchr2(cs + pos + 3, slen - pos - 3, ch, '\'');
     if (strend == NULL) {
-        st_assign(sf->current, TYPE_STRING, pos + 3, slen - pos - 3,
-                  cs + pos + 3);
+        st_assign(sf->current, TYPE_STRING, pos + 3, slen - pos - 3);
         sf->current->str_open = 'q';
         sf->current->str_close = CHAR_NULL;
         return slen;
     } else {
         st_assign(sf->current, TYPE_STRING, pos + 3,
-                  (size_t)(strend - cs) - pos - 3, cs + pos + 3);
+                  (size_t)(strend - cs) - pos - 3);
         sf->current->str_open = 'q';
         sf->current->str_close = 'q';
         return (size_t)(strend - cs + 2);
@@ -816,11 +1038,11 @@ static size_t parse_bstring(struct libinjection_sqli_state *sf) {
         return parse_word(sf);
     }
 
-    wlen = strlenspn(cs + pos + 2, sf->slen - pos - 2, "01");
+    wlen = strlenspn(cs + pos + 2, sf->slen - pos - 2, &sql_char_class_bin);
     if (pos + 2 + wlen >= slen || cs[pos + 2 + wlen] != '\'') {
         return parse_word(sf);
     }
-    st_assign(sf->current, TYPE_NUMBER, pos, wlen + 3, cs + pos);
+    st_assign(sf->current, TYPE_NUMBER, pos, wlen + 3);
     return pos + 2 + wlen + 1;
 }
 
@@ -844,12 +1066,11 @@ static size_t parse_xstring(struct libinjection_sqli_state *sf) {
         return parse_word(sf);
     }
 
-    wlen =
-        strlenspn(cs + pos + 2, sf->slen - pos - 2, "0123456789ABCDEFabcdef");
+    wlen = strlenspn(cs + pos + 2, sf->slen - pos - 2, &sql_char_class_hex);
     if (pos + 2 + wlen >= slen || cs[pos + 2 + wlen] != '\'') {
         return parse_word(sf);
     }
-    st_assign(sf->current, TYPE_NUMBER, pos, wlen + 3, cs + pos);
+    st_assign(sf->current, TYPE_NUMBER, pos, wlen + 3);
     return pos + 2 + wlen + 1;
 }
 
@@ -863,11 +1084,11 @@ static size_t parse_bword(struct libinjection_sqli_state *sf) {
     size_t pos = sf->pos;
     const char *endptr = (const char *)memchr(cs + pos, ']', sf->slen - pos);
     if (endptr == NULL) {
-        st_assign(sf->current, TYPE_BAREWORD, pos, sf->slen - pos, cs + pos);
+        st_assign(sf->current, TYPE_BAREWORD, pos, sf->slen - pos);
         return sf->slen;
     } else {
         st_assign(sf->current, TYPE_BAREWORD, pos,
-                  (size_t)(endptr - cs) - pos + 1, cs + pos);
+                  (size_t)(endptr - cs) - pos + 1);
         return (size_t)((endptr - cs) + 1);
     }
 }
@@ -879,18 +1100,24 @@ static size_t parse_word(struct libinjection_sqli_state *sf) {
     const char *cs = sf->s;
     size_t pos = sf->pos;
     size_t wlen =
-        strlencspn(cs + pos, sf->slen - pos,
-                   " []{}<>:\\?=@!#~+-*/&|^%(),';\t\n\v\f\r\"\240\000");
+        strlencspn(cs + pos, sf->slen - pos, &sql_char_class_word_delim);
+    const int builtin = sf->lookup == libinjection_sqli_lookup_word;
+    const keyword_t *kw = NULL;
 
-    st_assign(sf->current, TYPE_BAREWORD, pos, wlen, cs + pos);
+    st_assign(sf->current, TYPE_BAREWORD, pos, wlen);
 
     /* now we need to look inside what we good for "." and "`"
      * and see if what is before is a keyword or not
      */
     for (i = 0; i < sf->current->len; ++i) {
-        delim = sf->current->val[i];
+        delim = cs[pos + i];
         if (delim == '.' || delim == '`') {
-            ch = sf->lookup(sf, LOOKUP_WORD, sf->current->val, i);
+            if (builtin) {
+                kw = lookup_keyword(cs + pos, i);
+                ch = kw == NULL ? CHAR_NULL : kw->type;
+            } else {
+                ch = st_lookup_word(sf, sf->current, i);
+            }
             if (ch != TYPE_NONE && ch != TYPE_BAREWORD) {
                 /* needed for swig */
                 st_clear(sf->current);
@@ -898,9 +1125,19 @@ static size_t parse_word(struct libinjection_sqli_state *sf) {
                  * we got something like "SELECT.1"
                  * or SELECT`column`
                  */
-                st_assign(sf->current, ch, pos, i, cs + pos);
+                st_assign(sf->current, ch, pos, i);
                 return pos + i;
             }
+            /*
+             * Every longer prefix, and the whole word, has this one
+             * and delim in it.  No keyword has a '`' and only a
+             * dotted head goes on with a '.', so one lookup per '.'
+             * settles a.b.c.d: it's a bareword.
+             */
+            if (builtin && (delim == '`' || kw == NULL ||
+                            (kw->flags & KEYWORD_DOTTED_HEAD) == 0)) {
+                return pos + wlen;
+            }
         }
     }
 
@@ -909,7 +1146,7 @@ static size_t parse_word(struct libinjection_sqli_state *sf) {
      */
     if (wlen < LIBINJECTION_SQLI_TOKEN_SIZE) {
 
-        ch = sf->lookup(sf, LOOKUP_WORD, sf->current->val, wlen);
+        ch = st_lookup_word(sf, sf->current, wlen);
         if (ch == CHAR_NULL) {
             ch = TYPE_BAREWORD;
         }
@@ -935,7 +1172,7 @@ static size_t parse_tick(struct libinjection_sqli_state *sf) {
     /* check value of string to see if it's a keyword,
      * function, operator, etc
      */
-    char ch = sf->lookup(sf, LOOKUP_WORD, sf->current->val, sf->current->len);
+    char ch = st_lookup_word(sf, sf->current, sf->current->len);
     if (ch == TYPE_FUNCTION) {
         /* if it's a function, then convert token */
         sf->current->type = TYPE_FUNCTION;
@@ -987,13 +1224,12 @@ static size_t parse_var(struct libinjection_sqli_state *sf) {
         }
     }
 
-    xlen = strlencspn(cs + pos, slen - pos,
-                      " <>:\\?=@!#~+-*/&|^%(),';\t\n\v\f\r'`\"");
+    xlen = strlencspn(cs + pos, slen - pos, &sql_char_class_var_delim);
     if (xlen == 0) {
-        st_assign(sf->current, TYPE_VARIABLE, pos, 0, cs + pos);
+        st_assign(sf->current, TYPE_VARIABLE, pos, 0);
         return pos;
     } else {
-        st_assign(sf->current, TYPE_VARIABLE, pos, xlen, cs + pos);
+        st_assign(sf->current, TYPE_VARIABLE, pos, xlen);
         return pos + xlen;
     }
 }
@@ -1016,21 +1252,20 @@ static size_t parse_money(struct libinjection_sqli_state *sf) {
      * This also parses $....,,,111 but that's ok
      */
 
-    xlen = strlenspn(cs + pos + 1, slen - pos - 1, "0123456789.,");
+    xlen = strlenspn(cs + pos + 1, slen - pos - 1, &sql_char_class_money);
     if (xlen == 0) {
         if (cs[pos + 1] == '$') {
             /* we have $$ .. find ending $$ and make string */
             strend = memchr2(cs + pos + 2, slen - pos - 2, '$', '$');
             if (strend == NULL) {
                 /* fell off edge */
-                st_assign(sf->current, TYPE_STRING, pos + 2, slen - (pos + 2),
-                          cs + pos + 2);
+                st_assign(sf->current, TYPE_STRING, pos + 2, slen - (pos + 2));
                 sf->current->str_open = '$';
                 sf->current->str_close = CHAR_NULL;
                 return slen;
             } else {
                 st_assign(sf->current, TYPE_STRING, pos + 2,
-                          (size_t)(strend - (cs + pos + 2)), cs + pos + 2);
+                          (size_t)(strend - (cs + pos + 2)));
                 sf->current->str_open = '$';
                 sf->current->str_close = '$';
                 return (size_t)(strend - cs + 2);
@@ -1039,9 +1274,8 @@ static size_t parse_money(struct libinjection_sqli_state *sf) {
             /* ok it's not a number or '$$', but maybe it's pgsql "$ quoted
              * strings"
              */
-            xlen = strlenspn(
-                cs + pos + 1, slen - pos - 1,
-                "abcdefghjiklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ");
+            xlen = strlenspn(cs + pos + 1, slen - pos - 1,
+                             &sql_char_class_alpha);
             if (xlen == 0) {
                 /* hmm it's "$" _something_ .. just add $ and keep going*/
                 st_assign_char(sf->current, TYPE_BAREWORD, pos, 1, '$');
@@ -1062,15 +1296,14 @@ static size_t parse_money(struct libinjection_sqli_state *sf) {
             if (strend == NULL) {
                 /* fell off edge */
                 st_assign(sf->current, TYPE_STRING, pos + xlen + 2,
-                          slen - pos - xlen - 2, cs + pos + xlen + 2);
+                          slen - pos - xlen - 2);
                 sf->current->str_open = '$';
                 sf->current->str_close = CHAR_NULL;
                 return slen;
             } else {
                 /* got one */
                 st_assign(sf->current, TYPE_STRING, pos + xlen + 2,
-                          (size_t)(strend - (cs + pos + xlen + 2)),
-                          cs + pos + xlen + 2);
+                          (size_t)(strend - (cs + pos + xlen + 2)));
                 sf->current->str_open = '$';
                 sf->current->str_close = '$';
                 return (size_t)((strend + xlen + 2) - cs);
@@ -1080,7 +1313,7 @@ static size_t parse_money(struct libinjection_sqli_state *sf) {
         /* $. should parsed as a word */
         return parse_word(sf);
     } else {
-        st_assign(sf->current, TYPE_NUMBER, pos, 1 + xlen, cs + pos);
+        st_assign(sf->current, TYPE_NUMBER, pos, 1 + xlen);
         return pos + 1 + xlen;
     }
 }
@@ -1088,7 +1321,7 @@ static size_t parse_money(struct libinjection_sqli_state *sf) {
 static size_t parse_number(struct libinjection_sqli_state *sf) {
     size_t xlen;
     size_t start;
-    const char *digits = NULL;
+    const char_class_t *digits = NULL;
     const char *cs = sf->s;
     const size_t slen = sf->slen;
     size_t pos = sf->pos;
@@ -1100,18 +1333,18 @@ static size_t parse_number(struct libinjection_sqli_state *sf) {
      */
     if (cs[pos] == '0' && pos + 1 < slen) {
         if (cs[pos + 1] == 'X' || cs[pos + 1] == 'x') {
-            digits = "0123456789ABCDEFabcdef";
+            digits = &sql_char_class_hex;
         } else if (cs[pos + 1] == 'B' || cs[pos + 1] == 'b') {
-            digits = "01";
+            digits = &sql_char_class_bin;
         }
 
         if (digits) {
             xlen = strlenspn(cs + pos + 2, slen - pos - 2, digits);
             if (xlen == 0) {
-                st_assign(sf->current, TYPE_BAREWORD, pos, 2, cs + pos);
+                st_assign(sf->current, TYPE_BAREWORD, pos, 2);
                 return pos + 2;
             } else {
-                st_assign(sf->current, TYPE_NUMBER, pos, 2 + xlen, cs + pos);
+                st_assign(sf->current, TYPE_NUMBER, pos, 2 + xlen);
                 return pos + 2 + xlen;
             }
         }
@@ -1185,7 +1418,7 @@ static size_t parse_number(struct libinjection_sqli_state *sf) {
      * injection in case of WAF bypass.
      */
     if (!(have_e == 1 && have_exp == 0)) {
-        st_assign(sf->current, TYPE_NUMBER, start, pos - start, cs + start);
+        st_assign(sf->current, TYPE_NUMBER, start, pos - start);
     }
 
     return pos;
@@ -1198,8 +1431,10 @@ static size_t parse_number(struct libinjection_sqli_state *sf) {
  */
 const char *libinjection_version(void) { return LIBINJECTION_VERSION; }
 
-int libinjection_sqli_tokenize(struct libinjection_sqli_state *sf) {
+static int sqli_tokenize(struct libinjection_sqli_state *sf) {
+#ifndef LIBINJECTION_SQLI_SWITCH_DISPATCH
     pt2Function fnptr;
+#endif
     size_t *pos = &sf->pos;
     stoken_t *current = sf->current;
     const char *s = sf->s;
@@ -1236,10 +1471,16 @@ int libinjection_sqli_tokenize(struct libinjection_sqli_state *sf) {
          *
          * Porting Note: this is mapping of char to function
          *   charparsers[ch]()
+         * With LIBINJECTION_SQLI_SWITCH_DISPATCH the generated data
+         * has a switch statement instead of the table.
          */
+#ifdef LIBINJECTION_SQLI_SWITCH_DISPATCH
+        *pos = parse_dispatch(sf, ch);
+#else
         fnptr = char_parse_map[ch];
 
         *pos = (*fnptr)(sf);
+#endif
 
         /*
          *
@@ -1252,6 +1493,81 @@ int libinjection_sqli_tokenize(struct libinjection_sqli_state *sf) {
     return FALSE;
 }
 
+/*
+ * ANSI and MySQL tokenize an input the same way except at '#' and
+ * '--x' comments.  libinjection_is_sqli records the ANSI tokens up to
+ * the first of those, and the MySQL pass replays them instead of
+ * tokenizing that part of the input again.
+ */
+struct libinjection_sqli_replay {
+    int playing; /* FALSE while recording */
+    int done;    /* recording has stopped */
+    size_t count;
+    size_t next;
+    stoken_t tokens[LIBINJECTION_SQLI_REPLAY_TOKENS];
+    size_t next_pos[LIBINJECTION_SQLI_REPLAY_TOKENS];
+};
+
+/*
+ * What the detection passes need to know about the whole input,
+ * found once per libinjection_is_sqli rather than each time a pass
+ * asks.  Every field is the offset of the first occurrence, slen if
+ * there is none, or SCAN_UNKNOWN if nobody has asked yet.
+ */
+#define SCAN_UNKNOWN ((size_t)-1)
+struct libinjection_sqli_scan {
+    size_t single_quote;
+    size_t double_quote;
+    size_t hash;
+    size_t dash_dash;
+    size_t sp_password;
+};
+
+static int sqli_next_token(struct libinjection_sqli_state *sf) {
+    struct libinjection_sqli_replay *replay = sf->replay;
+    int comments;
+    int more;
+
+    if (replay == NULL) {
+        return sqli_tokenize(sf);
+    }
+
+    if (replay->playing) {
+        if (replay->next == replay->count) {
+            return sqli_tokenize(sf);
+        }
+        *(sf->current) = replay->tokens[replay->next];
+        sf->pos = replay->next_pos[replay->next];
+        replay->next += 1;
+        sf->stats_tokens += 1;
+        return TRUE;
+    }
+
+    comments = sf->stats_comment_hash + sf->stats_comment_ddx;
+    more = sqli_tokenize(sf);
+    if (replay->done) {
+        return more;
+    }
+    if (!more || replay->count == LIBINJECTION_SQLI_REPLAY_TOKENS ||
+        comments != sf->stats_comment_hash + sf->stats_comment_ddx) {
+        /* end of input, out of room, or the dialects differ from here */
+        replay->done = TRUE;
+    } else {
+        replay->tokens[replay->count] = *(sf->current);
+        replay->next_pos[replay->count] = sf->pos;
+        replay->count += 1;
+    }
+    return more;
+}
+
+int libinjection_sqli_tokenize(struct libinjection_sqli_state *sf) {
+    if (!sqli_next_token(sf)) {
+        return FALSE;
+    }
+    st_value(sf, sf->current);
+    return TRUE;
+}
+
 void libinjection_sqli_init(struct libinjection_sqli_state *sf, const char *s,
                             size_t len, int flags) {
     if (flags == 0) {
@@ -1269,15 +1585,28 @@ void libinjection_sqli_init(struct libinjection_sqli_state *sf, const char *s,
 
 static void libinjection_sqli_reset(struct libinjection_sqli_state *sf,
                                     int flags) {
-    void *userdata = sf->userdata;
-    ptr_lookup_fn lookup = sf->lookup;
-
     if (flags == 0) {
         flags = FLAG_QUOTE_NONE | FLAG_SQL_ANSI;
     }
-    libinjection_sqli_init(sf, sf->s, sf->slen, flags);
-    sf->lookup = lookup;
-    sf->userdata = userdata;
+
+    /*
+     * Same as libinjection_sqli_init, keeping the input, lookup,
+     * userdata and the replay and scan of libinjection_is_sqli, but
+     * only clearing what a pass reads before it writes.  Tokens are
+     * cleared by the tokenizer as it claims them and are only read up
+     * to the fingerprint length, so the memset of all eight is skipped.
+     */
+    sf->flags = flags;
+    sf->pos = 0;
+    sf->current = &(sf->tokenvec[0]);
+    memset(sf->fingerprint, 0, sizeof(sf->fingerprint));
+    sf->reason = 0;
+    sf->stats_comment_ddw = 0;
+    sf->stats_comment_ddx = 0;
+    sf->stats_comment_c = 0;
+    sf->stats_comment_hash = 0;
+    sf->stats_folds = 0;
+    sf->stats_tokens = 0;
 }
 
 void libinjection_sqli_callback(struct libinjection_sqli_state *sf,
@@ -1291,6 +1620,61 @@ void libinjection_sqli_callback(struct libinjection_sqli_state *sf,
     }
 }
 
+/*
+ * The token's keyword id, see keyword_id()
+ */
+static unsigned int st_keyword(const struct libinjection_sqli_state *sf,
+                               stoken_t *st) {
+    if (st->keyword == 0) {
+        st->keyword = keyword_id(lookup_keyword(st_chars(sf, st), st->len));
+    }
+    return st->keyword;
+}
+
+/*
+ * The KEYWORD_* flags of the token's value, from the built-in keyword
+ * table whatever sf->lookup is.
+ */
+static unsigned int st_keyword_flags(const struct libinjection_sqli_state *sf,
+                                     stoken_t *st) {
+    const unsigned int id = st_keyword(sf, st);
+
+    return id == KEYWORD_NONE ? 0 : sql_keywords[id - 1].flags;
+}
+
+/*
+ * Could the token be the first words of a phrase in sql_keywords?
+ */
+static int st_is_phrase_head(const struct libinjection_sqli_state *sf,
+                             stoken_t *st) {
+    const unsigned int id = st_keyword(sf, st);
+
+    return id != KEYWORD_NONE && sql_keywords[id - 1].phrases != 0;
+}
+
+/*
+ * Keyword id of the phrase "a b", KEYWORD_NONE if sql_keywords has
+ * no such phrase.  sqlparse2c.py lists what can follow each word a
+ * phrase starts with, so no string is built.
+ */
+static unsigned int st_phrase(const struct libinjection_sqli_state *sf,
+                              stoken_t *a, stoken_t *b) {
+    const phrase_t *phrase;
+    unsigned int id;
+
+    if (!st_is_phrase_head(sf, a)) {
+        return KEYWORD_NONE;
+    }
+    id = st_keyword(sf, b);
+    for (phrase = &sql_phrases[sql_keywords[a->keyword - 1].phrases];
+         phrase->next != 0; ++phrase) {
+        if (phrase->next == id) {
+            return phrase->phrase;
+        }
+    }
+    return KEYWORD_NONE;
+}
+
 /** See if two tokens can be merged since they are compound SQL phrases.
  *
  * This takes two tokens, and, if they are the right type,
@@ -1314,23 +1698,8 @@ syntax_merge_words(struct libinjection_sqli_state *sf, stoken_t *a,
     size_t sz2;
     size_t sz3;
     char tmp[LIBINJECTION_SQLI_TOKEN_SIZE];
-    char ch;
-
-    /* first token is of right type? */
-    if (!(a->type == TYPE_KEYWORD || a->type == TYPE_BAREWORD ||
-          a->type == TYPE_OPERATOR || a->type == TYPE_UNION ||
-          a->type == TYPE_FUNCTION || a->type == TYPE_EXPRESSION ||
-          a->type == TYPE_TSQL || a->type == TYPE_SQLTYPE)) {
-        return FALSE;
-    }
-
-    if (!(b->type == TYPE_KEYWORD || b->type == TYPE_BAREWORD ||
-          b->type == TYPE_OPERATOR || b->type == TYPE_UNION ||
-          b->type == TYPE_FUNCTION || b->type == TYPE_EXPRESSION ||
-          b->type == TYPE_TSQL || b->type == TYPE_SQLTYPE ||
-          b->type == TYPE_LOGIC_OPERATOR)) {
-        return FALSE;
-    }
+    char ch = CHAR_NULL;
+    unsigned int phrase = 0;
 
     sz1 = a->len;
     sz2 = b->len;
@@ -1339,34 +1708,165 @@ syntax_merge_words(struct libinjection_sqli_state *sf, stoken_t *a,
                                                   ending null */
         return FALSE;
     }
+
+    /*
+     * The phrase's id gives its type, so the merged value is only
+     * built to keep.  A custom lookup may know phrases sql_keywords
+     * doesn't, so it gets the string.
+     */
+    if (sf->lookup == libinjection_sqli_lookup_word) {
+        phrase = st_phrase(sf, a, b);
+        if (phrase == KEYWORD_NONE) {
+            return FALSE;
+        }
+        ch = sql_keywords[phrase - 1].type;
+        if (ch == CHAR_NULL) {
+            return FALSE;
+        }
+    }
+
     /*
      * oddly annoying  last.val + ' ' + current.val
      */
-    memcpy(tmp, a->val, sz1);
+    memcpy(tmp, st_chars(sf, a), sz1);
     tmp[sz1] = ' ';
-    memcpy(tmp + sz1 + 1, b->val, sz2);
+    memcpy(tmp + sz1 + 1, st_chars(sf, b), sz2);
     tmp[sz3] = CHAR_NULL;
-    ch = sf->lookup(sf, LOOKUP_WORD, tmp, sz3);
+    if (sf->lookup != libinjection_sqli_lookup_word) {
+        ch = sf->lookup(sf, LOOKUP_WORD, tmp, sz3);
+    }
 
     if (ch != CHAR_NULL) {
-        st_assign(a, ch, a->pos, sz3, tmp);
+        st_assign_copy(a, ch, a->pos, sz3, tmp);
+        a->keyword = (unsigned short)phrase;
         return TRUE;
     } else {
         return FALSE;
     }
 }
 
-int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
-    stoken_t last_comment;
-
-    /* POS is the position of where the NEXT token goes */
-    size_t pos = 0;
+/*
+ * The checks fold rules make beyond token types, see fold_rules.txt.
+ * tok is tokenvec + left.
+ */
+static int fold_guard(struct libinjection_sqli_state *sf, stoken_t *tok,
+                      int guard) {
+    const char *val;
+
+    switch (guard) {
+    case FOLD_GUARD_UNARY_OP:
+        return st_is_unary_op(sf, &tok[1]);
+    case FOLD_GUARD_ARITHMETIC_OP:
+        return st_is_arithmetic_op(sf, &tok[1]);
+    case FOLD_GUARD_MERGE_WORDS:
+        return syntax_merge_words(sf, &tok[0], &tok[1]);
+    case FOLD_GUARD_WORD_IF:
+        val = st_value(sf, &tok[1]);
+        return (val[0] == 'I' || val[0] == 'i') &&
+               (val[1] == 'F' || val[1] == 'f');
+    case FOLD_GUARD_WORD_FUNCTION:
+        return (st_keyword_flags(sf, &tok[0]) & KEYWORD_WORD_FUNCTION) != 0;
+    case FOLD_GUARD_WORD_IN:
+        return (st_keyword_flags(sf, &tok[0]) & KEYWORD_WORD_IN) != 0;
+    case FOLD_GUARD_WORD_LIKE:
+        return (st_keyword_flags(sf, &tok[0]) & KEYWORD_WORD_LIKE) != 0;
+    case FOLD_GUARD_WORD_USER:
+        return (st_keyword_flags(sf, &tok[0]) & KEYWORD_WORD_USER) != 0;
+    case FOLD_GUARD_HAS_UNDERSCORE:
+        return strchr(st_value(sf, &tok[1]), '_') != NULL;
+    case FOLD_GUARD_IS_EMPTY:
+        return tok[1].len == 0;
+    case FOLD_GUARD_IS_CAST:
+        return streq(st_value(sf, &tok[1]), "::");
+    default:
+        return FALSE;
+    }
+}
 
-    /* LEFT is a count of how many tokens that are already
-       folded or processed (i.e. part of the fingerprint) */
-    size_t left = 0;
+/*
+ * Runs the first rule for ntokens (2 or 3) tokens that matches
+ * tokenvec[left], [left + 1] and [left + 2].  The generated table
+ * gives the rules that could match the first two types, in order.
+ *
+ * Returns what the folder does next, FOLD_NEXT_STOP if no rule matched.
+ */
+static int fold_rules(struct libinjection_sqli_state *sf, int ntokens,
+                      size_t *pos, size_t *left) {
+    stoken_t *tok = &sf->tokenvec[*left];
+    const unsigned char *table = ntokens == 2 ? sql_fold_two : sql_fold_three;
+    const unsigned char *cand;
+    const fold_rule_t *rule;
+    unsigned int third = 0;
+
+    cand = sql_fold_cands +
+           table[sql_fold_type[(unsigned char)tok[0].type] * SQL_FOLD_TYPES +
+                 sql_fold_type[(unsigned char)tok[1].type]];
+    if (ntokens == 3) {
+        third = 1U << sql_fold_type[(unsigned char)tok[2].type];
+    }
+
+    /* most pairs of types have no rules */
+    if (*cand == 0) {
+        return FOLD_NEXT_STOP;
+    }
+    for (; *cand != 0; ++cand) {
+        rule = &sql_fold_rules[*cand];
+        if ((rule->third & third) != third ||
+            (rule->guard != FOLD_GUARD_NONE &&
+             !fold_guard(sf, tok, rule->guard))) {
+            continue;
+        }
 
-    int more = 1;
+        if (rule->set_type != CHAR_NULL) {
+            tok[rule->set_at].type = rule->set_type;
+        }
+        if (rule->copy_from != 0) {
+            st_copy(&tok[rule->copy_to], &tok[rule->copy_from]);
+        }
+        *pos -= rule->pos;
+        sf->stats_folds += rule->folds;
+        if (rule->left == FOLD_LEFT_ZERO) {
+            *left = 0;
+        } else if (rule->left == FOLD_LEFT_BACK && *left > 0) {
+            *left -= 1;
+        }
+        return rule->next;
+    }
+    return FOLD_NEXT_STOP;
+}
+
+/*
+ * Once sqli_fold has all the tokens it keeps, inputs starting with one
+ * of these are folded down to their first one or two tokens.
+ */
+static const char *const fold_five_patterns[] = {
+    "1o(1)", "1,(1)", "no(n)", "no(1)", "1),(1", "n)o(n", NULL};
+
+static int fold_five_match(const stoken_t *tokenvec, size_t count) {
+    const char *const *pattern;
+    size_t i;
+
+    for (pattern = fold_five_patterns; *pattern != NULL; ++pattern) {
+        for (i = 0; i < count && tokenvec[i].type == (*pattern)[i]; ++i) {
+        }
+        if (i == count) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static int sqli_fold(struct libinjection_sqli_state *sf) {
+    stoken_t last_comment;
+
+    /* POS is the position of where the NEXT token goes */
+    size_t pos = 0;
+
+    /* LEFT is a count of how many tokens that are already
+       folded or processed (i.e. part of the fingerprint) */
+    size_t left = 0;
+
+    int more = 1;
 
     st_clear(&last_comment);
 
@@ -1375,11 +1875,11 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
      */
     sf->current = &(sf->tokenvec[0]);
     while (more) {
-        more = libinjection_sqli_tokenize(sf);
+        more = sqli_next_token(sf);
         if (!(sf->current->type == TYPE_COMMENT ||
               sf->current->type == TYPE_LEFTPARENS ||
               sf->current->type == TYPE_SQLTYPE ||
-              st_is_unary_op(sf->current))) {
+              st_is_unary_op(sf, sf->current))) {
             break;
         }
     }
@@ -1399,28 +1899,7 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
          * some special cases for 5 tokens
          */
         if (pos >= LIBINJECTION_SQLI_MAX_TOKENS) {
-            if ((sf->tokenvec[0].type == TYPE_NUMBER &&
-                 (sf->tokenvec[1].type == TYPE_OPERATOR ||
-                  sf->tokenvec[1].type == TYPE_COMMA) &&
-                 sf->tokenvec[2].type == TYPE_LEFTPARENS &&
-                 sf->tokenvec[3].type == TYPE_NUMBER &&
-                 sf->tokenvec[4].type == TYPE_RIGHTPARENS) ||
-                (sf->tokenvec[0].type == TYPE_BAREWORD &&
-                 sf->tokenvec[1].type == TYPE_OPERATOR &&
-                 sf->tokenvec[2].type == TYPE_LEFTPARENS &&
-                 (sf->tokenvec[3].type == TYPE_BAREWORD ||
-                  sf->tokenvec[3].type == TYPE_NUMBER) &&
-                 sf->tokenvec[4].type == TYPE_RIGHTPARENS) ||
-                (sf->tokenvec[0].type == TYPE_NUMBER &&
-                 sf->tokenvec[1].type == TYPE_RIGHTPARENS &&
-                 sf->tokenvec[2].type == TYPE_COMMA &&
-                 sf->tokenvec[3].type == TYPE_LEFTPARENS &&
-                 sf->tokenvec[4].type == TYPE_NUMBER) ||
-                (sf->tokenvec[0].type == TYPE_BAREWORD &&
-                 sf->tokenvec[1].type == TYPE_RIGHTPARENS &&
-                 sf->tokenvec[2].type == TYPE_OPERATOR &&
-                 sf->tokenvec[3].type == TYPE_LEFTPARENS &&
-                 sf->tokenvec[4].type == TYPE_BAREWORD)) {
+            if (fold_five_match(sf->tokenvec, LIBINJECTION_SQLI_MAX_TOKENS)) {
                 if (pos > LIBINJECTION_SQLI_MAX_TOKENS) {
                     st_copy(&(sf->tokenvec[1]),
                             &(sf->tokenvec[LIBINJECTION_SQLI_MAX_TOKENS]));
@@ -1442,7 +1921,7 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
         while (more && pos <= LIBINJECTION_SQLI_MAX_TOKENS &&
                (pos - left) < 2) {
             sf->current = &(sf->tokenvec[pos]);
-            more = libinjection_sqli_tokenize(sf);
+            more = sqli_next_token(sf);
             if (more) {
                 if (sf->current->type == TYPE_COMMENT) {
                     st_copy(&last_comment, sf->current);
@@ -1459,234 +1938,16 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
             continue;
         }
 
-        /* FOLD: "ss" -> "s"
-         * "foo" "bar" is valid SQL
-         * just ignore second string
+        /*
+         * two token folding, the rules are in fold_rules.txt
          */
-        if (sf->tokenvec[left].type == TYPE_STRING &&
-            sf->tokenvec[left + 1].type == TYPE_STRING) {
-            pos -= 1;
-            sf->stats_folds += 1;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_SEMICOLON &&
-                   sf->tokenvec[left + 1].type == TYPE_SEMICOLON) {
-            /* not sure how various engines handle
-             * 'select 1;;drop table foo' or
-             * 'select 1; /x foo x/; drop table foo'
-             * to prevent surprises, just fold away repeated semicolons
-             */
-            pos -= 1;
-            sf->stats_folds += 1;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_OPERATOR ||
-                    sf->tokenvec[left].type == TYPE_LOGIC_OPERATOR) &&
-                   (st_is_unary_op(&sf->tokenvec[left + 1]) ||
-                    sf->tokenvec[left + 1].type == TYPE_SQLTYPE)) {
-            pos -= 1;
-            sf->stats_folds += 1;
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_LEFTPARENS &&
-                   st_is_unary_op(&sf->tokenvec[left + 1])) {
-            pos -= 1;
-            sf->stats_folds += 1;
-            if (left > 0) {
-                left -= 1;
-            }
-            continue;
-        } else if (syntax_merge_words(sf, &sf->tokenvec[left],
-                                      &sf->tokenvec[left + 1])) {
-            pos -= 1;
-            sf->stats_folds += 1;
-            if (left > 0) {
-                left -= 1;
-            }
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_SEMICOLON &&
-                   sf->tokenvec[left + 1].type == TYPE_FUNCTION &&
-                   (sf->tokenvec[left + 1].val[0] == 'I' ||
-                    sf->tokenvec[left + 1].val[0] == 'i') &&
-                   (sf->tokenvec[left + 1].val[1] == 'F' ||
-                    sf->tokenvec[left + 1].val[1] == 'f')) {
-            /* IF is normally a function, except in Transact-SQL where it can be
-             * used as a standalone control flow operator, e.g. ; IF 1=1 ... if
-             * found after a semicolon, convert from 'f' type to 'T' type
-             */
-            sf->tokenvec[left + 1].type = TYPE_TSQL;
-            /* left += 2; */
-            continue; /* reparse everything, but we probably can advance left,
-                       * and pos
-                       */
-        } else if ((sf->tokenvec[left].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left].type == TYPE_VARIABLE) &&
-                   sf->tokenvec[left + 1].type == TYPE_LEFTPARENS &&
-                   (
-                       /* TSQL functions but common enough to be column names */
-                       cstrcasecmp("USER_ID", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("USER_NAME", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-
-                       /* Function in MYSQL */
-                       cstrcasecmp("DATABASE", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("PASSWORD", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("USER", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-
-                       /* Mysql words that act as a variable and are a function
-                        */
-
-                       /* TSQL current_users is fake-variable */
-                       /* http://msdn.microsoft.com/en-us/library/ms176050.aspx
-                        */
-                       cstrcasecmp("CURRENT_USER", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("CURRENT_DATE", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("CURRENT_TIME", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("CURRENT_TIMESTAMP", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("LOCALTIME", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0 ||
-                       cstrcasecmp("LOCALTIMESTAMP", sf->tokenvec[left].val,
-                                   sf->tokenvec[left].len) == 0)) {
-
-            /* pos is the same
-             * other conversions need to go here... for instance
-             * password CAN be a function, coalesce CAN be a function
-             */
-            sf->tokenvec[left].type = TYPE_FUNCTION;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_KEYWORD &&
-                   (cstrcasecmp("IN", sf->tokenvec[left].val,
-                                sf->tokenvec[left].len) == 0 ||
-                    cstrcasecmp("NOT IN", sf->tokenvec[left].val,
-                                sf->tokenvec[left].len) == 0)) {
-
-            if (sf->tokenvec[left + 1].type == TYPE_LEFTPARENS) {
-                /* got .... IN ( ...  (or 'NOT IN')
-                 * it's an operator
-                 */
-                sf->tokenvec[left].type = TYPE_OPERATOR;
-            } else {
-                /*
-                 * it's a nothing
-                 */
-                sf->tokenvec[left].type = TYPE_BAREWORD;
-            }
-
-            /* "IN" can be used as "IN BOOLEAN MODE" for mysql
-             *  in which case merging of words can be done later
-             * other wise it acts as an equality operator __ IN (values..)
-             *
-             * here we got "IN" "(" so it's an operator.
-             * also back track to handle "NOT IN"
-             * might need to do the same with like
-             * two use cases   "foo" LIKE "BAR" (normal operator)
-             *  "foo" = LIKE(1,2)
-             */
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_OPERATOR) &&
-                   (cstrcasecmp("LIKE", sf->tokenvec[left].val,
-                                sf->tokenvec[left].len) == 0 ||
-                    cstrcasecmp("NOT LIKE", sf->tokenvec[left].val,
-                                sf->tokenvec[left].len) == 0)) {
-            if (sf->tokenvec[left + 1].type == TYPE_LEFTPARENS) {
-                /* SELECT LIKE(...
-                 * it's a function
-                 */
-                sf->tokenvec[left].type = TYPE_FUNCTION;
-            }
-        } else if (sf->tokenvec[left].type == TYPE_SQLTYPE &&
-                   (sf->tokenvec[left + 1].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left + 1].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 1].type == TYPE_SQLTYPE ||
-                    sf->tokenvec[left + 1].type == TYPE_LEFTPARENS ||
-                    sf->tokenvec[left + 1].type == TYPE_FUNCTION ||
-                    sf->tokenvec[left + 1].type == TYPE_VARIABLE ||
-                    sf->tokenvec[left + 1].type == TYPE_STRING)) {
-            st_copy(&sf->tokenvec[left], &sf->tokenvec[left + 1]);
-            pos -= 1;
-            sf->stats_folds += 1;
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_COLLATE &&
-                   sf->tokenvec[left + 1].type == TYPE_BAREWORD) {
-            /*
-             * there are too many collation types.. so if the bareword has a "_"
-             * then it's TYPE_SQLTYPE
-             */
-            if (strchr(sf->tokenvec[left + 1].val, '_') != NULL) {
-                sf->tokenvec[left + 1].type = TYPE_SQLTYPE;
-                left = 0;
-            }
-        } else if (sf->tokenvec[left].type == TYPE_BACKSLASH) {
-            if (st_is_arithmetic_op(&(sf->tokenvec[left + 1]))) {
-                /* very weird case in TSQL where '\%1' is parsed as '0 % 1', etc
-                 */
-                sf->tokenvec[left].type = TYPE_NUMBER;
-            } else {
-                /* just ignore it.. Again T-SQL seems to parse \1 as "1" */
-                st_copy(&sf->tokenvec[left], &sf->tokenvec[left + 1]);
-                pos -= 1;
-                sf->stats_folds += 1;
-            }
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_LEFTPARENS &&
-                   sf->tokenvec[left + 1].type == TYPE_LEFTPARENS) {
-            pos -= 1;
-            left = 0;
-            sf->stats_folds += 1;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_RIGHTPARENS &&
-                   sf->tokenvec[left + 1].type == TYPE_RIGHTPARENS) {
-            pos -= 1;
-            left = 0;
-            sf->stats_folds += 1;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_LEFTBRACE &&
-                   sf->tokenvec[left + 1].type == TYPE_BAREWORD) {
-
-            /*
-             * MySQL Degenerate case --
-             *
-             *   select { ``.``.id };  -- valid !!!
-             *   select { ``.``.``.id };  -- invalid
-             *   select ``.``.id; -- invalid
-             *   select { ``.id }; -- invalid
-             *
-             * so it appears {``.``.id} is a magic case
-             * I suspect this is "current database, current table, field id"
-             *
-             * The folding code can't look at more than 3 tokens, and
-             * I don't want to make two passes.
-             *
-             * Since "{ ``" so rare, we are just going to blacklist it.
-             *
-             * Highly likely this will need revisiting!
-             *
-             * CREDIT @rsalgado 2013-11-25
-             */
-            if (sf->tokenvec[left + 1].len == 0) {
-                sf->tokenvec[left + 1].type = TYPE_EVIL;
-                return (int)(left + 2);
-            }
-            /* weird ODBC / MYSQL  {foo expr} --> expr
-             * but for this rule we just strip away the "{ foo" part
-             */
-            left = 0;
-            pos -= 2;
-            sf->stats_folds += 2;
-            continue;
-        } else if (sf->tokenvec[left + 1].type == TYPE_RIGHTBRACE) {
-            pos -= 1;
-            left = 0;
-            sf->stats_folds += 1;
+        switch (fold_rules(sf, 2, &pos, &left)) {
+        case FOLD_NEXT_RESTART:
             continue;
+        case FOLD_NEXT_EVIL:
+            return (int)(left + 2);
+        default:
+            break;
         }
 
         /* all cases of handing 2 tokens is done
@@ -1695,7 +1956,7 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
         FOLD_DEBUG;
         while (more && pos <= LIBINJECTION_SQLI_MAX_TOKENS && pos - left < 3) {
             sf->current = &(sf->tokenvec[pos]);
-            more = libinjection_sqli_tokenize(sf);
+            more = sqli_next_token(sf);
             if (more) {
                 if (sf->current->type == TYPE_COMMENT) {
                     st_copy(&last_comment, sf->current);
@@ -1715,153 +1976,8 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
         /*
          * now look for three token folding
          */
-        if (sf->tokenvec[left].type == TYPE_NUMBER &&
-            sf->tokenvec[left + 1].type == TYPE_OPERATOR &&
-            sf->tokenvec[left + 2].type == TYPE_NUMBER) {
-            pos -= 2;
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_OPERATOR &&
-                   sf->tokenvec[left + 1].type != TYPE_LEFTPARENS &&
-                   sf->tokenvec[left + 2].type == TYPE_OPERATOR) {
-            left = 0;
-            pos -= 2;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_LOGIC_OPERATOR &&
-                   sf->tokenvec[left + 2].type == TYPE_LOGIC_OPERATOR) {
-            pos -= 2;
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_VARIABLE &&
-                   sf->tokenvec[left + 1].type == TYPE_OPERATOR &&
-                   (sf->tokenvec[left + 2].type == TYPE_VARIABLE ||
-                    sf->tokenvec[left + 2].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 2].type == TYPE_BAREWORD)) {
-            pos -= 2;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left].type == TYPE_NUMBER) &&
-                   sf->tokenvec[left + 1].type == TYPE_OPERATOR &&
-                   (sf->tokenvec[left + 2].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 2].type == TYPE_BAREWORD)) {
-            pos -= 2;
-            left = 0;
+        if (fold_rules(sf, 3, &pos, &left) == FOLD_NEXT_RESTART) {
             continue;
-        } else if ((sf->tokenvec[left].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left].type == TYPE_NUMBER ||
-                    sf->tokenvec[left].type == TYPE_VARIABLE ||
-                    sf->tokenvec[left].type == TYPE_STRING) &&
-                   sf->tokenvec[left + 1].type == TYPE_OPERATOR &&
-                   streq(sf->tokenvec[left + 1].val, "::") &&
-                   sf->tokenvec[left + 2].type == TYPE_SQLTYPE) {
-            pos -= 2;
-            left = 0;
-            sf->stats_folds += 2;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left].type == TYPE_NUMBER ||
-                    sf->tokenvec[left].type == TYPE_STRING ||
-                    sf->tokenvec[left].type == TYPE_VARIABLE) &&
-                   sf->tokenvec[left + 1].type == TYPE_COMMA &&
-                   (sf->tokenvec[left + 2].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 2].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left + 2].type == TYPE_STRING ||
-                    sf->tokenvec[left + 2].type == TYPE_VARIABLE)) {
-            pos -= 2;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_EXPRESSION ||
-                    sf->tokenvec[left].type == TYPE_GROUP ||
-                    sf->tokenvec[left].type == TYPE_COMMA) &&
-                   st_is_unary_op(&sf->tokenvec[left + 1]) &&
-                   sf->tokenvec[left + 2].type == TYPE_LEFTPARENS) {
-            /* got something like SELECT + (, LIMIT + (
-             * remove unary operator
-             */
-            st_copy(&sf->tokenvec[left + 1], &sf->tokenvec[left + 2]);
-            pos -= 1;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_KEYWORD ||
-                    sf->tokenvec[left].type == TYPE_EXPRESSION ||
-                    sf->tokenvec[left].type == TYPE_GROUP) &&
-                   st_is_unary_op(&sf->tokenvec[left + 1]) &&
-                   (sf->tokenvec[left + 2].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 2].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left + 2].type == TYPE_VARIABLE ||
-                    sf->tokenvec[left + 2].type == TYPE_STRING ||
-                    sf->tokenvec[left + 2].type == TYPE_FUNCTION)) {
-            /* remove unary operators
-             * select - 1
-             */
-            st_copy(&sf->tokenvec[left + 1], &sf->tokenvec[left + 2]);
-            pos -= 1;
-            left = 0;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_COMMA &&
-                   st_is_unary_op(&sf->tokenvec[left + 1]) &&
-                   (sf->tokenvec[left + 2].type == TYPE_NUMBER ||
-                    sf->tokenvec[left + 2].type == TYPE_BAREWORD ||
-                    sf->tokenvec[left + 2].type == TYPE_VARIABLE ||
-                    sf->tokenvec[left + 2].type == TYPE_STRING)) {
-            /*
-             * interesting case    turn ", -1"  ->> ",1" PLUS we need to back up
-             * one token if possible to see if more folding can be done
-             * "1,-1" --> "1"
-             */
-            st_copy(&sf->tokenvec[left + 1], &sf->tokenvec[left + 2]);
-            left = 0;
-            /* pos is >= 3 so this is safe */
-            assert(pos >= 3);
-            pos -= 3;
-            continue;
-        } else if (sf->tokenvec[left].type == TYPE_COMMA &&
-                   st_is_unary_op(&sf->tokenvec[left + 1]) &&
-                   sf->tokenvec[left + 2].type == TYPE_FUNCTION) {
-
-            /* Separate case from above since you end up with
-             * 1,-sin(1) --> 1 (1)
-             * Here, just do
-             * 1,-sin(1) --> 1,sin(1)
-             * just remove unary operator
-             */
-            st_copy(&sf->tokenvec[left + 1], &sf->tokenvec[left + 2]);
-            pos -= 1;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_BAREWORD) &&
-                   (sf->tokenvec[left + 1].type == TYPE_DOT) &&
-                   (sf->tokenvec[left + 2].type == TYPE_BAREWORD)) {
-            /* ignore the '.n'
-             * typically is this databasename.table
-             */
-            assert(pos >= 3);
-            pos -= 2;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_EXPRESSION) &&
-                   (sf->tokenvec[left + 1].type == TYPE_DOT) &&
-                   (sf->tokenvec[left + 2].type == TYPE_BAREWORD)) {
-            /* select . `foo` --> select `foo` */
-            st_copy(&sf->tokenvec[left + 1], &sf->tokenvec[left + 2]);
-            pos -= 1;
-            left = 0;
-            continue;
-        } else if ((sf->tokenvec[left].type == TYPE_FUNCTION) &&
-                   (sf->tokenvec[left + 1].type == TYPE_LEFTPARENS) &&
-                   (sf->tokenvec[left + 2].type != TYPE_RIGHTPARENS)) {
-            /*
-             * whats going on here
-             * Some SQL functions like USER() have 0 args
-             * if we get User(foo), then User is not a function
-             * This should be expanded since it eliminated a lot of false
-             * positives.
-             */
-            if (cstrcasecmp("USER", sf->tokenvec[left].val,
-                            sf->tokenvec[left].len) == 0) {
-                sf->tokenvec[left].type = TYPE_BAREWORD;
-            }
         }
 
         /* no folding -- assume left-most token is
@@ -1893,6 +2009,26 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
     return (int)left;
 }
 
+/*
+ * Callers outside the library read tokenvec[].val directly, so the
+ * public functions copy out the values of the tokens they return.
+ */
+static void sqli_token_values(struct libinjection_sqli_state *sf,
+                              size_t count) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        st_value(sf, &sf->tokenvec[i]);
+    }
+}
+
+int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
+    int tlen = sqli_fold(sf);
+
+    sqli_token_values(sf, (size_t)tlen);
+    return tlen;
+}
+
 /* secondary api: detects SQLi in a string, GIVEN a context.
  *
  * A context can be:
@@ -1903,15 +2039,14 @@ int libinjection_sqli_fold(struct libinjection_sqli_state *sf) {
  *          double quote.
  *
  */
-const char *
-libinjection_sqli_fingerprint(struct libinjection_sqli_state *sql_state,
-                              int flags) {
+static const char *
+sqli_fingerprint(struct libinjection_sqli_state *sql_state, int flags) {
     int i;
     int tlen = 0;
 
     libinjection_sqli_reset(sql_state, flags);
 
-    tlen = libinjection_sqli_fold(sql_state);
+    tlen = sqli_fold(sql_state);
 
     /* Check for magic PHP backquote comment
      * If:
@@ -1960,6 +2095,19 @@ libinjection_sqli_fingerprint(struct libinjection_sqli_state *sql_state,
         sql_state->tokenvec[1].type = CHAR_NULL;
     }
 
+    /* a custom lookup is free to look at the tokens */
+    if (sql_state->lookup != libinjection_sqli_lookup_word) {
+        sqli_token_values(sql_state, strlen(sql_state->fingerprint));
+    }
+
+    return sql_state->fingerprint;
+}
+
+const char *
+libinjection_sqli_fingerprint(struct libinjection_sqli_state *sql_state,
+                              int flags) {
+    sqli_fingerprint(sql_state, flags);
+    sqli_token_values(sql_state, strlen(sql_state->fingerprint));
     return sql_state->fingerprint;
 }
 
@@ -1975,53 +2123,26 @@ libinjection_sqli_lookup_word(struct libinjection_sqli_state *sql_state,
     if (lookup_type == LOOKUP_FINGERPRINT) {
         return libinjection_sqli_check_fingerprint(sql_state) ? 'X' : '\0';
     } else {
-        return bsearch_keyword_type(str, len, sql_keywords, sql_keywords_sz);
+        return lookup_keyword_type(str, len);
     }
 }
 
 static int
 libinjection_sqli_blacklist(struct libinjection_sqli_state *sql_state) {
-    /*
-     * use minimum of 8 bytes to make sure gcc -fstack-protector
-     * works correctly
-     */
-    char fp2[8];
-    char ch;
-    size_t i;
     size_t len = strlen(sql_state->fingerprint);
-    int patmatch;
 
     if (len < 1) {
         sql_state->reason = __LINE__;
         return FALSE;
     }
 
-    /*
-      to keep everything compatible, convert the
-      v0 fingerprint pattern to v1
-      v0: up to 5 chars, mixed case
-      v1: 1 char is '0', up to 5 more chars, upper case
-    */
-
-    fp2[0] = '0';
-    for (i = 0; i < len; ++i) {
-        ch = sql_state->fingerprint[i];
-        if (ch >= 'a' && ch <= 'z') {
-            ch -= 0x20;
-        }
-        fp2[i + 1] = ch;
-    }
-    fp2[i + 1] = '\0';
-
-    patmatch = is_keyword(fp2, len + 1) == TYPE_FINGERPRINT;
-
     /*
      * No match.
      *
      * Set sql_state->reason to current line number
      * only for debugging purposes.
      */
-    if (!patmatch) {
+    if (!is_fingerprint(sql_state->fingerprint, len)) {
         sql_state->reason = __LINE__;
         return FALSE;
     }
@@ -2032,6 +2153,157 @@ libinjection_sqli_blacklist(struct libinjection_sqli_state *sql_state) {
 /*
  * return TRUE if SQLi, false is benign
  */
+static int has_sp_password(struct libinjection_sqli_state *sql_state) {
+    struct libinjection_sqli_scan *scan = sql_state->scan;
+    const char *found;
+
+    if (scan != NULL && scan->sp_password != SCAN_UNKNOWN) {
+        return scan->sp_password < sql_state->slen;
+    }
+    found = my_memmem(sql_state->s, sql_state->slen, "sp_password",
+                      strlen("sp_password"));
+    if (scan != NULL) {
+        scan->sp_password = offset_or_len(sql_state->s, sql_state->slen, found);
+    }
+    return found != NULL;
+}
+
+#ifndef LIBINJECTION_SQLI_REFERENCE_MATCH
+/*
+ * Is the number that starts the input followed by white space, /x or
+ * --?  Only then is "1c" SQLi.
+ *
+ * There are some odd base64-looking query string values
+ * 1234-ABCDEFEhfhihwuefi-- which evaluate to "1c"... these are not
+ * SQLi but 1234-- probably is.  The -original- string is checked since
+ * the folding step may have merged tokens, e.g. "1+FOO" is folded
+ * into "1".
+ *
+ * Note: evasion: 1*1--
+ */
+static int number_ends_plain(const struct libinjection_sqli_state *sql_state) {
+    const char ch = sql_state->s[sql_state->tokenvec[0].len];
+
+    if (ch <= 32) {
+        /* next char was whitespace,e.g. "1234 --"
+         * this isn't exactly correct.. ideally we should skip over all
+         * whitespace but this seems to be ok for now
+         */
+        return TRUE;
+    }
+    if (ch == '/' && sql_state->s[sql_state->tokenvec[0].len + 1] == '*') {
+        return TRUE;
+    }
+    if (ch == '-' && sql_state->s[sql_state->tokenvec[0].len + 1] == '-') {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*
+ * The guards of whitelist_rules.txt
+ */
+static int whitelist_guard(struct libinjection_sqli_state *sql_state,
+                           unsigned int guard) {
+    stoken_t *tokenvec = sql_state->tokenvec;
+
+    if ((guard & WHITELIST_SP_PASSWORD) && has_sp_password(sql_state)) {
+        sql_state->reason = __LINE__;
+        return TRUE;
+    }
+
+    switch (guard & ~WHITELIST_SP_PASSWORD) {
+    case WHITELIST_UNION:
+        /* it really is a number and 'union' other wise it has
+         * folding or comments */
+        sql_state->reason = __LINE__;
+        return sql_state->stats_tokens != 2;
+    case WHITELIST_PAIR:
+        if (st_value(sql_state, &tokenvec[1])[0] == '#' ||
+            (tokenvec[1].len > 2 &&
+             st_value(sql_state, &tokenvec[1])[0] == '-')) {
+            sql_state->reason = __LINE__;
+            return FALSE;
+        }
+        return TRUE;
+    case WHITELIST_BAREWORD_COMMENT:
+        if (st_value(sql_state, &tokenvec[1])[0] != '/') {
+            sql_state->reason = __LINE__;
+            return FALSE;
+        }
+        return TRUE;
+    case WHITELIST_NUMBER_COMMENT:
+        if (st_value(sql_state, &tokenvec[1])[0] == '#') {
+            sql_state->reason = __LINE__;
+            return FALSE;
+        }
+        if (st_value(sql_state, &tokenvec[1])[0] == '/') {
+            return TRUE;
+        }
+        if (sql_state->stats_tokens > 2) {
+            /* we have some folding going on, highly likely SQLi */
+            sql_state->reason = __LINE__;
+            return TRUE;
+        }
+        if (number_ends_plain(sql_state)) {
+            return TRUE;
+        }
+        sql_state->reason = __LINE__;
+        return FALSE;
+    case WHITELIST_STRING_CONCAT:
+        /* if ....foo" + "bar.... */
+        sql_state->reason = __LINE__;
+        return tokenvec[0].str_open == CHAR_NULL &&
+               tokenvec[2].str_close == CHAR_NULL &&
+               tokenvec[0].str_close == tokenvec[2].str_open;
+    case WHITELIST_SHORT_LOGIC:
+        if (sql_state->stats_tokens == 3) {
+            sql_state->reason = __LINE__;
+            return FALSE;
+        }
+        return TRUE;
+    case WHITELIST_INTO:
+        if (tokenvec[1].len < 5 ||
+            cstrcasecmp("INTO", st_chars(sql_state, &tokenvec[1]), 4)) {
+            sql_state->reason = __LINE__;
+            return FALSE;
+        }
+        return TRUE;
+    default:
+        return TRUE;
+    }
+}
+
+/*
+ * The whitelist is compiled into the fingerprint DFA: the state that
+ * accepts the fingerprint has the guard of the first rule of
+ * whitelist_rules.txt that matches it, for each way the fingerprint's
+ * letters can be cased.  The rules match types exactly, as the
+ * reference build's checks written out by hand do, and
+ * test-sqli-dfa.sh compares them.
+ */
+static int
+libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
+    const char *fp = sql_state->fingerprint;
+    const size_t len = strlen(fp);
+    const unsigned int state = fingerprint_state(fp, len);
+    unsigned int cased = 0;
+    size_t i;
+
+    if (state == FINGERPRINT_DEAD) {
+        return TRUE;
+    }
+    for (i = 0; i < len; ++i) {
+        if (fp[i] >= 'a' && fp[i] <= 'z') {
+            cased |= 1U << i;
+        }
+    }
+    return whitelist_guard(
+        sql_state,
+        sql_whitelist_guard[sql_fingerprint_guard[state] * WHITELIST_CASES +
+                            cased]);
+}
+#else
 static int
 libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
     /*
@@ -2050,8 +2322,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
          * this "feature" of SQL Server but seems to be known SQLi
          * technique
          */
-        if (my_memmem(sql_state->s, sql_state->slen, "sp_password",
-                      strlen("sp_password"))) {
+        if (has_sp_password(sql_state)) {
             sql_state->reason = __LINE__;
             return TRUE;
         }
@@ -2084,7 +2355,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
         /*
          * if 'comment' is '#' ignore.. too many FP
          */
-        if (sql_state->tokenvec[1].val[0] == '#') {
+        if (st_value(sql_state, &sql_state->tokenvec[1])[0] == '#') {
             sql_state->reason = __LINE__;
             return FALSE;
         }
@@ -2095,7 +2366,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
          */
         if (sql_state->tokenvec[0].type == TYPE_BAREWORD &&
             sql_state->tokenvec[1].type == TYPE_COMMENT &&
-            sql_state->tokenvec[1].val[0] != '/') {
+            st_value(sql_state, &sql_state->tokenvec[1])[0] != '/') {
             sql_state->reason = __LINE__;
             return FALSE;
         }
@@ -2105,7 +2376,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
          */
         if (sql_state->tokenvec[0].type == TYPE_NUMBER &&
             sql_state->tokenvec[1].type == TYPE_COMMENT &&
-            sql_state->tokenvec[1].val[0] == '/') {
+            st_value(sql_state, &sql_state->tokenvec[1])[0] == '/') {
             return TRUE;
         }
 
@@ -2158,7 +2429,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
          * so only detect if input ends with '--', e.g. 1-- but not 1-- foo
          */
         if ((sql_state->tokenvec[1].len > 2) &&
-            sql_state->tokenvec[1].val[0] == '-') {
+            st_value(sql_state, &sql_state->tokenvec[1])[0] == '-') {
             sql_state->reason = __LINE__;
             return FALSE;
         }
@@ -2209,7 +2480,8 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
             }
         } else if (sql_state->tokenvec[1].type == TYPE_KEYWORD) {
             if ((sql_state->tokenvec[1].len < 5) ||
-                cstrcasecmp("INTO", sql_state->tokenvec[1].val, 4)) {
+                cstrcasecmp("INTO",
+                            st_chars(sql_state, &sql_state->tokenvec[1]), 4)) {
                 /* if it's not "INTO OUTFILE", or "INTO DUMPFILE" (MySQL)
                  * then treat as safe
                  */
@@ -2228,6 +2500,7 @@ libinjection_sqli_not_whitelist(struct libinjection_sqli_state *sql_state) {
 
     return TRUE;
 }
+#endif
 
 /**  Main API, detects SQLi in an input.
  *
@@ -2247,35 +2520,137 @@ libinjection_sqli_get_token(struct libinjection_sqli_state *sql_state, int i) {
     if (i < 0 || i > (int)LIBINJECTION_SQLI_MAX_TOKENS) {
         return NULL;
     }
+    st_value(sql_state, &sql_state->tokenvec[i]);
     return &(sql_state->tokenvec[i]);
 }
 
-int libinjection_is_sqli(struct libinjection_sqli_state *sql_state) {
-    const char *s = sql_state->s;
+/*
+ * One detection pass: fingerprint the input with flags and ask the
+ * lookup about it.  pass is the bit it sets in sql_state->passes.
+ */
+static int sqli_pass(struct libinjection_sqli_state *sql_state, int flags,
+                     int pass) {
+    sqli_fingerprint(sql_state, flags);
+    sql_state->passes |= pass;
+    return sql_state->lookup(sql_state, LOOKUP_FINGERPRINT,
+                             sql_state->fingerprint,
+                             strlen(sql_state->fingerprint)) != 0;
+}
+
+/*
+ * This function is mostly use with SWIG
+ */
+struct libinjection_sqli_context *
+libinjection_sqli_get_context(struct libinjection_sqli_report *report,
+                              int i) {
+    if (i < 0 || i >= LIBINJECTION_SQLI_CONTEXTS) {
+        return NULL;
+    }
+    return &(report->contexts[i]);
+}
+
+/*
+ * Fingerprint the input as ANSI SQL and, if it has comments MySQL reads
+ * differently, as MySQL.  With share set, the MySQL pass reuses the
+ * ANSI tokens up to the first such comment.  If dialects leaves out
+ * one of FLAG_SQL_ANSI and FLAG_SQL_MYSQL, only the other pass runs.
+ */
+static int sqli_check_dialects(struct libinjection_sqli_state *sql_state,
+                               int quote_flag, int dialects, int share) {
+    struct libinjection_sqli_replay replay;
+    const int ansi = (dialects & FLAG_SQL_ANSI) != 0;
+    int issqli = FALSE;
+
+    replay.playing = FALSE;
+    replay.done = FALSE;
+    replay.count = 0;
+    replay.next = 0;
+    if (share && ansi && (dialects & FLAG_SQL_MYSQL)) {
+        sql_state->replay = &replay;
+    }
+
+    if (ansi) {
+        issqli = sqli_pass(sql_state, quote_flag | FLAG_SQL_ANSI,
+                           quote_flag == FLAG_QUOTE_NONE ? PASS_NONE_ANSI
+                                                         : PASS_SINGLE_ANSI);
+    }
+    if (!issqli && (dialects & FLAG_SQL_MYSQL) &&
+        (!ansi || reparse_as_mysql(sql_state))) {
+        replay.playing = TRUE;
+        issqli = sqli_pass(sql_state, quote_flag | FLAG_SQL_MYSQL,
+                           quote_flag == FLAG_QUOTE_NONE ? PASS_NONE_MYSQL
+                                                         : PASS_SINGLE_MYSQL);
+    }
+
+    sql_state->replay = NULL;
+    return issqli;
+}
+
+/*
+ * Each search is a memchr() over the input: the C library's version
+ * reads 32 or 64 bytes per step, well ahead of a single combined scan
+ * for all of these bytes.  sp_password is rarely needed and found on
+ * first use, see has_sp_password().
+ */
+static void sqli_prescan(const char *s, size_t slen,
+                         struct libinjection_sqli_scan *scan) {
+    scan->single_quote =
+        offset_or_len(s, slen, (const char *)memchr(s, CHAR_SINGLE, slen));
+    scan->double_quote =
+        offset_or_len(s, slen, (const char *)memchr(s, CHAR_DOUBLE, slen));
+    scan->hash = offset_or_len(s, slen, (const char *)memchr(s, '#', slen));
+    scan->dash_dash = offset_or_len(s, slen, find_dash_dash(s, slen));
+    scan->sp_password = SCAN_UNKNOWN;
+}
+
+injection_result_t
+libinjection_sqli_ex(struct libinjection_sqli_state *sql_state, int flags) {
+    struct libinjection_sqli_scan scan;
     size_t slen = sql_state->slen;
+    int quotes = flags & (FLAG_QUOTE_NONE | FLAG_QUOTE_SINGLE |
+                          FLAG_QUOTE_DOUBLE);
+    int dialects = flags & (FLAG_SQL_ANSI | FLAG_SQL_MYSQL);
+    int share;
+    int single;
+    int dbl;
+    int issqli = FALSE;
+
+    sql_state->passes = 0;
 
     /*
      * no input? not SQLi
      */
     if (slen == 0) {
-        return FALSE;
+        return LIBINJECTION_RESULT_FALSE;
+    }
+
+    if (quotes == 0) {
+        quotes = FLAG_QUOTE_NONE | FLAG_QUOTE_SINGLE | FLAG_QUOTE_DOUBLE;
     }
+    if (dialects == 0) {
+        dialects = FLAG_SQL_ANSI | FLAG_SQL_MYSQL;
+    }
+
+    sqli_prescan(sql_state->s, slen, &scan);
+    sql_state->scan = &scan;
+
+    /*
+     * Sharing tokens between dialects only pays off if there can be
+     * a MySQL pass.  A custom lookup sees every word of both passes,
+     * as before.
+     */
+    share = sql_state->lookup == libinjection_sqli_lookup_word &&
+            (scan.hash < slen || scan.dash_dash < slen);
+
+    single = (quotes & FLAG_QUOTE_SINGLE) && scan.single_quote < slen;
+    dbl = (quotes & FLAG_QUOTE_DOUBLE) && scan.double_quote < slen;
 
     /*
      * test input "as-is"
      */
-    libinjection_sqli_fingerprint(sql_state, FLAG_QUOTE_NONE | FLAG_SQL_ANSI);
-    if (sql_state->lookup(sql_state, LOOKUP_FINGERPRINT, sql_state->fingerprint,
-                          strlen(sql_state->fingerprint))) {
-        return TRUE;
-    } else if (reparse_as_mysql(sql_state)) {
-        libinjection_sqli_fingerprint(sql_state,
-                                      FLAG_QUOTE_NONE | FLAG_SQL_MYSQL);
-        if (sql_state->lookup(sql_state, LOOKUP_FINGERPRINT,
-                              sql_state->fingerprint,
-                              strlen(sql_state->fingerprint))) {
-            return TRUE;
-        }
+    if (quotes & FLAG_QUOTE_NONE) {
+        issqli =
+            sqli_check_dialects(sql_state, FLAG_QUOTE_NONE, dialects, share);
     }
 
     /*
@@ -2287,41 +2662,191 @@ int libinjection_is_sqli(struct libinjection_sqli_state *sql_state) {
      *   is_string_sqli(sql_state, "'" + s, slen+1, NULL, fn, arg)
      *
      */
-    if (memchr(s, CHAR_SINGLE, slen)) {
-        libinjection_sqli_fingerprint(sql_state,
-                                      FLAG_QUOTE_SINGLE | FLAG_SQL_ANSI);
-        if (sql_state->lookup(sql_state, LOOKUP_FINGERPRINT,
-                              sql_state->fingerprint,
-                              strlen(sql_state->fingerprint))) {
-            return TRUE;
-        } else if (reparse_as_mysql(sql_state)) {
-            libinjection_sqli_fingerprint(sql_state,
-                                          FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL);
-            if (sql_state->lookup(sql_state, LOOKUP_FINGERPRINT,
-                                  sql_state->fingerprint,
-                                  strlen(sql_state->fingerprint))) {
-                return TRUE;
-            }
-        }
+    if (!issqli && single) {
+        issqli = sqli_check_dialects(sql_state, FLAG_QUOTE_SINGLE, dialects,
+                                     share);
     }
 
     /*
-     * same as above but with a double-quote "
+     * same as above but with a double-quote ".  Only MySQL reads
+     * "..." as a string, so this pass ignores the dialects.
      */
-    if (memchr(s, CHAR_DOUBLE, slen)) {
-        libinjection_sqli_fingerprint(sql_state,
-                                      FLAG_QUOTE_DOUBLE | FLAG_SQL_MYSQL);
-        if (sql_state->lookup(sql_state, LOOKUP_FINGERPRINT,
-                              sql_state->fingerprint,
-                              strlen(sql_state->fingerprint))) {
-            return TRUE;
+    if (!issqli && dbl) {
+        issqli = sqli_pass(sql_state, FLAG_QUOTE_DOUBLE | FLAG_SQL_MYSQL,
+                           PASS_DOUBLE_MYSQL);
+    }
+
+    sql_state->scan = NULL;
+    sqli_token_values(sql_state, strlen(sql_state->fingerprint));
+
+    /*
+     * FALSE: Hurray, input is not SQLi
+     */
+    return issqli ? LIBINJECTION_RESULT_TRUE : LIBINJECTION_RESULT_FALSE;
+}
+
+/*
+ * The shapes are ASCII only: '0' - '9', and '_' with the letters,
+ * which are found case-insensitively by setting bit 0x20.
+ */
+#define SHAPE_IS_DIGIT(ch) ((unsigned char)((ch) - '0') <= 9)
+#define SHAPE_IS_LETTER(ch) ((unsigned char)(((ch) | 0x20) - 'a') <= 25)
+
+#ifdef LIBINJECTION_SHAPE_STATS
+static struct libinjection_shape_stats sqli_shape_stats;
+#endif
+
+void libinjection_sqli_shape_stats(struct libinjection_shape_stats *stats) {
+#ifdef LIBINJECTION_SHAPE_STATS
+    stats->calls = SHAPE_STATS_READ(sqli_shape_stats.calls);
+    stats->benign = SHAPE_STATS_READ(sqli_shape_stats.benign);
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/*
+ * An input that is all ASCII digits, or an ASCII letter followed by
+ * letters, digits and '_', is one token in every pass: a number or a
+ * word in the plain passes and a string in the quoted ones, as it
+ * has no quote, comment, operator or space to end it.  No fingerprint
+ * is a single token but 'X', which a word can't be, so such an input
+ * is never SQLi.  test_equivalence.c checks this for every token type.
+ * Having no quote or comment, it only gets the plain ANSI pass.
+ *
+ * This is the rule of libinjection_sqli_lanes_benign, one input at a
+ * time.
+ */
+static int sqli_benign_shape(const char *s, size_t len) {
+    size_t i;
+
+    if (len == 0) {
+        return FALSE;
+    }
+    if (SHAPE_IS_DIGIT(s[0])) {
+        for (i = 1; i < len; ++i) {
+            if (!SHAPE_IS_DIGIT(s[i])) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+    if (!SHAPE_IS_LETTER(s[0])) {
+        return FALSE;
+    }
+    for (i = 1; i < len; ++i) {
+        if (!SHAPE_IS_DIGIT(s[i]) && !SHAPE_IS_LETTER(s[i]) && s[i] != '_') {
+            return FALSE;
         }
     }
+    return TRUE;
+}
+
+injection_result_t
+libinjection_is_sqli(struct libinjection_sqli_state *sql_state) {
+#ifdef LIBINJECTION_SHAPE_STATS
+    SHAPE_STATS_ADD(sqli_shape_stats.calls);
+#endif
 
     /*
-     * Hurray, input is not SQLi
+     * The shape says nothing about the fingerprints of a custom lookup.
+     * The one token is still fingerprinted, as callers read it after a
+     * FALSE result, but not looked up and the input isn't scanned.
      */
-    return FALSE;
+    if (sql_state->lookup == libinjection_sqli_lookup_word &&
+        sqli_benign_shape(sql_state->s, sql_state->slen)) {
+#ifdef LIBINJECTION_SHAPE_STATS
+        SHAPE_STATS_ADD(sqli_shape_stats.benign);
+#endif
+        sqli_fingerprint(sql_state, FLAG_QUOTE_NONE | FLAG_SQL_ANSI);
+        sqli_token_values(sql_state, strlen(sql_state->fingerprint));
+        sql_state->passes = PASS_NONE_ANSI;
+        sql_state->reason = __LINE__;
+        return LIBINJECTION_RESULT_FALSE;
+    }
+    return libinjection_sqli_ex(sql_state, FLAG_NONE);
+}
+
+/*
+ * The flags of each context in a libinjection_sqli_report, in the
+ * order of enum sqli_passes
+ */
+static const int sqli_report_flags[LIBINJECTION_SQLI_CONTEXTS] = {
+    FLAG_QUOTE_NONE | FLAG_SQL_ANSI, FLAG_QUOTE_NONE | FLAG_SQL_MYSQL,
+    FLAG_QUOTE_SINGLE | FLAG_SQL_ANSI, FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL,
+    FLAG_QUOTE_DOUBLE | FLAG_SQL_MYSQL};
+
+static int sqli_report_pass(struct libinjection_sqli_state *sql_state,
+                            struct libinjection_sqli_report *report, int i) {
+    struct libinjection_sqli_context *context = &report->contexts[i];
+
+    context->issqli = sqli_pass(sql_state, context->flags, 1 << i);
+    context->reason = sql_state->reason;
+    memcpy(context->fingerprint, sql_state->fingerprint,
+           sizeof(context->fingerprint));
+    return context->issqli;
+}
+
+/*
+ * The ANSI pass at i and the MySQL pass after it, sharing tokens as
+ * in sqli_check_dialects.  Returns what libinjection_is_sqli would
+ * have made of this quote context.
+ */
+static int sqli_report_dialects(struct libinjection_sqli_state *sql_state,
+                                struct libinjection_sqli_report *report,
+                                int i) {
+    struct libinjection_sqli_replay replay;
+    int ansi;
+    int mysql;
+    int reparse;
+
+    replay.playing = FALSE;
+    replay.done = FALSE;
+    replay.count = 0;
+    replay.next = 0;
+    if (sql_state->lookup == libinjection_sqli_lookup_word) {
+        sql_state->replay = &replay;
+    }
+
+    ansi = sqli_report_pass(sql_state, report, i);
+    reparse = reparse_as_mysql(sql_state);
+    replay.playing = TRUE;
+    mysql = sqli_report_pass(sql_state, report, i + 1);
+
+    sql_state->replay = NULL;
+    return ansi || (reparse && mysql);
+}
+
+injection_result_t
+libinjection_is_sqli_report(struct libinjection_sqli_state *sql_state,
+                            struct libinjection_sqli_report *report) {
+    struct libinjection_sqli_scan scan;
+    size_t slen = sql_state->slen;
+    int issqli;
+    int i;
+
+    memset(report, 0, sizeof(struct libinjection_sqli_report));
+    for (i = 0; i < LIBINJECTION_SQLI_CONTEXTS; ++i) {
+        report->contexts[i].flags = sqli_report_flags[i];
+    }
+    sql_state->passes = 0;
+
+    sqli_prescan(sql_state->s, slen, &scan);
+    sql_state->scan = &scan;
+
+    issqli = sqli_report_dialects(sql_state, report, 0);
+    if (sqli_report_dialects(sql_state, report, 2) &&
+        scan.single_quote < slen) {
+        issqli = TRUE;
+    }
+    if (sqli_report_pass(sql_state, report, 4) && scan.double_quote < slen) {
+        issqli = TRUE;
+    }
+
+    sql_state->scan = NULL;
+    sqli_token_values(sql_state, strlen(sql_state->fingerprint));
+
+    return issqli ? LIBINJECTION_RESULT_TRUE : LIBINJECTION_RESULT_FALSE;
 }
 
 injection_result_t libinjection_sqli(const char *s, size_t slen,
@@ -2338,3 +2863,184 @@ injection_result_t libinjection_sqli(const char *s, size_t slen,
     }
     return issqli;
 }
+
+size_t libinjection_sqli_lanes_pack(struct libinjection_sqli_lanes *lanes,
+                                    const char **ptrs, const size_t *lens,
+                                    size_t n) {
+    size_t count = 0;
+    size_t width = 0;
+    size_t lane;
+    size_t i;
+
+    while (count < n && count < LIBINJECTION_SQLI_LANES &&
+           lens[count] <= LIBINJECTION_SQLI_LANE_BYTES) {
+        if (lens[count] > width) {
+            width = lens[count];
+        }
+        count += 1;
+    }
+
+    /* row 0 is read even if every input is empty */
+    memset(lanes->bytes, '0',
+           (width > 0 ? width : 1) * LIBINJECTION_SQLI_LANES);
+    for (lane = 0; lane < count; ++lane) {
+        for (i = 0; i < lens[lane]; ++i) {
+            lanes->bytes[i][lane] = (unsigned char)ptrs[lane][i];
+        }
+        lanes->lens[lane] = lens[lane];
+    }
+    lanes->count = count;
+    lanes->width = width;
+    return count;
+}
+
+unsigned int
+libinjection_sqli_lanes_benign(const struct libinjection_sqli_lanes *lanes) {
+    unsigned int nonempty = 0;
+    unsigned int digits;
+    unsigned int words;
+    size_t lane;
+    size_t i;
+#if defined(LIBINJECTION_CHARCLASS_AVX2) ||                                   \
+    defined(LIBINJECTION_CHARCLASS_SSE2)
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i digit_span = _mm_set1_epi8(9);
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i a = _mm_set1_epi8('a');
+    const __m128i letter_span = _mm_set1_epi8(25);
+    const __m128i underscore = _mm_set1_epi8('_');
+    __m128i all_digits = _mm_set1_epi8(-1);
+    __m128i all_words;
+    __m128i x;
+    __m128i d;
+    __m128i l;
+
+    for (lane = 0; lane < lanes->count; ++lane) {
+        if (lanes->lens[lane] != 0) {
+            nonempty |= 1U << lane;
+        }
+    }
+
+    /* lo <= x <= hi  is  (x - lo) <= (hi - lo) unsigned */
+    x = _mm_loadu_si128((const __m128i *)(const void *)lanes->bytes[0]);
+    l = _mm_sub_epi8(_mm_or_si128(x, lower), a);
+    all_words = _mm_cmpeq_epi8(_mm_min_epu8(l, letter_span), l);
+    for (i = 0; i < lanes->width; ++i) {
+        x = _mm_loadu_si128((const __m128i *)(const void *)lanes->bytes[i]);
+        d = _mm_sub_epi8(x, zero);
+        d = _mm_cmpeq_epi8(_mm_min_epu8(d, digit_span), d);
+        l = _mm_sub_epi8(_mm_or_si128(x, lower), a);
+        l = _mm_cmpeq_epi8(_mm_min_epu8(l, letter_span), l);
+        all_digits = _mm_and_si128(all_digits, d);
+        all_words = _mm_and_si128(
+            all_words,
+            _mm_or_si128(_mm_or_si128(d, l), _mm_cmpeq_epi8(x, underscore)));
+        /* most lanes that aren't benign find out in the first bytes */
+        if (((unsigned int)_mm_movemask_epi8(
+                 _mm_or_si128(all_digits, all_words)) &
+             nonempty) == 0) {
+            return 0;
+        }
+    }
+    digits = (unsigned int)_mm_movemask_epi8(all_digits);
+    words = (unsigned int)_mm_movemask_epi8(all_words);
+#else
+    unsigned char ch;
+
+    for (lane = 0; lane < lanes->count; ++lane) {
+        if (lanes->lens[lane] != 0) {
+            nonempty |= 1U << lane;
+        }
+    }
+    digits = 0;
+    words = 0;
+    for (lane = 0; lane < LIBINJECTION_SQLI_LANES; ++lane) {
+        digits |= 1U << lane;
+        if (SHAPE_IS_LETTER(lanes->bytes[0][lane])) {
+            words |= 1U << lane;
+        }
+    }
+    for (i = 0; i < lanes->width; ++i) {
+        for (lane = 0; lane < LIBINJECTION_SQLI_LANES; ++lane) {
+            ch = lanes->bytes[i][lane];
+            if (!SHAPE_IS_DIGIT(ch)) {
+                digits &= ~(1U << lane);
+                if (!SHAPE_IS_LETTER(ch) && ch != '_') {
+                    words &= ~(1U << lane);
+                }
+            }
+        }
+    }
+#endif
+
+    return (digits | words) & nonempty;
+}
+
+size_t libinjection_sqli_batch(const char **ptrs, const size_t *lens,
+                               size_t n, injection_result_t *results,
+                               char *fingerprints) {
+    struct libinjection_sqli_state state;
+    struct libinjection_sqli_lanes lanes;
+    unsigned int benign;
+    size_t found = 0;
+    size_t count;
+    size_t lane;
+    size_t i;
+
+    if (n == 0) {
+        return 0;
+    }
+
+    /*
+     * One state for the whole batch: each pass resets what it reads
+     * (see libinjection_sqli_reset), so only the input changes
+     */
+    libinjection_sqli_init(&state, ptrs[0], lens[0], 0);
+    i = 0;
+    while (i < n) {
+        /*
+         * Short inputs are checked LIBINJECTION_SQLI_LANES at a time
+         * for a shape that can't be SQLi.  The rest, and long inputs,
+         * go through libinjection_is_sqli.  Packing is skipped when
+         * the next input can't be benign by its first byte.
+         */
+        count = 0;
+        if (lens[i] > 0 && lens[i] <= LIBINJECTION_SQLI_LANE_BYTES &&
+            (SHAPE_IS_DIGIT(ptrs[i][0]) || SHAPE_IS_LETTER(ptrs[i][0]))) {
+            count = libinjection_sqli_lanes_pack(&lanes, ptrs + i,
+                                                 lens + i, n - i);
+        }
+        benign = count > 0 ? libinjection_sqli_lanes_benign(&lanes) : 0;
+        if (count == 0) {
+            count = 1;
+        }
+        for (lane = 0; lane < count; ++lane, ++i) {
+            if (benign & (1U << lane)) {
+                results[i] = LIBINJECTION_RESULT_FALSE;
+            } else {
+                if (i + 1 < n) {
+                    PREFETCH(ptrs[i + 1]);
+                }
+                state.s = ptrs[i];
+                state.slen = lens[i];
+                results[i] = libinjection_is_sqli(&state)
+                                 ? LIBINJECTION_RESULT_TRUE
+                                 : LIBINJECTION_RESULT_FALSE;
+            }
+            if (results[i] == LIBINJECTION_RESULT_TRUE) {
+                found += 1;
+            }
+            if (fingerprints == NULL) {
+                continue;
+            }
+            if (results[i] == LIBINJECTION_RESULT_TRUE) {
+                memcpy(fingerprints + i * LIBINJECTION_SQLI_FINGERPRINT_SIZE,
+                       state.fingerprint, LIBINJECTION_SQLI_FINGERPRINT_SIZE);
+            } else {
+                memset(fingerprints + i * LIBINJECTION_SQLI_FINGERPRINT_SIZE,
+                       0, LIBINJECTION_SQLI_FINGERPRINT_SIZE);
+            }
+        }
+    }
+    return found;
+}
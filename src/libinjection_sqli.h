@@ -30,6 +30,51 @@ enum sqli_flags {
     FLAG_SQL_MYSQL = 16    /* 1 << 4 */
 };
 
+/*
+ * The detection passes libinjection_is_sqli and libinjection_sqli_ex
+ * can run, one per context.  A double quoted string is only a string
+ * in MySQL, so there is no ANSI pass for it.
+ */
+enum sqli_passes {
+    PASS_NONE_ANSI = 1,    /* 1 << 0 */
+    PASS_NONE_MYSQL = 2,   /* 1 << 1 */
+    PASS_SINGLE_ANSI = 4,  /* 1 << 2 */
+    PASS_SINGLE_MYSQL = 8, /* 1 << 3 */
+    PASS_DOUBLE_MYSQL = 16 /* 1 << 4 */
+};
+
+/*
+ * What libinjection_is_sqli_report found in one context
+ */
+struct libinjection_sqli_context {
+    int flags; /* FLAG_QUOTE_* | FLAG_SQL_* */
+    int issqli;
+    int reason;
+    char fingerprint[8];
+};
+
+/*
+ * A context for each bit of enum sqli_passes, in that order
+ */
+#define LIBINJECTION_SQLI_CONTEXTS 5
+struct libinjection_sqli_report {
+    struct libinjection_sqli_context contexts[LIBINJECTION_SQLI_CONTEXTS];
+};
+
+/*
+ * Up to LIBINJECTION_SQLI_LANES short inputs side by side, for
+ * checking them all at once with SIMD.  bytes[i][lane] is byte i of
+ * the input in that lane, '0' past its end.
+ */
+#define LIBINJECTION_SQLI_LANES 16
+#define LIBINJECTION_SQLI_LANE_BYTES 32
+struct libinjection_sqli_lanes {
+    unsigned char bytes[LIBINJECTION_SQLI_LANE_BYTES][LIBINJECTION_SQLI_LANES];
+    size_t lens[LIBINJECTION_SQLI_LANES];
+    size_t count; /* lanes in use */
+    size_t width; /* longest input */
+};
+
 enum lookup_type {
     LOOKUP_WORD = 1,
     LOOKUP_TYPE = 2,
@@ -57,6 +102,17 @@ struct libinjection_sqli_token { // cppcheck-suppress syntaxError
     char type;
     char str_open;
     char str_close;
+
+    /*
+     * internal: which keyword the value is, 0 until it is looked up
+     */
+    unsigned short keyword;
+
+    /*
+     * null terminated copy of the token, at most 31 chars.
+     * Filled in for the tokens the public functions hand back;
+     * while tokenizing, a token only records pos and len.
+     */
     char val[32];
 };
 
@@ -67,6 +123,8 @@ typedef struct libinjection_sqli_token stoken_t;
  *  returns '\0' for no match, else a char
  */
 struct libinjection_sqli_state;
+struct libinjection_sqli_replay;
+struct libinjection_sqli_scan;
 typedef char (*ptr_lookup_fn)(struct libinjection_sqli_state *, int lookuptype,
                               const char *word, size_t len);
 
@@ -145,9 +203,9 @@ struct libinjection_sqli_state {
      * ANSI SQL treats these are comments, MySQL treats this as
      * two unary operators '-' '-'
      *
-     * If you are parsing result returns FALSE and
-     * stats_comment_dd > 0, you should reparse with
-     * COMMENT_MYSQL
+     * If libinjection_sqli_fingerprint with FLAG_SQL_ANSI is not
+     * SQLi and stats_comment_ddx > 0, you should reparse with
+     * FLAG_SQL_MYSQL.  libinjection_is_sqli does this itself.
      *
      */
     int stats_comment_ddx;
@@ -171,6 +229,26 @@ struct libinjection_sqli_state {
      * total tokens processed
      */
     int stats_tokens;
+
+    /*
+     * The passes the last libinjection_is_sqli or libinjection_sqli_ex
+     * ran, a bit from enum sqli_passes for each
+     */
+    int passes;
+
+#ifndef SWIG
+    /*
+     * Tokens shared between the ANSI and MySQL passes of
+     * libinjection_is_sqli.  NULL outside of it.
+     */
+    struct libinjection_sqli_replay *replay;
+
+    /*
+     * Summary of the whole input made once by libinjection_is_sqli.
+     * NULL outside of it.
+     */
+    struct libinjection_sqli_scan *scan;
+#endif
 };
 
 typedef struct libinjection_sqli_state sfilter;
@@ -178,6 +256,10 @@ typedef struct libinjection_sqli_state sfilter;
 struct libinjection_sqli_token *
 libinjection_sqli_get_token(struct libinjection_sqli_state *sql_state, int i);
 
+struct libinjection_sqli_context *
+libinjection_sqli_get_context(struct libinjection_sqli_report *report,
+                              int i);
+
 /*
  * Version info.
  *
@@ -201,6 +283,12 @@ void libinjection_sqli_init(struct libinjection_sqli_state *sf, const char *s,
  * Main API: tests for SQLi in three possible contexts, no quotes,
  * single quote and double quote
  *
+ * Input that is all digits or a single word (the rule of
+ * libinjection_sqli_lanes_benign) is FALSE without looking up its
+ * fingerprint; the one token is still fingerprinted, in the plain
+ * ANSI pass.  This is skipped if a lookup was given to
+ * libinjection_sqli_callback.
+ *
  * \param sql_state core data structure
  *
  * \return injection_result_t
@@ -208,6 +296,80 @@ void libinjection_sqli_init(struct libinjection_sqli_state *sf, const char *s,
 injection_result_t
 libinjection_is_sqli(struct libinjection_sqli_state *sql_state);
 
+/**
+ * libinjection_is_sqli, but only in the contexts the caller says the
+ * input can be in.  flags is a mask of FLAG_QUOTE_NONE,
+ * FLAG_QUOTE_SINGLE and FLAG_QUOTE_DOUBLE for where the input is
+ * pasted, and FLAG_SQL_ANSI and FLAG_SQL_MYSQL for the dialect.  No
+ * quote flag means any quote, no dialect flag means any dialect, so
+ * FLAG_NONE is the same as libinjection_is_sqli.  For example
+ *
+ *   FLAG_QUOTE_NONE                     a bare number, any dialect
+ *   FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL  a single quoted MySQL literal
+ *
+ * With both dialects the MySQL pass only runs if the input has
+ * comments MySQL reads differently, as in libinjection_is_sqli; with
+ * just FLAG_SQL_MYSQL it always runs.  FLAG_QUOTE_DOUBLE always runs
+ * the MySQL pass.  Quoted passes are skipped if the input doesn't have
+ * that quote.  sql_state->passes says which passes ran.
+ *
+ * \param sql_state core data structure
+ * \param flags contexts to test
+ *
+ * \return injection_result_t
+ */
+injection_result_t
+libinjection_sqli_ex(struct libinjection_sqli_state *sql_state, int flags);
+
+/**
+ * Packs the first inputs of ptrs into lanes, as many as fit: it stops
+ * at LIBINJECTION_SQLI_LANES inputs or at the first one longer than
+ * LIBINJECTION_SQLI_LANE_BYTES.  Input i goes in lane i.
+ *
+ * \return the number packed, 0 if ptrs[0] is too long or n is 0
+ */
+size_t libinjection_sqli_lanes_pack(struct libinjection_sqli_lanes *lanes,
+                                    const char **ptrs, const size_t *lens,
+                                    size_t n);
+
+/**
+ * Which packed inputs are certainly not SQLi, from their shape alone,
+ * checked for all lanes at once.  An input is benign if it is not
+ * empty and is
+ *
+ *   all ASCII digits, or
+ *   an ASCII letter followed by ASCII letters, digits and '_'
+ *
+ * Either way it is one token with no quotes and no comments, and no
+ * fingerprint is a single token except 'X'.  Any other lane has to
+ * go through libinjection_is_sqli.  This is what
+ * libinjection_sqli_batch does.
+ *
+ * \return a bit (1 << lane) for each benign lane
+ */
+unsigned int
+libinjection_sqli_lanes_benign(const struct libinjection_sqli_lanes *lanes);
+
+/**
+ * Fingerprints the input in all five contexts and fills in the
+ * fingerprint, verdict and reason of each, the same as
+ * libinjection_sqli_fingerprint and libinjection_sqli_check_fingerprint
+ * would, for logging and tuning.  The passes share the scan of the
+ * input, and each MySQL pass reuses the tokens of the ANSI pass
+ * before it up to the first comment the dialects read differently.
+ *
+ * Every pass runs to the end and sql_state->passes has all five bits.
+ * sql_state is left as the double quote pass left it.
+ *
+ * \param sql_state core data structure
+ * \param report filled in, one context per bit of enum sqli_passes
+ *
+ * \return what libinjection_is_sqli says about the input
+ */
+injection_result_t
+libinjection_is_sqli_report(struct libinjection_sqli_state *sql_state,
+                            struct libinjection_sqli_report *report);
+
 /*  FOR HACKERS ONLY
  *   provides deep hooks into the decision making process
  */
@@ -241,7 +403,7 @@ libinjection_sqli_fingerprint(struct libinjection_sqli_state *sql_state,
 
 /**
  * The default "word" to token-type or fingerprint function.  This
- * uses a ASCII case-insensitive binary tree.
+ * uses a generated ASCII case-insensitive perfect hash.
  */
 static char
 libinjection_sqli_lookup_word(struct libinjection_sqli_state *sql_state,
@@ -3,13 +3,21 @@
 #define LIBINJECTION_SQLI_DATA_H
 
 #include "libinjection.h"
+#include "libinjection_charclass.h"
 #include "libinjection_sqli.h"
 
 typedef struct {
     const char *word;
     char type;
+    unsigned char flags; /* KEYWORD_* */
+    unsigned short phrases; /* sql_phrases offset, 0 if none */
 } keyword_t;
 
+typedef struct {
+    unsigned short next; /* keyword id of what follows */
+    unsigned short phrase; /* keyword id of both together */
+} phrase_t;
+
 static size_t parse_money(sfilter *sf);
 static size_t parse_other(sfilter *sf);
 static size_t parse_white(sfilter *sf);
@@ -33,6 +41,7 @@ static size_t parse_bstring(sfilter *sf);
 static size_t parse_estring(sfilter *sf);
 static size_t parse_bword(sfilter *sf);
 
+#ifndef LIBINJECTION_SQLI_SWITCH_DISPATCH
 typedef size_t (*pt2Function)(sfilter *sf);
 static const pt2Function char_parse_map[] = {
     &parse_white,     /* 0 */
@@ -292,9360 +301,4388 @@ static const pt2Function char_parse_map[] = {
     &parse_word,      /* 254 */
     &parse_word,      /* 255 */
 };
+#else
+static size_t parse_dispatch(sfilter *sf, unsigned char ch) {
+    switch (ch) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 127:
+    case 160:
+        return parse_white(sf);
+    case 33:
+    case 38:
+    case 42:
+    case 58:
+    case 60:
+    case 61:
+    case 62:
+    case 124:
+        return parse_operator2(sf);
+    case 34:
+    case 39:
+        return parse_string(sf);
+    case 35:
+        return parse_hash(sf);
+    case 36:
+        return parse_money(sf);
+    case 37:
+    case 43:
+    case 94:
+    case 126:
+        return parse_operator1(sf);
+    case 40:
+    case 41:
+    case 44:
+    case 59:
+    case 123:
+    case 125:
+        return parse_char(sf);
+    case 45:
+        return parse_dash(sf);
+    case 46:
+    case 48:
+    case 49:
+    case 50:
+    case 51:
+    case 52:
+    case 53:
+    case 54:
+    case 55:
+    case 56:
+    case 57:
+        return parse_number(sf);
+    case 47:
+        return parse_slash(sf);
+    case 63:
+    case 93:
+        return parse_other(sf);
+    case 64:
+        return parse_var(sf);
+    case 66:
+    case 98:
+        return parse_bstring(sf);
+    case 69:
+    case 101:
+        return parse_estring(sf);
+    case 78:
+    case 110:
+        return parse_nqstring(sf);
+    case 81:
+    case 113:
+        return parse_qstring(sf);
+    case 85:
+    case 117:
+        return parse_ustring(sf);
+    case 88:
+    case 120:
+        return parse_xstring(sf);
+    case 91:
+        return parse_bword(sf);
+    case 92:
+        return parse_backslash(sf);
+    case 96:
+        return parse_tick(sf);
+    default:
+        return parse_word(sf);
+    }
+}
+#endif
+
+static const unsigned char sql_char_class_map[] = {
+    255, 128, 128, 128, 128, 128, 128, 128, 128, 135, 135, 135, 135, 135, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 135, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 38, 6, 32, 6, 56, 56, 48,
+    48, 48, 48, 48, 48, 48, 48, 6, 6, 6, 6, 6, 6, 6, 80, 80, 80, 80, 80, 80, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    2, 6, 2, 6, 0, 4, 80, 80, 80, 80, 80, 80, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 2, 6, 2, 6, 128, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const char_range_t sql_char_class_white_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x20},
+    {0xA0, 0xA0},
+};
+static const char_class_t sql_char_class_white = {
+    sql_char_class_map, 0x01, sql_char_class_white_ranges, 4};
+
+static const char_range_t sql_char_class_word_delim_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x23},
+    {0x25, 0x2D},
+    {0x2F, 0x2F},
+    {0x3A, 0x40},
+    {0x5B, 0x5E},
+    {0x7B, 0x7E},
+    {0xA0, 0xA0},
+};
+static const char_class_t sql_char_class_word_delim = {
+    sql_char_class_map, 0x02, sql_char_class_word_delim_ranges, 9};
+
+static const char_range_t sql_char_class_var_delim_ranges[] = {
+    {0x00, 0x00},
+    {0x09, 0x0D},
+    {0x20, 0x23},
+    {0x25, 0x2D},
+    {0x2F, 0x2F},
+    {0x3A, 0x40},
+    {0x5C, 0x5C},
+    {0x5E, 0x5E},
+    {0x60, 0x60},
+    {0x7C, 0x7C},
+    {0x7E, 0x7E},
+};
+static const char_class_t sql_char_class_var_delim = {
+    sql_char_class_map, 0x04, sql_char_class_var_delim_ranges, 11};
+
+static const char_range_t sql_char_class_bin_ranges[] = {
+    {0x00, 0x00},
+    {0x30, 0x31},
+};
+static const char_class_t sql_char_class_bin = {
+    sql_char_class_map, 0x08, sql_char_class_bin_ranges, 2};
+
+static const char_range_t sql_char_class_hex_ranges[] = {
+    {0x00, 0x00},
+    {0x30, 0x39},
+    {0x41, 0x46},
+    {0x61, 0x66},
+};
+static const char_class_t sql_char_class_hex = {
+    sql_char_class_map, 0x10, sql_char_class_hex_ranges, 4};
+
+static const char_range_t sql_char_class_money_ranges[] = {
+    {0x00, 0x00},
+    {0x2C, 0x2C},
+    {0x2E, 0x2E},
+    {0x30, 0x39},
+};
+static const char_class_t sql_char_class_money = {
+    sql_char_class_map, 0x20, sql_char_class_money_ranges, 4};
+
+static const char_range_t sql_char_class_alpha_ranges[] = {
+    {0x00, 0x00},
+    {0x41, 0x5A},
+    {0x61, 0x7A},
+};
+static const char_class_t sql_char_class_alpha = {
+    sql_char_class_map, 0x40, sql_char_class_alpha_ranges, 3};
+
+static const char_range_t sql_char_class_blank_ranges[] = {
+    {0x00, 0x20},
+    {0x7F, 0x7F},
+    {0xA0, 0xA0},
+};
+static const char_class_t sql_char_class_blank = {
+    sql_char_class_map, 0x80, sql_char_class_blank_ranges, 3};
+
+#define KEYWORD_WORD_FUNCTION 1
+#define KEYWORD_WORD_IN 2
+#define KEYWORD_WORD_LIKE 4
+#define KEYWORD_WORD_USER 8
+#define KEYWORD_DOTTED_HEAD 16
 
 static const keyword_t sql_keywords[] = {
-    {"!!", 'o'},
-    {"!<", 'o'},
-    {"!=", 'o'},
-    {"!>", 'o'},
-    {"%=", 'o'},
-    {"&&", '&'},
-    {"&=", 'o'},
-    {"*=", 'o'},
-    {"+=", 'o'},
-    {"-=", 'o'},
-    {"/=", 'o'},
-    {"0&(1)O", 'F'},
-    {"0&(1)U", 'F'},
-    {"0&(1O(", 'F'},
-    {"0&(1OF", 'F'},
-    {"0&(1OS", 'F'},
-    {"0&(1OV", 'F'},
-    {"0&(F()", 'F'},
-    {"0&(F(1", 'F'},
-    {"0&(F(F", 'F'},
-    {"0&(F(N", 'F'},
-    {"0&(F(S", 'F'},
-    {"0&(F(V", 'F'},
-    {"0&(N)O", 'F'},
-    {"0&(N)U", 'F'},
-    {"0&(NO(", 'F'},
-    {"0&(NOF", 'F'},
-    {"0&(NOS", 'F'},
-    {"0&(NOV", 'F'},
-    {"0&(S)O", 'F'},
-    {"0&(S)U", 'F'},
-    {"0&(SO(", 'F'},
-    {"0&(SO1", 'F'},
-    {"0&(SOF", 'F'},
-    {"0&(SON", 'F'},
-    {"0&(SOS", 'F'},
-    {"0&(SOV", 'F'},
-    {"0&(V)O", 'F'},
-    {"0&(V)U", 'F'},
-    {"0&(VO(", 'F'},
-    {"0&(VOF", 'F'},
-    {"0&(VOS", 'F'},
-    {"0&1O(1", 'F'},
-    {"0&1O(F", 'F'},
-    {"0&1O(N", 'F'},
-    {"0&1O(S", 'F'},
-    {"0&1O(V", 'F'},
-    {"0&1OF(", 'F'},
-    {"0&1OS(", 'F'},
-    {"0&1OS1", 'F'},
-    {"0&1OSF", 'F'},
-    {"0&1OSU", 'F'},
-    {"0&1OSV", 'F'},
-    {"0&1OV(", 'F'},
-    {"0&1OVF", 'F'},
-    {"0&1OVO", 'F'},
-    {"0&1OVS", 'F'},
-    {"0&1OVU", 'F'},
-    {"0&1UE(", 'F'},
-    {"0&1UE1", 'F'},
-    {"0&1UEF", 'F'},
-    {"0&1UEK", 'F'},
-    {"0&1UEN", 'F'},
-    {"0&1UES", 'F'},
-    {"0&1UEV", 'F'},
-    {"0&F()O", 'F'},
-    {"0&F()U", 'F'},
-    {"0&F(1)", 'F'},
-    {"0&F(1O", 'F'},
-    {"0&F(F(", 'F'},
-    {"0&F(N)", 'F'},
-    {"0&F(NO", 'F'},
-    {"0&F(S)", 'F'},
-    {"0&F(SO", 'F'},
-    {"0&F(V)", 'F'},
-    {"0&F(VO", 'F'},
-    {"0&NO(1", 'F'},
-    {"0&NO(F", 'F'},
-    {"0&NO(N", 'F'},
-    {"0&NO(S", 'F'},
-    {"0&NO(V", 'F'},
-    {"0&NOF(", 'F'},
-    {"0&NOS(", 'F'},
-    {"0&NOS1", 'F'},
-    {"0&NOSF", 'F'},
-    {"0&NOSU", 'F'},
-    {"0&NOSV", 'F'},
-    {"0&NOV(", 'F'},
-    {"0&NOVF", 'F'},
-    {"0&NOVO", 'F'},
-    {"0&NOVS", 'F'},
-    {"0&NOVU", 'F'},
-    {"0&NUE(", 'F'},
-    {"0&NUE1", 'F'},
-    {"0&NUEF", 'F'},
-    {"0&NUEK", 'F'},
-    {"0&NUEN", 'F'},
-    {"0&NUES", 'F'},
-    {"0&NUEV", 'F'},
-    {"0&SO(1", 'F'},
-    {"0&SO(F", 'F'},
-    {"0&SO(N", 'F'},
-    {"0&SO(S", 'F'},
-    {"0&SO(V", 'F'},
-    {"0&SO1(", 'F'},
-    {"0&SO1F", 'F'},
-    {"0&SO1N", 'F'},
-    {"0&SO1S", 'F'},
-    {"0&SO1U", 'F'},
-    {"0&SO1V", 'F'},
-    {"0&SOF(", 'F'},
-    {"0&SON(", 'F'},
-    {"0&SON1", 'F'},
-    {"0&SONF", 'F'},
-    {"0&SONU", 'F'},
-    {"0&SOS(", 'F'},
-    {"0&SOS1", 'F'},
-    {"0&SOSF", 'F'},
-    {"0&SOSU", 'F'},
-    {"0&SOSV", 'F'},
-    {"0&SOV(", 'F'},
-    {"0&SOVF", 'F'},
-    {"0&SOVO", 'F'},
-    {"0&SOVS", 'F'},
-    {"0&SOVU", 'F'},
-    {"0&SUE(", 'F'},
-    {"0&SUE1", 'F'},
-    {"0&SUEF", 'F'},
-    {"0&SUEK", 'F'},
-    {"0&SUEN", 'F'},
-    {"0&SUES", 'F'},
-    {"0&SUEV", 'F'},
-    {"0&VO(1", 'F'},
-    {"0&VO(F", 'F'},
-    {"0&VO(N", 'F'},
-    {"0&VO(S", 'F'},
-    {"0&VO(V", 'F'},
-    {"0&VOF(", 'F'},
-    {"0&VOS(", 'F'},
-    {"0&VOS1", 'F'},
-    {"0&VOSF", 'F'},
-    {"0&VOSU", 'F'},
-    {"0&VOSV", 'F'},
-    {"0&VUE(", 'F'},
-    {"0&VUE1", 'F'},
-    {"0&VUEF", 'F'},
-    {"0&VUEK", 'F'},
-    {"0&VUEN", 'F'},
-    {"0&VUES", 'F'},
-    {"0&VUEV", 'F'},
-    {"0)&(EK", 'F'},
-    {"0)&(EN", 'F'},
-    {"0)UE(1", 'F'},
-    {"0)UE(F", 'F'},
-    {"0)UE(N", 'F'},
-    {"0)UE(S", 'F'},
-    {"0)UE(V", 'F'},
-    {"0)UE1K", 'F'},
-    {"0)UE1O", 'F'},
-    {"0)UEF(", 'F'},
-    {"0)UEK(", 'F'},
-    {"0)UEK1", 'F'},
-    {"0)UEKF", 'F'},
-    {"0)UEKN", 'F'},
-    {"0)UEKS", 'F'},
-    {"0)UEKV", 'F'},
-    {"0)UENK", 'F'},
-    {"0)UENO", 'F'},
-    {"0)UESK", 'F'},
-    {"0)UESO", 'F'},
-    {"0)UEVK", 'F'},
-    {"0)UEVO", 'F'},
-    {"01&(1&", 'F'},
-    {"01&(1)", 'F'},
-    {"01&(1,", 'F'},
-    {"01&(1O", 'F'},
-    {"01&(E(", 'F'},
-    {"01&(E1", 'F'},
-    {"01&(EF", 'F'},
-    {"01&(EK", 'F'},
-    {"01&(EN", 'F'},
-    {"01&(EO", 'F'},
-    {"01&(ES", 'F'},
-    {"01&(EV", 'F'},
-    {"01&(F(", 'F'},
-    {"01&(N&", 'F'},
-    {"01&(N)", 'F'},
-    {"01&(N,", 'F'},
-    {"01&(NO", 'F'},
-    {"01&(S&", 'F'},
-    {"01&(S)", 'F'},
-    {"01&(S,", 'F'},
-    {"01&(SO", 'F'},
-    {"01&(V&", 'F'},
-    {"01&(V)", 'F'},
-    {"01&(V,", 'F'},
-    {"01&(VO", 'F'},
-    {"01&1", 'F'},
-    {"01&1&(", 'F'},
-    {"01&1&1", 'F'},
-    {"01&1&F", 'F'},
-    {"01&1&N", 'F'},
-    {"01&1&S", 'F'},
-    {"01&1&V", 'F'},
-    {"01&1)&", 'F'},
-    {"01&1)C", 'F'},
-    {"01&1)O", 'F'},
-    {"01&1)U", 'F'},
-    {"01&1;", 'F'},
-    {"01&1;C", 'F'},
-    {"01&1;E", 'F'},
-    {"01&1;T", 'F'},
-    {"01&1B(", 'F'},
-    {"01&1B1", 'F'},
-    {"01&1BF", 'F'},
-    {"01&1BN", 'F'},
-    {"01&1BS", 'F'},
-    {"01&1BV", 'F'},
-    {"01&1C", 'F'},
-    {"01&1EK", 'F'},
-    {"01&1EN", 'F'},
-    {"01&1F(", 'F'},
-    {"01&1K(", 'F'},
-    {"01&1K1", 'F'},
-    {"01&1KF", 'F'},
-    {"01&1KN", 'F'},
-    {"01&1KS", 'F'},
-    {"01&1KV", 'F'},
-    {"01&1O(", 'F'},
-    {"01&1OF", 'F'},
-    {"01&1OS", 'F'},
-    {"01&1OV", 'F'},
-    {"01&1TN", 'F'},
-    {"01&1U", 'F'},
-    {"01&1U(", 'F'},
-    {"01&1U;", 'F'},
-    {"01&1UC", 'F'},
-    {"01&1UE", 'F'},
-    {"01&E(1", 'F'},
-    {"01&E(F", 'F'},
-    {"01&E(N", 'F'},
-    {"01&E(O", 'F'},
-    {"01&E(S", 'F'},
-    {"01&E(V", 'F'},
-    {"01&E1", 'F'},
-    {"01&E1;", 'F'},
-    {"01&E1C", 'F'},
-    {"01&E1K", 'F'},
-    {"01&E1O", 'F'},
-    {"01&EF(", 'F'},
-    {"01&EK(", 'F'},
-    {"01&EK1", 'F'},
-    {"01&EKF", 'F'},
-    {"01&EKN", 'F'},
-    {"01&EKS", 'F'},
-    {"01&EKU", 'F'},
-    {"01&EKV", 'F'},
-    {"01&EN", 'F'},
-    {"01&EN;", 'F'},
-    {"01&ENC", 'F'},
-    {"01&ENK", 'F'},
-    {"01&ENO", 'F'},
-    {"01&ES", 'F'},
-    {"01&ES;", 'F'},
-    {"01&ESC", 'F'},
-    {"01&ESK", 'F'},
-    {"01&ESO", 'F'},
-    {"01&EUE", 'F'},
-    {"01&EV", 'F'},
-    {"01&EV;", 'F'},
-    {"01&EVC", 'F'},
-    {"01&EVK", 'F'},
-    {"01&EVO", 'F'},
-    {"01&F()", 'F'},
-    {"01&F(1", 'F'},
-    {"01&F(E", 'F'},
-    {"01&F(F", 'F'},
-    {"01&F(N", 'F'},
-    {"01&F(S", 'F'},
-    {"01&F(V", 'F'},
-    {"01&K&(", 'F'},
-    {"01&K&1", 'F'},
-    {"01&K&F", 'F'},
-    {"01&K&N", 'F'},
-    {"01&K&S", 'F'},
-    {"01&K&V", 'F'},
-    {"01&K(1", 'F'},
-    {"01&K(F", 'F'},
-    {"01&K(N", 'F'},
-    {"01&K(S", 'F'},
-    {"01&K(V", 'F'},
-    {"01&K1O", 'F'},
-    {"01&KC", 'F'},
-    {"01&KF(", 'F'},
-    {"01&KNK", 'F'},
-    {"01&KO(", 'F'},
-    {"01&KO1", 'F'},
-    {"01&KOF", 'F'},
-    {"01&KOK", 'F'},
-    {"01&KON", 'F'},
-    {"01&KOS", 'F'},
-    {"01&KOV", 'F'},
-    {"01&KSO", 'F'},
-    {"01&KVO", 'F'},
-    {"01&N&(", 'F'},
-    {"01&N&1", 'F'},
-    {"01&N&F", 'F'},
-    {"01&N&N", 'F'},
-    {"01&N&S", 'F'},
-    {"01&N&V", 'F'},
-    {"01&N)&", 'F'},
-    {"01&N)C", 'F'},
-    {"01&N)O", 'F'},
-    {"01&N)U", 'F'},
-    {"01&N;", 'F'},
-    {"01&N;C", 'F'},
-    {"01&N;E", 'F'},
-    {"01&N;T", 'F'},
-    {"01&NB(", 'F'},
-    {"01&NB1", 'F'},
-    {"01&NBF", 'F'},
-    {"01&NBN", 'F'},
-    {"01&NBS", 'F'},
-    {"01&NBV", 'F'},
-    {"01&NC", 'F'},
-    {"01&NEN", 'F'},
-    {"01&NF(", 'F'},
-    {"01&NK(", 'F'},
-    {"01&NK1", 'F'},
-    {"01&NKF", 'F'},
-    {"01&NKN", 'F'},
-    {"01&NKS", 'F'},
-    {"01&NKV", 'F'},
-    {"01&NO(", 'F'},
-    {"01&NOF", 'F'},
-    {"01&NOS", 'F'},
-    {"01&NOV", 'F'},
-    {"01&NTN", 'F'},
-    {"01&NU", 'F'},
-    {"01&NU(", 'F'},
-    {"01&NU;", 'F'},
-    {"01&NUC", 'F'},
-    {"01&NUE", 'F'},
-    {"01&S", 'F'},
-    {"01&S&(", 'F'},
-    {"01&S&1", 'F'},
-    {"01&S&F", 'F'},
-    {"01&S&N", 'F'},
-    {"01&S&S", 'F'},
-    {"01&S&V", 'F'},
-    {"01&S)&", 'F'},
-    {"01&S)C", 'F'},
-    {"01&S)O", 'F'},
-    {"01&S)U", 'F'},
-    {"01&S1", 'F'},
-    {"01&S1;", 'F'},
-    {"01&S1C", 'F'},
-    {"01&S;", 'F'},
-    {"01&S;C", 'F'},
-    {"01&S;E", 'F'},
-    {"01&S;T", 'F'},
-    {"01&SB(", 'F'},
-    {"01&SB1", 'F'},
-    {"01&SBF", 'F'},
-    {"01&SBN", 'F'},
-    {"01&SBS", 'F'},
-    {"01&SBV", 'F'},
-    {"01&SC", 'F'},
-    {"01&SEK", 'F'},
-    {"01&SEN", 'F'},
-    {"01&SF(", 'F'},
-    {"01&SK(", 'F'},
-    {"01&SK1", 'F'},
-    {"01&SKF", 'F'},
-    {"01&SKN", 'F'},
-    {"01&SKS", 'F'},
-    {"01&SKV", 'F'},
-    {"01&SO(", 'F'},
-    {"01&SO1", 'F'},
-    {"01&SOF", 'F'},
-    {"01&SON", 'F'},
-    {"01&SOS", 'F'},
-    {"01&SOV", 'F'},
-    {"01&STN", 'F'},
-    {"01&SU", 'F'},
-    {"01&SU(", 'F'},
-    {"01&SU;", 'F'},
-    {"01&SUC", 'F'},
-    {"01&SUE", 'F'},
-    {"01&SV", 'F'},
-    {"01&SV;", 'F'},
-    {"01&SVC", 'F'},
-    {"01&SVO", 'F'},
-    {"01&V", 'F'},
-    {"01&V&(", 'F'},
-    {"01&V&1", 'F'},
-    {"01&V&F", 'F'},
-    {"01&V&N", 'F'},
-    {"01&V&S", 'F'},
-    {"01&V&V", 'F'},
-    {"01&V)&", 'F'},
-    {"01&V)C", 'F'},
-    {"01&V)O", 'F'},
-    {"01&V)U", 'F'},
-    {"01&V;", 'F'},
-    {"01&V;C", 'F'},
-    {"01&V;E", 'F'},
-    {"01&V;T", 'F'},
-    {"01&VB(", 'F'},
-    {"01&VB1", 'F'},
-    {"01&VBF", 'F'},
-    {"01&VBN", 'F'},
-    {"01&VBS", 'F'},
-    {"01&VBV", 'F'},
-    {"01&VC", 'F'},
-    {"01&VEK", 'F'},
-    {"01&VEN", 'F'},
-    {"01&VF(", 'F'},
-    {"01&VK(", 'F'},
-    {"01&VK1", 'F'},
-    {"01&VKF", 'F'},
-    {"01&VKN", 'F'},
-    {"01&VKS", 'F'},
-    {"01&VKV", 'F'},
-    {"01&VO(", 'F'},
-    {"01&VOF", 'F'},
-    {"01&VOS", 'F'},
-    {"01&VS", 'F'},
-    {"01&VS;", 'F'},
-    {"01&VSC", 'F'},
-    {"01&VSO", 'F'},
-    {"01&VTN", 'F'},
-    {"01&VU", 'F'},
-    {"01&VU(", 'F'},
-    {"01&VU;", 'F'},
-    {"01&VUC", 'F'},
-    {"01&VUE", 'F'},
-    {"01(EF(", 'F'},
-    {"01(EKF", 'F'},
-    {"01(EKN", 'F'},
-    {"01(ENK", 'F'},
-    {"01(U(E", 'F'},
-    {"01)&(1", 'F'},
-    {"01)&(E", 'F'},
-    {"01)&(F", 'F'},
-    {"01)&(N", 'F'},
-    {"01)&(S", 'F'},
-    {"01)&(V", 'F'},
-    {"01)&1", 'F'},
-    {"01)&1&", 'F'},
-    {"01)&1)", 'F'},
-    {"01)&1;", 'F'},
-    {"01)&1B", 'F'},
-    {"01)&1C", 'F'},
-    {"01)&1F", 'F'},
-    {"01)&1O", 'F'},
-    {"01)&1U", 'F'},
-    {"01)&F(", 'F'},
-    {"01)&N", 'F'},
-    {"01)&N&", 'F'},
-    {"01)&N)", 'F'},
-    {"01)&N;", 'F'},
-    {"01)&NB", 'F'},
-    {"01)&NC", 'F'},
-    {"01)&NF", 'F'},
-    {"01)&NO", 'F'},
-    {"01)&NU", 'F'},
-    {"01)&S", 'F'},
-    {"01)&S&", 'F'},
-    {"01)&S)", 'F'},
-    {"01)&S;", 'F'},
-    {"01)&SB", 'F'},
-    {"01)&SC", 'F'},
-    {"01)&SF", 'F'},
-    {"01)&SO", 'F'},
-    {"01)&SU", 'F'},
-    {"01)&V", 'F'},
-    {"01)&V&", 'F'},
-    {"01)&V)", 'F'},
-    {"01)&V;", 'F'},
-    {"01)&VB", 'F'},
-    {"01)&VC", 'F'},
-    {"01)&VF", 'F'},
-    {"01)&VO", 'F'},
-    {"01)&VU", 'F'},
-    {"01),(1", 'F'},
-    {"01),(F", 'F'},
-    {"01),(N", 'F'},
-    {"01),(S", 'F'},
-    {"01),(V", 'F'},
-    {"01);E(", 'F'},
-    {"01);E1", 'F'},
-    {"01);EF", 'F'},
-    {"01);EK", 'F'},
-    {"01);EN", 'F'},
-    {"01);EO", 'F'},
-    {"01);ES", 'F'},
-    {"01);EV", 'F'},
-    {"01);T(", 'F'},
-    {"01);T1", 'F'},
-    {"01);TF", 'F'},
-    {"01);TK", 'F'},
-    {"01);TN", 'F'},
-    {"01);TO", 'F'},
-    {"01);TS", 'F'},
-    {"01);TV", 'F'},
-    {"01)B(1", 'F'},
-    {"01)B(F", 'F'},
-    {"01)B(N", 'F'},
-    {"01)B(S", 'F'},
-    {"01)B(V", 'F'},
-    {"01)B1", 'F'},
-    {"01)B1&", 'F'},
-    {"01)B1;", 'F'},
-    {"01)B1C", 'F'},
-    {"01)B1K", 'F'},
-    {"01)B1N", 'F'},
-    {"01)B1O", 'F'},
-    {"01)B1U", 'F'},
-    {"01)BF(", 'F'},
-    {"01)BN", 'F'},
-    {"01)BN&", 'F'},
-    {"01)BN;", 'F'},
-    {"01)BNC", 'F'},
-    {"01)BNK", 'F'},
-    {"01)BNO", 'F'},
-    {"01)BNU", 'F'},
-    {"01)BS", 'F'},
-    {"01)BS&", 'F'},
-    {"01)BS;", 'F'},
-    {"01)BSC", 'F'},
-    {"01)BSK", 'F'},
-    {"01)BSO", 'F'},
-    {"01)BSU", 'F'},
-    {"01)BV", 'F'},
-    {"01)BV&", 'F'},
-    {"01)BV;", 'F'},
-    {"01)BVC", 'F'},
-    {"01)BVK", 'F'},
-    {"01)BVO", 'F'},
-    {"01)BVU", 'F'},
-    {"01)C", 'F'},
-    {"01)E(1", 'F'},
-    {"01)E(F", 'F'},
-    {"01)E(N", 'F'},
-    {"01)E(S", 'F'},
-    {"01)E(V", 'F'},
-    {"01)E1C", 'F'},
-    {"01)E1O", 'F'},
-    {"01)EF(", 'F'},
-    {"01)EK(", 'F'},
-    {"01)EK1", 'F'},
-    {"01)EKF", 'F'},
-    {"01)EKN", 'F'},
-    {"01)EKS", 'F'},
-    {"01)EKV", 'F'},
-    {"01)ENC", 'F'},
-    {"01)ENO", 'F'},
-    {"01)ESC", 'F'},
-    {"01)ESO", 'F'},
-    {"01)EVC", 'F'},
-    {"01)EVO", 'F'},
-    {"01)F(F", 'F'},
-    {"01)K(1", 'F'},
-    {"01)K(F", 'F'},
-    {"01)K(N", 'F'},
-    {"01)K(S", 'F'},
-    {"01)K(V", 'F'},
-    {"01)K1&", 'F'},
-    {"01)K1;", 'F'},
-    {"01)K1B", 'F'},
-    {"01)K1E", 'F'},
-    {"01)K1O", 'F'},
-    {"01)K1U", 'F'},
-    {"01)KB(", 'F'},
-    {"01)KB1", 'F'},
-    {"01)KBF", 'F'},
-    {"01)KBN", 'F'},
-    {"01)KBS", 'F'},
-    {"01)KBV", 'F'},
-    {"01)KF(", 'F'},
-    {"01)KN&", 'F'},
-    {"01)KN;", 'F'},
-    {"01)KNB", 'F'},
-    {"01)KNC", 'F'},
-    {"01)KNE", 'F'},
-    {"01)KNK", 'F'},
-    {"01)KNU", 'F'},
-    {"01)KS&", 'F'},
-    {"01)KS;", 'F'},
-    {"01)KSB", 'F'},
-    {"01)KSE", 'F'},
-    {"01)KSO", 'F'},
-    {"01)KSU", 'F'},
-    {"01)KUE", 'F'},
-    {"01)KV&", 'F'},
-    {"01)KV;", 'F'},
-    {"01)KVB", 'F'},
-    {"01)KVE", 'F'},
-    {"01)KVO", 'F'},
-    {"01)KVU", 'F'},
-    {"01)O(1", 'F'},
-    {"01)O(E", 'F'},
-    {"01)O(F", 'F'},
-    {"01)O(N", 'F'},
-    {"01)O(S", 'F'},
-    {"01)O(V", 'F'},
-    {"01)O1", 'F'},
-    {"01)O1&", 'F'},
-    {"01)O1)", 'F'},
-    {"01)O1;", 'F'},
-    {"01)O1B", 'F'},
-    {"01)O1C", 'F'},
-    {"01)O1K", 'F'},
-    {"01)O1U", 'F'},
-    {"01)OF(", 'F'},
-    {"01)ON&", 'F'},
-    {"01)ON)", 'F'},
-    {"01)ON;", 'F'},
-    {"01)ONB", 'F'},
-    {"01)ONC", 'F'},
-    {"01)ONK", 'F'},
-    {"01)ONU", 'F'},
-    {"01)OS", 'F'},
-    {"01)OS&", 'F'},
-    {"01)OS)", 'F'},
-    {"01)OS;", 'F'},
-    {"01)OSB", 'F'},
-    {"01)OSC", 'F'},
-    {"01)OSK", 'F'},
-    {"01)OSU", 'F'},
-    {"01)OV", 'F'},
-    {"01)OV&", 'F'},
-    {"01)OV)", 'F'},
-    {"01)OV;", 'F'},
-    {"01)OVB", 'F'},
-    {"01)OVC", 'F'},
-    {"01)OVK", 'F'},
-    {"01)OVO", 'F'},
-    {"01)OVU", 'F'},
-    {"01)U(E", 'F'},
-    {"01)UE(", 'F'},
-    {"01)UE1", 'F'},
-    {"01)UEF", 'F'},
-    {"01)UEK", 'F'},
-    {"01)UEN", 'F'},
-    {"01)UES", 'F'},
-    {"01)UEV", 'F'},
-    {"01,(1)", 'F'},
-    {"01,(1O", 'F'},
-    {"01,(E(", 'F'},
-    {"01,(E1", 'F'},
-    {"01,(EF", 'F'},
-    {"01,(EK", 'F'},
-    {"01,(EN", 'F'},
-    {"01,(ES", 'F'},
-    {"01,(EV", 'F'},
-    {"01,(F(", 'F'},
-    {"01,(N)", 'F'},
-    {"01,(NO", 'F'},
-    {"01,(S)", 'F'},
-    {"01,(SO", 'F'},
-    {"01,(V)", 'F'},
-    {"01,(VO", 'F'},
-    {"01,F()", 'F'},
-    {"01,F(1", 'F'},
-    {"01,F(F", 'F'},
-    {"01,F(N", 'F'},
-    {"01,F(S", 'F'},
-    {"01,F(V", 'F'},
-    {"01;E(1", 'F'},
-    {"01;E(E", 'F'},
-    {"01;E(F", 'F'},
-    {"01;E(N", 'F'},
-    {"01;E(S", 'F'},
-    {"01;E(V", 'F'},
-    {"01;E1,", 'F'},
-    {"01;E1;", 'F'},
-    {"01;E1C", 'F'},
-    {"01;E1K", 'F'},
-    {"01;E1O", 'F'},
-    {"01;E1T", 'F'},
-    {"01;EF(", 'F'},
-    {"01;EK(", 'F'},
-    {"01;EK1", 'F'},
-    {"01;EKF", 'F'},
-    {"01;EKN", 'F'},
-    {"01;EKO", 'F'},
-    {"01;EKS", 'F'},
-    {"01;EKV", 'F'},
-    {"01;EN,", 'F'},
-    {"01;EN;", 'F'},
-    {"01;ENC", 'F'},
-    {"01;ENE", 'F'},
-    {"01;ENK", 'F'},
-    {"01;ENO", 'F'},
-    {"01;ENT", 'F'},
-    {"01;ES,", 'F'},
-    {"01;ES;", 'F'},
-    {"01;ESC", 'F'},
-    {"01;ESK", 'F'},
-    {"01;ESO", 'F'},
-    {"01;EST", 'F'},
-    {"01;EV,", 'F'},
-    {"01;EV;", 'F'},
-    {"01;EVC", 'F'},
-    {"01;EVK", 'F'},
-    {"01;EVO", 'F'},
-    {"01;EVT", 'F'},
-    {"01;N:T", 'F'},
-    {"01;T(1", 'F'},
-    {"01;T(C", 'F'},
-    {"01;T(E", 'F'},
-    {"01;T(F", 'F'},
-    {"01;T(N", 'F'},
-    {"01;T(S", 'F'},
-    {"01;T(V", 'F'},
-    {"01;T1(", 'F'},
-    {"01;T1,", 'F'},
-    {"01;T1;", 'F'},
-    {"01;T1C", 'F'},
-    {"01;T1F", 'F'},
-    {"01;T1K", 'F'},
-    {"01;T1O", 'F'},
-    {"01;T1T", 'F'},
-    {"01;T;", 'F'},
-    {"01;T;C", 'F'},
-    {"01;TF(", 'F'},
-    {"01;TK(", 'F'},
-    {"01;TK1", 'F'},
-    {"01;TKF", 'F'},
-    {"01;TKK", 'F'},
-    {"01;TKN", 'F'},
-    {"01;TKO", 'F'},
-    {"01;TKS", 'F'},
-    {"01;TKV", 'F'},
-    {"01;TN(", 'F'},
-    {"01;TN,", 'F'},
-    {"01;TN1", 'F'},
-    {"01;TN;", 'F'},
-    {"01;TNC", 'F'},
-    {"01;TNF", 'F'},
-    {"01;TNK", 'F'},
-    {"01;TNN", 'F'},
-    {"01;TNO", 'F'},
-    {"01;TNS", 'F'},
-    {"01;TNT", 'F'},
-    {"01;TNV", 'F'},
-    {"01;TO(", 'F'},
-    {"01;TS(", 'F'},
-    {"01;TS,", 'F'},
-    {"01;TS;", 'F'},
-    {"01;TSC", 'F'},
-    {"01;TSF", 'F'},
-    {"01;TSK", 'F'},
-    {"01;TSO", 'F'},
-    {"01;TST", 'F'},
-    {"01;TTN", 'F'},
-    {"01;TV(", 'F'},
-    {"01;TV,", 'F'},
-    {"01;TV;", 'F'},
-    {"01;TVC", 'F'},
-    {"01;TVF", 'F'},
-    {"01;TVK", 'F'},
-    {"01;TVO", 'F'},
-    {"01;TVT", 'F'},
-    {"01A(F(", 'F'},
-    {"01A(N)", 'F'},
-    {"01A(NO", 'F'},
-    {"01A(S)", 'F'},
-    {"01A(SO", 'F'},
-    {"01A(V)", 'F'},
-    {"01A(VO", 'F'},
-    {"01AF()", 'F'},
-    {"01AF(1", 'F'},
-    {"01AF(F", 'F'},
-    {"01AF(N", 'F'},
-    {"01AF(S", 'F'},
-    {"01AF(V", 'F'},
-    {"01ASO(", 'F'},
-    {"01ASO1", 'F'},
-    {"01ASOF", 'F'},
-    {"01ASON", 'F'},
-    {"01ASOS", 'F'},
-    {"01ASOV", 'F'},
-    {"01ASUE", 'F'},
-    {"01ATO(", 'F'},
-    {"01ATO1", 'F'},
-    {"01ATOF", 'F'},
-    {"01ATON", 'F'},
-    {"01ATOS", 'F'},
-    {"01ATOV", 'F'},
-    {"01ATUE", 'F'},
-    {"01AVO(", 'F'},
-    {"01AVOF", 'F'},
-    {"01AVOS", 'F'},
-    {"01AVUE", 'F'},
-    {"01B(1)", 'F'},
-    {"01B(1O", 'F'},
-    {"01B(F(", 'F'},
-    {"01B(NO", 'F'},
-    {"01B(S)", 'F'},
-    {"01B(SO", 'F'},
-    {"01B(V)", 'F'},
-    {"01B(VO", 'F'},
-    {"01B1", 'F'},
-    {"01B1&(", 'F'},
-    {"01B1&1", 'F'},
-    {"01B1&F", 'F'},
-    {"01B1&N", 'F'},
-    {"01B1&S", 'F'},
-    {"01B1&V", 'F'},
-    {"01B1,(", 'F'},
-    {"01B1,F", 'F'},
-    {"01B1;", 'F'},
-    {"01B1;C", 'F'},
-    {"01B1B(", 'F'},
-    {"01B1B1", 'F'},
-    {"01B1BF", 'F'},
-    {"01B1BN", 'F'},
-    {"01B1BS", 'F'},
-    {"01B1BV", 'F'},
-    {"01B1C", 'F'},
-    {"01B1K(", 'F'},
-    {"01B1K1", 'F'},
-    {"01B1KF", 'F'},
-    {"01B1KN", 'F'},
-    {"01B1KS", 'F'},
-    {"01B1KV", 'F'},
-    {"01B1O(", 'F'},
-    {"01B1OF", 'F'},
-    {"01B1OS", 'F'},
-    {"01B1OV", 'F'},
-    {"01B1U(", 'F'},
-    {"01B1UE", 'F'},
-    {"01BE(1", 'F'},
-    {"01BE(F", 'F'},
-    {"01BE(N", 'F'},
-    {"01BE(S", 'F'},
-    {"01BE(V", 'F'},
-    {"01BEK(", 'F'},
-    {"01BF()", 'F'},
-    {"01BF(1", 'F'},
-    {"01BF(F", 'F'},
-    {"01BF(N", 'F'},
-    {"01BF(S", 'F'},
-    {"01BF(V", 'F'},
-    {"01BN", 'F'},
-    {"01BN&(", 'F'},
-    {"01BN&1", 'F'},
-    {"01BN&F", 'F'},
-    {"01BN&N", 'F'},
-    {"01BN&S", 'F'},
-    {"01BN&V", 'F'},
-    {"01BN,(", 'F'},
-    {"01BN,F", 'F'},
-    {"01BN;", 'F'},
-    {"01BN;C", 'F'},
-    {"01BNB(", 'F'},
-    {"01BNB1", 'F'},
-    {"01BNBF", 'F'},
-    {"01BNBN", 'F'},
-    {"01BNBS", 'F'},
-    {"01BNBV", 'F'},
-    {"01BNC", 'F'},
-    {"01BNK(", 'F'},
-    {"01BNK1", 'F'},
-    {"01BNKF", 'F'},
-    {"01BNKN", 'F'},
-    {"01BNKS", 'F'},
-    {"01BNKV", 'F'},
-    {"01BNO(", 'F'},
-    {"01BNOF", 'F'},
-    {"01BNOS", 'F'},
-    {"01BNOV", 'F'},
-    {"01BNU(", 'F'},
-    {"01BNUE", 'F'},
-    {"01BS", 'F'},
-    {"01BS&(", 'F'},
-    {"01BS&1", 'F'},
-    {"01BS&F", 'F'},
-    {"01BS&N", 'F'},
-    {"01BS&S", 'F'},
-    {"01BS&V", 'F'},
-    {"01BS,(", 'F'},
-    {"01BS,F", 'F'},
-    {"01BS;", 'F'},
-    {"01BS;C", 'F'},
-    {"01BSB(", 'F'},
-    {"01BSB1", 'F'},
-    {"01BSBF", 'F'},
-    {"01BSBN", 'F'},
-    {"01BSBS", 'F'},
-    {"01BSBV", 'F'},
-    {"01BSC", 'F'},
-    {"01BSK(", 'F'},
-    {"01BSK1", 'F'},
-    {"01BSKF", 'F'},
-    {"01BSKN", 'F'},
-    {"01BSKS", 'F'},
-    {"01BSKV", 'F'},
-    {"01BSO(", 'F'},
-    {"01BSO1", 'F'},
-    {"01BSOF", 'F'},
-    {"01BSON", 'F'},
-    {"01BSOS", 'F'},
-    {"01BSOV", 'F'},
-    {"01BSU(", 'F'},
-    {"01BSUE", 'F'},
-    {"01BV", 'F'},
-    {"01BV&(", 'F'},
-    {"01BV&1", 'F'},
-    {"01BV&F", 'F'},
-    {"01BV&N", 'F'},
-    {"01BV&S", 'F'},
-    {"01BV&V", 'F'},
-    {"01BV,(", 'F'},
-    {"01BV,F", 'F'},
-    {"01BV;", 'F'},
-    {"01BV;C", 'F'},
-    {"01BVB(", 'F'},
-    {"01BVB1", 'F'},
-    {"01BVBF", 'F'},
-    {"01BVBN", 'F'},
-    {"01BVBS", 'F'},
-    {"01BVBV", 'F'},
-    {"01BVC", 'F'},
-    {"01BVK(", 'F'},
-    {"01BVK1", 'F'},
-    {"01BVKF", 'F'},
-    {"01BVKN", 'F'},
-    {"01BVKS", 'F'},
-    {"01BVKV", 'F'},
-    {"01BVO(", 'F'},
-    {"01BVOF", 'F'},
-    {"01BVOS", 'F'},
-    {"01BVU(", 'F'},
-    {"01BVUE", 'F'},
-    {"01C", 'F'},
-    {"01E(1)", 'F'},
-    {"01E(1O", 'F'},
-    {"01E(F(", 'F'},
-    {"01E(N)", 'F'},
-    {"01E(NO", 'F'},
-    {"01E(S)", 'F'},
-    {"01E(SO", 'F'},
-    {"01E(V)", 'F'},
-    {"01E(VO", 'F'},
-    {"01E1;T", 'F'},
-    {"01E1C", 'F'},
-    {"01E1O(", 'F'},
-    {"01E1OF", 'F'},
-    {"01E1OS", 'F'},
-    {"01E1OV", 'F'},
-    {"01E1T(", 'F'},
-    {"01E1T1", 'F'},
-    {"01E1TF", 'F'},
-    {"01E1TN", 'F'},
-    {"01E1TS", 'F'},
-    {"01E1TV", 'F'},
-    {"01E1UE", 'F'},
-    {"01EF()", 'F'},
-    {"01EF(1", 'F'},
-    {"01EF(F", 'F'},
-    {"01EF(N", 'F'},
-    {"01EF(S", 'F'},
-    {"01EF(V", 'F'},
-    {"01EK(1", 'F'},
-    {"01EK(E", 'F'},
-    {"01EK(F", 'F'},
-    {"01EK(N", 'F'},
-    {"01EK(S", 'F'},
-    {"01EK(V", 'F'},
-    {"01EK1;", 'F'},
-    {"01EK1C", 'F'},
-    {"01EK1O", 'F'},
-    {"01EK1T", 'F'},
-    {"01EK1U", 'F'},
-    {"01EKF(", 'F'},
-    {"01EKN;", 'F'},
-    {"01EKNC", 'F'},
-    {"01EKNE", 'F'},
-    {"01EKNT", 'F'},
-    {"01EKNU", 'F'},
-    {"01EKOK", 'F'},
-    {"01EKS;", 'F'},
-    {"01EKSC", 'F'},
-    {"01EKSO", 'F'},
-    {"01EKST", 'F'},
-    {"01EKSU", 'F'},
-    {"01EKU(", 'F'},
-    {"01EKU1", 'F'},
-    {"01EKUE", 'F'},
-    {"01EKUF", 'F'},
-    {"01EKUS", 'F'},
-    {"01EKUV", 'F'},
-    {"01EKV;", 'F'},
-    {"01EKVC", 'F'},
-    {"01EKVO", 'F'},
-    {"01EKVT", 'F'},
-    {"01EKVU", 'F'},
-    {"01EN;T", 'F'},
-    {"01ENC", 'F'},
-    {"01ENEN", 'F'},
-    {"01ENO(", 'F'},
-    {"01ENOF", 'F'},
-    {"01ENOS", 'F'},
-    {"01ENOV", 'F'},
-    {"01ENT(", 'F'},
-    {"01ENT1", 'F'},
-    {"01ENTF", 'F'},
-    {"01ENTN", 'F'},
-    {"01ENTS", 'F'},
-    {"01ENTV", 'F'},
-    {"01ENUE", 'F'},
-    {"01EOKN", 'F'},
-    {"01ES;T", 'F'},
-    {"01ESC", 'F'},
-    {"01ESO(", 'F'},
-    {"01ESO1", 'F'},
-    {"01ESOF", 'F'},
-    {"01ESON", 'F'},
-    {"01ESOS", 'F'},
-    {"01ESOV", 'F'},
-    {"01EST(", 'F'},
-    {"01EST1", 'F'},
-    {"01ESTF", 'F'},
-    {"01ESTN", 'F'},
-    {"01ESTS", 'F'},
-    {"01ESTV", 'F'},
-    {"01ESUE", 'F'},
-    {"01EU(1", 'F'},
-    {"01EU(F", 'F'},
-    {"01EU(N", 'F'},
-    {"01EU(S", 'F'},
-    {"01EU(V", 'F'},
-    {"01EU1,", 'F'},
-    {"01EU1C", 'F'},
-    {"01EU1O", 'F'},
-    {"01EUEF", 'F'},
-    {"01EUEK", 'F'},
-    {"01EUF(", 'F'},
-    {"01EUS,", 'F'},
-    {"01EUSC", 'F'},
-    {"01EUSO", 'F'},
-    {"01EUV,", 'F'},
-    {"01EUVC", 'F'},
-    {"01EUVO", 'F'},
-    {"01EV;T", 'F'},
-    {"01EVC", 'F'},
-    {"01EVO(", 'F'},
-    {"01EVOF", 'F'},
-    {"01EVOS", 'F'},
-    {"01EVT(", 'F'},
-    {"01EVT1", 'F'},
-    {"01EVTF", 'F'},
-    {"01EVTN", 'F'},
-    {"01EVTS", 'F'},
-    {"01EVTV", 'F'},
-    {"01EVUE", 'F'},
-    {"01F()1", 'F'},
-    {"01F()F", 'F'},
-    {"01F()K", 'F'},
-    {"01F()N", 'F'},
-    {"01F()O", 'F'},
-    {"01F()S", 'F'},
-    {"01F()U", 'F'},
-    {"01F()V", 'F'},
-    {"01F(1)", 'F'},
-    {"01F(1N", 'F'},
-    {"01F(1O", 'F'},
-    {"01F(E(", 'F'},
-    {"01F(E1", 'F'},
-    {"01F(EF", 'F'},
-    {"01F(EK", 'F'},
-    {"01F(EN", 'F'},
-    {"01F(ES", 'F'},
-    {"01F(EV", 'F'},
-    {"01F(F(", 'F'},
-    {"01F(N)", 'F'},
-    {"01F(N,", 'F'},
-    {"01F(NO", 'F'},
-    {"01F(S)", 'F'},
-    {"01F(SO", 'F'},
-    {"01F(V)", 'F'},
-    {"01F(VO", 'F'},
-    {"01K(1O", 'F'},
-    {"01K(F(", 'F'},
-    {"01K(N)", 'F'},
-    {"01K(NO", 'F'},
-    {"01K(S)", 'F'},
-    {"01K(SO", 'F'},
-    {"01K(V)", 'F'},
-    {"01K(VO", 'F'},
-    {"01K)&(", 'F'},
-    {"01K)&1", 'F'},
-    {"01K)&F", 'F'},
-    {"01K)&N", 'F'},
-    {"01K)&S", 'F'},
-    {"01K)&V", 'F'},
-    {"01K);E", 'F'},
-    {"01K);T", 'F'},
-    {"01K)B(", 'F'},
-    {"01K)B1", 'F'},
-    {"01K)BF", 'F'},
-    {"01K)BN", 'F'},
-    {"01K)BS", 'F'},
-    {"01K)BV", 'F'},
-    {"01K)E(", 'F'},
-    {"01K)E1", 'F'},
-    {"01K)EF", 'F'},
-    {"01K)EK", 'F'},
-    {"01K)EN", 'F'},
-    {"01K)ES", 'F'},
-    {"01K)EV", 'F'},
-    {"01K)F(", 'F'},
-    {"01K)O(", 'F'},
-    {"01K)OF", 'F'},
-    {"01K)UE", 'F'},
-    {"01K1", 'F'},
-    {"01K1&(", 'F'},
-    {"01K1&1", 'F'},
-    {"01K1&F", 'F'},
-    {"01K1&N", 'F'},
-    {"01K1&S", 'F'},
-    {"01K1&V", 'F'},
-    {"01K1;", 'F'},
-    {"01K1;C", 'F'},
-    {"01K1;E", 'F'},
-    {"01K1;T", 'F'},
-    {"01K1B(", 'F'},
-    {"01K1B1", 'F'},
-    {"01K1BF", 'F'},
-    {"01K1BN", 'F'},
-    {"01K1BS", 'F'},
-    {"01K1BV", 'F'},
-    {"01K1C", 'F'},
-    {"01K1E(", 'F'},
-    {"01K1E1", 'F'},
-    {"01K1EF", 'F'},
-    {"01K1EK", 'F'},
-    {"01K1EN", 'F'},
-    {"01K1ES", 'F'},
-    {"01K1EV", 'F'},
-    {"01K1O(", 'F'},
-    {"01K1OF", 'F'},
-    {"01K1OS", 'F'},
-    {"01K1OV", 'F'},
-    {"01K1U(", 'F'},
-    {"01K1UE", 'F'},
-    {"01KF()", 'F'},
-    {"01KF(1", 'F'},
-    {"01KF(F", 'F'},
-    {"01KF(N", 'F'},
-    {"01KF(S", 'F'},
-    {"01KF(V", 'F'},
-    {"01KN", 'F'},
-    {"01KN&(", 'F'},
-    {"01KN&1", 'F'},
-    {"01KN&F", 'F'},
-    {"01KN&N", 'F'},
-    {"01KN&S", 'F'},
-    {"01KN&V", 'F'},
-    {"01KN;", 'F'},
-    {"01KN;C", 'F'},
-    {"01KN;E", 'F'},
-    {"01KN;T", 'F'},
-    {"01KNB(", 'F'},
-    {"01KNB1", 'F'},
-    {"01KNBF", 'F'},
-    {"01KNBN", 'F'},
-    {"01KNBS", 'F'},
-    {"01KNBV", 'F'},
-    {"01KNC", 'F'},
-    {"01KNE(", 'F'},
-    {"01KNE1", 'F'},
-    {"01KNEF", 'F'},
-    {"01KNEN", 'F'},
-    {"01KNES", 'F'},
-    {"01KNEV", 'F'},
-    {"01KNU(", 'F'},
-    {"01KNUE", 'F'},
-    {"01KS", 'F'},
-    {"01KS&(", 'F'},
-    {"01KS&1", 'F'},
-    {"01KS&F", 'F'},
-    {"01KS&N", 'F'},
-    {"01KS&S", 'F'},
-    {"01KS&V", 'F'},
-    {"01KS;", 'F'},
-    {"01KS;C", 'F'},
-    {"01KS;E", 'F'},
-    {"01KS;T", 'F'},
-    {"01KSB(", 'F'},
-    {"01KSB1", 'F'},
-    {"01KSBF", 'F'},
-    {"01KSBN", 'F'},
-    {"01KSBS", 'F'},
-    {"01KSBV", 'F'},
-    {"01KSC", 'F'},
-    {"01KSE(", 'F'},
-    {"01KSE1", 'F'},
-    {"01KSEF", 'F'},
-    {"01KSEK", 'F'},
-    {"01KSEN", 'F'},
-    {"01KSES", 'F'},
-    {"01KSEV", 'F'},
-    {"01KSO(", 'F'},
-    {"01KSO1", 'F'},
-    {"01KSOF", 'F'},
-    {"01KSON", 'F'},
-    {"01KSOS", 'F'},
-    {"01KSOV", 'F'},
-    {"01KSU(", 'F'},
-    {"01KSUE", 'F'},
-    {"01KUE(", 'F'},
-    {"01KUE1", 'F'},
-    {"01KUEF", 'F'},
-    {"01KUEK", 'F'},
-    {"01KUEN", 'F'},
-    {"01KUES", 'F'},
-    {"01KUEV", 'F'},
-    {"01KV", 'F'},
-    {"01KV&(", 'F'},
-    {"01KV&1", 'F'},
-    {"01KV&F", 'F'},
-    {"01KV&N", 'F'},
-    {"01KV&S", 'F'},
-    {"01KV&V", 'F'},
-    {"01KV;", 'F'},
-    {"01KV;C", 'F'},
-    {"01KV;E", 'F'},
-    {"01KV;T", 'F'},
-    {"01KVB(", 'F'},
-    {"01KVB1", 'F'},
-    {"01KVBF", 'F'},
-    {"01KVBN", 'F'},
-    {"01KVBS", 'F'},
-    {"01KVBV", 'F'},
-    {"01KVC", 'F'},
-    {"01KVE(", 'F'},
-    {"01KVE1", 'F'},
-    {"01KVEF", 'F'},
-    {"01KVEK", 'F'},
-    {"01KVEN", 'F'},
-    {"01KVES", 'F'},
-    {"01KVEV", 'F'},
-    {"01KVO(", 'F'},
-    {"01KVOF", 'F'},
-    {"01KVOS", 'F'},
-    {"01KVU(", 'F'},
-    {"01KVUE", 'F'},
-    {"01N&F(", 'F'},
-    {"01N(1O", 'F'},
-    {"01N(F(", 'F'},
-    {"01N(S)", 'F'},
-    {"01N(SO", 'F'},
-    {"01N(V)", 'F'},
-    {"01N(VO", 'F'},
-    {"01N)UE", 'F'},
-    {"01N,F(", 'F'},
-    {"01NE(1", 'F'},
-    {"01NE(F", 'F'},
-    {"01NE(N", 'F'},
-    {"01NE(S", 'F'},
-    {"01NE(V", 'F'},
-    {"01NE1C", 'F'},
-    {"01NE1O", 'F'},
-    {"01NEF(", 'F'},
-    {"01NENC", 'F'},
-    {"01NENO", 'F'},
-    {"01NESC", 'F'},
-    {"01NESO", 'F'},
-    {"01NEVC", 'F'},
-    {"01NEVO", 'F'},
-    {"01NU(E", 'F'},
-    {"01NUE", 'F'},
-    {"01NUE(", 'F'},
-    {"01NUE1", 'F'},
-    {"01NUE;", 'F'},
-    {"01NUEC", 'F'},
-    {"01NUEF", 'F'},
-    {"01NUEK", 'F'},
-    {"01NUEN", 'F'},
-    {"01NUES", 'F'},
-    {"01NUEV", 'F'},
-    {"01O(1&", 'F'},
-    {"01O(1)", 'F'},
-    {"01O(1,", 'F'},
-    {"01O(1O", 'F'},
-    {"01O(E(", 'F'},
-    {"01O(E1", 'F'},
-    {"01O(EE", 'F'},
-    {"01O(EF", 'F'},
-    {"01O(EK", 'F'},
-    {"01O(EN", 'F'},
-    {"01O(EO", 'F'},
-    {"01O(ES", 'F'},
-    {"01O(EV", 'F'},
-    {"01O(F(", 'F'},
-    {"01O(N&", 'F'},
-    {"01O(N)", 'F'},
-    {"01O(N,", 'F'},
-    {"01O(NO", 'F'},
-    {"01O(S&", 'F'},
-    {"01O(S)", 'F'},
-    {"01O(S,", 'F'},
-    {"01O(SO", 'F'},
-    {"01O(V&", 'F'},
-    {"01O(V)", 'F'},
-    {"01O(V,", 'F'},
-    {"01O(VO", 'F'},
-    {"01OF()", 'F'},
-    {"01OF(1", 'F'},
-    {"01OF(E", 'F'},
-    {"01OF(F", 'F'},
-    {"01OF(N", 'F'},
-    {"01OF(S", 'F'},
-    {"01OF(V", 'F'},
-    {"01OK&(", 'F'},
-    {"01OK&1", 'F'},
-    {"01OK&F", 'F'},
-    {"01OK&N", 'F'},
-    {"01OK&S", 'F'},
-    {"01OK&V", 'F'},
-    {"01OK(1", 'F'},
-    {"01OK(F", 'F'},
-    {"01OK(N", 'F'},
-    {"01OK(S", 'F'},
-    {"01OK(V", 'F'},
-    {"01OK1C", 'F'},
-    {"01OK1O", 'F'},
-    {"01OKF(", 'F'},
-    {"01OKNC", 'F'},
-    {"01OKO(", 'F'},
-    {"01OKO1", 'F'},
-    {"01OKOF", 'F'},
-    {"01OKON", 'F'},
-    {"01OKOS", 'F'},
-    {"01OKOV", 'F'},
-    {"01OKSC", 'F'},
-    {"01OKSO", 'F'},
-    {"01OKVC", 'F'},
-    {"01OKVO", 'F'},
-    {"01ONSU", 'F'},
-    {"01OS&(", 'F'},
-    {"01OS&1", 'F'},
-    {"01OS&E", 'F'},
-    {"01OS&F", 'F'},
-    {"01OS&K", 'F'},
-    {"01OS&N", 'F'},
-    {"01OS&S", 'F'},
-    {"01OS&U", 'F'},
-    {"01OS&V", 'F'},
-    {"01OS(E", 'F'},
-    {"01OS(U", 'F'},
-    {"01OS)&", 'F'},
-    {"01OS),", 'F'},
-    {"01OS);", 'F'},
-    {"01OS)B", 'F'},
-    {"01OS)C", 'F'},
-    {"01OS)E", 'F'},
-    {"01OS)F", 'F'},
-    {"01OS)K", 'F'},
-    {"01OS)O", 'F'},
-    {"01OS)U", 'F'},
-    {"01OS,(", 'F'},
-    {"01OS,F", 'F'},
-    {"01OS1(", 'F'},
-    {"01OS1F", 'F'},
-    {"01OS1N", 'F'},
-    {"01OS1S", 'F'},
-    {"01OS1U", 'F'},
-    {"01OS1V", 'F'},
-    {"01OS;", 'F'},
-    {"01OS;C", 'F'},
-    {"01OS;E", 'F'},
-    {"01OS;N", 'F'},
-    {"01OS;T", 'F'},
-    {"01OSA(", 'F'},
-    {"01OSAF", 'F'},
-    {"01OSAS", 'F'},
-    {"01OSAT", 'F'},
-    {"01OSAV", 'F'},
-    {"01OSB(", 'F'},
-    {"01OSB1", 'F'},
-    {"01OSBE", 'F'},
-    {"01OSBF", 'F'},
-    {"01OSBN", 'F'},
-    {"01OSBS", 'F'},
-    {"01OSBV", 'F'},
-    {"01OSC", 'F'},
-    {"01OSE(", 'F'},
-    {"01OSE1", 'F'},
-    {"01OSEF", 'F'},
-    {"01OSEK", 'F'},
-    {"01OSEN", 'F'},
-    {"01OSEO", 'F'},
-    {"01OSES", 'F'},
-    {"01OSEU", 'F'},
-    {"01OSEV", 'F'},
-    {"01OSF(", 'F'},
-    {"01OSK(", 'F'},
-    {"01OSK)", 'F'},
-    {"01OSK1", 'F'},
-    {"01OSKB", 'F'},
-    {"01OSKF", 'F'},
-    {"01OSKN", 'F'},
-    {"01OSKS", 'F'},
-    {"01OSKU", 'F'},
-    {"01OSKV", 'F'},
-    {"01OST(", 'F'},
-    {"01OST1", 'F'},
-    {"01OSTE", 'F'},
-    {"01OSTF", 'F'},
-    {"01OSTN", 'F'},
-    {"01OSTS", 'F'},
-    {"01OSTT", 'F'},
-    {"01OSTV", 'F'},
-    {"01OSU", 'F'},
-    {"01OSU(", 'F'},
-    {"01OSU1", 'F'},
-    {"01OSU;", 'F'},
-    {"01OSUC", 'F'},
-    {"01OSUE", 'F'},
-    {"01OSUF", 'F'},
-    {"01OSUK", 'F'},
-    {"01OSUO", 'F'},
-    {"01OSUS", 'F'},
-    {"01OSUT", 'F'},
-    {"01OSUV", 'F'},
-    {"01OSV(", 'F'},
-    {"01OSVF", 'F'},
-    {"01OSVO", 'F'},
-    {"01OSVS", 'F'},
-    {"01OSVU", 'F'},
-    {"01OU(E", 'F'},
-    {"01OUEK", 'F'},
-    {"01OUEN", 'F'},
-    {"01OV", 'F'},
-    {"01OV&(", 'F'},
-    {"01OV&1", 'F'},
-    {"01OV&E", 'F'},
-    {"01OV&F", 'F'},
-    {"01OV&K", 'F'},
-    {"01OV&N", 'F'},
-    {"01OV&S", 'F'},
-    {"01OV&U", 'F'},
-    {"01OV&V", 'F'},
-    {"01OV(E", 'F'},
-    {"01OV(U", 'F'},
-    {"01OV)&", 'F'},
-    {"01OV),", 'F'},
-    {"01OV);", 'F'},
-    {"01OV)B", 'F'},
-    {"01OV)C", 'F'},
-    {"01OV)E", 'F'},
-    {"01OV)F", 'F'},
-    {"01OV)K", 'F'},
-    {"01OV)O", 'F'},
-    {"01OV)U", 'F'},
-    {"01OV,(", 'F'},
-    {"01OV,F", 'F'},
-    {"01OV;", 'F'},
-    {"01OV;C", 'F'},
-    {"01OV;E", 'F'},
-    {"01OV;N", 'F'},
-    {"01OV;T", 'F'},
-    {"01OVA(", 'F'},
-    {"01OVAF", 'F'},
-    {"01OVAS", 'F'},
-    {"01OVAT", 'F'},
-    {"01OVAV", 'F'},
-    {"01OVB(", 'F'},
-    {"01OVB1", 'F'},
-    {"01OVBE", 'F'},
-    {"01OVBF", 'F'},
-    {"01OVBN", 'F'},
-    {"01OVBS", 'F'},
-    {"01OVBV", 'F'},
-    {"01OVC", 'F'},
-    {"01OVE(", 'F'},
-    {"01OVE1", 'F'},
-    {"01OVEF", 'F'},
-    {"01OVEK", 'F'},
-    {"01OVEN", 'F'},
-    {"01OVEO", 'F'},
-    {"01OVES", 'F'},
-    {"01OVEU", 'F'},
-    {"01OVEV", 'F'},
-    {"01OVF(", 'F'},
-    {"01OVK(", 'F'},
-    {"01OVK)", 'F'},
-    {"01OVK1", 'F'},
-    {"01OVKB", 'F'},
-    {"01OVKF", 'F'},
-    {"01OVKN", 'F'},
-    {"01OVKS", 'F'},
-    {"01OVKU", 'F'},
-    {"01OVKV", 'F'},
-    {"01OVO(", 'F'},
-    {"01OVOF", 'F'},
-    {"01OVOK", 'F'},
-    {"01OVOS", 'F'},
-    {"01OVOU", 'F'},
-    {"01OVS(", 'F'},
-    {"01OVS1", 'F'},
-    {"01OVSF", 'F'},
-    {"01OVSO", 'F'},
-    {"01OVSU", 'F'},
-    {"01OVSV", 'F'},
-    {"01OVT(", 'F'},
-    {"01OVT1", 'F'},
-    {"01OVTE", 'F'},
-    {"01OVTF", 'F'},
-    {"01OVTN", 'F'},
-    {"01OVTS", 'F'},
-    {"01OVTT", 'F'},
-    {"01OVTV", 'F'},
-    {"01OVU", 'F'},
-    {"01OVU(", 'F'},
-    {"01OVU1", 'F'},
-    {"01OVU;", 'F'},
-    {"01OVUC", 'F'},
-    {"01OVUE", 'F'},
-    {"01OVUF", 'F'},
-    {"01OVUK", 'F'},
-    {"01OVUO", 'F'},
-    {"01OVUS", 'F'},
-    {"01OVUT", 'F'},
-    {"01OVUV", 'F'},
-    {"01SF()", 'F'},
-    {"01SF(1", 'F'},
-    {"01SF(F", 'F'},
-    {"01SF(N", 'F'},
-    {"01SF(S", 'F'},
-    {"01SF(V", 'F'},
-    {"01SUE", 'F'},
-    {"01SUE;", 'F'},
-    {"01SUEC", 'F'},
-    {"01SUEK", 'F'},
-    {"01SV", 'F'},
-    {"01SV;", 'F'},
-    {"01SV;C", 'F'},
-    {"01SVC", 'F'},
-    {"01SVO(", 'F'},
-    {"01SVOF", 'F'},
-    {"01SVOS", 'F'},
-    {"01T(1)", 'F'},
-    {"01T(1O", 'F'},
-    {"01T(F(", 'F'},
-    {"01T(N)", 'F'},
-    {"01T(NO", 'F'},
-    {"01T(S)", 'F'},
-    {"01T(SO", 'F'},
-    {"01T(V)", 'F'},
-    {"01T(VO", 'F'},
-    {"01T1(F", 'F'},
-    {"01T1O(", 'F'},
-    {"01T1OF", 'F'},
-    {"01T1OS", 'F'},
-    {"01T1OV", 'F'},
-    {"01TE(1", 'F'},
-    {"01TE(F", 'F'},
-    {"01TE(N", 'F'},
-    {"01TE(S", 'F'},
-    {"01TE(V", 'F'},
-    {"01TE1N", 'F'},
-    {"01TE1O", 'F'},
-    {"01TEF(", 'F'},
-    {"01TEK(", 'F'},
-    {"01TEK1", 'F'},
-    {"01TEKF", 'F'},
-    {"01TEKN", 'F'},
-    {"01TEKS", 'F'},
-    {"01TEKV", 'F'},
-    {"01TENN", 'F'},
-    {"01TENO", 'F'},
-    {"01TESN", 'F'},
-    {"01TESO", 'F'},
-    {"01TEVN", 'F'},
-    {"01TEVO", 'F'},
-    {"01TF()", 'F'},
-    {"01TF(1", 'F'},
-    {"01TF(F", 'F'},
-    {"01TF(N", 'F'},
-    {"01TF(S", 'F'},
-    {"01TF(V", 'F'},
-    {"01TN(1", 'F'},
-    {"01TN(F", 'F'},
-    {"01TN(S", 'F'},
-    {"01TN(V", 'F'},
-    {"01TN1C", 'F'},
-    {"01TN1O", 'F'},
-    {"01TN;E", 'F'},
-    {"01TN;N", 'F'},
-    {"01TN;T", 'F'},
-    {"01TNE(", 'F'},
-    {"01TNE1", 'F'},
-    {"01TNEF", 'F'},
-    {"01TNEN", 'F'},
-    {"01TNES", 'F'},
-    {"01TNEV", 'F'},
-    {"01TNF(", 'F'},
-    {"01TNKN", 'F'},
-    {"01TNN:", 'F'},
-    {"01TNNC", 'F'},
-    {"01TNNO", 'F'},
-    {"01TNO(", 'F'},
-    {"01TNOF", 'F'},
-    {"01TNOS", 'F'},
-    {"01TNOV", 'F'},
-    {"01TNSC", 'F'},
-    {"01TNSO", 'F'},
-    {"01TNT(", 'F'},
-    {"01TNT1", 'F'},
-    {"01TNTF", 'F'},
-    {"01TNTN", 'F'},
-    {"01TNTS", 'F'},
-    {"01TNTV", 'F'},
-    {"01TNVC", 'F'},
-    {"01TNVO", 'F'},
-    {"01TS(F", 'F'},
-    {"01TSO(", 'F'},
-    {"01TSO1", 'F'},
-    {"01TSOF", 'F'},
-    {"01TSON", 'F'},
-    {"01TSOS", 'F'},
-    {"01TSOV", 'F'},
-    {"01TTNE", 'F'},
-    {"01TTNK", 'F'},
-    {"01TTNN", 'F'},
-    {"01TTNT", 'F'},
-    {"01TV(1", 'F'},
-    {"01TV(F", 'F'},
-    {"01TVO(", 'F'},
-    {"01TVOF", 'F'},
-    {"01TVOS", 'F'},
-    {"01U", 'F'},
-    {"01U(1)", 'F'},
-    {"01U(1O", 'F'},
-    {"01U(E(", 'F'},
-    {"01U(E1", 'F'},
-    {"01U(EF", 'F'},
-    {"01U(EK", 'F'},
-    {"01U(EN", 'F'},
-    {"01U(ES", 'F'},
-    {"01U(EV", 'F'},
-    {"01U(F(", 'F'},
-    {"01U(N)", 'F'},
-    {"01U(NO", 'F'},
-    {"01U(S)", 'F'},
-    {"01U(SO", 'F'},
-    {"01U(V)", 'F'},
-    {"01U(VO", 'F'},
-    {"01U1,(", 'F'},
-    {"01U1,F", 'F'},
-    {"01U1C", 'F'},
-    {"01U1O(", 'F'},
-    {"01U1OF", 'F'},
-    {"01U1OS", 'F'},
-    {"01U1OV", 'F'},
-    {"01U;", 'F'},
-    {"01U;C", 'F'},
-    {"01UC", 'F'},
-    {"01UE", 'F'},
-    {"01UE(1", 'F'},
-    {"01UE(E", 'F'},
-    {"01UE(F", 'F'},
-    {"01UE(N", 'F'},
-    {"01UE(O", 'F'},
-    {"01UE(S", 'F'},
-    {"01UE(V", 'F'},
-    {"01UE1", 'F'},
-    {"01UE1&", 'F'},
-    {"01UE1(", 'F'},
-    {"01UE1)", 'F'},
-    {"01UE1,", 'F'},
-    {"01UE1;", 'F'},
-    {"01UE1B", 'F'},
-    {"01UE1C", 'F'},
-    {"01UE1F", 'F'},
-    {"01UE1K", 'F'},
-    {"01UE1N", 'F'},
-    {"01UE1O", 'F'},
-    {"01UE1S", 'F'},
-    {"01UE1U", 'F'},
-    {"01UE1V", 'F'},
-    {"01UE;", 'F'},
-    {"01UE;C", 'F'},
-    {"01UEC", 'F'},
-    {"01UEF", 'F'},
-    {"01UEF(", 'F'},
-    {"01UEF,", 'F'},
-    {"01UEF;", 'F'},
-    {"01UEFC", 'F'},
-    {"01UEK", 'F'},
-    {"01UEK(", 'F'},
-    {"01UEK1", 'F'},
-    {"01UEK;", 'F'},
-    {"01UEKC", 'F'},
-    {"01UEKF", 'F'},
-    {"01UEKN", 'F'},
-    {"01UEKO", 'F'},
-    {"01UEKS", 'F'},
-    {"01UEKV", 'F'},
-    {"01UEN", 'F'},
-    {"01UEN&", 'F'},
-    {"01UEN(", 'F'},
-    {"01UEN)", 'F'},
-    {"01UEN,", 'F'},
-    {"01UEN1", 'F'},
-    {"01UEN;", 'F'},
-    {"01UENB", 'F'},
-    {"01UENC", 'F'},
-    {"01UENF", 'F'},
-    {"01UENK", 'F'},
-    {"01UENN", 'F'},
-    {"01UENO", 'F'},
-    {"01UENS", 'F'},
-    {"01UENU", 'F'},
-    {"01UEOK", 'F'},
-    {"01UEON", 'F'},
-    {"01UES", 'F'},
-    {"01UES&", 'F'},
-    {"01UES(", 'F'},
-    {"01UES)", 'F'},
-    {"01UES,", 'F'},
-    {"01UES1", 'F'},
-    {"01UES;", 'F'},
-    {"01UESB", 'F'},
-    {"01UESC", 'F'},
-    {"01UESF", 'F'},
-    {"01UESK", 'F'},
-    {"01UESO", 'F'},
-    {"01UESU", 'F'},
-    {"01UESV", 'F'},
-    {"01UEV", 'F'},
-    {"01UEV&", 'F'},
-    {"01UEV(", 'F'},
-    {"01UEV)", 'F'},
-    {"01UEV,", 'F'},
-    {"01UEV;", 'F'},
-    {"01UEVB", 'F'},
-    {"01UEVC", 'F'},
-    {"01UEVF", 'F'},
-    {"01UEVK", 'F'},
-    {"01UEVN", 'F'},
-    {"01UEVO", 'F'},
-    {"01UEVS", 'F'},
-    {"01UEVU", 'F'},
-    {"01UF()", 'F'},
-    {"01UF(1", 'F'},
-    {"01UF(F", 'F'},
-    {"01UF(N", 'F'},
-    {"01UF(S", 'F'},
-    {"01UF(V", 'F'},
-    {"01UK(E", 'F'},
-    {"01UO(E", 'F'},
-    {"01UON(", 'F'},
-    {"01UON1", 'F'},
-    {"01UONF", 'F'},
-    {"01UONS", 'F'},
-    {"01US,(", 'F'},
-    {"01US,F", 'F'},
-    {"01USC", 'F'},
-    {"01USO(", 'F'},
-    {"01USO1", 'F'},
-    {"01USOF", 'F'},
-    {"01USON", 'F'},
-    {"01USOS", 'F'},
-    {"01USOV", 'F'},
-    {"01UTN(", 'F'},
-    {"01UTN1", 'F'},
-    {"01UTNF", 'F'},
-    {"01UTNN", 'F'},
-    {"01UTNS", 'F'},
-    {"01UTNV", 'F'},
-    {"01UV,(", 'F'},
-    {"01UV,F", 'F'},
-    {"01UVC", 'F'},
-    {"01UVO(", 'F'},
-    {"01UVOF", 'F'},
-    {"01UVOS", 'F'},
-    {"01VF()", 'F'},
-    {"01VF(1", 'F'},
-    {"01VF(F", 'F'},
-    {"01VF(N", 'F'},
-    {"01VF(S", 'F'},
-    {"01VF(V", 'F'},
-    {"01VO(1", 'F'},
-    {"01VO(F", 'F'},
-    {"01VO(N", 'F'},
-    {"01VO(S", 'F'},
-    {"01VO(V", 'F'},
-    {"01VOF(", 'F'},
-    {"01VOS(", 'F'},
-    {"01VOS1", 'F'},
-    {"01VOSF", 'F'},
-    {"01VOSU", 'F'},
-    {"01VOSV", 'F'},
-    {"01VS", 'F'},
-    {"01VS;", 'F'},
-    {"01VS;C", 'F'},
-    {"01VSC", 'F'},
-    {"01VSO(", 'F'},
-    {"01VSO1", 'F'},
-    {"01VSOF", 'F'},
-    {"01VSON", 'F'},
-    {"01VSOS", 'F'},
-    {"01VSOV", 'F'},
-    {"01VUE", 'F'},
-    {"01VUE;", 'F'},
-    {"01VUEC", 'F'},
-    {"01VUEK", 'F'},
-    {"0;T(EF", 'F'},
-    {"0;T(EK", 'F'},
-    {"0;TKNC", 'F'},
-    {"0E(1&(", 'F'},
-    {"0E(1&1", 'F'},
-    {"0E(1&F", 'F'},
-    {"0E(1&N", 'F'},
-    {"0E(1&S", 'F'},
-    {"0E(1&V", 'F'},
-    {"0E(1)&", 'F'},
-    {"0E(1),", 'F'},
-    {"0E(1)1", 'F'},
-    {"0E(1);", 'F'},
-    {"0E(1)B", 'F'},
-    {"0E(1)C", 'F'},
-    {"0E(1)F", 'F'},
-    {"0E(1)K", 'F'},
-    {"0E(1)N", 'F'},
-    {"0E(1)O", 'F'},
-    {"0E(1)S", 'F'},
-    {"0E(1)U", 'F'},
-    {"0E(1)V", 'F'},
-    {"0E(1,F", 'F'},
-    {"0E(1F(", 'F'},
-    {"0E(1N)", 'F'},
-    {"0E(1O(", 'F'},
-    {"0E(1OF", 'F'},
-    {"0E(1OS", 'F'},
-    {"0E(1OV", 'F'},
-    {"0E(1S)", 'F'},
-    {"0E(1V)", 'F'},
-    {"0E(1VO", 'F'},
-    {"0E(E(1", 'F'},
-    {"0E(E(E", 'F'},
-    {"0E(E(F", 'F'},
-    {"0E(E(N", 'F'},
-    {"0E(E(S", 'F'},
-    {"0E(E(V", 'F'},
-    {"0E(E1&", 'F'},
-    {"0E(E1)", 'F'},
-    {"0E(E1O", 'F'},
-    {"0E(EF(", 'F'},
-    {"0E(EK(", 'F'},
-    {"0E(EK1", 'F'},
-    {"0E(EKF", 'F'},
-    {"0E(EKN", 'F'},
-    {"0E(EKS", 'F'},
-    {"0E(EKV", 'F'},
-    {"0E(EN&", 'F'},
-    {"0E(EN)", 'F'},
-    {"0E(ENO", 'F'},
-    {"0E(ES&", 'F'},
-    {"0E(ES)", 'F'},
-    {"0E(ESO", 'F'},
-    {"0E(EV&", 'F'},
-    {"0E(EV)", 'F'},
-    {"0E(EVO", 'F'},
-    {"0E(F()", 'F'},
-    {"0E(F(1", 'F'},
-    {"0E(F(E", 'F'},
-    {"0E(F(F", 'F'},
-    {"0E(F(N", 'F'},
-    {"0E(F(S", 'F'},
-    {"0E(F(V", 'F'},
-    {"0E(N&(", 'F'},
-    {"0E(N&1", 'F'},
-    {"0E(N&F", 'F'},
-    {"0E(N&N", 'F'},
-    {"0E(N&S", 'F'},
-    {"0E(N&V", 'F'},
-    {"0E(N(1", 'F'},
-    {"0E(N(F", 'F'},
-    {"0E(N(S", 'F'},
-    {"0E(N(V", 'F'},
-    {"0E(N)&", 'F'},
-    {"0E(N),", 'F'},
-    {"0E(N)1", 'F'},
-    {"0E(N);", 'F'},
-    {"0E(N)B", 'F'},
-    {"0E(N)C", 'F'},
-    {"0E(N)F", 'F'},
-    {"0E(N)K", 'F'},
-    {"0E(N)N", 'F'},
-    {"0E(N)O", 'F'},
-    {"0E(N)S", 'F'},
-    {"0E(N)U", 'F'},
-    {"0E(N)V", 'F'},
-    {"0E(N,F", 'F'},
-    {"0E(N1)", 'F'},
-    {"0E(N1O", 'F'},
-    {"0E(NF(", 'F'},
-    {"0E(NO(", 'F'},
-    {"0E(NOF", 'F'},
-    {"0E(NOS", 'F'},
-    {"0E(NOV", 'F'},
-    {"0E(S&(", 'F'},
-    {"0E(S&1", 'F'},
-    {"0E(S&F", 'F'},
-    {"0E(S&N", 'F'},
-    {"0E(S&S", 'F'},
-    {"0E(S&V", 'F'},
-    {"0E(S)&", 'F'},
-    {"0E(S),", 'F'},
-    {"0E(S)1", 'F'},
-    {"0E(S);", 'F'},
-    {"0E(S)B", 'F'},
-    {"0E(S)C", 'F'},
-    {"0E(S)F", 'F'},
-    {"0E(S)K", 'F'},
-    {"0E(S)N", 'F'},
-    {"0E(S)O", 'F'},
-    {"0E(S)S", 'F'},
-    {"0E(S)U", 'F'},
-    {"0E(S)V", 'F'},
-    {"0E(S,F", 'F'},
-    {"0E(S1)", 'F'},
-    {"0E(SF(", 'F'},
-    {"0E(SO(", 'F'},
-    {"0E(SO1", 'F'},
-    {"0E(SOF", 'F'},
-    {"0E(SON", 'F'},
-    {"0E(SOS", 'F'},
-    {"0E(SOV", 'F'},
-    {"0E(SV)", 'F'},
-    {"0E(SVO", 'F'},
-    {"0E(V&(", 'F'},
-    {"0E(V&1", 'F'},
-    {"0E(V&F", 'F'},
-    {"0E(V&N", 'F'},
-    {"0E(V&S", 'F'},
-    {"0E(V&V", 'F'},
-    {"0E(V)&", 'F'},
-    {"0E(V),", 'F'},
-    {"0E(V)1", 'F'},
-    {"0E(V);", 'F'},
-    {"0E(V)B", 'F'},
-    {"0E(V)C", 'F'},
-    {"0E(V)F", 'F'},
-    {"0E(V)K", 'F'},
-    {"0E(V)N", 'F'},
-    {"0E(V)O", 'F'},
-    {"0E(V)S", 'F'},
-    {"0E(V)U", 'F'},
-    {"0E(V)V", 'F'},
-    {"0E(V,F", 'F'},
-    {"0E(VF(", 'F'},
-    {"0E(VO(", 'F'},
-    {"0E(VOF", 'F'},
-    {"0E(VOS", 'F'},
-    {"0E(VS)", 'F'},
-    {"0E(VSO", 'F'},
-    {"0E1&(1", 'F'},
-    {"0E1&(E", 'F'},
-    {"0E1&(F", 'F'},
-    {"0E1&(N", 'F'},
-    {"0E1&(S", 'F'},
-    {"0E1&(V", 'F'},
-    {"0E1&1)", 'F'},
-    {"0E1&1O", 'F'},
-    {"0E1&F(", 'F'},
-    {"0E1&N)", 'F'},
-    {"0E1&NO", 'F'},
-    {"0E1&S)", 'F'},
-    {"0E1&SO", 'F'},
-    {"0E1&V)", 'F'},
-    {"0E1&VO", 'F'},
-    {"0E1)", 'F'},
-    {"0E1)&(", 'F'},
-    {"0E1)&1", 'F'},
-    {"0E1)&F", 'F'},
-    {"0E1)&N", 'F'},
-    {"0E1)&S", 'F'},
-    {"0E1)&V", 'F'},
-    {"0E1);", 'F'},
-    {"0E1);(", 'F'},
-    {"0E1);C", 'F'},
-    {"0E1);E", 'F'},
-    {"0E1);T", 'F'},
-    {"0E1)C", 'F'},
-    {"0E1)KN", 'F'},
-    {"0E1)O(", 'F'},
-    {"0E1)O1", 'F'},
-    {"0E1)OF", 'F'},
-    {"0E1)ON", 'F'},
-    {"0E1)OS", 'F'},
-    {"0E1)OV", 'F'},
-    {"0E1)UE", 'F'},
-    {"0E1,(1", 'F'},
-    {"0E1,(F", 'F'},
-    {"0E1,(N", 'F'},
-    {"0E1,(S", 'F'},
-    {"0E1,(V", 'F'},
-    {"0E1,F(", 'F'},
-    {"0E1;(E", 'F'},
-    {"0E1B(1", 'F'},
-    {"0E1B(F", 'F'},
-    {"0E1B(N", 'F'},
-    {"0E1B(S", 'F'},
-    {"0E1B(V", 'F'},
-    {"0E1B1)", 'F'},
-    {"0E1B1O", 'F'},
-    {"0E1BF(", 'F'},
-    {"0E1BN)", 'F'},
-    {"0E1BNO", 'F'},
-    {"0E1BS)", 'F'},
-    {"0E1BSO", 'F'},
-    {"0E1BV)", 'F'},
-    {"0E1BVO", 'F'},
-    {"0E1F()", 'F'},
-    {"0E1F(1", 'F'},
-    {"0E1F(F", 'F'},
-    {"0E1F(N", 'F'},
-    {"0E1F(S", 'F'},
-    {"0E1F(V", 'F'},
-    {"0E1K(1", 'F'},
-    {"0E1K(E", 'F'},
-    {"0E1K(F", 'F'},
-    {"0E1K(N", 'F'},
-    {"0E1K(S", 'F'},
-    {"0E1K(V", 'F'},
-    {"0E1K1)", 'F'},
-    {"0E1K1K", 'F'},
-    {"0E1K1O", 'F'},
-    {"0E1KF(", 'F'},
-    {"0E1KN", 'F'},
-    {"0E1KN)", 'F'},
-    {"0E1KN;", 'F'},
-    {"0E1KNC", 'F'},
-    {"0E1KNK", 'F'},
-    {"0E1KNU", 'F'},
-    {"0E1KS)", 'F'},
-    {"0E1KSK", 'F'},
-    {"0E1KSO", 'F'},
-    {"0E1KV)", 'F'},
-    {"0E1KVK", 'F'},
-    {"0E1KVO", 'F'},
-    {"0E1N)U", 'F'},
-    {"0E1N;", 'F'},
-    {"0E1N;C", 'F'},
-    {"0E1NC", 'F'},
-    {"0E1NKN", 'F'},
-    {"0E1O(1", 'F'},
-    {"0E1O(E", 'F'},
-    {"0E1O(F", 'F'},
-    {"0E1O(N", 'F'},
-    {"0E1O(S", 'F'},
-    {"0E1O(V", 'F'},
-    {"0E1OF(", 'F'},
-    {"0E1OS&", 'F'},
-    {"0E1OS(", 'F'},
-    {"0E1OS)", 'F'},
-    {"0E1OS,", 'F'},
-    {"0E1OS1", 'F'},
-    {"0E1OS;", 'F'},
-    {"0E1OSB", 'F'},
-    {"0E1OSF", 'F'},
-    {"0E1OSK", 'F'},
-    {"0E1OSU", 'F'},
-    {"0E1OSV", 'F'},
-    {"0E1OV&", 'F'},
-    {"0E1OV(", 'F'},
-    {"0E1OV)", 'F'},
-    {"0E1OV,", 'F'},
-    {"0E1OV;", 'F'},
-    {"0E1OVB", 'F'},
-    {"0E1OVF", 'F'},
-    {"0E1OVK", 'F'},
-    {"0E1OVO", 'F'},
-    {"0E1OVS", 'F'},
-    {"0E1OVU", 'F'},
-    {"0E1S;", 'F'},
-    {"0E1S;C", 'F'},
-    {"0E1SC", 'F'},
-    {"0E1U(E", 'F'},
-    {"0E1UE(", 'F'},
-    {"0E1UE1", 'F'},
-    {"0E1UEF", 'F'},
-    {"0E1UEK", 'F'},
-    {"0E1UEN", 'F'},
-    {"0E1UES", 'F'},
-    {"0E1UEV", 'F'},
-    {"0E1V", 'F'},
-    {"0E1V;", 'F'},
-    {"0E1V;C", 'F'},
-    {"0E1VC", 'F'},
-    {"0E1VO(", 'F'},
-    {"0E1VOF", 'F'},
-    {"0E1VOS", 'F'},
-    {"0EE(F(", 'F'},
-    {"0EEK(F", 'F'},
-    {"0EF()&", 'F'},
-    {"0EF(),", 'F'},
-    {"0EF()1", 'F'},
-    {"0EF();", 'F'},
-    {"0EF()B", 'F'},
-    {"0EF()F", 'F'},
-    {"0EF()K", 'F'},
-    {"0EF()N", 'F'},
-    {"0EF()O", 'F'},
-    {"0EF()S", 'F'},
-    {"0EF()U", 'F'},
-    {"0EF()V", 'F'},
-    {"0EF(1&", 'F'},
-    {"0EF(1)", 'F'},
-    {"0EF(1,", 'F'},
-    {"0EF(1O", 'F'},
-    {"0EF(E(", 'F'},
-    {"0EF(E1", 'F'},
-    {"0EF(EF", 'F'},
-    {"0EF(EK", 'F'},
-    {"0EF(EN", 'F'},
-    {"0EF(ES", 'F'},
-    {"0EF(EV", 'F'},
-    {"0EF(F(", 'F'},
-    {"0EF(N&", 'F'},
-    {"0EF(N)", 'F'},
-    {"0EF(N,", 'F'},
-    {"0EF(NO", 'F'},
-    {"0EF(O)", 'F'},
-    {"0EF(S&", 'F'},
-    {"0EF(S)", 'F'},
-    {"0EF(S,", 'F'},
-    {"0EF(SO", 'F'},
-    {"0EF(V&", 'F'},
-    {"0EF(V)", 'F'},
-    {"0EF(V,", 'F'},
-    {"0EF(VO", 'F'},
-    {"0EK(1&", 'F'},
-    {"0EK(1(", 'F'},
-    {"0EK(1)", 'F'},
-    {"0EK(1,", 'F'},
-    {"0EK(1F", 'F'},
-    {"0EK(1N", 'F'},
-    {"0EK(1O", 'F'},
-    {"0EK(1S", 'F'},
-    {"0EK(1V", 'F'},
-    {"0EK(E(", 'F'},
-    {"0EK(E1", 'F'},
-    {"0EK(EF", 'F'},
-    {"0EK(EK", 'F'},
-    {"0EK(EN", 'F'},
-    {"0EK(ES", 'F'},
-    {"0EK(EV", 'F'},
-    {"0EK(F(", 'F'},
-    {"0EK(N&", 'F'},
-    {"0EK(N(", 'F'},
-    {"0EK(N)", 'F'},
-    {"0EK(N,", 'F'},
-    {"0EK(N1", 'F'},
-    {"0EK(NF", 'F'},
-    {"0EK(NO", 'F'},
-    {"0EK(S&", 'F'},
-    {"0EK(S(", 'F'},
-    {"0EK(S)", 'F'},
-    {"0EK(S,", 'F'},
-    {"0EK(S1", 'F'},
-    {"0EK(SF", 'F'},
-    {"0EK(SO", 'F'},
-    {"0EK(SV", 'F'},
-    {"0EK(V&", 'F'},
-    {"0EK(V(", 'F'},
-    {"0EK(V)", 'F'},
-    {"0EK(V,", 'F'},
-    {"0EK(VF", 'F'},
-    {"0EK(VO", 'F'},
-    {"0EK(VS", 'F'},
-    {"0EK1&(", 'F'},
-    {"0EK1&1", 'F'},
-    {"0EK1&F", 'F'},
-    {"0EK1&N", 'F'},
-    {"0EK1&S", 'F'},
-    {"0EK1&V", 'F'},
-    {"0EK1)", 'F'},
-    {"0EK1)&", 'F'},
-    {"0EK1);", 'F'},
-    {"0EK1)C", 'F'},
-    {"0EK1)K", 'F'},
-    {"0EK1)O", 'F'},
-    {"0EK1)U", 'F'},
-    {"0EK1,(", 'F'},
-    {"0EK1,F", 'F'},
-    {"0EK1;(", 'F'},
-    {"0EK1B(", 'F'},
-    {"0EK1B1", 'F'},
-    {"0EK1BF", 'F'},
-    {"0EK1BN", 'F'},
-    {"0EK1BS", 'F'},
-    {"0EK1BV", 'F'},
-    {"0EK1F(", 'F'},
-    {"0EK1K(", 'F'},
-    {"0EK1K1", 'F'},
-    {"0EK1KF", 'F'},
-    {"0EK1KN", 'F'},
-    {"0EK1KS", 'F'},
-    {"0EK1KV", 'F'},
-    {"0EK1N", 'F'},
-    {"0EK1N)", 'F'},
-    {"0EK1N;", 'F'},
-    {"0EK1NC", 'F'},
-    {"0EK1NK", 'F'},
-    {"0EK1O(", 'F'},
-    {"0EK1OF", 'F'},
-    {"0EK1OS", 'F'},
-    {"0EK1OV", 'F'},
-    {"0EK1S", 'F'},
-    {"0EK1S;", 'F'},
-    {"0EK1SC", 'F'},
-    {"0EK1SF", 'F'},
-    {"0EK1SK", 'F'},
-    {"0EK1U(", 'F'},
-    {"0EK1UE", 'F'},
-    {"0EK1V", 'F'},
-    {"0EK1V;", 'F'},
-    {"0EK1VC", 'F'},
-    {"0EK1VF", 'F'},
-    {"0EK1VK", 'F'},
-    {"0EK1VO", 'F'},
-    {"0EKE(F", 'F'},
-    {"0EKEK(", 'F'},
-    {"0EKF()", 'F'},
-    {"0EKF(1", 'F'},
-    {"0EKF(E", 'F'},
-    {"0EKF(F", 'F'},
-    {"0EKF(N", 'F'},
-    {"0EKF(O", 'F'},
-    {"0EKF(S", 'F'},
-    {"0EKF(V", 'F'},
-    {"0EKN&(", 'F'},
-    {"0EKN&1", 'F'},
-    {"0EKN&F", 'F'},
-    {"0EKN&N", 'F'},
-    {"0EKN&S", 'F'},
-    {"0EKN&V", 'F'},
-    {"0EKN(1", 'F'},
-    {"0EKN(F", 'F'},
-    {"0EKN(S", 'F'},
-    {"0EKN(V", 'F'},
-    {"0EKN)", 'F'},
-    {"0EKN)&", 'F'},
-    {"0EKN);", 'F'},
-    {"0EKN)C", 'F'},
-    {"0EKN)K", 'F'},
-    {"0EKN)O", 'F'},
-    {"0EKN)U", 'F'},
-    {"0EKN,(", 'F'},
-    {"0EKN,F", 'F'},
-    {"0EKN1", 'F'},
-    {"0EKN1;", 'F'},
-    {"0EKN1C", 'F'},
-    {"0EKN1K", 'F'},
-    {"0EKN1O", 'F'},
-    {"0EKN;(", 'F'},
-    {"0EKNB(", 'F'},
-    {"0EKNB1", 'F'},
-    {"0EKNBF", 'F'},
-    {"0EKNBN", 'F'},
-    {"0EKNBS", 'F'},
-    {"0EKNBV", 'F'},
-    {"0EKNF(", 'F'},
-    {"0EKNK(", 'F'},
-    {"0EKNK1", 'F'},
-    {"0EKNKF", 'F'},
-    {"0EKNKN", 'F'},
-    {"0EKNKS", 'F'},
-    {"0EKNKV", 'F'},
-    {"0EKNU(", 'F'},
-    {"0EKNUE", 'F'},
-    {"0EKO(1", 'F'},
-    {"0EKO(F", 'F'},
-    {"0EKO(N", 'F'},
-    {"0EKO(S", 'F'},
-    {"0EKO(V", 'F'},
-    {"0EKOK(", 'F'},
-    {"0EKOKN", 'F'},
-    {"0EKS&(", 'F'},
-    {"0EKS&1", 'F'},
-    {"0EKS&F", 'F'},
-    {"0EKS&N", 'F'},
-    {"0EKS&S", 'F'},
-    {"0EKS&V", 'F'},
-    {"0EKS)", 'F'},
-    {"0EKS)&", 'F'},
-    {"0EKS);", 'F'},
-    {"0EKS)C", 'F'},
-    {"0EKS)K", 'F'},
-    {"0EKS)O", 'F'},
-    {"0EKS)U", 'F'},
-    {"0EKS,(", 'F'},
-    {"0EKS,F", 'F'},
-    {"0EKS1", 'F'},
-    {"0EKS1;", 'F'},
-    {"0EKS1C", 'F'},
-    {"0EKS1F", 'F'},
-    {"0EKS1K", 'F'},
-    {"0EKS;(", 'F'},
-    {"0EKSB(", 'F'},
-    {"0EKSB1", 'F'},
-    {"0EKSBF", 'F'},
-    {"0EKSBN", 'F'},
-    {"0EKSBS", 'F'},
-    {"0EKSBV", 'F'},
-    {"0EKSF(", 'F'},
-    {"0EKSK(", 'F'},
-    {"0EKSK1", 'F'},
-    {"0EKSKF", 'F'},
-    {"0EKSKN", 'F'},
-    {"0EKSKS", 'F'},
-    {"0EKSKV", 'F'},
-    {"0EKSO(", 'F'},
-    {"0EKSO1", 'F'},
-    {"0EKSOF", 'F'},
-    {"0EKSON", 'F'},
-    {"0EKSOS", 'F'},
-    {"0EKSOV", 'F'},
-    {"0EKSU(", 'F'},
-    {"0EKSUE", 'F'},
-    {"0EKSV", 'F'},
-    {"0EKSV;", 'F'},
-    {"0EKSVC", 'F'},
-    {"0EKSVF", 'F'},
-    {"0EKSVK", 'F'},
-    {"0EKSVO", 'F'},
-    {"0EKV&(", 'F'},
-    {"0EKV&1", 'F'},
-    {"0EKV&F", 'F'},
-    {"0EKV&N", 'F'},
-    {"0EKV&S", 'F'},
-    {"0EKV&V", 'F'},
-    {"0EKV)", 'F'},
-    {"0EKV)&", 'F'},
-    {"0EKV);", 'F'},
-    {"0EKV)C", 'F'},
-    {"0EKV)K", 'F'},
-    {"0EKV)O", 'F'},
-    {"0EKV)U", 'F'},
-    {"0EKV,(", 'F'},
-    {"0EKV,F", 'F'},
-    {"0EKV;(", 'F'},
-    {"0EKVB(", 'F'},
-    {"0EKVB1", 'F'},
-    {"0EKVBF", 'F'},
-    {"0EKVBN", 'F'},
-    {"0EKVBS", 'F'},
-    {"0EKVBV", 'F'},
-    {"0EKVF(", 'F'},
-    {"0EKVK(", 'F'},
-    {"0EKVK1", 'F'},
-    {"0EKVKF", 'F'},
-    {"0EKVKN", 'F'},
-    {"0EKVKS", 'F'},
-    {"0EKVKV", 'F'},
-    {"0EKVO(", 'F'},
-    {"0EKVOF", 'F'},
-    {"0EKVOS", 'F'},
-    {"0EKVS", 'F'},
-    {"0EKVS;", 'F'},
-    {"0EKVSC", 'F'},
-    {"0EKVSF", 'F'},
-    {"0EKVSK", 'F'},
-    {"0EKVSO", 'F'},
-    {"0EKVU(", 'F'},
-    {"0EKVUE", 'F'},
-    {"0EN&(1", 'F'},
-    {"0EN&(E", 'F'},
-    {"0EN&(F", 'F'},
-    {"0EN&(N", 'F'},
-    {"0EN&(S", 'F'},
-    {"0EN&(V", 'F'},
-    {"0EN&1)", 'F'},
-    {"0EN&1O", 'F'},
-    {"0EN&F(", 'F'},
-    {"0EN&N)", 'F'},
-    {"0EN&NO", 'F'},
-    {"0EN&S)", 'F'},
-    {"0EN&SO", 'F'},
-    {"0EN&V)", 'F'},
-    {"0EN&VO", 'F'},
-    {"0EN(1O", 'F'},
-    {"0EN(F(", 'F'},
-    {"0EN(S)", 'F'},
-    {"0EN(SO", 'F'},
-    {"0EN(V)", 'F'},
-    {"0EN(VO", 'F'},
-    {"0EN)", 'F'},
-    {"0EN)&(", 'F'},
-    {"0EN)&1", 'F'},
-    {"0EN)&F", 'F'},
-    {"0EN)&N", 'F'},
-    {"0EN)&S", 'F'},
-    {"0EN)&V", 'F'},
-    {"0EN);", 'F'},
-    {"0EN);(", 'F'},
-    {"0EN);C", 'F'},
-    {"0EN);E", 'F'},
-    {"0EN);T", 'F'},
-    {"0EN)C", 'F'},
-    {"0EN)KN", 'F'},
-    {"0EN)O(", 'F'},
-    {"0EN)O1", 'F'},
-    {"0EN)OF", 'F'},
-    {"0EN)ON", 'F'},
-    {"0EN)OS", 'F'},
-    {"0EN)OV", 'F'},
-    {"0EN)UE", 'F'},
-    {"0EN,(1", 'F'},
-    {"0EN,(F", 'F'},
-    {"0EN,(N", 'F'},
-    {"0EN,(S", 'F'},
-    {"0EN,(V", 'F'},
-    {"0EN,F(", 'F'},
-    {"0EN1;", 'F'},
-    {"0EN1;C", 'F'},
-    {"0EN1O(", 'F'},
-    {"0EN1OF", 'F'},
-    {"0EN1OS", 'F'},
-    {"0EN1OV", 'F'},
-    {"0EN;(E", 'F'},
-    {"0ENB(1", 'F'},
-    {"0ENB(F", 'F'},
-    {"0ENB(N", 'F'},
-    {"0ENB(S", 'F'},
-    {"0ENB(V", 'F'},
-    {"0ENB1)", 'F'},
-    {"0ENB1O", 'F'},
-    {"0ENBF(", 'F'},
-    {"0ENBN)", 'F'},
-    {"0ENBNO", 'F'},
-    {"0ENBS)", 'F'},
-    {"0ENBSO", 'F'},
-    {"0ENBV)", 'F'},
-    {"0ENBVO", 'F'},
-    {"0ENF()", 'F'},
-    {"0ENF(1", 'F'},
-    {"0ENF(F", 'F'},
-    {"0ENF(N", 'F'},
-    {"0ENF(S", 'F'},
-    {"0ENF(V", 'F'},
-    {"0ENK(1", 'F'},
-    {"0ENK(E", 'F'},
-    {"0ENK(F", 'F'},
-    {"0ENK(N", 'F'},
-    {"0ENK(S", 'F'},
-    {"0ENK(V", 'F'},
-    {"0ENK1)", 'F'},
-    {"0ENK1K", 'F'},
-    {"0ENK1O", 'F'},
-    {"0ENKF(", 'F'},
-    {"0ENKN)", 'F'},
-    {"0ENKN,", 'F'},
-    {"0ENKN;", 'F'},
-    {"0ENKNB", 'F'},
-    {"0ENKNC", 'F'},
-    {"0ENKNK", 'F'},
-    {"0ENKNU", 'F'},
-    {"0ENKS)", 'F'},
-    {"0ENKSK", 'F'},
-    {"0ENKSO", 'F'},
-    {"0ENKV)", 'F'},
-    {"0ENKVK", 'F'},
-    {"0ENKVO", 'F'},
-    {"0ENO(1", 'F'},
-    {"0ENO(E", 'F'},
-    {"0ENO(F", 'F'},
-    {"0ENO(N", 'F'},
-    {"0ENO(S", 'F'},
-    {"0ENO(V", 'F'},
-    {"0ENOF(", 'F'},
-    {"0ENOS&", 'F'},
-    {"0ENOS(", 'F'},
-    {"0ENOS)", 'F'},
-    {"0ENOS,", 'F'},
-    {"0ENOS1", 'F'},
-    {"0ENOS;", 'F'},
-    {"0ENOSB", 'F'},
-    {"0ENOSF", 'F'},
-    {"0ENOSK", 'F'},
-    {"0ENOSU", 'F'},
-    {"0ENOSV", 'F'},
-    {"0ENOV&", 'F'},
-    {"0ENOV(", 'F'},
-    {"0ENOV)", 'F'},
-    {"0ENOV,", 'F'},
-    {"0ENOV;", 'F'},
-    {"0ENOVB", 'F'},
-    {"0ENOVF", 'F'},
-    {"0ENOVK", 'F'},
-    {"0ENOVO", 'F'},
-    {"0ENOVS", 'F'},
-    {"0ENOVU", 'F'},
-    {"0ENU(E", 'F'},
-    {"0ENUE(", 'F'},
-    {"0ENUE1", 'F'},
-    {"0ENUEF", 'F'},
-    {"0ENUEK", 'F'},
-    {"0ENUEN", 'F'},
-    {"0ENUES", 'F'},
-    {"0ENUEV", 'F'},
-    {"0EOK(E", 'F'},
-    {"0EOKNK", 'F'},
-    {"0ES&(1", 'F'},
-    {"0ES&(E", 'F'},
-    {"0ES&(F", 'F'},
-    {"0ES&(N", 'F'},
-    {"0ES&(S", 'F'},
-    {"0ES&(V", 'F'},
-    {"0ES&1)", 'F'},
-    {"0ES&1O", 'F'},
-    {"0ES&F(", 'F'},
-    {"0ES&N)", 'F'},
-    {"0ES&NO", 'F'},
-    {"0ES&S)", 'F'},
-    {"0ES&SO", 'F'},
-    {"0ES&V)", 'F'},
-    {"0ES&VO", 'F'},
-    {"0ES)", 'F'},
-    {"0ES)&(", 'F'},
-    {"0ES)&1", 'F'},
-    {"0ES)&F", 'F'},
-    {"0ES)&N", 'F'},
-    {"0ES)&S", 'F'},
-    {"0ES)&V", 'F'},
-    {"0ES);", 'F'},
-    {"0ES);(", 'F'},
-    {"0ES);C", 'F'},
-    {"0ES);E", 'F'},
-    {"0ES);T", 'F'},
-    {"0ES)C", 'F'},
-    {"0ES)KN", 'F'},
-    {"0ES)O(", 'F'},
-    {"0ES)O1", 'F'},
-    {"0ES)OF", 'F'},
-    {"0ES)ON", 'F'},
-    {"0ES)OS", 'F'},
-    {"0ES)OV", 'F'},
-    {"0ES)UE", 'F'},
-    {"0ES,(1", 'F'},
-    {"0ES,(F", 'F'},
-    {"0ES,(N", 'F'},
-    {"0ES,(S", 'F'},
-    {"0ES,(V", 'F'},
-    {"0ES,F(", 'F'},
-    {"0ES1", 'F'},
-    {"0ES1;", 'F'},
-    {"0ES1;C", 'F'},
-    {"0ES1C", 'F'},
-    {"0ES;(E", 'F'},
-    {"0ESB(1", 'F'},
-    {"0ESB(F", 'F'},
-    {"0ESB(N", 'F'},
-    {"0ESB(S", 'F'},
-    {"0ESB(V", 'F'},
-    {"0ESB1)", 'F'},
-    {"0ESB1O", 'F'},
-    {"0ESBF(", 'F'},
-    {"0ESBN)", 'F'},
-    {"0ESBNO", 'F'},
-    {"0ESBS)", 'F'},
-    {"0ESBSO", 'F'},
-    {"0ESBV)", 'F'},
-    {"0ESBVO", 'F'},
-    {"0ESF()", 'F'},
-    {"0ESF(1", 'F'},
-    {"0ESF(F", 'F'},
-    {"0ESF(N", 'F'},
-    {"0ESF(S", 'F'},
-    {"0ESF(V", 'F'},
-    {"0ESK(1", 'F'},
-    {"0ESK(E", 'F'},
-    {"0ESK(F", 'F'},
-    {"0ESK(N", 'F'},
-    {"0ESK(S", 'F'},
-    {"0ESK(V", 'F'},
-    {"0ESK1)", 'F'},
-    {"0ESK1K", 'F'},
-    {"0ESK1O", 'F'},
-    {"0ESKF(", 'F'},
-    {"0ESKN", 'F'},
-    {"0ESKN)", 'F'},
-    {"0ESKN;", 'F'},
-    {"0ESKNC", 'F'},
-    {"0ESKNK", 'F'},
-    {"0ESKNU", 'F'},
-    {"0ESKS)", 'F'},
-    {"0ESKSK", 'F'},
-    {"0ESKSO", 'F'},
-    {"0ESKV)", 'F'},
-    {"0ESKVK", 'F'},
-    {"0ESKVO", 'F'},
-    {"0ESO(1", 'F'},
-    {"0ESO(E", 'F'},
-    {"0ESO(F", 'F'},
-    {"0ESO(N", 'F'},
-    {"0ESO(S", 'F'},
-    {"0ESO(V", 'F'},
-    {"0ESO1&", 'F'},
-    {"0ESO1(", 'F'},
-    {"0ESO1)", 'F'},
-    {"0ESO1,", 'F'},
-    {"0ESO1;", 'F'},
-    {"0ESO1B", 'F'},
-    {"0ESO1F", 'F'},
-    {"0ESO1K", 'F'},
-    {"0ESO1N", 'F'},
-    {"0ESO1S", 'F'},
-    {"0ESO1U", 'F'},
-    {"0ESO1V", 'F'},
-    {"0ESOF(", 'F'},
-    {"0ESON&", 'F'},
-    {"0ESON(", 'F'},
-    {"0ESON)", 'F'},
-    {"0ESON,", 'F'},
-    {"0ESON1", 'F'},
-    {"0ESON;", 'F'},
-    {"0ESONB", 'F'},
-    {"0ESONF", 'F'},
-    {"0ESONK", 'F'},
-    {"0ESONU", 'F'},
-    {"0ESOS&", 'F'},
-    {"0ESOS(", 'F'},
-    {"0ESOS)", 'F'},
-    {"0ESOS,", 'F'},
-    {"0ESOS1", 'F'},
-    {"0ESOS;", 'F'},
-    {"0ESOSB", 'F'},
-    {"0ESOSF", 'F'},
-    {"0ESOSK", 'F'},
-    {"0ESOSU", 'F'},
-    {"0ESOSV", 'F'},
-    {"0ESOV&", 'F'},
-    {"0ESOV(", 'F'},
-    {"0ESOV)", 'F'},
-    {"0ESOV,", 'F'},
-    {"0ESOV;", 'F'},
-    {"0ESOVB", 'F'},
-    {"0ESOVF", 'F'},
-    {"0ESOVK", 'F'},
-    {"0ESOVO", 'F'},
-    {"0ESOVS", 'F'},
-    {"0ESOVU", 'F'},
-    {"0ESU(E", 'F'},
-    {"0ESUE(", 'F'},
-    {"0ESUE1", 'F'},
-    {"0ESUEF", 'F'},
-    {"0ESUEK", 'F'},
-    {"0ESUEN", 'F'},
-    {"0ESUES", 'F'},
-    {"0ESUEV", 'F'},
-    {"0ESV", 'F'},
-    {"0ESV;", 'F'},
-    {"0ESV;C", 'F'},
-    {"0ESVC", 'F'},
-    {"0ESVO(", 'F'},
-    {"0ESVOF", 'F'},
-    {"0ESVOS", 'F'},
-    {"0EV&(1", 'F'},
-    {"0EV&(E", 'F'},
-    {"0EV&(F", 'F'},
-    {"0EV&(N", 'F'},
-    {"0EV&(S", 'F'},
-    {"0EV&(V", 'F'},
-    {"0EV&1)", 'F'},
-    {"0EV&1O", 'F'},
-    {"0EV&F(", 'F'},
-    {"0EV&N)", 'F'},
-    {"0EV&NO", 'F'},
-    {"0EV&S)", 'F'},
-    {"0EV&SO", 'F'},
-    {"0EV&V)", 'F'},
-    {"0EV&VO", 'F'},
-    {"0EV)", 'F'},
-    {"0EV)&(", 'F'},
-    {"0EV)&1", 'F'},
-    {"0EV)&F", 'F'},
-    {"0EV)&N", 'F'},
-    {"0EV)&S", 'F'},
-    {"0EV)&V", 'F'},
-    {"0EV);", 'F'},
-    {"0EV);(", 'F'},
-    {"0EV);C", 'F'},
-    {"0EV);E", 'F'},
-    {"0EV);T", 'F'},
-    {"0EV)C", 'F'},
-    {"0EV)KN", 'F'},
-    {"0EV)O(", 'F'},
-    {"0EV)O1", 'F'},
-    {"0EV)OF", 'F'},
-    {"0EV)ON", 'F'},
-    {"0EV)OS", 'F'},
-    {"0EV)OV", 'F'},
-    {"0EV)UE", 'F'},
-    {"0EV,(1", 'F'},
-    {"0EV,(F", 'F'},
-    {"0EV,(N", 'F'},
-    {"0EV,(S", 'F'},
-    {"0EV,(V", 'F'},
-    {"0EV,F(", 'F'},
-    {"0EV;(E", 'F'},
-    {"0EVB(1", 'F'},
-    {"0EVB(F", 'F'},
-    {"0EVB(N", 'F'},
-    {"0EVB(S", 'F'},
-    {"0EVB(V", 'F'},
-    {"0EVB1)", 'F'},
-    {"0EVB1O", 'F'},
-    {"0EVBF(", 'F'},
-    {"0EVBN)", 'F'},
-    {"0EVBNO", 'F'},
-    {"0EVBS)", 'F'},
-    {"0EVBSO", 'F'},
-    {"0EVBV)", 'F'},
-    {"0EVBVO", 'F'},
-    {"0EVF()", 'F'},
-    {"0EVF(1", 'F'},
-    {"0EVF(F", 'F'},
-    {"0EVF(N", 'F'},
-    {"0EVF(S", 'F'},
-    {"0EVF(V", 'F'},
-    {"0EVK(1", 'F'},
-    {"0EVK(E", 'F'},
-    {"0EVK(F", 'F'},
-    {"0EVK(N", 'F'},
-    {"0EVK(S", 'F'},
-    {"0EVK(V", 'F'},
-    {"0EVK1)", 'F'},
-    {"0EVK1K", 'F'},
-    {"0EVK1O", 'F'},
-    {"0EVKF(", 'F'},
-    {"0EVKN", 'F'},
-    {"0EVKN)", 'F'},
-    {"0EVKN;", 'F'},
-    {"0EVKNC", 'F'},
-    {"0EVKNK", 'F'},
-    {"0EVKNU", 'F'},
-    {"0EVKS)", 'F'},
-    {"0EVKSK", 'F'},
-    {"0EVKSO", 'F'},
-    {"0EVKV)", 'F'},
-    {"0EVKVK", 'F'},
-    {"0EVKVO", 'F'},
-    {"0EVN", 'F'},
-    {"0EVN)U", 'F'},
-    {"0EVN;", 'F'},
-    {"0EVN;C", 'F'},
-    {"0EVNC", 'F'},
-    {"0EVNKN", 'F'},
-    {"0EVNO(", 'F'},
-    {"0EVNOF", 'F'},
-    {"0EVNOS", 'F'},
-    {"0EVNOV", 'F'},
-    {"0EVO(1", 'F'},
-    {"0EVO(E", 'F'},
-    {"0EVO(F", 'F'},
-    {"0EVO(N", 'F'},
-    {"0EVO(S", 'F'},
-    {"0EVO(V", 'F'},
-    {"0EVOF(", 'F'},
-    {"0EVOS&", 'F'},
-    {"0EVOS(", 'F'},
-    {"0EVOS)", 'F'},
-    {"0EVOS,", 'F'},
-    {"0EVOS1", 'F'},
-    {"0EVOS;", 'F'},
-    {"0EVOSB", 'F'},
-    {"0EVOSF", 'F'},
-    {"0EVOSK", 'F'},
-    {"0EVOSU", 'F'},
-    {"0EVOSV", 'F'},
-    {"0EVS", 'F'},
-    {"0EVS;", 'F'},
-    {"0EVS;C", 'F'},
-    {"0EVSC", 'F'},
-    {"0EVSO(", 'F'},
-    {"0EVSO1", 'F'},
-    {"0EVSOF", 'F'},
-    {"0EVSON", 'F'},
-    {"0EVSOS", 'F'},
-    {"0EVSOV", 'F'},
-    {"0EVU(E", 'F'},
-    {"0EVUE(", 'F'},
-    {"0EVUE1", 'F'},
-    {"0EVUEF", 'F'},
-    {"0EVUEK", 'F'},
-    {"0EVUEN", 'F'},
-    {"0EVUES", 'F'},
-    {"0EVUEV", 'F'},
-    {"0F()&(", 'F'},
-    {"0F()&1", 'F'},
-    {"0F()&E", 'F'},
-    {"0F()&F", 'F'},
-    {"0F()&K", 'F'},
-    {"0F()&N", 'F'},
-    {"0F()&S", 'F'},
-    {"0F()&V", 'F'},
-    {"0F(),(", 'F'},
-    {"0F(),1", 'F'},
-    {"0F(),F", 'F'},
-    {"0F(),N", 'F'},
-    {"0F(),S", 'F'},
-    {"0F(),V", 'F'},
-    {"0F()1(", 'F'},
-    {"0F()1F", 'F'},
-    {"0F()1N", 'F'},
-    {"0F()1O", 'F'},
-    {"0F()1S", 'F'},
-    {"0F()1U", 'F'},
-    {"0F()1V", 'F'},
-    {"0F();E", 'F'},
-    {"0F();N", 'F'},
-    {"0F();T", 'F'},
-    {"0F()A(", 'F'},
-    {"0F()AF", 'F'},
-    {"0F()AS", 'F'},
-    {"0F()AT", 'F'},
-    {"0F()AV", 'F'},
-    {"0F()B(", 'F'},
-    {"0F()B1", 'F'},
-    {"0F()BE", 'F'},
-    {"0F()BF", 'F'},
-    {"0F()BN", 'F'},
-    {"0F()BS", 'F'},
-    {"0F()BV", 'F'},
-    {"0F()C", 'F'},
-    {"0F()E(", 'F'},
-    {"0F()E1", 'F'},
-    {"0F()EF", 'F'},
-    {"0F()EK", 'F'},
-    {"0F()EN", 'F'},
-    {"0F()EO", 'F'},
-    {"0F()ES", 'F'},
-    {"0F()EU", 'F'},
-    {"0F()EV", 'F'},
-    {"0F()F(", 'F'},
-    {"0F()K(", 'F'},
-    {"0F()K)", 'F'},
-    {"0F()K1", 'F'},
-    {"0F()KF", 'F'},
-    {"0F()KN", 'F'},
-    {"0F()KS", 'F'},
-    {"0F()KU", 'F'},
-    {"0F()KV", 'F'},
-    {"0F()N&", 'F'},
-    {"0F()N(", 'F'},
-    {"0F()N)", 'F'},
-    {"0F()N,", 'F'},
-    {"0F()N1", 'F'},
-    {"0F()NE", 'F'},
-    {"0F()NF", 'F'},
-    {"0F()NO", 'F'},
-    {"0F()NU", 'F'},
-    {"0F()O(", 'F'},
-    {"0F()O1", 'F'},
-    {"0F()OF", 'F'},
-    {"0F()OK", 'F'},
-    {"0F()ON", 'F'},
-    {"0F()OS", 'F'},
-    {"0F()OU", 'F'},
-    {"0F()OV", 'F'},
-    {"0F()S(", 'F'},
-    {"0F()S1", 'F'},
-    {"0F()SF", 'F'},
-    {"0F()SO", 'F'},
-    {"0F()SU", 'F'},
-    {"0F()SV", 'F'},
-    {"0F()T(", 'F'},
-    {"0F()T1", 'F'},
-    {"0F()TE", 'F'},
-    {"0F()TF", 'F'},
-    {"0F()TN", 'F'},
-    {"0F()TS", 'F'},
-    {"0F()TT", 'F'},
-    {"0F()TV", 'F'},
-    {"0F()U", 'F'},
-    {"0F()U(", 'F'},
-    {"0F()U1", 'F'},
-    {"0F()U;", 'F'},
-    {"0F()UC", 'F'},
-    {"0F()UE", 'F'},
-    {"0F()UF", 'F'},
-    {"0F()UK", 'F'},
-    {"0F()UO", 'F'},
-    {"0F()US", 'F'},
-    {"0F()UT", 'F'},
-    {"0F()UV", 'F'},
-    {"0F()V(", 'F'},
-    {"0F()VF", 'F'},
-    {"0F()VO", 'F'},
-    {"0F()VS", 'F'},
-    {"0F()VU", 'F'},
-    {"0F(1&(", 'F'},
-    {"0F(1&1", 'F'},
-    {"0F(1&F", 'F'},
-    {"0F(1&N", 'F'},
-    {"0F(1&S", 'F'},
-    {"0F(1&V", 'F'},
-    {"0F(1)", 'F'},
-    {"0F(1)&", 'F'},
-    {"0F(1),", 'F'},
-    {"0F(1)1", 'F'},
-    {"0F(1);", 'F'},
-    {"0F(1)A", 'F'},
-    {"0F(1)B", 'F'},
-    {"0F(1)C", 'F'},
-    {"0F(1)E", 'F'},
-    {"0F(1)F", 'F'},
-    {"0F(1)K", 'F'},
-    {"0F(1)N", 'F'},
-    {"0F(1)O", 'F'},
-    {"0F(1)S", 'F'},
-    {"0F(1)T", 'F'},
-    {"0F(1)U", 'F'},
-    {"0F(1)V", 'F'},
-    {"0F(1,(", 'F'},
-    {"0F(1,F", 'F'},
-    {"0F(1O(", 'F'},
-    {"0F(1OF", 'F'},
-    {"0F(1OS", 'F'},
-    {"0F(1OV", 'F'},
-    {"0F(E(1", 'F'},
-    {"0F(E(E", 'F'},
-    {"0F(E(F", 'F'},
-    {"0F(E(N", 'F'},
-    {"0F(E(S", 'F'},
-    {"0F(E(V", 'F'},
-    {"0F(E1&", 'F'},
-    {"0F(E1)", 'F'},
-    {"0F(E1K", 'F'},
-    {"0F(E1O", 'F'},
-    {"0F(EF(", 'F'},
-    {"0F(EK(", 'F'},
-    {"0F(EK1", 'F'},
-    {"0F(EKF", 'F'},
-    {"0F(EKN", 'F'},
-    {"0F(EKO", 'F'},
-    {"0F(EKS", 'F'},
-    {"0F(EKV", 'F'},
-    {"0F(EN&", 'F'},
-    {"0F(EN)", 'F'},
-    {"0F(ENK", 'F'},
-    {"0F(ENO", 'F'},
-    {"0F(EOK", 'F'},
-    {"0F(ES&", 'F'},
-    {"0F(ES)", 'F'},
-    {"0F(ESK", 'F'},
-    {"0F(ESO", 'F'},
-    {"0F(EV&", 'F'},
-    {"0F(EV)", 'F'},
-    {"0F(EVK", 'F'},
-    {"0F(EVO", 'F'},
-    {"0F(F()", 'F'},
-    {"0F(F(1", 'F'},
-    {"0F(F(E", 'F'},
-    {"0F(F(F", 'F'},
-    {"0F(F(N", 'F'},
-    {"0F(F(S", 'F'},
-    {"0F(F(V", 'F'},
-    {"0F(K()", 'F'},
-    {"0F(K,(", 'F'},
-    {"0F(K,F", 'F'},
-    {"0F(N&(", 'F'},
-    {"0F(N&1", 'F'},
-    {"0F(N&F", 'F'},
-    {"0F(N&N", 'F'},
-    {"0F(N&S", 'F'},
-    {"0F(N&V", 'F'},
-    {"0F(N)", 'F'},
-    {"0F(N)&", 'F'},
-    {"0F(N),", 'F'},
-    {"0F(N)1", 'F'},
-    {"0F(N);", 'F'},
-    {"0F(N)A", 'F'},
-    {"0F(N)B", 'F'},
-    {"0F(N)C", 'F'},
-    {"0F(N)E", 'F'},
-    {"0F(N)F", 'F'},
-    {"0F(N)K", 'F'},
-    {"0F(N)N", 'F'},
-    {"0F(N)O", 'F'},
-    {"0F(N)S", 'F'},
-    {"0F(N)T", 'F'},
-    {"0F(N)U", 'F'},
-    {"0F(N)V", 'F'},
-    {"0F(N,(", 'F'},
-    {"0F(N,F", 'F'},
-    {"0F(NO(", 'F'},
-    {"0F(NOF", 'F'},
-    {"0F(NOS", 'F'},
-    {"0F(NOV", 'F'},
-    {"0F(S&(", 'F'},
-    {"0F(S&1", 'F'},
-    {"0F(S&F", 'F'},
-    {"0F(S&N", 'F'},
-    {"0F(S&S", 'F'},
-    {"0F(S&V", 'F'},
-    {"0F(S)", 'F'},
-    {"0F(S)&", 'F'},
-    {"0F(S),", 'F'},
-    {"0F(S)1", 'F'},
-    {"0F(S);", 'F'},
-    {"0F(S)A", 'F'},
-    {"0F(S)B", 'F'},
-    {"0F(S)C", 'F'},
-    {"0F(S)E", 'F'},
-    {"0F(S)F", 'F'},
-    {"0F(S)K", 'F'},
-    {"0F(S)N", 'F'},
-    {"0F(S)O", 'F'},
-    {"0F(S)S", 'F'},
-    {"0F(S)T", 'F'},
-    {"0F(S)U", 'F'},
-    {"0F(S)V", 'F'},
-    {"0F(S,(", 'F'},
-    {"0F(S,F", 'F'},
-    {"0F(SO(", 'F'},
-    {"0F(SO1", 'F'},
-    {"0F(SOF", 'F'},
-    {"0F(SON", 'F'},
-    {"0F(SOS", 'F'},
-    {"0F(SOV", 'F'},
-    {"0F(T,(", 'F'},
-    {"0F(T,F", 'F'},
-    {"0F(V&(", 'F'},
-    {"0F(V&1", 'F'},
-    {"0F(V&F", 'F'},
-    {"0F(V&N", 'F'},
-    {"0F(V&S", 'F'},
-    {"0F(V&V", 'F'},
-    {"0F(V)", 'F'},
-    {"0F(V)&", 'F'},
-    {"0F(V),", 'F'},
-    {"0F(V)1", 'F'},
-    {"0F(V);", 'F'},
-    {"0F(V)A", 'F'},
-    {"0F(V)B", 'F'},
-    {"0F(V)C", 'F'},
-    {"0F(V)E", 'F'},
-    {"0F(V)F", 'F'},
-    {"0F(V)K", 'F'},
-    {"0F(V)N", 'F'},
-    {"0F(V)O", 'F'},
-    {"0F(V)S", 'F'},
-    {"0F(V)T", 'F'},
-    {"0F(V)U", 'F'},
-    {"0F(V)V", 'F'},
-    {"0F(V,(", 'F'},
-    {"0F(V,F", 'F'},
-    {"0F(VO(", 'F'},
-    {"0F(VOF", 'F'},
-    {"0F(VOS", 'F'},
-    {"0K(1),", 'F'},
-    {"0K(1)A", 'F'},
-    {"0K(1)K", 'F'},
-    {"0K(1)O", 'F'},
-    {"0K(1O(", 'F'},
-    {"0K(1OF", 'F'},
-    {"0K(1OS", 'F'},
-    {"0K(1OV", 'F'},
-    {"0K(F()", 'F'},
-    {"0K(F(1", 'F'},
-    {"0K(F(F", 'F'},
-    {"0K(F(N", 'F'},
-    {"0K(F(S", 'F'},
-    {"0K(F(V", 'F'},
-    {"0K(N),", 'F'},
-    {"0K(N)A", 'F'},
-    {"0K(N)K", 'F'},
-    {"0K(N)O", 'F'},
-    {"0K(NO(", 'F'},
-    {"0K(NOF", 'F'},
-    {"0K(NOS", 'F'},
-    {"0K(NOV", 'F'},
-    {"0K(S),", 'F'},
-    {"0K(S)A", 'F'},
-    {"0K(S)K", 'F'},
-    {"0K(S)O", 'F'},
-    {"0K(SO(", 'F'},
-    {"0K(SO1", 'F'},
-    {"0K(SOF", 'F'},
-    {"0K(SON", 'F'},
-    {"0K(SOS", 'F'},
-    {"0K(SOV", 'F'},
-    {"0K(V),", 'F'},
-    {"0K(V)A", 'F'},
-    {"0K(V)K", 'F'},
-    {"0K(V)O", 'F'},
-    {"0K(VO(", 'F'},
-    {"0K(VOF", 'F'},
-    {"0K(VOS", 'F'},
-    {"0K1,(1", 'F'},
-    {"0K1,(F", 'F'},
-    {"0K1,(N", 'F'},
-    {"0K1,(S", 'F'},
-    {"0K1,(V", 'F'},
-    {"0K1,F(", 'F'},
-    {"0K1A(F", 'F'},
-    {"0K1A(N", 'F'},
-    {"0K1A(S", 'F'},
-    {"0K1A(V", 'F'},
-    {"0K1AF(", 'F'},
-    {"0K1ASO", 'F'},
-    {"0K1AVO", 'F'},
-    {"0K1K(1", 'F'},
-    {"0K1K(F", 'F'},
-    {"0K1K(N", 'F'},
-    {"0K1K(S", 'F'},
-    {"0K1K(V", 'F'},
-    {"0K1K1O", 'F'},
-    {"0K1K1U", 'F'},
-    {"0K1KF(", 'F'},
-    {"0K1KNU", 'F'},
-    {"0K1KSO", 'F'},
-    {"0K1KSU", 'F'},
-    {"0K1KVO", 'F'},
-    {"0K1KVU", 'F'},
-    {"0K1O(1", 'F'},
-    {"0K1O(F", 'F'},
-    {"0K1O(N", 'F'},
-    {"0K1O(S", 'F'},
-    {"0K1O(V", 'F'},
-    {"0K1OF(", 'F'},
-    {"0K1OS(", 'F'},
-    {"0K1OS,", 'F'},
-    {"0K1OS1", 'F'},
-    {"0K1OSA", 'F'},
-    {"0K1OSF", 'F'},
-    {"0K1OSK", 'F'},
-    {"0K1OSV", 'F'},
-    {"0K1OV(", 'F'},
-    {"0K1OV,", 'F'},
-    {"0K1OVA", 'F'},
-    {"0K1OVF", 'F'},
-    {"0K1OVK", 'F'},
-    {"0K1OVO", 'F'},
-    {"0K1OVS", 'F'},
-    {"0KF(),", 'F'},
-    {"0KF()A", 'F'},
-    {"0KF()K", 'F'},
-    {"0KF()O", 'F'},
-    {"0KF(1)", 'F'},
-    {"0KF(1O", 'F'},
-    {"0KF(F(", 'F'},
-    {"0KF(N)", 'F'},
-    {"0KF(NO", 'F'},
-    {"0KF(S)", 'F'},
-    {"0KF(SO", 'F'},
-    {"0KF(V)", 'F'},
-    {"0KF(VO", 'F'},
-    {"0KN,(1", 'F'},
-    {"0KN,(F", 'F'},
-    {"0KN,(N", 'F'},
-    {"0KN,(S", 'F'},
-    {"0KN,(V", 'F'},
-    {"0KN,F(", 'F'},
-    {"0KNA(F", 'F'},
-    {"0KNA(N", 'F'},
-    {"0KNA(S", 'F'},
-    {"0KNA(V", 'F'},
-    {"0KNAF(", 'F'},
-    {"0KNASO", 'F'},
-    {"0KNAVO", 'F'},
-    {"0KNK(1", 'F'},
-    {"0KNK(F", 'F'},
-    {"0KNK(N", 'F'},
-    {"0KNK(S", 'F'},
-    {"0KNK(V", 'F'},
-    {"0KNK1O", 'F'},
-    {"0KNK1U", 'F'},
-    {"0KNKF(", 'F'},
-    {"0KNKNU", 'F'},
-    {"0KNKSO", 'F'},
-    {"0KNKSU", 'F'},
-    {"0KNKVO", 'F'},
-    {"0KNKVU", 'F'},
-    {"0KS,(1", 'F'},
-    {"0KS,(F", 'F'},
-    {"0KS,(N", 'F'},
-    {"0KS,(S", 'F'},
-    {"0KS,(V", 'F'},
-    {"0KS,F(", 'F'},
-    {"0KSA(F", 'F'},
-    {"0KSA(N", 'F'},
-    {"0KSA(S", 'F'},
-    {"0KSA(V", 'F'},
-    {"0KSAF(", 'F'},
-    {"0KSASO", 'F'},
-    {"0KSAVO", 'F'},
-    {"0KSK(1", 'F'},
-    {"0KSK(F", 'F'},
-    {"0KSK(N", 'F'},
-    {"0KSK(S", 'F'},
-    {"0KSK(V", 'F'},
-    {"0KSK1O", 'F'},
-    {"0KSK1U", 'F'},
-    {"0KSKF(", 'F'},
-    {"0KSKNU", 'F'},
-    {"0KSKSO", 'F'},
-    {"0KSKSU", 'F'},
-    {"0KSKVO", 'F'},
-    {"0KSKVU", 'F'},
-    {"0KSO(1", 'F'},
-    {"0KSO(F", 'F'},
-    {"0KSO(N", 'F'},
-    {"0KSO(S", 'F'},
-    {"0KSO(V", 'F'},
-    {"0KSO1(", 'F'},
-    {"0KSO1,", 'F'},
-    {"0KSO1A", 'F'},
-    {"0KSO1F", 'F'},
-    {"0KSO1K", 'F'},
-    {"0KSO1N", 'F'},
-    {"0KSO1S", 'F'},
-    {"0KSO1V", 'F'},
-    {"0KSOF(", 'F'},
-    {"0KSON(", 'F'},
-    {"0KSON,", 'F'},
-    {"0KSON1", 'F'},
-    {"0KSONA", 'F'},
-    {"0KSONF", 'F'},
-    {"0KSONK", 'F'},
-    {"0KSOS(", 'F'},
-    {"0KSOS,", 'F'},
-    {"0KSOS1", 'F'},
-    {"0KSOSA", 'F'},
-    {"0KSOSF", 'F'},
-    {"0KSOSK", 'F'},
-    {"0KSOSV", 'F'},
-    {"0KSOV(", 'F'},
-    {"0KSOV,", 'F'},
-    {"0KSOVA", 'F'},
-    {"0KSOVF", 'F'},
-    {"0KSOVK", 'F'},
-    {"0KSOVO", 'F'},
-    {"0KSOVS", 'F'},
-    {"0KV,(1", 'F'},
-    {"0KV,(F", 'F'},
-    {"0KV,(N", 'F'},
-    {"0KV,(S", 'F'},
-    {"0KV,(V", 'F'},
-    {"0KV,F(", 'F'},
-    {"0KVA(F", 'F'},
-    {"0KVA(N", 'F'},
-    {"0KVA(S", 'F'},
-    {"0KVA(V", 'F'},
-    {"0KVAF(", 'F'},
-    {"0KVASO", 'F'},
-    {"0KVAVO", 'F'},
-    {"0KVK(1", 'F'},
-    {"0KVK(F", 'F'},
-    {"0KVK(N", 'F'},
-    {"0KVK(S", 'F'},
-    {"0KVK(V", 'F'},
-    {"0KVK1O", 'F'},
-    {"0KVK1U", 'F'},
-    {"0KVKF(", 'F'},
-    {"0KVKNU", 'F'},
-    {"0KVKSO", 'F'},
-    {"0KVKSU", 'F'},
-    {"0KVKVO", 'F'},
-    {"0KVKVU", 'F'},
-    {"0KVO(1", 'F'},
-    {"0KVO(F", 'F'},
-    {"0KVO(N", 'F'},
-    {"0KVO(S", 'F'},
-    {"0KVO(V", 'F'},
-    {"0KVOF(", 'F'},
-    {"0KVOS(", 'F'},
-    {"0KVOS,", 'F'},
-    {"0KVOS1", 'F'},
-    {"0KVOSA", 'F'},
-    {"0KVOSF", 'F'},
-    {"0KVOSK", 'F'},
-    {"0KVOSV", 'F'},
-    {"0N&(1&", 'F'},
-    {"0N&(1)", 'F'},
-    {"0N&(1,", 'F'},
-    {"0N&(1O", 'F'},
-    {"0N&(E(", 'F'},
-    {"0N&(E1", 'F'},
-    {"0N&(EF", 'F'},
-    {"0N&(EK", 'F'},
-    {"0N&(EN", 'F'},
-    {"0N&(EO", 'F'},
-    {"0N&(ES", 'F'},
-    {"0N&(EV", 'F'},
-    {"0N&(F(", 'F'},
-    {"0N&(N&", 'F'},
-    {"0N&(N)", 'F'},
-    {"0N&(N,", 'F'},
-    {"0N&(NO", 'F'},
-    {"0N&(S&", 'F'},
-    {"0N&(S)", 'F'},
-    {"0N&(S,", 'F'},
-    {"0N&(SO", 'F'},
-    {"0N&(V&", 'F'},
-    {"0N&(V)", 'F'},
-    {"0N&(V,", 'F'},
-    {"0N&(VO", 'F'},
-    {"0N&1", 'F'},
-    {"0N&1&(", 'F'},
-    {"0N&1&1", 'F'},
-    {"0N&1&F", 'F'},
-    {"0N&1&N", 'F'},
-    {"0N&1&S", 'F'},
-    {"0N&1&V", 'F'},
-    {"0N&1)&", 'F'},
-    {"0N&1)C", 'F'},
-    {"0N&1)O", 'F'},
-    {"0N&1)U", 'F'},
-    {"0N&1;", 'F'},
-    {"0N&1;C", 'F'},
-    {"0N&1;E", 'F'},
-    {"0N&1;T", 'F'},
-    {"0N&1B(", 'F'},
-    {"0N&1B1", 'F'},
-    {"0N&1BF", 'F'},
-    {"0N&1BN", 'F'},
-    {"0N&1BS", 'F'},
-    {"0N&1BV", 'F'},
-    {"0N&1C", 'F'},
-    {"0N&1EK", 'F'},
-    {"0N&1EN", 'F'},
-    {"0N&1F(", 'F'},
-    {"0N&1K(", 'F'},
-    {"0N&1K1", 'F'},
-    {"0N&1KF", 'F'},
-    {"0N&1KN", 'F'},
-    {"0N&1KS", 'F'},
-    {"0N&1KV", 'F'},
-    {"0N&1O(", 'F'},
-    {"0N&1OF", 'F'},
-    {"0N&1OS", 'F'},
-    {"0N&1OV", 'F'},
-    {"0N&1TN", 'F'},
-    {"0N&1U", 'F'},
-    {"0N&1U(", 'F'},
-    {"0N&1U;", 'F'},
-    {"0N&1UC", 'F'},
-    {"0N&1UE", 'F'},
-    {"0N&E(1", 'F'},
-    {"0N&E(F", 'F'},
-    {"0N&E(N", 'F'},
-    {"0N&E(O", 'F'},
-    {"0N&E(S", 'F'},
-    {"0N&E(V", 'F'},
-    {"0N&E1", 'F'},
-    {"0N&E1;", 'F'},
-    {"0N&E1C", 'F'},
-    {"0N&E1K", 'F'},
-    {"0N&E1O", 'F'},
-    {"0N&EF(", 'F'},
-    {"0N&EK(", 'F'},
-    {"0N&EK1", 'F'},
-    {"0N&EKF", 'F'},
-    {"0N&EKN", 'F'},
-    {"0N&EKS", 'F'},
-    {"0N&EKV", 'F'},
-    {"0N&EN;", 'F'},
-    {"0N&ENC", 'F'},
-    {"0N&ENK", 'F'},
-    {"0N&ENO", 'F'},
-    {"0N&ES", 'F'},
-    {"0N&ES;", 'F'},
-    {"0N&ESC", 'F'},
-    {"0N&ESK", 'F'},
-    {"0N&ESO", 'F'},
-    {"0N&EV", 'F'},
-    {"0N&EV;", 'F'},
-    {"0N&EVC", 'F'},
-    {"0N&EVK", 'F'},
-    {"0N&EVO", 'F'},
-    {"0N&F()", 'F'},
-    {"0N&F(1", 'F'},
-    {"0N&F(E", 'F'},
-    {"0N&F(F", 'F'},
-    {"0N&F(N", 'F'},
-    {"0N&F(S", 'F'},
-    {"0N&F(V", 'F'},
-    {"0N&K&(", 'F'},
-    {"0N&K&1", 'F'},
-    {"0N&K&F", 'F'},
-    {"0N&K&N", 'F'},
-    {"0N&K&S", 'F'},
-    {"0N&K&V", 'F'},
-    {"0N&K(1", 'F'},
-    {"0N&K(F", 'F'},
-    {"0N&K(N", 'F'},
-    {"0N&K(S", 'F'},
-    {"0N&K(V", 'F'},
-    {"0N&K1O", 'F'},
-    {"0N&KC", 'F'},
-    {"0N&KF(", 'F'},
-    {"0N&KNK", 'F'},
-    {"0N&KO(", 'F'},
-    {"0N&KO1", 'F'},
-    {"0N&KOF", 'F'},
-    {"0N&KOK", 'F'},
-    {"0N&KON", 'F'},
-    {"0N&KOS", 'F'},
-    {"0N&KOV", 'F'},
-    {"0N&KSO", 'F'},
-    {"0N&KVO", 'F'},
-    {"0N&N&(", 'F'},
-    {"0N&N&1", 'F'},
-    {"0N&N&F", 'F'},
-    {"0N&N&S", 'F'},
-    {"0N&N&V", 'F'},
-    {"0N&N)&", 'F'},
-    {"0N&N)C", 'F'},
-    {"0N&N)O", 'F'},
-    {"0N&N)U", 'F'},
-    {"0N&N;C", 'F'},
-    {"0N&N;E", 'F'},
-    {"0N&N;T", 'F'},
-    {"0N&NB(", 'F'},
-    {"0N&NB1", 'F'},
-    {"0N&NBF", 'F'},
-    {"0N&NBS", 'F'},
-    {"0N&NBV", 'F'},
-    {"0N&NF(", 'F'},
-    {"0N&NK(", 'F'},
-    {"0N&NK1", 'F'},
-    {"0N&NKF", 'F'},
-    {"0N&NKS", 'F'},
-    {"0N&NKV", 'F'},
-    {"0N&NO(", 'F'},
-    {"0N&NOF", 'F'},
-    {"0N&NOS", 'F'},
-    {"0N&NOV", 'F'},
-    {"0N&NU", 'F'},
-    {"0N&NU(", 'F'},
-    {"0N&NU;", 'F'},
-    {"0N&NUC", 'F'},
-    {"0N&NUE", 'F'},
-    {"0N&S&(", 'F'},
-    {"0N&S&1", 'F'},
-    {"0N&S&F", 'F'},
-    {"0N&S&N", 'F'},
-    {"0N&S&S", 'F'},
-    {"0N&S&V", 'F'},
-    {"0N&S)&", 'F'},
-    {"0N&S)C", 'F'},
-    {"0N&S)O", 'F'},
-    {"0N&S)U", 'F'},
-    {"0N&S1", 'F'},
-    {"0N&S1;", 'F'},
-    {"0N&S1C", 'F'},
-    {"0N&S;", 'F'},
-    {"0N&S;C", 'F'},
-    {"0N&S;E", 'F'},
-    {"0N&S;T", 'F'},
-    {"0N&SB(", 'F'},
-    {"0N&SB1", 'F'},
-    {"0N&SBF", 'F'},
-    {"0N&SBN", 'F'},
-    {"0N&SBS", 'F'},
-    {"0N&SBV", 'F'},
-    {"0N&SC", 'F'},
-    {"0N&SEK", 'F'},
-    {"0N&SEN", 'F'},
-    {"0N&SF(", 'F'},
-    {"0N&SK(", 'F'},
-    {"0N&SK1", 'F'},
-    {"0N&SKF", 'F'},
-    {"0N&SKN", 'F'},
-    {"0N&SKS", 'F'},
-    {"0N&SKV", 'F'},
-    {"0N&SO(", 'F'},
-    {"0N&SO1", 'F'},
-    {"0N&SOF", 'F'},
-    {"0N&SON", 'F'},
-    {"0N&SOS", 'F'},
-    {"0N&SOV", 'F'},
-    {"0N&STN", 'F'},
-    {"0N&SU", 'F'},
-    {"0N&SU(", 'F'},
-    {"0N&SU;", 'F'},
-    {"0N&SUC", 'F'},
-    {"0N&SUE", 'F'},
-    {"0N&SV", 'F'},
-    {"0N&SV;", 'F'},
-    {"0N&SVC", 'F'},
-    {"0N&SVO", 'F'},
-    {"0N&V", 'F'},
-    {"0N&V&(", 'F'},
-    {"0N&V&1", 'F'},
-    {"0N&V&F", 'F'},
-    {"0N&V&N", 'F'},
-    {"0N&V&S", 'F'},
-    {"0N&V&V", 'F'},
-    {"0N&V)&", 'F'},
-    {"0N&V)C", 'F'},
-    {"0N&V)O", 'F'},
-    {"0N&V)U", 'F'},
-    {"0N&V;", 'F'},
-    {"0N&V;C", 'F'},
-    {"0N&V;E", 'F'},
-    {"0N&V;T", 'F'},
-    {"0N&VB(", 'F'},
-    {"0N&VB1", 'F'},
-    {"0N&VBF", 'F'},
-    {"0N&VBN", 'F'},
-    {"0N&VBS", 'F'},
-    {"0N&VBV", 'F'},
-    {"0N&VC", 'F'},
-    {"0N&VEK", 'F'},
-    {"0N&VEN", 'F'},
-    {"0N&VF(", 'F'},
-    {"0N&VK(", 'F'},
-    {"0N&VK1", 'F'},
-    {"0N&VKF", 'F'},
-    {"0N&VKN", 'F'},
-    {"0N&VKS", 'F'},
-    {"0N&VKV", 'F'},
-    {"0N&VO(", 'F'},
-    {"0N&VOF", 'F'},
-    {"0N&VOS", 'F'},
-    {"0N&VS", 'F'},
-    {"0N&VS;", 'F'},
-    {"0N&VSC", 'F'},
-    {"0N&VSO", 'F'},
-    {"0N&VTN", 'F'},
-    {"0N&VU", 'F'},
-    {"0N&VU(", 'F'},
-    {"0N&VU;", 'F'},
-    {"0N&VUC", 'F'},
-    {"0N&VUE", 'F'},
-    {"0N)&(1", 'F'},
-    {"0N)&(E", 'F'},
-    {"0N)&(F", 'F'},
-    {"0N)&(N", 'F'},
-    {"0N)&(S", 'F'},
-    {"0N)&(V", 'F'},
-    {"0N)&1", 'F'},
-    {"0N)&1&", 'F'},
-    {"0N)&1)", 'F'},
-    {"0N)&1;", 'F'},
-    {"0N)&1B", 'F'},
-    {"0N)&1C", 'F'},
-    {"0N)&1F", 'F'},
-    {"0N)&1O", 'F'},
-    {"0N)&1U", 'F'},
-    {"0N)&F(", 'F'},
-    {"0N)&N", 'F'},
-    {"0N)&N&", 'F'},
-    {"0N)&N)", 'F'},
-    {"0N)&N;", 'F'},
-    {"0N)&NB", 'F'},
-    {"0N)&NC", 'F'},
-    {"0N)&NF", 'F'},
-    {"0N)&NO", 'F'},
-    {"0N)&NU", 'F'},
-    {"0N)&S", 'F'},
-    {"0N)&S&", 'F'},
-    {"0N)&S)", 'F'},
-    {"0N)&S;", 'F'},
-    {"0N)&SB", 'F'},
-    {"0N)&SC", 'F'},
-    {"0N)&SF", 'F'},
-    {"0N)&SO", 'F'},
-    {"0N)&SU", 'F'},
-    {"0N)&V", 'F'},
-    {"0N)&V&", 'F'},
-    {"0N)&V)", 'F'},
-    {"0N)&V;", 'F'},
-    {"0N)&VB", 'F'},
-    {"0N)&VC", 'F'},
-    {"0N)&VF", 'F'},
-    {"0N)&VO", 'F'},
-    {"0N)&VU", 'F'},
-    {"0N),(1", 'F'},
-    {"0N),(F", 'F'},
-    {"0N),(N", 'F'},
-    {"0N),(S", 'F'},
-    {"0N),(V", 'F'},
-    {"0N);E(", 'F'},
-    {"0N);E1", 'F'},
-    {"0N);EF", 'F'},
-    {"0N);EK", 'F'},
-    {"0N);EN", 'F'},
-    {"0N);EO", 'F'},
-    {"0N);ES", 'F'},
-    {"0N);EV", 'F'},
-    {"0N);T(", 'F'},
-    {"0N);T1", 'F'},
-    {"0N);TF", 'F'},
-    {"0N);TK", 'F'},
-    {"0N);TN", 'F'},
-    {"0N);TO", 'F'},
-    {"0N);TS", 'F'},
-    {"0N);TV", 'F'},
-    {"0N)B(1", 'F'},
-    {"0N)B(F", 'F'},
-    {"0N)B(N", 'F'},
-    {"0N)B(S", 'F'},
-    {"0N)B(V", 'F'},
-    {"0N)B1", 'F'},
-    {"0N)B1&", 'F'},
-    {"0N)B1;", 'F'},
-    {"0N)B1C", 'F'},
-    {"0N)B1K", 'F'},
-    {"0N)B1N", 'F'},
-    {"0N)B1O", 'F'},
-    {"0N)B1U", 'F'},
-    {"0N)BF(", 'F'},
-    {"0N)BN", 'F'},
-    {"0N)BN&", 'F'},
-    {"0N)BN;", 'F'},
-    {"0N)BNC", 'F'},
-    {"0N)BNK", 'F'},
-    {"0N)BNO", 'F'},
-    {"0N)BNU", 'F'},
-    {"0N)BS", 'F'},
-    {"0N)BS&", 'F'},
-    {"0N)BS;", 'F'},
-    {"0N)BSC", 'F'},
-    {"0N)BSK", 'F'},
-    {"0N)BSO", 'F'},
-    {"0N)BSU", 'F'},
-    {"0N)BV", 'F'},
-    {"0N)BV&", 'F'},
-    {"0N)BV;", 'F'},
-    {"0N)BVC", 'F'},
-    {"0N)BVK", 'F'},
-    {"0N)BVO", 'F'},
-    {"0N)BVU", 'F'},
-    {"0N)E(1", 'F'},
-    {"0N)E(F", 'F'},
-    {"0N)E(N", 'F'},
-    {"0N)E(S", 'F'},
-    {"0N)E(V", 'F'},
-    {"0N)E1C", 'F'},
-    {"0N)E1O", 'F'},
-    {"0N)EF(", 'F'},
-    {"0N)EK(", 'F'},
-    {"0N)EK1", 'F'},
-    {"0N)EKF", 'F'},
-    {"0N)EKN", 'F'},
-    {"0N)EKS", 'F'},
-    {"0N)EKV", 'F'},
-    {"0N)ENC", 'F'},
-    {"0N)ENO", 'F'},
-    {"0N)ESC", 'F'},
-    {"0N)ESO", 'F'},
-    {"0N)EVC", 'F'},
-    {"0N)EVO", 'F'},
-    {"0N)F(F", 'F'},
-    {"0N)K(1", 'F'},
-    {"0N)K(F", 'F'},
-    {"0N)K(N", 'F'},
-    {"0N)K(S", 'F'},
-    {"0N)K(V", 'F'},
-    {"0N)K1&", 'F'},
-    {"0N)K1;", 'F'},
-    {"0N)K1B", 'F'},
-    {"0N)K1E", 'F'},
-    {"0N)K1O", 'F'},
-    {"0N)K1U", 'F'},
-    {"0N)KB(", 'F'},
-    {"0N)KB1", 'F'},
-    {"0N)KBF", 'F'},
-    {"0N)KBN", 'F'},
-    {"0N)KBS", 'F'},
-    {"0N)KBV", 'F'},
-    {"0N)KF(", 'F'},
-    {"0N)KN&", 'F'},
-    {"0N)KN;", 'F'},
-    {"0N)KNB", 'F'},
-    {"0N)KNC", 'F'},
-    {"0N)KNE", 'F'},
-    {"0N)KNK", 'F'},
-    {"0N)KNU", 'F'},
-    {"0N)KS&", 'F'},
-    {"0N)KS;", 'F'},
-    {"0N)KSB", 'F'},
-    {"0N)KSE", 'F'},
-    {"0N)KSO", 'F'},
-    {"0N)KSU", 'F'},
-    {"0N)KUE", 'F'},
-    {"0N)KV&", 'F'},
-    {"0N)KV;", 'F'},
-    {"0N)KVB", 'F'},
-    {"0N)KVE", 'F'},
-    {"0N)KVO", 'F'},
-    {"0N)KVU", 'F'},
-    {"0N)O(1", 'F'},
-    {"0N)O(E", 'F'},
-    {"0N)O(F", 'F'},
-    {"0N)O(N", 'F'},
-    {"0N)O(S", 'F'},
-    {"0N)O(V", 'F'},
-    {"0N)O1&", 'F'},
-    {"0N)O1)", 'F'},
-    {"0N)O1;", 'F'},
-    {"0N)O1B", 'F'},
-    {"0N)O1C", 'F'},
-    {"0N)O1K", 'F'},
-    {"0N)O1U", 'F'},
-    {"0N)OF(", 'F'},
-    {"0N)ON&", 'F'},
-    {"0N)ON)", 'F'},
-    {"0N)ON;", 'F'},
-    {"0N)ONB", 'F'},
-    {"0N)ONC", 'F'},
-    {"0N)ONK", 'F'},
-    {"0N)ONU", 'F'},
-    {"0N)OS", 'F'},
-    {"0N)OS&", 'F'},
-    {"0N)OS)", 'F'},
-    {"0N)OS;", 'F'},
-    {"0N)OSB", 'F'},
-    {"0N)OSC", 'F'},
-    {"0N)OSK", 'F'},
-    {"0N)OSU", 'F'},
-    {"0N)OV", 'F'},
-    {"0N)OV&", 'F'},
-    {"0N)OV)", 'F'},
-    {"0N)OV;", 'F'},
-    {"0N)OVB", 'F'},
-    {"0N)OVC", 'F'},
-    {"0N)OVK", 'F'},
-    {"0N)OVO", 'F'},
-    {"0N)OVU", 'F'},
-    {"0N)U(E", 'F'},
-    {"0N)UE(", 'F'},
-    {"0N)UE1", 'F'},
-    {"0N)UEF", 'F'},
-    {"0N)UEK", 'F'},
-    {"0N)UEN", 'F'},
-    {"0N)UES", 'F'},
-    {"0N)UEV", 'F'},
-    {"0N,(1)", 'F'},
-    {"0N,(1O", 'F'},
-    {"0N,(E(", 'F'},
-    {"0N,(E1", 'F'},
-    {"0N,(EF", 'F'},
-    {"0N,(EK", 'F'},
-    {"0N,(EN", 'F'},
-    {"0N,(ES", 'F'},
-    {"0N,(EV", 'F'},
-    {"0N,(F(", 'F'},
-    {"0N,(NO", 'F'},
-    {"0N,(S)", 'F'},
-    {"0N,(SO", 'F'},
-    {"0N,(V)", 'F'},
-    {"0N,(VO", 'F'},
-    {"0N,F()", 'F'},
-    {"0N,F(1", 'F'},
-    {"0N,F(F", 'F'},
-    {"0N,F(N", 'F'},
-    {"0N,F(S", 'F'},
-    {"0N,F(V", 'F'},
-    {"0N1O(1", 'F'},
-    {"0N1O(F", 'F'},
-    {"0N1O(N", 'F'},
-    {"0N1O(S", 'F'},
-    {"0N1O(V", 'F'},
-    {"0N1OF(", 'F'},
-    {"0N1OS(", 'F'},
-    {"0N1OS1", 'F'},
-    {"0N1OSF", 'F'},
-    {"0N1OSU", 'F'},
-    {"0N1OSV", 'F'},
-    {"0N1OV(", 'F'},
-    {"0N1OVF", 'F'},
-    {"0N1OVO", 'F'},
-    {"0N1OVS", 'F'},
-    {"0N1OVU", 'F'},
-    {"0N1S;", 'F'},
-    {"0N1S;C", 'F'},
-    {"0N1SC", 'F'},
-    {"0N1UE", 'F'},
-    {"0N1UE;", 'F'},
-    {"0N1UEC", 'F'},
-    {"0N1UEK", 'F'},
-    {"0N1V;", 'F'},
-    {"0N1V;C", 'F'},
-    {"0N1VC", 'F'},
-    {"0N1VO(", 'F'},
-    {"0N1VOF", 'F'},
-    {"0N1VOS", 'F'},
-    {"0N;E(1", 'F'},
-    {"0N;E(E", 'F'},
-    {"0N;E(F", 'F'},
-    {"0N;E(N", 'F'},
-    {"0N;E(S", 'F'},
-    {"0N;E(V", 'F'},
-    {"0N;E1,", 'F'},
-    {"0N;E1;", 'F'},
-    {"0N;E1C", 'F'},
-    {"0N;E1K", 'F'},
-    {"0N;E1O", 'F'},
-    {"0N;E1T", 'F'},
-    {"0N;EF(", 'F'},
-    {"0N;EK(", 'F'},
-    {"0N;EK1", 'F'},
-    {"0N;EKF", 'F'},
-    {"0N;EKN", 'F'},
-    {"0N;EKO", 'F'},
-    {"0N;EKS", 'F'},
-    {"0N;EKV", 'F'},
-    {"0N;EN,", 'F'},
-    {"0N;EN;", 'F'},
-    {"0N;ENC", 'F'},
-    {"0N;ENE", 'F'},
-    {"0N;ENK", 'F'},
-    {"0N;ENO", 'F'},
-    {"0N;ENT", 'F'},
-    {"0N;ES,", 'F'},
-    {"0N;ES;", 'F'},
-    {"0N;ESC", 'F'},
-    {"0N;ESK", 'F'},
-    {"0N;ESO", 'F'},
-    {"0N;EST", 'F'},
-    {"0N;EV,", 'F'},
-    {"0N;EV;", 'F'},
-    {"0N;EVC", 'F'},
-    {"0N;EVK", 'F'},
-    {"0N;EVO", 'F'},
-    {"0N;EVT", 'F'},
-    {"0N;N:T", 'F'},
-    {"0N;T(1", 'F'},
-    {"0N;T(C", 'F'},
-    {"0N;T(E", 'F'},
-    {"0N;T(F", 'F'},
-    {"0N;T(N", 'F'},
-    {"0N;T(S", 'F'},
-    {"0N;T(V", 'F'},
-    {"0N;T1(", 'F'},
-    {"0N;T1,", 'F'},
-    {"0N;T1;", 'F'},
-    {"0N;T1C", 'F'},
-    {"0N;T1F", 'F'},
-    {"0N;T1K", 'F'},
-    {"0N;T1O", 'F'},
-    {"0N;T1T", 'F'},
-    {"0N;T;", 'F'},
-    {"0N;T;C", 'F'},
-    {"0N;TF(", 'F'},
-    {"0N;TK(", 'F'},
-    {"0N;TK1", 'F'},
-    {"0N;TKF", 'F'},
-    {"0N;TKK", 'F'},
-    {"0N;TKO", 'F'},
-    {"0N;TKS", 'F'},
-    {"0N;TKV", 'F'},
-    {"0N;TN(", 'F'},
-    {"0N;TN,", 'F'},
-    {"0N;TN1", 'F'},
-    {"0N;TN;", 'F'},
-    {"0N;TNC", 'F'},
-    {"0N;TNE", 'F'},
-    {"0N;TNF", 'F'},
-    {"0N;TNK", 'F'},
-    {"0N;TNN", 'F'},
-    {"0N;TNO", 'F'},
-    {"0N;TNS", 'F'},
-    {"0N;TNT", 'F'},
-    {"0N;TNV", 'F'},
-    {"0N;TO(", 'F'},
-    {"0N;TS(", 'F'},
-    {"0N;TS,", 'F'},
-    {"0N;TS;", 'F'},
-    {"0N;TSC", 'F'},
-    {"0N;TSF", 'F'},
-    {"0N;TSK", 'F'},
-    {"0N;TSO", 'F'},
-    {"0N;TST", 'F'},
-    {"0N;TTN", 'F'},
-    {"0N;TV(", 'F'},
-    {"0N;TV,", 'F'},
-    {"0N;TV;", 'F'},
-    {"0N;TVC", 'F'},
-    {"0N;TVF", 'F'},
-    {"0N;TVK", 'F'},
-    {"0N;TVO", 'F'},
-    {"0N;TVT", 'F'},
-    {"0NA(F(", 'F'},
-    {"0NA(N)", 'F'},
-    {"0NA(NO", 'F'},
-    {"0NA(S)", 'F'},
-    {"0NA(SO", 'F'},
-    {"0NA(V)", 'F'},
-    {"0NA(VO", 'F'},
-    {"0NAF()", 'F'},
-    {"0NAF(1", 'F'},
-    {"0NAF(F", 'F'},
-    {"0NAF(N", 'F'},
-    {"0NAF(S", 'F'},
-    {"0NAF(V", 'F'},
-    {"0NASO(", 'F'},
-    {"0NASO1", 'F'},
-    {"0NASOF", 'F'},
-    {"0NASON", 'F'},
-    {"0NASOS", 'F'},
-    {"0NASOV", 'F'},
-    {"0NASUE", 'F'},
-    {"0NATO(", 'F'},
-    {"0NATO1", 'F'},
-    {"0NATOF", 'F'},
-    {"0NATON", 'F'},
-    {"0NATOS", 'F'},
-    {"0NATOV", 'F'},
-    {"0NATUE", 'F'},
-    {"0NAVO(", 'F'},
-    {"0NAVOF", 'F'},
-    {"0NAVOS", 'F'},
-    {"0NAVUE", 'F'},
-    {"0NB(1&", 'F'},
-    {"0NB(1)", 'F'},
-    {"0NB(1O", 'F'},
-    {"0NB(F(", 'F'},
-    {"0NB(N&", 'F'},
-    {"0NB(NO", 'F'},
-    {"0NB(S&", 'F'},
-    {"0NB(S)", 'F'},
-    {"0NB(SO", 'F'},
-    {"0NB(V&", 'F'},
-    {"0NB(V)", 'F'},
-    {"0NB(VO", 'F'},
-    {"0NB1", 'F'},
-    {"0NB1&(", 'F'},
-    {"0NB1&1", 'F'},
-    {"0NB1&F", 'F'},
-    {"0NB1&N", 'F'},
-    {"0NB1&S", 'F'},
-    {"0NB1&V", 'F'},
-    {"0NB1,(", 'F'},
-    {"0NB1,F", 'F'},
-    {"0NB1;", 'F'},
-    {"0NB1;C", 'F'},
-    {"0NB1B(", 'F'},
-    {"0NB1B1", 'F'},
-    {"0NB1BF", 'F'},
-    {"0NB1BN", 'F'},
-    {"0NB1BS", 'F'},
-    {"0NB1BV", 'F'},
-    {"0NB1C", 'F'},
-    {"0NB1K(", 'F'},
-    {"0NB1K1", 'F'},
-    {"0NB1KF", 'F'},
-    {"0NB1KN", 'F'},
-    {"0NB1KS", 'F'},
-    {"0NB1KV", 'F'},
-    {"0NB1O(", 'F'},
-    {"0NB1OF", 'F'},
-    {"0NB1OS", 'F'},
-    {"0NB1OV", 'F'},
-    {"0NB1U(", 'F'},
-    {"0NB1UE", 'F'},
-    {"0NBE(1", 'F'},
-    {"0NBE(F", 'F'},
-    {"0NBE(N", 'F'},
-    {"0NBE(S", 'F'},
-    {"0NBE(V", 'F'},
-    {"0NBEK(", 'F'},
-    {"0NBF()", 'F'},
-    {"0NBF(1", 'F'},
-    {"0NBF(F", 'F'},
-    {"0NBF(N", 'F'},
-    {"0NBF(S", 'F'},
-    {"0NBF(V", 'F'},
-    {"0NBN&(", 'F'},
-    {"0NBN&1", 'F'},
-    {"0NBN&F", 'F'},
-    {"0NBN&N", 'F'},
-    {"0NBN&S", 'F'},
-    {"0NBN&V", 'F'},
-    {"0NBN,(", 'F'},
-    {"0NBN,F", 'F'},
-    {"0NBN;", 'F'},
-    {"0NBN;C", 'F'},
-    {"0NBNB(", 'F'},
-    {"0NBNB1", 'F'},
-    {"0NBNBF", 'F'},
-    {"0NBNBN", 'F'},
-    {"0NBNBS", 'F'},
-    {"0NBNBV", 'F'},
-    {"0NBNC", 'F'},
-    {"0NBNK(", 'F'},
-    {"0NBNK1", 'F'},
-    {"0NBNKF", 'F'},
-    {"0NBNKN", 'F'},
-    {"0NBNKS", 'F'},
-    {"0NBNKV", 'F'},
-    {"0NBNO(", 'F'},
-    {"0NBNOF", 'F'},
-    {"0NBNOS", 'F'},
-    {"0NBNOV", 'F'},
-    {"0NBNU(", 'F'},
-    {"0NBNUE", 'F'},
-    {"0NBS", 'F'},
-    {"0NBS&(", 'F'},
-    {"0NBS&1", 'F'},
-    {"0NBS&F", 'F'},
-    {"0NBS&N", 'F'},
-    {"0NBS&S", 'F'},
-    {"0NBS&V", 'F'},
-    {"0NBS,(", 'F'},
-    {"0NBS,F", 'F'},
-    {"0NBS;", 'F'},
-    {"0NBS;C", 'F'},
-    {"0NBSB(", 'F'},
-    {"0NBSB1", 'F'},
-    {"0NBSBF", 'F'},
-    {"0NBSBN", 'F'},
-    {"0NBSBS", 'F'},
-    {"0NBSBV", 'F'},
-    {"0NBSC", 'F'},
-    {"0NBSK(", 'F'},
-    {"0NBSK1", 'F'},
-    {"0NBSKF", 'F'},
-    {"0NBSKN", 'F'},
-    {"0NBSKS", 'F'},
-    {"0NBSKV", 'F'},
-    {"0NBSO(", 'F'},
-    {"0NBSO1", 'F'},
-    {"0NBSOF", 'F'},
-    {"0NBSON", 'F'},
-    {"0NBSOS", 'F'},
-    {"0NBSOV", 'F'},
-    {"0NBSU(", 'F'},
-    {"0NBSUE", 'F'},
-    {"0NBV", 'F'},
-    {"0NBV&(", 'F'},
-    {"0NBV&1", 'F'},
-    {"0NBV&F", 'F'},
-    {"0NBV&N", 'F'},
-    {"0NBV&S", 'F'},
-    {"0NBV&V", 'F'},
-    {"0NBV,(", 'F'},
-    {"0NBV,F", 'F'},
-    {"0NBV;", 'F'},
-    {"0NBV;C", 'F'},
-    {"0NBVB(", 'F'},
-    {"0NBVB1", 'F'},
-    {"0NBVBF", 'F'},
-    {"0NBVBN", 'F'},
-    {"0NBVBS", 'F'},
-    {"0NBVBV", 'F'},
-    {"0NBVC", 'F'},
-    {"0NBVK(", 'F'},
-    {"0NBVK1", 'F'},
-    {"0NBVKF", 'F'},
-    {"0NBVKN", 'F'},
-    {"0NBVKS", 'F'},
-    {"0NBVKV", 'F'},
-    {"0NBVO(", 'F'},
-    {"0NBVOF", 'F'},
-    {"0NBVOS", 'F'},
-    {"0NBVU(", 'F'},
-    {"0NBVUE", 'F'},
-    {"0NC", 'F'},
-    {"0NE(1)", 'F'},
-    {"0NE(1O", 'F'},
-    {"0NE(F(", 'F'},
-    {"0NE(N)", 'F'},
-    {"0NE(NO", 'F'},
-    {"0NE(S)", 'F'},
-    {"0NE(SO", 'F'},
-    {"0NE(V)", 'F'},
-    {"0NE(VO", 'F'},
-    {"0NE1;T", 'F'},
-    {"0NE1C", 'F'},
-    {"0NE1O(", 'F'},
-    {"0NE1OF", 'F'},
-    {"0NE1OS", 'F'},
-    {"0NE1OV", 'F'},
-    {"0NE1T(", 'F'},
-    {"0NE1T1", 'F'},
-    {"0NE1TF", 'F'},
-    {"0NE1TN", 'F'},
-    {"0NE1TS", 'F'},
-    {"0NE1TV", 'F'},
-    {"0NE1UE", 'F'},
-    {"0NEF()", 'F'},
-    {"0NEF(1", 'F'},
-    {"0NEF(F", 'F'},
-    {"0NEF(N", 'F'},
-    {"0NEF(S", 'F'},
-    {"0NEF(V", 'F'},
-    {"0NEN;T", 'F'},
-    {"0NENO(", 'F'},
-    {"0NENOF", 'F'},
-    {"0NENOS", 'F'},
-    {"0NENOV", 'F'},
-    {"0NENT(", 'F'},
-    {"0NENT1", 'F'},
-    {"0NENTF", 'F'},
-    {"0NENTN", 'F'},
-    {"0NENTS", 'F'},
-    {"0NENTV", 'F'},
-    {"0NENUE", 'F'},
-    {"0NEOKN", 'F'},
-    {"0NES;T", 'F'},
-    {"0NESC", 'F'},
-    {"0NESO(", 'F'},
-    {"0NESO1", 'F'},
-    {"0NESOF", 'F'},
-    {"0NESON", 'F'},
-    {"0NESOS", 'F'},
-    {"0NESOV", 'F'},
-    {"0NEST(", 'F'},
-    {"0NEST1", 'F'},
-    {"0NESTF", 'F'},
-    {"0NESTN", 'F'},
-    {"0NESTS", 'F'},
-    {"0NESTV", 'F'},
-    {"0NESUE", 'F'},
-    {"0NEU(1", 'F'},
-    {"0NEU(F", 'F'},
-    {"0NEU(N", 'F'},
-    {"0NEU(S", 'F'},
-    {"0NEU(V", 'F'},
-    {"0NEU1,", 'F'},
-    {"0NEU1C", 'F'},
-    {"0NEU1O", 'F'},
-    {"0NEUEF", 'F'},
-    {"0NEUEK", 'F'},
-    {"0NEUF(", 'F'},
-    {"0NEUS,", 'F'},
-    {"0NEUSC", 'F'},
-    {"0NEUSO", 'F'},
-    {"0NEUV,", 'F'},
-    {"0NEUVC", 'F'},
-    {"0NEUVO", 'F'},
-    {"0NEV;T", 'F'},
-    {"0NEVC", 'F'},
-    {"0NEVO(", 'F'},
-    {"0NEVOF", 'F'},
-    {"0NEVOS", 'F'},
-    {"0NEVT(", 'F'},
-    {"0NEVT1", 'F'},
-    {"0NEVTF", 'F'},
-    {"0NEVTN", 'F'},
-    {"0NEVTS", 'F'},
-    {"0NEVTV", 'F'},
-    {"0NEVUE", 'F'},
-    {"0NF()1", 'F'},
-    {"0NF()F", 'F'},
-    {"0NF()K", 'F'},
-    {"0NF()N", 'F'},
-    {"0NF()O", 'F'},
-    {"0NF()S", 'F'},
-    {"0NF()U", 'F'},
-    {"0NF()V", 'F'},
-    {"0NF(1)", 'F'},
-    {"0NF(1O", 'F'},
-    {"0NF(E(", 'F'},
-    {"0NF(E1", 'F'},
-    {"0NF(EF", 'F'},
-    {"0NF(EK", 'F'},
-    {"0NF(EN", 'F'},
-    {"0NF(ES", 'F'},
-    {"0NF(EV", 'F'},
-    {"0NF(F(", 'F'},
-    {"0NF(N,", 'F'},
-    {"0NF(NO", 'F'},
-    {"0NF(S)", 'F'},
-    {"0NF(SO", 'F'},
-    {"0NF(V)", 'F'},
-    {"0NF(VO", 'F'},
-    {"0NK(1)", 'F'},
-    {"0NK(1O", 'F'},
-    {"0NK(F(", 'F'},
-    {"0NK(NO", 'F'},
-    {"0NK(S)", 'F'},
-    {"0NK(SO", 'F'},
-    {"0NK(V)", 'F'},
-    {"0NK(VO", 'F'},
-    {"0NK)&(", 'F'},
-    {"0NK)&1", 'F'},
-    {"0NK)&F", 'F'},
-    {"0NK)&N", 'F'},
-    {"0NK)&S", 'F'},
-    {"0NK)&V", 'F'},
-    {"0NK);E", 'F'},
-    {"0NK);T", 'F'},
-    {"0NK)B(", 'F'},
-    {"0NK)B1", 'F'},
-    {"0NK)BF", 'F'},
-    {"0NK)BN", 'F'},
-    {"0NK)BS", 'F'},
-    {"0NK)BV", 'F'},
-    {"0NK)E(", 'F'},
-    {"0NK)E1", 'F'},
-    {"0NK)EF", 'F'},
-    {"0NK)EK", 'F'},
-    {"0NK)EN", 'F'},
-    {"0NK)ES", 'F'},
-    {"0NK)EV", 'F'},
-    {"0NK)F(", 'F'},
-    {"0NK)O(", 'F'},
-    {"0NK)OF", 'F'},
-    {"0NK)UE", 'F'},
-    {"0NK1", 'F'},
-    {"0NK1&(", 'F'},
-    {"0NK1&1", 'F'},
-    {"0NK1&F", 'F'},
-    {"0NK1&N", 'F'},
-    {"0NK1&S", 'F'},
-    {"0NK1&V", 'F'},
-    {"0NK1;C", 'F'},
-    {"0NK1;E", 'F'},
-    {"0NK1;T", 'F'},
-    {"0NK1B(", 'F'},
-    {"0NK1B1", 'F'},
-    {"0NK1BF", 'F'},
-    {"0NK1BN", 'F'},
-    {"0NK1BS", 'F'},
-    {"0NK1BV", 'F'},
-    {"0NK1C", 'F'},
-    {"0NK1E(", 'F'},
-    {"0NK1E1", 'F'},
-    {"0NK1EF", 'F'},
-    {"0NK1EK", 'F'},
-    {"0NK1EN", 'F'},
-    {"0NK1ES", 'F'},
-    {"0NK1EV", 'F'},
-    {"0NK1O(", 'F'},
-    {"0NK1OF", 'F'},
-    {"0NK1OS", 'F'},
-    {"0NK1OV", 'F'},
-    {"0NK1U(", 'F'},
-    {"0NK1UE", 'F'},
-    {"0NKF()", 'F'},
-    {"0NKF(1", 'F'},
-    {"0NKF(F", 'F'},
-    {"0NKF(N", 'F'},
-    {"0NKF(S", 'F'},
-    {"0NKF(V", 'F'},
-    {"0NKN", 'F'},
-    {"0NKN&(", 'F'},
-    {"0NKN&1", 'F'},
-    {"0NKN&F", 'F'},
-    {"0NKN&S", 'F'},
-    {"0NKN&V", 'F'},
-    {"0NKN;C", 'F'},
-    {"0NKN;E", 'F'},
-    {"0NKN;T", 'F'},
-    {"0NKNB(", 'F'},
-    {"0NKNB1", 'F'},
-    {"0NKNBF", 'F'},
-    {"0NKNBN", 'F'},
-    {"0NKNBS", 'F'},
-    {"0NKNBV", 'F'},
-    {"0NKNE(", 'F'},
-    {"0NKNE1", 'F'},
-    {"0NKNEF", 'F'},
-    {"0NKNES", 'F'},
-    {"0NKNEV", 'F'},
-    {"0NKNU(", 'F'},
-    {"0NKNUE", 'F'},
-    {"0NKS", 'F'},
-    {"0NKS&(", 'F'},
-    {"0NKS&1", 'F'},
-    {"0NKS&F", 'F'},
-    {"0NKS&N", 'F'},
-    {"0NKS&S", 'F'},
-    {"0NKS&V", 'F'},
-    {"0NKS;", 'F'},
-    {"0NKS;C", 'F'},
-    {"0NKS;E", 'F'},
-    {"0NKS;T", 'F'},
-    {"0NKSB(", 'F'},
-    {"0NKSB1", 'F'},
-    {"0NKSBF", 'F'},
-    {"0NKSBN", 'F'},
-    {"0NKSBS", 'F'},
-    {"0NKSBV", 'F'},
-    {"0NKSC", 'F'},
-    {"0NKSE(", 'F'},
-    {"0NKSE1", 'F'},
-    {"0NKSEF", 'F'},
-    {"0NKSEK", 'F'},
-    {"0NKSEN", 'F'},
-    {"0NKSES", 'F'},
-    {"0NKSEV", 'F'},
-    {"0NKSO(", 'F'},
-    {"0NKSO1", 'F'},
-    {"0NKSOF", 'F'},
-    {"0NKSON", 'F'},
-    {"0NKSOS", 'F'},
-    {"0NKSOV", 'F'},
-    {"0NKSU(", 'F'},
-    {"0NKSUE", 'F'},
-    {"0NKUE(", 'F'},
-    {"0NKUE1", 'F'},
-    {"0NKUEF", 'F'},
-    {"0NKUEK", 'F'},
-    {"0NKUEN", 'F'},
-    {"0NKUES", 'F'},
-    {"0NKUEV", 'F'},
-    {"0NKV", 'F'},
-    {"0NKV&(", 'F'},
-    {"0NKV&1", 'F'},
-    {"0NKV&F", 'F'},
-    {"0NKV&N", 'F'},
-    {"0NKV&S", 'F'},
-    {"0NKV&V", 'F'},
-    {"0NKV;", 'F'},
-    {"0NKV;C", 'F'},
-    {"0NKV;E", 'F'},
-    {"0NKV;T", 'F'},
-    {"0NKVB(", 'F'},
-    {"0NKVB1", 'F'},
-    {"0NKVBF", 'F'},
-    {"0NKVBN", 'F'},
-    {"0NKVBS", 'F'},
-    {"0NKVBV", 'F'},
-    {"0NKVC", 'F'},
-    {"0NKVE(", 'F'},
-    {"0NKVE1", 'F'},
-    {"0NKVEF", 'F'},
-    {"0NKVEK", 'F'},
-    {"0NKVEN", 'F'},
-    {"0NKVES", 'F'},
-    {"0NKVEV", 'F'},
-    {"0NKVO(", 'F'},
-    {"0NKVOF", 'F'},
-    {"0NKVOS", 'F'},
-    {"0NKVU(", 'F'},
-    {"0NKVUE", 'F'},
-    {"0NO(1&", 'F'},
-    {"0NO(1)", 'F'},
-    {"0NO(1,", 'F'},
-    {"0NO(1O", 'F'},
-    {"0NO(E(", 'F'},
-    {"0NO(E1", 'F'},
-    {"0NO(EE", 'F'},
-    {"0NO(EF", 'F'},
-    {"0NO(EK", 'F'},
-    {"0NO(EN", 'F'},
-    {"0NO(EO", 'F'},
-    {"0NO(ES", 'F'},
-    {"0NO(EV", 'F'},
-    {"0NO(F(", 'F'},
-    {"0NO(N&", 'F'},
-    {"0NO(N)", 'F'},
-    {"0NO(N,", 'F'},
-    {"0NO(NO", 'F'},
-    {"0NO(S&", 'F'},
-    {"0NO(S)", 'F'},
-    {"0NO(S,", 'F'},
-    {"0NO(SO", 'F'},
-    {"0NO(V&", 'F'},
-    {"0NO(V)", 'F'},
-    {"0NO(V,", 'F'},
-    {"0NO(VO", 'F'},
-    {"0NOF()", 'F'},
-    {"0NOF(1", 'F'},
-    {"0NOF(E", 'F'},
-    {"0NOF(F", 'F'},
-    {"0NOF(N", 'F'},
-    {"0NOF(S", 'F'},
-    {"0NOF(V", 'F'},
-    {"0NOK&(", 'F'},
-    {"0NOK(1", 'F'},
-    {"0NOK(F", 'F'},
-    {"0NOK(N", 'F'},
-    {"0NOK(S", 'F'},
-    {"0NOK(V", 'F'},
-    {"0NOK1C", 'F'},
-    {"0NOK1O", 'F'},
-    {"0NOKF(", 'F'},
-    {"0NOKNC", 'F'},
-    {"0NOKO(", 'F'},
-    {"0NOKO1", 'F'},
-    {"0NOKOF", 'F'},
-    {"0NOKON", 'F'},
-    {"0NOKOS", 'F'},
-    {"0NOKOV", 'F'},
-    {"0NOKSC", 'F'},
-    {"0NOKSO", 'F'},
-    {"0NOKVC", 'F'},
-    {"0NOKVO", 'F'},
-    {"0NONSU", 'F'},
-    {"0NOS&(", 'F'},
-    {"0NOS&1", 'F'},
-    {"0NOS&E", 'F'},
-    {"0NOS&F", 'F'},
-    {"0NOS&K", 'F'},
-    {"0NOS&N", 'F'},
-    {"0NOS&S", 'F'},
-    {"0NOS&U", 'F'},
-    {"0NOS&V", 'F'},
-    {"0NOS(E", 'F'},
-    {"0NOS(U", 'F'},
-    {"0NOS)&", 'F'},
-    {"0NOS),", 'F'},
-    {"0NOS);", 'F'},
-    {"0NOS)B", 'F'},
-    {"0NOS)C", 'F'},
-    {"0NOS)E", 'F'},
-    {"0NOS)F", 'F'},
-    {"0NOS)K", 'F'},
-    {"0NOS)O", 'F'},
-    {"0NOS)U", 'F'},
-    {"0NOS,(", 'F'},
-    {"0NOS,F", 'F'},
-    {"0NOS1(", 'F'},
-    {"0NOS1F", 'F'},
-    {"0NOS1N", 'F'},
-    {"0NOS1S", 'F'},
-    {"0NOS1U", 'F'},
-    {"0NOS1V", 'F'},
-    {"0NOS;", 'F'},
-    {"0NOS;C", 'F'},
-    {"0NOS;E", 'F'},
-    {"0NOS;T", 'F'},
-    {"0NOSA(", 'F'},
-    {"0NOSAF", 'F'},
-    {"0NOSAS", 'F'},
-    {"0NOSAT", 'F'},
-    {"0NOSAV", 'F'},
-    {"0NOSB(", 'F'},
-    {"0NOSB1", 'F'},
-    {"0NOSBE", 'F'},
-    {"0NOSBF", 'F'},
-    {"0NOSBN", 'F'},
-    {"0NOSBS", 'F'},
-    {"0NOSBV", 'F'},
-    {"0NOSC", 'F'},
-    {"0NOSE(", 'F'},
-    {"0NOSE1", 'F'},
-    {"0NOSEF", 'F'},
-    {"0NOSEK", 'F'},
-    {"0NOSEN", 'F'},
-    {"0NOSEO", 'F'},
-    {"0NOSES", 'F'},
-    {"0NOSEU", 'F'},
-    {"0NOSEV", 'F'},
-    {"0NOSF(", 'F'},
-    {"0NOSK(", 'F'},
-    {"0NOSK)", 'F'},
-    {"0NOSK1", 'F'},
-    {"0NOSKB", 'F'},
-    {"0NOSKF", 'F'},
-    {"0NOSKN", 'F'},
-    {"0NOSKS", 'F'},
-    {"0NOSKU", 'F'},
-    {"0NOSKV", 'F'},
-    {"0NOST(", 'F'},
-    {"0NOST1", 'F'},
-    {"0NOSTE", 'F'},
-    {"0NOSTF", 'F'},
-    {"0NOSTN", 'F'},
-    {"0NOSTS", 'F'},
-    {"0NOSTT", 'F'},
-    {"0NOSTV", 'F'},
-    {"0NOSU", 'F'},
-    {"0NOSU(", 'F'},
-    {"0NOSU1", 'F'},
-    {"0NOSU;", 'F'},
-    {"0NOSUC", 'F'},
-    {"0NOSUE", 'F'},
-    {"0NOSUF", 'F'},
-    {"0NOSUK", 'F'},
-    {"0NOSUO", 'F'},
-    {"0NOSUS", 'F'},
-    {"0NOSUT", 'F'},
-    {"0NOSUV", 'F'},
-    {"0NOSV(", 'F'},
-    {"0NOSVF", 'F'},
-    {"0NOSVO", 'F'},
-    {"0NOSVS", 'F'},
-    {"0NOSVU", 'F'},
-    {"0NOU(E", 'F'},
-    {"0NOUEK", 'F'},
-    {"0NOUEN", 'F'},
-    {"0NOV&(", 'F'},
-    {"0NOV&1", 'F'},
-    {"0NOV&E", 'F'},
-    {"0NOV&F", 'F'},
-    {"0NOV&K", 'F'},
-    {"0NOV&N", 'F'},
-    {"0NOV&S", 'F'},
-    {"0NOV&U", 'F'},
-    {"0NOV&V", 'F'},
-    {"0NOV(E", 'F'},
-    {"0NOV(U", 'F'},
-    {"0NOV)&", 'F'},
-    {"0NOV),", 'F'},
-    {"0NOV);", 'F'},
-    {"0NOV)B", 'F'},
-    {"0NOV)C", 'F'},
-    {"0NOV)E", 'F'},
-    {"0NOV)F", 'F'},
-    {"0NOV)K", 'F'},
-    {"0NOV)O", 'F'},
-    {"0NOV)U", 'F'},
-    {"0NOV,(", 'F'},
-    {"0NOV,F", 'F'},
-    {"0NOV;", 'F'},
-    {"0NOV;C", 'F'},
-    {"0NOV;E", 'F'},
-    {"0NOV;N", 'F'},
-    {"0NOV;T", 'F'},
-    {"0NOVA(", 'F'},
-    {"0NOVAF", 'F'},
-    {"0NOVAS", 'F'},
-    {"0NOVAT", 'F'},
-    {"0NOVAV", 'F'},
-    {"0NOVB(", 'F'},
-    {"0NOVB1", 'F'},
-    {"0NOVBE", 'F'},
-    {"0NOVBF", 'F'},
-    {"0NOVBN", 'F'},
-    {"0NOVBS", 'F'},
-    {"0NOVBV", 'F'},
-    {"0NOVC", 'F'},
-    {"0NOVE(", 'F'},
-    {"0NOVE1", 'F'},
-    {"0NOVEF", 'F'},
-    {"0NOVEK", 'F'},
-    {"0NOVEN", 'F'},
-    {"0NOVEO", 'F'},
-    {"0NOVES", 'F'},
-    {"0NOVEU", 'F'},
-    {"0NOVEV", 'F'},
-    {"0NOVF(", 'F'},
-    {"0NOVK(", 'F'},
-    {"0NOVK)", 'F'},
-    {"0NOVK1", 'F'},
-    {"0NOVKB", 'F'},
-    {"0NOVKF", 'F'},
-    {"0NOVKN", 'F'},
-    {"0NOVKS", 'F'},
-    {"0NOVKU", 'F'},
-    {"0NOVKV", 'F'},
-    {"0NOVO(", 'F'},
-    {"0NOVOF", 'F'},
-    {"0NOVOK", 'F'},
-    {"0NOVOS", 'F'},
-    {"0NOVOU", 'F'},
-    {"0NOVS(", 'F'},
-    {"0NOVS1", 'F'},
-    {"0NOVSF", 'F'},
-    {"0NOVSO", 'F'},
-    {"0NOVSU", 'F'},
-    {"0NOVSV", 'F'},
-    {"0NOVT(", 'F'},
-    {"0NOVT1", 'F'},
-    {"0NOVTE", 'F'},
-    {"0NOVTF", 'F'},
-    {"0NOVTN", 'F'},
-    {"0NOVTS", 'F'},
-    {"0NOVTT", 'F'},
-    {"0NOVTV", 'F'},
-    {"0NOVU", 'F'},
-    {"0NOVU(", 'F'},
-    {"0NOVU1", 'F'},
-    {"0NOVU;", 'F'},
-    {"0NOVUC", 'F'},
-    {"0NOVUE", 'F'},
-    {"0NOVUF", 'F'},
-    {"0NOVUK", 'F'},
-    {"0NOVUO", 'F'},
-    {"0NOVUS", 'F'},
-    {"0NOVUT", 'F'},
-    {"0NOVUV", 'F'},
-    {"0NSO1U", 'F'},
-    {"0NSONU", 'F'},
-    {"0NSOSU", 'F'},
-    {"0NSOVU", 'F'},
-    {"0NSUE", 'F'},
-    {"0NSUE;", 'F'},
-    {"0NSUEC", 'F'},
-    {"0NSUEK", 'F'},
-    {"0NT(1)", 'F'},
-    {"0NT(1O", 'F'},
-    {"0NT(F(", 'F'},
-    {"0NT(N)", 'F'},
-    {"0NT(NO", 'F'},
-    {"0NT(S)", 'F'},
-    {"0NT(SO", 'F'},
-    {"0NT(V)", 'F'},
-    {"0NT(VO", 'F'},
-    {"0NT1(F", 'F'},
-    {"0NT1O(", 'F'},
-    {"0NT1OF", 'F'},
-    {"0NT1OS", 'F'},
-    {"0NT1OV", 'F'},
-    {"0NTE(1", 'F'},
-    {"0NTE(F", 'F'},
-    {"0NTE(N", 'F'},
-    {"0NTE(S", 'F'},
-    {"0NTE(V", 'F'},
-    {"0NTE1N", 'F'},
-    {"0NTE1O", 'F'},
-    {"0NTEF(", 'F'},
-    {"0NTEK(", 'F'},
-    {"0NTEK1", 'F'},
-    {"0NTEKF", 'F'},
-    {"0NTEKN", 'F'},
-    {"0NTEKS", 'F'},
-    {"0NTEKV", 'F'},
-    {"0NTENN", 'F'},
-    {"0NTENO", 'F'},
-    {"0NTESN", 'F'},
-    {"0NTESO", 'F'},
-    {"0NTEVN", 'F'},
-    {"0NTEVO", 'F'},
-    {"0NTF()", 'F'},
-    {"0NTF(1", 'F'},
-    {"0NTF(F", 'F'},
-    {"0NTF(N", 'F'},
-    {"0NTF(S", 'F'},
-    {"0NTF(V", 'F'},
-    {"0NTN(1", 'F'},
-    {"0NTN(F", 'F'},
-    {"0NTN(S", 'F'},
-    {"0NTN(V", 'F'},
-    {"0NTN1C", 'F'},
-    {"0NTN1O", 'F'},
-    {"0NTN;E", 'F'},
-    {"0NTN;N", 'F'},
-    {"0NTN;T", 'F'},
-    {"0NTNE(", 'F'},
-    {"0NTNE1", 'F'},
-    {"0NTNEF", 'F'},
-    {"0NTNEN", 'F'},
-    {"0NTNES", 'F'},
-    {"0NTNEV", 'F'},
-    {"0NTNF(", 'F'},
-    {"0NTNKN", 'F'},
-    {"0NTNN:", 'F'},
-    {"0NTNNC", 'F'},
-    {"0NTNNO", 'F'},
-    {"0NTNO(", 'F'},
-    {"0NTNOF", 'F'},
-    {"0NTNOS", 'F'},
-    {"0NTNOV", 'F'},
-    {"0NTNSC", 'F'},
-    {"0NTNSO", 'F'},
-    {"0NTNT(", 'F'},
-    {"0NTNT1", 'F'},
-    {"0NTNTF", 'F'},
-    {"0NTNTN", 'F'},
-    {"0NTNTS", 'F'},
-    {"0NTNTV", 'F'},
-    {"0NTNVC", 'F'},
-    {"0NTNVO", 'F'},
-    {"0NTS(F", 'F'},
-    {"0NTSO(", 'F'},
-    {"0NTSO1", 'F'},
-    {"0NTSOF", 'F'},
-    {"0NTSON", 'F'},
-    {"0NTSOS", 'F'},
-    {"0NTSOV", 'F'},
-    {"0NTTNE", 'F'},
-    {"0NTTNK", 'F'},
-    {"0NTTNN", 'F'},
-    {"0NTTNT", 'F'},
-    {"0NTV(1", 'F'},
-    {"0NTV(F", 'F'},
-    {"0NTVO(", 'F'},
-    {"0NTVOF", 'F'},
-    {"0NTVOS", 'F'},
-    {"0NU(1)", 'F'},
-    {"0NU(1O", 'F'},
-    {"0NU(E(", 'F'},
-    {"0NU(E1", 'F'},
-    {"0NU(EF", 'F'},
-    {"0NU(EK", 'F'},
-    {"0NU(EN", 'F'},
-    {"0NU(ES", 'F'},
-    {"0NU(EV", 'F'},
-    {"0NU(F(", 'F'},
-    {"0NU(N)", 'F'},
-    {"0NU(NO", 'F'},
-    {"0NU(S)", 'F'},
-    {"0NU(SO", 'F'},
-    {"0NU(V)", 'F'},
-    {"0NU(VO", 'F'},
-    {"0NU1,(", 'F'},
-    {"0NU1,F", 'F'},
-    {"0NU1C", 'F'},
-    {"0NU1O(", 'F'},
-    {"0NU1OF", 'F'},
-    {"0NU1OS", 'F'},
-    {"0NU1OV", 'F'},
-    {"0NU;", 'F'},
-    {"0NU;C", 'F'},
-    {"0NUC", 'F'},
-    {"0NUE", 'F'},
-    {"0NUE(1", 'F'},
-    {"0NUE(E", 'F'},
-    {"0NUE(F", 'F'},
-    {"0NUE(N", 'F'},
-    {"0NUE(O", 'F'},
-    {"0NUE(S", 'F'},
-    {"0NUE(V", 'F'},
-    {"0NUE1", 'F'},
-    {"0NUE1&", 'F'},
-    {"0NUE1(", 'F'},
-    {"0NUE1)", 'F'},
-    {"0NUE1,", 'F'},
-    {"0NUE1;", 'F'},
-    {"0NUE1B", 'F'},
-    {"0NUE1C", 'F'},
-    {"0NUE1F", 'F'},
-    {"0NUE1K", 'F'},
-    {"0NUE1N", 'F'},
-    {"0NUE1O", 'F'},
-    {"0NUE1S", 'F'},
-    {"0NUE1U", 'F'},
-    {"0NUE1V", 'F'},
-    {"0NUE;", 'F'},
-    {"0NUE;C", 'F'},
-    {"0NUEC", 'F'},
-    {"0NUEF", 'F'},
-    {"0NUEF(", 'F'},
-    {"0NUEF,", 'F'},
-    {"0NUEF;", 'F'},
-    {"0NUEFC", 'F'},
-    {"0NUEK", 'F'},
-    {"0NUEK(", 'F'},
-    {"0NUEK1", 'F'},
-    {"0NUEK;", 'F'},
-    {"0NUEKC", 'F'},
-    {"0NUEKF", 'F'},
-    {"0NUEKN", 'F'},
-    {"0NUEKO", 'F'},
-    {"0NUEKS", 'F'},
-    {"0NUEKV", 'F'},
-    {"0NUEN", 'F'},
-    {"0NUEN&", 'F'},
-    {"0NUEN(", 'F'},
-    {"0NUEN)", 'F'},
-    {"0NUEN,", 'F'},
-    {"0NUEN1", 'F'},
-    {"0NUEN;", 'F'},
-    {"0NUENB", 'F'},
-    {"0NUENC", 'F'},
-    {"0NUENF", 'F'},
-    {"0NUENK", 'F'},
-    {"0NUENO", 'F'},
-    {"0NUENS", 'F'},
-    {"0NUENU", 'F'},
-    {"0NUEOK", 'F'},
-    {"0NUEON", 'F'},
-    {"0NUES", 'F'},
-    {"0NUES&", 'F'},
-    {"0NUES(", 'F'},
-    {"0NUES)", 'F'},
-    {"0NUES,", 'F'},
-    {"0NUES1", 'F'},
-    {"0NUES;", 'F'},
-    {"0NUESB", 'F'},
-    {"0NUESC", 'F'},
-    {"0NUESF", 'F'},
-    {"0NUESK", 'F'},
-    {"0NUESO", 'F'},
-    {"0NUESU", 'F'},
-    {"0NUESV", 'F'},
-    {"0NUEV", 'F'},
-    {"0NUEV&", 'F'},
-    {"0NUEV(", 'F'},
-    {"0NUEV)", 'F'},
-    {"0NUEV,", 'F'},
-    {"0NUEV;", 'F'},
-    {"0NUEVB", 'F'},
-    {"0NUEVC", 'F'},
-    {"0NUEVF", 'F'},
-    {"0NUEVK", 'F'},
-    {"0NUEVN", 'F'},
-    {"0NUEVO", 'F'},
-    {"0NUEVS", 'F'},
-    {"0NUEVU", 'F'},
-    {"0NUF()", 'F'},
-    {"0NUF(1", 'F'},
-    {"0NUF(F", 'F'},
-    {"0NUF(N", 'F'},
-    {"0NUF(S", 'F'},
-    {"0NUF(V", 'F'},
-    {"0NUK(E", 'F'},
-    {"0NUO(E", 'F'},
-    {"0NUON(", 'F'},
-    {"0NUON1", 'F'},
-    {"0NUONF", 'F'},
-    {"0NUONS", 'F'},
-    {"0NUS,(", 'F'},
-    {"0NUS,F", 'F'},
-    {"0NUSC", 'F'},
-    {"0NUSO(", 'F'},
-    {"0NUSO1", 'F'},
-    {"0NUSOF", 'F'},
-    {"0NUSON", 'F'},
-    {"0NUSOS", 'F'},
-    {"0NUSOV", 'F'},
-    {"0NUTN(", 'F'},
-    {"0NUTN1", 'F'},
-    {"0NUTNF", 'F'},
-    {"0NUTNN", 'F'},
-    {"0NUTNS", 'F'},
-    {"0NUTNV", 'F'},
-    {"0NUV,(", 'F'},
-    {"0NUV,F", 'F'},
-    {"0NUVC", 'F'},
-    {"0NUVO(", 'F'},
-    {"0NUVOF", 'F'},
-    {"0NUVOS", 'F'},
-    {"0S&(1&", 'F'},
-    {"0S&(1)", 'F'},
-    {"0S&(1,", 'F'},
-    {"0S&(1O", 'F'},
-    {"0S&(E(", 'F'},
-    {"0S&(E1", 'F'},
-    {"0S&(EF", 'F'},
-    {"0S&(EK", 'F'},
-    {"0S&(EN", 'F'},
-    {"0S&(EO", 'F'},
-    {"0S&(ES", 'F'},
-    {"0S&(EV", 'F'},
-    {"0S&(F(", 'F'},
-    {"0S&(N&", 'F'},
-    {"0S&(N)", 'F'},
-    {"0S&(N,", 'F'},
-    {"0S&(NO", 'F'},
-    {"0S&(S&", 'F'},
-    {"0S&(S)", 'F'},
-    {"0S&(S,", 'F'},
-    {"0S&(SO", 'F'},
-    {"0S&(V&", 'F'},
-    {"0S&(V)", 'F'},
-    {"0S&(V,", 'F'},
-    {"0S&(VO", 'F'},
-    {"0S&1", 'F'},
-    {"0S&1&(", 'F'},
-    {"0S&1&1", 'F'},
-    {"0S&1&F", 'F'},
-    {"0S&1&N", 'F'},
-    {"0S&1&S", 'F'},
-    {"0S&1&V", 'F'},
-    {"0S&1)&", 'F'},
-    {"0S&1)C", 'F'},
-    {"0S&1)O", 'F'},
-    {"0S&1)U", 'F'},
-    {"0S&1;", 'F'},
-    {"0S&1;C", 'F'},
-    {"0S&1;E", 'F'},
-    {"0S&1;T", 'F'},
-    {"0S&1B(", 'F'},
-    {"0S&1B1", 'F'},
-    {"0S&1BF", 'F'},
-    {"0S&1BN", 'F'},
-    {"0S&1BS", 'F'},
-    {"0S&1BV", 'F'},
-    {"0S&1C", 'F'},
-    {"0S&1EK", 'F'},
-    {"0S&1EN", 'F'},
-    {"0S&1F(", 'F'},
-    {"0S&1K(", 'F'},
-    {"0S&1K1", 'F'},
-    {"0S&1KF", 'F'},
-    {"0S&1KN", 'F'},
-    {"0S&1KS", 'F'},
-    {"0S&1KV", 'F'},
-    {"0S&1O(", 'F'},
-    {"0S&1OF", 'F'},
-    {"0S&1OS", 'F'},
-    {"0S&1OV", 'F'},
-    {"0S&1TN", 'F'},
-    {"0S&1U", 'F'},
-    {"0S&1U(", 'F'},
-    {"0S&1U;", 'F'},
-    {"0S&1UC", 'F'},
-    {"0S&1UE", 'F'},
-    {"0S&E(1", 'F'},
-    {"0S&E(F", 'F'},
-    {"0S&E(N", 'F'},
-    {"0S&E(O", 'F'},
-    {"0S&E(S", 'F'},
-    {"0S&E(V", 'F'},
-    {"0S&E1", 'F'},
-    {"0S&E1;", 'F'},
-    {"0S&E1C", 'F'},
-    {"0S&E1K", 'F'},
-    {"0S&E1O", 'F'},
-    {"0S&EF(", 'F'},
-    {"0S&EK(", 'F'},
-    {"0S&EK1", 'F'},
-    {"0S&EKF", 'F'},
-    {"0S&EKN", 'F'},
-    {"0S&EKS", 'F'},
-    {"0S&EKV", 'F'},
-    {"0S&EN", 'F'},
-    {"0S&EN;", 'F'},
-    {"0S&ENC", 'F'},
-    {"0S&ENK", 'F'},
-    {"0S&ENO", 'F'},
-    {"0S&ES", 'F'},
-    {"0S&ES;", 'F'},
-    {"0S&ESC", 'F'},
-    {"0S&ESK", 'F'},
-    {"0S&ESO", 'F'},
-    {"0S&EV", 'F'},
-    {"0S&EV;", 'F'},
-    {"0S&EVC", 'F'},
-    {"0S&EVK", 'F'},
-    {"0S&EVO", 'F'},
-    {"0S&F()", 'F'},
-    {"0S&F(1", 'F'},
-    {"0S&F(E", 'F'},
-    {"0S&F(F", 'F'},
-    {"0S&F(N", 'F'},
-    {"0S&F(S", 'F'},
-    {"0S&F(V", 'F'},
-    {"0S&K&(", 'F'},
-    {"0S&K&1", 'F'},
-    {"0S&K&F", 'F'},
-    {"0S&K&N", 'F'},
-    {"0S&K&S", 'F'},
-    {"0S&K&V", 'F'},
-    {"0S&K(1", 'F'},
-    {"0S&K(F", 'F'},
-    {"0S&K(N", 'F'},
-    {"0S&K(S", 'F'},
-    {"0S&K(V", 'F'},
-    {"0S&K1O", 'F'},
-    {"0S&KC", 'F'},
-    {"0S&KF(", 'F'},
-    {"0S&KNK", 'F'},
-    {"0S&KO(", 'F'},
-    {"0S&KO1", 'F'},
-    {"0S&KOF", 'F'},
-    {"0S&KOK", 'F'},
-    {"0S&KON", 'F'},
-    {"0S&KOS", 'F'},
-    {"0S&KOV", 'F'},
-    {"0S&KSO", 'F'},
-    {"0S&KVO", 'F'},
-    {"0S&N", 'F'},
-    {"0S&N&(", 'F'},
-    {"0S&N&1", 'F'},
-    {"0S&N&F", 'F'},
-    {"0S&N&N", 'F'},
-    {"0S&N&S", 'F'},
-    {"0S&N&V", 'F'},
-    {"0S&N)&", 'F'},
-    {"0S&N)C", 'F'},
-    {"0S&N)O", 'F'},
-    {"0S&N)U", 'F'},
-    {"0S&N;", 'F'},
-    {"0S&N;C", 'F'},
-    {"0S&N;E", 'F'},
-    {"0S&N;T", 'F'},
-    {"0S&NB(", 'F'},
-    {"0S&NB1", 'F'},
-    {"0S&NBF", 'F'},
-    {"0S&NBN", 'F'},
-    {"0S&NBS", 'F'},
-    {"0S&NBV", 'F'},
-    {"0S&NC", 'F'},
-    {"0S&NEN", 'F'},
-    {"0S&NF(", 'F'},
-    {"0S&NK(", 'F'},
-    {"0S&NK1", 'F'},
-    {"0S&NKF", 'F'},
-    {"0S&NKN", 'F'},
-    {"0S&NKS", 'F'},
-    {"0S&NKV", 'F'},
-    {"0S&NO(", 'F'},
-    {"0S&NOF", 'F'},
-    {"0S&NOS", 'F'},
-    {"0S&NOV", 'F'},
-    {"0S&NTN", 'F'},
-    {"0S&NU", 'F'},
-    {"0S&NU(", 'F'},
-    {"0S&NU;", 'F'},
-    {"0S&NUC", 'F'},
-    {"0S&NUE", 'F'},
-    {"0S&S", 'F'},
-    {"0S&S&(", 'F'},
-    {"0S&S&1", 'F'},
-    {"0S&S&F", 'F'},
-    {"0S&S&N", 'F'},
-    {"0S&S&S", 'F'},
-    {"0S&S&V", 'F'},
-    {"0S&S)&", 'F'},
-    {"0S&S)C", 'F'},
-    {"0S&S)O", 'F'},
-    {"0S&S)U", 'F'},
-    {"0S&S1", 'F'},
-    {"0S&S1;", 'F'},
-    {"0S&S1C", 'F'},
-    {"0S&S;", 'F'},
-    {"0S&S;C", 'F'},
-    {"0S&S;E", 'F'},
-    {"0S&S;T", 'F'},
-    {"0S&SB(", 'F'},
-    {"0S&SB1", 'F'},
-    {"0S&SBF", 'F'},
-    {"0S&SBN", 'F'},
-    {"0S&SBS", 'F'},
-    {"0S&SBV", 'F'},
-    {"0S&SC", 'F'},
-    {"0S&SEK", 'F'},
-    {"0S&SEN", 'F'},
-    {"0S&SF(", 'F'},
-    {"0S&SK(", 'F'},
-    {"0S&SK1", 'F'},
-    {"0S&SKF", 'F'},
-    {"0S&SKN", 'F'},
-    {"0S&SKS", 'F'},
-    {"0S&SKV", 'F'},
-    {"0S&SO(", 'F'},
-    {"0S&SO1", 'F'},
-    {"0S&SOF", 'F'},
-    {"0S&SON", 'F'},
-    {"0S&SOS", 'F'},
-    {"0S&SOV", 'F'},
-    {"0S&STN", 'F'},
-    {"0S&SU", 'F'},
-    {"0S&SU(", 'F'},
-    {"0S&SU;", 'F'},
-    {"0S&SUC", 'F'},
-    {"0S&SUE", 'F'},
-    {"0S&SV", 'F'},
-    {"0S&SV;", 'F'},
-    {"0S&SVC", 'F'},
-    {"0S&SVO", 'F'},
-    {"0S&V", 'F'},
-    {"0S&V&(", 'F'},
-    {"0S&V&1", 'F'},
-    {"0S&V&F", 'F'},
-    {"0S&V&N", 'F'},
-    {"0S&V&S", 'F'},
-    {"0S&V&V", 'F'},
-    {"0S&V)&", 'F'},
-    {"0S&V)C", 'F'},
-    {"0S&V)O", 'F'},
-    {"0S&V)U", 'F'},
-    {"0S&V;", 'F'},
-    {"0S&V;C", 'F'},
-    {"0S&V;E", 'F'},
-    {"0S&V;T", 'F'},
-    {"0S&VB(", 'F'},
-    {"0S&VB1", 'F'},
-    {"0S&VBF", 'F'},
-    {"0S&VBN", 'F'},
-    {"0S&VBS", 'F'},
-    {"0S&VBV", 'F'},
-    {"0S&VC", 'F'},
-    {"0S&VEK", 'F'},
-    {"0S&VEN", 'F'},
-    {"0S&VF(", 'F'},
-    {"0S&VK(", 'F'},
-    {"0S&VK1", 'F'},
-    {"0S&VKF", 'F'},
-    {"0S&VKN", 'F'},
-    {"0S&VKS", 'F'},
-    {"0S&VKV", 'F'},
-    {"0S&VO(", 'F'},
-    {"0S&VOF", 'F'},
-    {"0S&VOS", 'F'},
-    {"0S&VS", 'F'},
-    {"0S&VS;", 'F'},
-    {"0S&VSC", 'F'},
-    {"0S&VSO", 'F'},
-    {"0S&VTN", 'F'},
-    {"0S&VU", 'F'},
-    {"0S&VU(", 'F'},
-    {"0S&VU;", 'F'},
-    {"0S&VUC", 'F'},
-    {"0S&VUE", 'F'},
-    {"0S(EF(", 'F'},
-    {"0S(EKF", 'F'},
-    {"0S(EKN", 'F'},
-    {"0S(ENK", 'F'},
-    {"0S(U(E", 'F'},
-    {"0S)&(1", 'F'},
-    {"0S)&(E", 'F'},
-    {"0S)&(F", 'F'},
-    {"0S)&(N", 'F'},
-    {"0S)&(S", 'F'},
-    {"0S)&(V", 'F'},
-    {"0S)&1", 'F'},
-    {"0S)&1&", 'F'},
-    {"0S)&1)", 'F'},
-    {"0S)&1;", 'F'},
-    {"0S)&1B", 'F'},
-    {"0S)&1C", 'F'},
-    {"0S)&1F", 'F'},
-    {"0S)&1O", 'F'},
-    {"0S)&1U", 'F'},
-    {"0S)&F(", 'F'},
-    {"0S)&N", 'F'},
-    {"0S)&N&", 'F'},
-    {"0S)&N)", 'F'},
-    {"0S)&N;", 'F'},
-    {"0S)&NB", 'F'},
-    {"0S)&NC", 'F'},
-    {"0S)&NF", 'F'},
-    {"0S)&NO", 'F'},
-    {"0S)&NU", 'F'},
-    {"0S)&S", 'F'},
-    {"0S)&S&", 'F'},
-    {"0S)&S)", 'F'},
-    {"0S)&S;", 'F'},
-    {"0S)&SB", 'F'},
-    {"0S)&SC", 'F'},
-    {"0S)&SF", 'F'},
-    {"0S)&SO", 'F'},
-    {"0S)&SU", 'F'},
-    {"0S)&V", 'F'},
-    {"0S)&V&", 'F'},
-    {"0S)&V)", 'F'},
-    {"0S)&V;", 'F'},
-    {"0S)&VB", 'F'},
-    {"0S)&VC", 'F'},
-    {"0S)&VF", 'F'},
-    {"0S)&VO", 'F'},
-    {"0S)&VU", 'F'},
-    {"0S),(1", 'F'},
-    {"0S),(F", 'F'},
-    {"0S),(N", 'F'},
-    {"0S),(S", 'F'},
-    {"0S),(V", 'F'},
-    {"0S);E(", 'F'},
-    {"0S);E1", 'F'},
-    {"0S);EF", 'F'},
-    {"0S);EK", 'F'},
-    {"0S);EN", 'F'},
-    {"0S);EO", 'F'},
-    {"0S);ES", 'F'},
-    {"0S);EV", 'F'},
-    {"0S);T(", 'F'},
-    {"0S);T1", 'F'},
-    {"0S);TF", 'F'},
-    {"0S);TK", 'F'},
-    {"0S);TN", 'F'},
-    {"0S);TO", 'F'},
-    {"0S);TS", 'F'},
-    {"0S);TV", 'F'},
-    {"0S)B(1", 'F'},
-    {"0S)B(F", 'F'},
-    {"0S)B(N", 'F'},
-    {"0S)B(S", 'F'},
-    {"0S)B(V", 'F'},
-    {"0S)B1", 'F'},
-    {"0S)B1&", 'F'},
-    {"0S)B1;", 'F'},
-    {"0S)B1C", 'F'},
-    {"0S)B1K", 'F'},
-    {"0S)B1N", 'F'},
-    {"0S)B1O", 'F'},
-    {"0S)B1U", 'F'},
-    {"0S)BF(", 'F'},
-    {"0S)BN", 'F'},
-    {"0S)BN&", 'F'},
-    {"0S)BN;", 'F'},
-    {"0S)BNC", 'F'},
-    {"0S)BNK", 'F'},
-    {"0S)BNO", 'F'},
-    {"0S)BNU", 'F'},
-    {"0S)BS", 'F'},
-    {"0S)BS&", 'F'},
-    {"0S)BS;", 'F'},
-    {"0S)BSC", 'F'},
-    {"0S)BSK", 'F'},
-    {"0S)BSO", 'F'},
-    {"0S)BSU", 'F'},
-    {"0S)BV", 'F'},
-    {"0S)BV&", 'F'},
-    {"0S)BV;", 'F'},
-    {"0S)BVC", 'F'},
-    {"0S)BVK", 'F'},
-    {"0S)BVO", 'F'},
-    {"0S)BVU", 'F'},
-    {"0S)C", 'F'},
-    {"0S)E(1", 'F'},
-    {"0S)E(F", 'F'},
-    {"0S)E(N", 'F'},
-    {"0S)E(S", 'F'},
-    {"0S)E(V", 'F'},
-    {"0S)E1C", 'F'},
-    {"0S)E1O", 'F'},
-    {"0S)EF(", 'F'},
-    {"0S)EK(", 'F'},
-    {"0S)EK1", 'F'},
-    {"0S)EKF", 'F'},
-    {"0S)EKN", 'F'},
-    {"0S)EKS", 'F'},
-    {"0S)EKV", 'F'},
-    {"0S)ENC", 'F'},
-    {"0S)ENO", 'F'},
-    {"0S)ESC", 'F'},
-    {"0S)ESO", 'F'},
-    {"0S)EVC", 'F'},
-    {"0S)EVO", 'F'},
-    {"0S)F(F", 'F'},
-    {"0S)K(1", 'F'},
-    {"0S)K(F", 'F'},
-    {"0S)K(N", 'F'},
-    {"0S)K(S", 'F'},
-    {"0S)K(V", 'F'},
-    {"0S)K1&", 'F'},
-    {"0S)K1;", 'F'},
-    {"0S)K1B", 'F'},
-    {"0S)K1E", 'F'},
-    {"0S)K1O", 'F'},
-    {"0S)K1U", 'F'},
-    {"0S)KB(", 'F'},
-    {"0S)KB1", 'F'},
-    {"0S)KBF", 'F'},
-    {"0S)KBN", 'F'},
-    {"0S)KBS", 'F'},
-    {"0S)KBV", 'F'},
-    {"0S)KF(", 'F'},
-    {"0S)KN&", 'F'},
-    {"0S)KN;", 'F'},
-    {"0S)KNB", 'F'},
-    {"0S)KNC", 'F'},
-    {"0S)KNE", 'F'},
-    {"0S)KNK", 'F'},
-    {"0S)KNU", 'F'},
-    {"0S)KS&", 'F'},
-    {"0S)KS;", 'F'},
-    {"0S)KSB", 'F'},
-    {"0S)KSE", 'F'},
-    {"0S)KSO", 'F'},
-    {"0S)KSU", 'F'},
-    {"0S)KUE", 'F'},
-    {"0S)KV&", 'F'},
-    {"0S)KV;", 'F'},
-    {"0S)KVB", 'F'},
-    {"0S)KVE", 'F'},
-    {"0S)KVO", 'F'},
-    {"0S)KVU", 'F'},
-    {"0S)O(1", 'F'},
-    {"0S)O(E", 'F'},
-    {"0S)O(F", 'F'},
-    {"0S)O(N", 'F'},
-    {"0S)O(S", 'F'},
-    {"0S)O(V", 'F'},
-    {"0S)O1", 'F'},
-    {"0S)O1&", 'F'},
-    {"0S)O1)", 'F'},
-    {"0S)O1;", 'F'},
-    {"0S)O1B", 'F'},
-    {"0S)O1C", 'F'},
-    {"0S)O1K", 'F'},
-    {"0S)O1U", 'F'},
-    {"0S)OF(", 'F'},
-    {"0S)ON&", 'F'},
-    {"0S)ON)", 'F'},
-    {"0S)ON;", 'F'},
-    {"0S)ONB", 'F'},
-    {"0S)ONC", 'F'},
-    {"0S)ONK", 'F'},
-    {"0S)ONU", 'F'},
-    {"0S)OS", 'F'},
-    {"0S)OS&", 'F'},
-    {"0S)OS)", 'F'},
-    {"0S)OS;", 'F'},
-    {"0S)OSB", 'F'},
-    {"0S)OSC", 'F'},
-    {"0S)OSK", 'F'},
-    {"0S)OSU", 'F'},
-    {"0S)OV", 'F'},
-    {"0S)OV&", 'F'},
-    {"0S)OV)", 'F'},
-    {"0S)OV;", 'F'},
-    {"0S)OVB", 'F'},
-    {"0S)OVC", 'F'},
-    {"0S)OVK", 'F'},
-    {"0S)OVO", 'F'},
-    {"0S)OVU", 'F'},
-    {"0S)U(E", 'F'},
-    {"0S)UE(", 'F'},
-    {"0S)UE1", 'F'},
-    {"0S)UEF", 'F'},
-    {"0S)UEK", 'F'},
-    {"0S)UEN", 'F'},
-    {"0S)UES", 'F'},
-    {"0S)UEV", 'F'},
-    {"0S,(1)", 'F'},
-    {"0S,(1O", 'F'},
-    {"0S,(E(", 'F'},
-    {"0S,(E1", 'F'},
-    {"0S,(EF", 'F'},
-    {"0S,(EK", 'F'},
-    {"0S,(EN", 'F'},
-    {"0S,(ES", 'F'},
-    {"0S,(EV", 'F'},
-    {"0S,(F(", 'F'},
-    {"0S,(N)", 'F'},
-    {"0S,(NO", 'F'},
-    {"0S,(S)", 'F'},
-    {"0S,(SO", 'F'},
-    {"0S,(V)", 'F'},
-    {"0S,(VO", 'F'},
-    {"0S,F()", 'F'},
-    {"0S,F(1", 'F'},
-    {"0S,F(F", 'F'},
-    {"0S,F(N", 'F'},
-    {"0S,F(S", 'F'},
-    {"0S,F(V", 'F'},
-    {"0S1F()", 'F'},
-    {"0S1F(1", 'F'},
-    {"0S1F(F", 'F'},
-    {"0S1F(N", 'F'},
-    {"0S1F(S", 'F'},
-    {"0S1F(V", 'F'},
-    {"0S1NC", 'F'},
-    {"0S1S;", 'F'},
-    {"0S1S;C", 'F'},
-    {"0S1SC", 'F'},
-    {"0S1UE", 'F'},
-    {"0S1UE;", 'F'},
-    {"0S1UEC", 'F'},
-    {"0S1UEK", 'F'},
-    {"0S1V", 'F'},
-    {"0S1V;", 'F'},
-    {"0S1V;C", 'F'},
-    {"0S1VC", 'F'},
-    {"0S1VO(", 'F'},
-    {"0S1VOF", 'F'},
-    {"0S1VOS", 'F'},
-    {"0S;E(1", 'F'},
-    {"0S;E(E", 'F'},
-    {"0S;E(F", 'F'},
-    {"0S;E(N", 'F'},
-    {"0S;E(S", 'F'},
-    {"0S;E(V", 'F'},
-    {"0S;E1,", 'F'},
-    {"0S;E1;", 'F'},
-    {"0S;E1C", 'F'},
-    {"0S;E1K", 'F'},
-    {"0S;E1O", 'F'},
-    {"0S;E1T", 'F'},
-    {"0S;EF(", 'F'},
-    {"0S;EK(", 'F'},
-    {"0S;EK1", 'F'},
-    {"0S;EKF", 'F'},
-    {"0S;EKN", 'F'},
-    {"0S;EKO", 'F'},
-    {"0S;EKS", 'F'},
-    {"0S;EKV", 'F'},
-    {"0S;EN,", 'F'},
-    {"0S;EN;", 'F'},
-    {"0S;ENC", 'F'},
-    {"0S;ENE", 'F'},
-    {"0S;ENK", 'F'},
-    {"0S;ENO", 'F'},
-    {"0S;ENT", 'F'},
-    {"0S;ES,", 'F'},
-    {"0S;ES;", 'F'},
-    {"0S;ESC", 'F'},
-    {"0S;ESK", 'F'},
-    {"0S;ESO", 'F'},
-    {"0S;EST", 'F'},
-    {"0S;EV,", 'F'},
-    {"0S;EV;", 'F'},
-    {"0S;EVC", 'F'},
-    {"0S;EVK", 'F'},
-    {"0S;EVO", 'F'},
-    {"0S;EVT", 'F'},
-    {"0S;N:T", 'F'},
-    {"0S;T(1", 'F'},
-    {"0S;T(C", 'F'},
-    {"0S;T(E", 'F'},
-    {"0S;T(F", 'F'},
-    {"0S;T(N", 'F'},
-    {"0S;T(S", 'F'},
-    {"0S;T(V", 'F'},
-    {"0S;T1(", 'F'},
-    {"0S;T1,", 'F'},
-    {"0S;T1;", 'F'},
-    {"0S;T1C", 'F'},
-    {"0S;T1F", 'F'},
-    {"0S;T1K", 'F'},
-    {"0S;T1O", 'F'},
-    {"0S;T1T", 'F'},
-    {"0S;T;", 'F'},
-    {"0S;T;C", 'F'},
-    {"0S;TF(", 'F'},
-    {"0S;TK(", 'F'},
-    {"0S;TK1", 'F'},
-    {"0S;TKF", 'F'},
-    {"0S;TKK", 'F'},
-    {"0S;TKN", 'F'},
-    {"0S;TKO", 'F'},
-    {"0S;TKS", 'F'},
-    {"0S;TKV", 'F'},
-    {"0S;TN(", 'F'},
-    {"0S;TN,", 'F'},
-    {"0S;TN1", 'F'},
-    {"0S;TN;", 'F'},
-    {"0S;TNC", 'F'},
-    {"0S;TNE", 'F'},
-    {"0S;TNF", 'F'},
-    {"0S;TNK", 'F'},
-    {"0S;TNN", 'F'},
-    {"0S;TNO", 'F'},
-    {"0S;TNS", 'F'},
-    {"0S;TNT", 'F'},
-    {"0S;TNV", 'F'},
-    {"0S;TO(", 'F'},
-    {"0S;TS(", 'F'},
-    {"0S;TS,", 'F'},
-    {"0S;TS;", 'F'},
-    {"0S;TSC", 'F'},
-    {"0S;TSF", 'F'},
-    {"0S;TSK", 'F'},
-    {"0S;TSO", 'F'},
-    {"0S;TST", 'F'},
-    {"0S;TTN", 'F'},
-    {"0S;TV(", 'F'},
-    {"0S;TV,", 'F'},
-    {"0S;TV;", 'F'},
-    {"0S;TVC", 'F'},
-    {"0S;TVF", 'F'},
-    {"0S;TVK", 'F'},
-    {"0S;TVO", 'F'},
-    {"0S;TVT", 'F'},
-    {"0SA(F(", 'F'},
-    {"0SA(N)", 'F'},
-    {"0SA(NO", 'F'},
-    {"0SA(S)", 'F'},
-    {"0SA(SO", 'F'},
-    {"0SA(V)", 'F'},
-    {"0SA(VO", 'F'},
-    {"0SAF()", 'F'},
-    {"0SAF(1", 'F'},
-    {"0SAF(F", 'F'},
-    {"0SAF(N", 'F'},
-    {"0SAF(S", 'F'},
-    {"0SAF(V", 'F'},
-    {"0SASO(", 'F'},
-    {"0SASO1", 'F'},
-    {"0SASOF", 'F'},
-    {"0SASON", 'F'},
-    {"0SASOS", 'F'},
-    {"0SASOV", 'F'},
-    {"0SASUE", 'F'},
-    {"0SATO(", 'F'},
-    {"0SATO1", 'F'},
-    {"0SATOF", 'F'},
-    {"0SATON", 'F'},
-    {"0SATOS", 'F'},
-    {"0SATOV", 'F'},
-    {"0SATUE", 'F'},
-    {"0SAVO(", 'F'},
-    {"0SAVOF", 'F'},
-    {"0SAVOS", 'F'},
-    {"0SAVUE", 'F'},
-    {"0SB(1)", 'F'},
-    {"0SB(1O", 'F'},
-    {"0SB(F(", 'F'},
-    {"0SB(NO", 'F'},
-    {"0SB(S)", 'F'},
-    {"0SB(SO", 'F'},
-    {"0SB(V)", 'F'},
-    {"0SB(VO", 'F'},
-    {"0SB1", 'F'},
-    {"0SB1&(", 'F'},
-    {"0SB1&1", 'F'},
-    {"0SB1&F", 'F'},
-    {"0SB1&N", 'F'},
-    {"0SB1&S", 'F'},
-    {"0SB1&V", 'F'},
-    {"0SB1,(", 'F'},
-    {"0SB1,F", 'F'},
-    {"0SB1;", 'F'},
-    {"0SB1;C", 'F'},
-    {"0SB1B(", 'F'},
-    {"0SB1B1", 'F'},
-    {"0SB1BF", 'F'},
-    {"0SB1BN", 'F'},
-    {"0SB1BS", 'F'},
-    {"0SB1BV", 'F'},
-    {"0SB1C", 'F'},
-    {"0SB1K(", 'F'},
-    {"0SB1K1", 'F'},
-    {"0SB1KF", 'F'},
-    {"0SB1KN", 'F'},
-    {"0SB1KS", 'F'},
-    {"0SB1KV", 'F'},
-    {"0SB1O(", 'F'},
-    {"0SB1OF", 'F'},
-    {"0SB1OS", 'F'},
-    {"0SB1OV", 'F'},
-    {"0SB1U(", 'F'},
-    {"0SB1UE", 'F'},
-    {"0SBE(1", 'F'},
-    {"0SBE(F", 'F'},
-    {"0SBE(N", 'F'},
-    {"0SBE(S", 'F'},
-    {"0SBE(V", 'F'},
-    {"0SBEK(", 'F'},
-    {"0SBF()", 'F'},
-    {"0SBF(1", 'F'},
-    {"0SBF(F", 'F'},
-    {"0SBF(N", 'F'},
-    {"0SBF(S", 'F'},
-    {"0SBF(V", 'F'},
-    {"0SBN", 'F'},
-    {"0SBN&(", 'F'},
-    {"0SBN&1", 'F'},
-    {"0SBN&F", 'F'},
-    {"0SBN&N", 'F'},
-    {"0SBN&S", 'F'},
-    {"0SBN&V", 'F'},
-    {"0SBN,(", 'F'},
-    {"0SBN,F", 'F'},
-    {"0SBN;", 'F'},
-    {"0SBN;C", 'F'},
-    {"0SBNB(", 'F'},
-    {"0SBNB1", 'F'},
-    {"0SBNBF", 'F'},
-    {"0SBNBN", 'F'},
-    {"0SBNBS", 'F'},
-    {"0SBNBV", 'F'},
-    {"0SBNC", 'F'},
-    {"0SBNK(", 'F'},
-    {"0SBNK1", 'F'},
-    {"0SBNKF", 'F'},
-    {"0SBNKN", 'F'},
-    {"0SBNKS", 'F'},
-    {"0SBNKV", 'F'},
-    {"0SBNO(", 'F'},
-    {"0SBNOF", 'F'},
-    {"0SBNOS", 'F'},
-    {"0SBNOV", 'F'},
-    {"0SBNU(", 'F'},
-    {"0SBNUE", 'F'},
-    {"0SBS", 'F'},
-    {"0SBS&(", 'F'},
-    {"0SBS&1", 'F'},
-    {"0SBS&F", 'F'},
-    {"0SBS&N", 'F'},
-    {"0SBS&S", 'F'},
-    {"0SBS&V", 'F'},
-    {"0SBS,(", 'F'},
-    {"0SBS,F", 'F'},
-    {"0SBS;", 'F'},
-    {"0SBS;C", 'F'},
-    {"0SBSB(", 'F'},
-    {"0SBSB1", 'F'},
-    {"0SBSBF", 'F'},
-    {"0SBSBN", 'F'},
-    {"0SBSBS", 'F'},
-    {"0SBSBV", 'F'},
-    {"0SBSC", 'F'},
-    {"0SBSK(", 'F'},
-    {"0SBSK1", 'F'},
-    {"0SBSKF", 'F'},
-    {"0SBSKN", 'F'},
-    {"0SBSKS", 'F'},
-    {"0SBSKV", 'F'},
-    {"0SBSO(", 'F'},
-    {"0SBSO1", 'F'},
-    {"0SBSOF", 'F'},
-    {"0SBSON", 'F'},
-    {"0SBSOS", 'F'},
-    {"0SBSOV", 'F'},
-    {"0SBSU(", 'F'},
-    {"0SBSUE", 'F'},
-    {"0SBV", 'F'},
-    {"0SBV&(", 'F'},
-    {"0SBV&1", 'F'},
-    {"0SBV&F", 'F'},
-    {"0SBV&N", 'F'},
-    {"0SBV&S", 'F'},
-    {"0SBV&V", 'F'},
-    {"0SBV,(", 'F'},
-    {"0SBV,F", 'F'},
-    {"0SBV;", 'F'},
-    {"0SBV;C", 'F'},
-    {"0SBVB(", 'F'},
-    {"0SBVB1", 'F'},
-    {"0SBVBF", 'F'},
-    {"0SBVBN", 'F'},
-    {"0SBVBS", 'F'},
-    {"0SBVBV", 'F'},
-    {"0SBVC", 'F'},
-    {"0SBVK(", 'F'},
-    {"0SBVK1", 'F'},
-    {"0SBVKF", 'F'},
-    {"0SBVKN", 'F'},
-    {"0SBVKS", 'F'},
-    {"0SBVKV", 'F'},
-    {"0SBVO(", 'F'},
-    {"0SBVOF", 'F'},
-    {"0SBVOS", 'F'},
-    {"0SBVU(", 'F'},
-    {"0SBVUE", 'F'},
-    {"0SC", 'F'},
-    {"0SE(1)", 'F'},
-    {"0SE(1O", 'F'},
-    {"0SE(F(", 'F'},
-    {"0SE(N)", 'F'},
-    {"0SE(NO", 'F'},
-    {"0SE(S)", 'F'},
-    {"0SE(SO", 'F'},
-    {"0SE(V)", 'F'},
-    {"0SE(VO", 'F'},
-    {"0SE1;T", 'F'},
-    {"0SE1C", 'F'},
-    {"0SE1O(", 'F'},
-    {"0SE1OF", 'F'},
-    {"0SE1OS", 'F'},
-    {"0SE1OV", 'F'},
-    {"0SE1T(", 'F'},
-    {"0SE1T1", 'F'},
-    {"0SE1TF", 'F'},
-    {"0SE1TN", 'F'},
-    {"0SE1TS", 'F'},
-    {"0SE1TV", 'F'},
-    {"0SE1UE", 'F'},
-    {"0SEF()", 'F'},
-    {"0SEF(1", 'F'},
-    {"0SEF(F", 'F'},
-    {"0SEF(N", 'F'},
-    {"0SEF(S", 'F'},
-    {"0SEF(V", 'F'},
-    {"0SEK(1", 'F'},
-    {"0SEK(E", 'F'},
-    {"0SEK(F", 'F'},
-    {"0SEK(N", 'F'},
-    {"0SEK(S", 'F'},
-    {"0SEK(V", 'F'},
-    {"0SEK1;", 'F'},
-    {"0SEK1C", 'F'},
-    {"0SEK1O", 'F'},
-    {"0SEK1T", 'F'},
-    {"0SEK1U", 'F'},
-    {"0SEKF(", 'F'},
-    {"0SEKN;", 'F'},
-    {"0SEKNC", 'F'},
-    {"0SEKNE", 'F'},
-    {"0SEKNT", 'F'},
-    {"0SEKNU", 'F'},
-    {"0SEKOK", 'F'},
-    {"0SEKS;", 'F'},
-    {"0SEKSC", 'F'},
-    {"0SEKSO", 'F'},
-    {"0SEKST", 'F'},
-    {"0SEKSU", 'F'},
-    {"0SEKU(", 'F'},
-    {"0SEKU1", 'F'},
-    {"0SEKUE", 'F'},
-    {"0SEKUF", 'F'},
-    {"0SEKUS", 'F'},
-    {"0SEKUV", 'F'},
-    {"0SEKV;", 'F'},
-    {"0SEKVC", 'F'},
-    {"0SEKVO", 'F'},
-    {"0SEKVT", 'F'},
-    {"0SEKVU", 'F'},
-    {"0SEN;T", 'F'},
-    {"0SENC", 'F'},
-    {"0SENEN", 'F'},
-    {"0SENO(", 'F'},
-    {"0SENOF", 'F'},
-    {"0SENOS", 'F'},
-    {"0SENOV", 'F'},
-    {"0SENT(", 'F'},
-    {"0SENT1", 'F'},
-    {"0SENTF", 'F'},
-    {"0SENTN", 'F'},
-    {"0SENTS", 'F'},
-    {"0SENTV", 'F'},
-    {"0SENUE", 'F'},
-    {"0SEOKN", 'F'},
-    {"0SES;T", 'F'},
-    {"0SESC", 'F'},
-    {"0SESO(", 'F'},
-    {"0SESO1", 'F'},
-    {"0SESOF", 'F'},
-    {"0SESON", 'F'},
-    {"0SESOS", 'F'},
-    {"0SESOV", 'F'},
-    {"0SEST(", 'F'},
-    {"0SEST1", 'F'},
-    {"0SESTF", 'F'},
-    {"0SESTN", 'F'},
-    {"0SESTS", 'F'},
-    {"0SESTV", 'F'},
-    {"0SESUE", 'F'},
-    {"0SEU(1", 'F'},
-    {"0SEU(F", 'F'},
-    {"0SEU(N", 'F'},
-    {"0SEU(S", 'F'},
-    {"0SEU(V", 'F'},
-    {"0SEU1,", 'F'},
-    {"0SEU1C", 'F'},
-    {"0SEU1O", 'F'},
-    {"0SEUEF", 'F'},
-    {"0SEUEK", 'F'},
-    {"0SEUF(", 'F'},
-    {"0SEUS,", 'F'},
-    {"0SEUSC", 'F'},
-    {"0SEUSO", 'F'},
-    {"0SEUV,", 'F'},
-    {"0SEUVC", 'F'},
-    {"0SEUVO", 'F'},
-    {"0SEV;T", 'F'},
-    {"0SEVC", 'F'},
-    {"0SEVO(", 'F'},
-    {"0SEVOF", 'F'},
-    {"0SEVOS", 'F'},
-    {"0SEVT(", 'F'},
-    {"0SEVT1", 'F'},
-    {"0SEVTF", 'F'},
-    {"0SEVTN", 'F'},
-    {"0SEVTS", 'F'},
-    {"0SEVTV", 'F'},
-    {"0SEVUE", 'F'},
-    {"0SF()1", 'F'},
-    {"0SF()F", 'F'},
-    {"0SF()K", 'F'},
-    {"0SF()N", 'F'},
-    {"0SF()O", 'F'},
-    {"0SF()S", 'F'},
-    {"0SF()U", 'F'},
-    {"0SF()V", 'F'},
-    {"0SF(1)", 'F'},
-    {"0SF(1N", 'F'},
-    {"0SF(1O", 'F'},
-    {"0SF(E(", 'F'},
-    {"0SF(E1", 'F'},
-    {"0SF(EF", 'F'},
-    {"0SF(EK", 'F'},
-    {"0SF(EN", 'F'},
-    {"0SF(ES", 'F'},
-    {"0SF(EV", 'F'},
-    {"0SF(F(", 'F'},
-    {"0SF(N)", 'F'},
-    {"0SF(N,", 'F'},
-    {"0SF(NO", 'F'},
-    {"0SF(S)", 'F'},
-    {"0SF(SO", 'F'},
-    {"0SF(V)", 'F'},
-    {"0SF(VO", 'F'},
-    {"0SK(1)", 'F'},
-    {"0SK(1O", 'F'},
-    {"0SK(F(", 'F'},
-    {"0SK(N)", 'F'},
-    {"0SK(NO", 'F'},
-    {"0SK(S)", 'F'},
-    {"0SK(SO", 'F'},
-    {"0SK(V)", 'F'},
-    {"0SK(VO", 'F'},
-    {"0SK)&(", 'F'},
-    {"0SK)&1", 'F'},
-    {"0SK)&F", 'F'},
-    {"0SK)&N", 'F'},
-    {"0SK)&S", 'F'},
-    {"0SK)&V", 'F'},
-    {"0SK);E", 'F'},
-    {"0SK);T", 'F'},
-    {"0SK)B(", 'F'},
-    {"0SK)B1", 'F'},
-    {"0SK)BF", 'F'},
-    {"0SK)BN", 'F'},
-    {"0SK)BS", 'F'},
-    {"0SK)BV", 'F'},
-    {"0SK)E(", 'F'},
-    {"0SK)E1", 'F'},
-    {"0SK)EF", 'F'},
-    {"0SK)EK", 'F'},
-    {"0SK)EN", 'F'},
-    {"0SK)ES", 'F'},
-    {"0SK)EV", 'F'},
-    {"0SK)F(", 'F'},
-    {"0SK)O(", 'F'},
-    {"0SK)OF", 'F'},
-    {"0SK)UE", 'F'},
-    {"0SK1", 'F'},
-    {"0SK1&(", 'F'},
-    {"0SK1&1", 'F'},
-    {"0SK1&F", 'F'},
-    {"0SK1&N", 'F'},
-    {"0SK1&S", 'F'},
-    {"0SK1&V", 'F'},
-    {"0SK1;", 'F'},
-    {"0SK1;C", 'F'},
-    {"0SK1;E", 'F'},
-    {"0SK1;T", 'F'},
-    {"0SK1B(", 'F'},
-    {"0SK1B1", 'F'},
-    {"0SK1BF", 'F'},
-    {"0SK1BN", 'F'},
-    {"0SK1BS", 'F'},
-    {"0SK1BV", 'F'},
-    {"0SK1C", 'F'},
-    {"0SK1E(", 'F'},
-    {"0SK1E1", 'F'},
-    {"0SK1EF", 'F'},
-    {"0SK1EK", 'F'},
-    {"0SK1EN", 'F'},
-    {"0SK1ES", 'F'},
-    {"0SK1EV", 'F'},
-    {"0SK1O(", 'F'},
-    {"0SK1OF", 'F'},
-    {"0SK1OS", 'F'},
-    {"0SK1OV", 'F'},
-    {"0SK1U(", 'F'},
-    {"0SK1UE", 'F'},
-    {"0SKF()", 'F'},
-    {"0SKF(1", 'F'},
-    {"0SKF(F", 'F'},
-    {"0SKF(N", 'F'},
-    {"0SKF(S", 'F'},
-    {"0SKF(V", 'F'},
-    {"0SKN", 'F'},
-    {"0SKN&(", 'F'},
-    {"0SKN&1", 'F'},
-    {"0SKN&F", 'F'},
-    {"0SKN&N", 'F'},
-    {"0SKN&S", 'F'},
-    {"0SKN&V", 'F'},
-    {"0SKN;", 'F'},
-    {"0SKN;C", 'F'},
-    {"0SKN;E", 'F'},
-    {"0SKN;T", 'F'},
-    {"0SKNB(", 'F'},
-    {"0SKNB1", 'F'},
-    {"0SKNBF", 'F'},
-    {"0SKNBN", 'F'},
-    {"0SKNBS", 'F'},
-    {"0SKNBV", 'F'},
-    {"0SKNC", 'F'},
-    {"0SKNE(", 'F'},
-    {"0SKNE1", 'F'},
-    {"0SKNEF", 'F'},
-    {"0SKNEN", 'F'},
-    {"0SKNES", 'F'},
-    {"0SKNEV", 'F'},
-    {"0SKNU(", 'F'},
-    {"0SKNUE", 'F'},
-    {"0SKS", 'F'},
-    {"0SKS&(", 'F'},
-    {"0SKS&1", 'F'},
-    {"0SKS&F", 'F'},
-    {"0SKS&N", 'F'},
-    {"0SKS&S", 'F'},
-    {"0SKS&V", 'F'},
-    {"0SKS;", 'F'},
-    {"0SKS;C", 'F'},
-    {"0SKS;E", 'F'},
-    {"0SKS;T", 'F'},
-    {"0SKSB(", 'F'},
-    {"0SKSB1", 'F'},
-    {"0SKSBF", 'F'},
-    {"0SKSBN", 'F'},
-    {"0SKSBS", 'F'},
-    {"0SKSBV", 'F'},
-    {"0SKSC", 'F'},
-    {"0SKSE(", 'F'},
-    {"0SKSE1", 'F'},
-    {"0SKSEF", 'F'},
-    {"0SKSEK", 'F'},
-    {"0SKSEN", 'F'},
-    {"0SKSES", 'F'},
-    {"0SKSEV", 'F'},
-    {"0SKSO(", 'F'},
-    {"0SKSO1", 'F'},
-    {"0SKSOF", 'F'},
-    {"0SKSON", 'F'},
-    {"0SKSOS", 'F'},
-    {"0SKSOV", 'F'},
-    {"0SKSU(", 'F'},
-    {"0SKSUE", 'F'},
-    {"0SKUE(", 'F'},
-    {"0SKUE1", 'F'},
-    {"0SKUEF", 'F'},
-    {"0SKUEK", 'F'},
-    {"0SKUEN", 'F'},
-    {"0SKUES", 'F'},
-    {"0SKUEV", 'F'},
-    {"0SKV", 'F'},
-    {"0SKV&(", 'F'},
-    {"0SKV&1", 'F'},
-    {"0SKV&F", 'F'},
-    {"0SKV&N", 'F'},
-    {"0SKV&S", 'F'},
-    {"0SKV&V", 'F'},
-    {"0SKV;", 'F'},
-    {"0SKV;C", 'F'},
-    {"0SKV;E", 'F'},
-    {"0SKV;T", 'F'},
-    {"0SKVB(", 'F'},
-    {"0SKVB1", 'F'},
-    {"0SKVBF", 'F'},
-    {"0SKVBN", 'F'},
-    {"0SKVBS", 'F'},
-    {"0SKVBV", 'F'},
-    {"0SKVC", 'F'},
-    {"0SKVE(", 'F'},
-    {"0SKVE1", 'F'},
-    {"0SKVEF", 'F'},
-    {"0SKVEK", 'F'},
-    {"0SKVEN", 'F'},
-    {"0SKVES", 'F'},
-    {"0SKVEV", 'F'},
-    {"0SKVO(", 'F'},
-    {"0SKVOF", 'F'},
-    {"0SKVOS", 'F'},
-    {"0SKVU(", 'F'},
-    {"0SKVUE", 'F'},
-    {"0SO(1&", 'F'},
-    {"0SO(1)", 'F'},
-    {"0SO(1,", 'F'},
-    {"0SO(1O", 'F'},
-    {"0SO(E(", 'F'},
-    {"0SO(E1", 'F'},
-    {"0SO(EE", 'F'},
-    {"0SO(EF", 'F'},
-    {"0SO(EK", 'F'},
-    {"0SO(EN", 'F'},
-    {"0SO(EO", 'F'},
-    {"0SO(ES", 'F'},
-    {"0SO(EV", 'F'},
-    {"0SO(F(", 'F'},
-    {"0SO(N&", 'F'},
-    {"0SO(N)", 'F'},
-    {"0SO(N,", 'F'},
-    {"0SO(NO", 'F'},
-    {"0SO(S&", 'F'},
-    {"0SO(S)", 'F'},
-    {"0SO(S,", 'F'},
-    {"0SO(SO", 'F'},
-    {"0SO(V&", 'F'},
-    {"0SO(V)", 'F'},
-    {"0SO(V,", 'F'},
-    {"0SO(VO", 'F'},
-    {"0SO1&(", 'F'},
-    {"0SO1&1", 'F'},
-    {"0SO1&E", 'F'},
-    {"0SO1&F", 'F'},
-    {"0SO1&K", 'F'},
-    {"0SO1&N", 'F'},
-    {"0SO1&S", 'F'},
-    {"0SO1&U", 'F'},
-    {"0SO1&V", 'F'},
-    {"0SO1(E", 'F'},
-    {"0SO1(U", 'F'},
-    {"0SO1)&", 'F'},
-    {"0SO1),", 'F'},
-    {"0SO1);", 'F'},
-    {"0SO1)B", 'F'},
-    {"0SO1)C", 'F'},
-    {"0SO1)E", 'F'},
-    {"0SO1)F", 'F'},
-    {"0SO1)K", 'F'},
-    {"0SO1)O", 'F'},
-    {"0SO1)U", 'F'},
-    {"0SO1,(", 'F'},
-    {"0SO1,F", 'F'},
-    {"0SO1;", 'F'},
-    {"0SO1;C", 'F'},
-    {"0SO1;E", 'F'},
-    {"0SO1;N", 'F'},
-    {"0SO1;T", 'F'},
-    {"0SO1A(", 'F'},
-    {"0SO1AF", 'F'},
-    {"0SO1AS", 'F'},
-    {"0SO1AT", 'F'},
-    {"0SO1AV", 'F'},
-    {"0SO1B(", 'F'},
-    {"0SO1B1", 'F'},
-    {"0SO1BE", 'F'},
-    {"0SO1BF", 'F'},
-    {"0SO1BN", 'F'},
-    {"0SO1BS", 'F'},
-    {"0SO1BV", 'F'},
-    {"0SO1C", 'F'},
-    {"0SO1E(", 'F'},
-    {"0SO1E1", 'F'},
-    {"0SO1EF", 'F'},
-    {"0SO1EK", 'F'},
-    {"0SO1EN", 'F'},
-    {"0SO1EO", 'F'},
-    {"0SO1ES", 'F'},
-    {"0SO1EU", 'F'},
-    {"0SO1EV", 'F'},
-    {"0SO1F(", 'F'},
-    {"0SO1K(", 'F'},
-    {"0SO1K)", 'F'},
-    {"0SO1K1", 'F'},
-    {"0SO1KB", 'F'},
-    {"0SO1KF", 'F'},
-    {"0SO1KN", 'F'},
-    {"0SO1KS", 'F'},
-    {"0SO1KU", 'F'},
-    {"0SO1KV", 'F'},
-    {"0SO1N&", 'F'},
-    {"0SO1N(", 'F'},
-    {"0SO1N,", 'F'},
-    {"0SO1NE", 'F'},
-    {"0SO1NU", 'F'},
-    {"0SO1SU", 'F'},
-    {"0SO1SV", 'F'},
-    {"0SO1T(", 'F'},
-    {"0SO1T1", 'F'},
-    {"0SO1TE", 'F'},
-    {"0SO1TF", 'F'},
-    {"0SO1TN", 'F'},
-    {"0SO1TS", 'F'},
-    {"0SO1TT", 'F'},
-    {"0SO1TV", 'F'},
-    {"0SO1U", 'F'},
-    {"0SO1U(", 'F'},
-    {"0SO1U1", 'F'},
-    {"0SO1U;", 'F'},
-    {"0SO1UC", 'F'},
-    {"0SO1UE", 'F'},
-    {"0SO1UF", 'F'},
-    {"0SO1UK", 'F'},
-    {"0SO1UO", 'F'},
-    {"0SO1US", 'F'},
-    {"0SO1UT", 'F'},
-    {"0SO1UV", 'F'},
-    {"0SO1V(", 'F'},
-    {"0SO1VF", 'F'},
-    {"0SO1VO", 'F'},
-    {"0SO1VS", 'F'},
-    {"0SO1VU", 'F'},
-    {"0SOF()", 'F'},
-    {"0SOF(1", 'F'},
-    {"0SOF(E", 'F'},
-    {"0SOF(F", 'F'},
-    {"0SOF(N", 'F'},
-    {"0SOF(S", 'F'},
-    {"0SOF(V", 'F'},
-    {"0SOK&(", 'F'},
-    {"0SOK&1", 'F'},
-    {"0SOK&F", 'F'},
-    {"0SOK&N", 'F'},
-    {"0SOK&S", 'F'},
-    {"0SOK&V", 'F'},
-    {"0SOK(1", 'F'},
-    {"0SOK(F", 'F'},
-    {"0SOK(N", 'F'},
-    {"0SOK(S", 'F'},
-    {"0SOK(V", 'F'},
-    {"0SOK1C", 'F'},
-    {"0SOK1O", 'F'},
-    {"0SOKF(", 'F'},
-    {"0SOKNC", 'F'},
-    {"0SOKO(", 'F'},
-    {"0SOKO1", 'F'},
-    {"0SOKOF", 'F'},
-    {"0SOKON", 'F'},
-    {"0SOKOS", 'F'},
-    {"0SOKOV", 'F'},
-    {"0SOKSC", 'F'},
-    {"0SOKSO", 'F'},
-    {"0SOKVC", 'F'},
-    {"0SOKVO", 'F'},
-    {"0SON&(", 'F'},
-    {"0SON&1", 'F'},
-    {"0SON&E", 'F'},
-    {"0SON&F", 'F'},
-    {"0SON&K", 'F'},
-    {"0SON&N", 'F'},
-    {"0SON&S", 'F'},
-    {"0SON&U", 'F'},
-    {"0SON&V", 'F'},
-    {"0SON(1", 'F'},
-    {"0SON(E", 'F'},
-    {"0SON(F", 'F'},
-    {"0SON(S", 'F'},
-    {"0SON(U", 'F'},
-    {"0SON(V", 'F'},
-    {"0SON)&", 'F'},
-    {"0SON),", 'F'},
-    {"0SON);", 'F'},
-    {"0SON)B", 'F'},
-    {"0SON)C", 'F'},
-    {"0SON)E", 'F'},
-    {"0SON)F", 'F'},
-    {"0SON)K", 'F'},
-    {"0SON)O", 'F'},
-    {"0SON)U", 'F'},
-    {"0SON,(", 'F'},
-    {"0SON,F", 'F'},
-    {"0SON1(", 'F'},
-    {"0SON1O", 'F'},
-    {"0SON1U", 'F'},
-    {"0SON1V", 'F'},
-    {"0SON;", 'F'},
-    {"0SON;C", 'F'},
-    {"0SON;E", 'F'},
-    {"0SON;N", 'F'},
-    {"0SON;T", 'F'},
-    {"0SONA(", 'F'},
-    {"0SONAF", 'F'},
-    {"0SONAS", 'F'},
-    {"0SONAT", 'F'},
-    {"0SONAV", 'F'},
-    {"0SONB(", 'F'},
-    {"0SONB1", 'F'},
-    {"0SONBE", 'F'},
-    {"0SONBF", 'F'},
-    {"0SONBN", 'F'},
-    {"0SONBS", 'F'},
-    {"0SONBV", 'F'},
-    {"0SONE(", 'F'},
-    {"0SONE1", 'F'},
-    {"0SONEF", 'F'},
-    {"0SONEN", 'F'},
-    {"0SONEO", 'F'},
-    {"0SONES", 'F'},
-    {"0SONEU", 'F'},
-    {"0SONEV", 'F'},
-    {"0SONF(", 'F'},
-    {"0SONK(", 'F'},
-    {"0SONK)", 'F'},
-    {"0SONK1", 'F'},
-    {"0SONKB", 'F'},
-    {"0SONKF", 'F'},
-    {"0SONKS", 'F'},
-    {"0SONKU", 'F'},
-    {"0SONKV", 'F'},
-    {"0SONSU", 'F'},
-    {"0SONT(", 'F'},
-    {"0SONT1", 'F'},
-    {"0SONTE", 'F'},
-    {"0SONTF", 'F'},
-    {"0SONTN", 'F'},
-    {"0SONTS", 'F'},
-    {"0SONTT", 'F'},
-    {"0SONTV", 'F'},
-    {"0SONU", 'F'},
-    {"0SONU(", 'F'},
-    {"0SONU1", 'F'},
-    {"0SONU;", 'F'},
-    {"0SONUC", 'F'},
-    {"0SONUE", 'F'},
-    {"0SONUF", 'F'},
-    {"0SONUK", 'F'},
-    {"0SONUO", 'F'},
-    {"0SONUS", 'F'},
-    {"0SONUT", 'F'},
-    {"0SONUV", 'F'},
-    {"0SOS", 'F'},
-    {"0SOS&(", 'F'},
-    {"0SOS&1", 'F'},
-    {"0SOS&E", 'F'},
-    {"0SOS&F", 'F'},
-    {"0SOS&K", 'F'},
-    {"0SOS&N", 'F'},
-    {"0SOS&S", 'F'},
-    {"0SOS&U", 'F'},
-    {"0SOS&V", 'F'},
-    {"0SOS(E", 'F'},
-    {"0SOS(U", 'F'},
-    {"0SOS)&", 'F'},
-    {"0SOS),", 'F'},
-    {"0SOS);", 'F'},
-    {"0SOS)B", 'F'},
-    {"0SOS)C", 'F'},
-    {"0SOS)E", 'F'},
-    {"0SOS)F", 'F'},
-    {"0SOS)K", 'F'},
-    {"0SOS)O", 'F'},
-    {"0SOS)U", 'F'},
-    {"0SOS,(", 'F'},
-    {"0SOS,F", 'F'},
-    {"0SOS1(", 'F'},
-    {"0SOS1F", 'F'},
-    {"0SOS1N", 'F'},
-    {"0SOS1S", 'F'},
-    {"0SOS1U", 'F'},
-    {"0SOS1V", 'F'},
-    {"0SOS;", 'F'},
-    {"0SOS;C", 'F'},
-    {"0SOS;E", 'F'},
-    {"0SOS;N", 'F'},
-    {"0SOS;T", 'F'},
-    {"0SOSA(", 'F'},
-    {"0SOSAF", 'F'},
-    {"0SOSAS", 'F'},
-    {"0SOSAT", 'F'},
-    {"0SOSAV", 'F'},
-    {"0SOSB(", 'F'},
-    {"0SOSB1", 'F'},
-    {"0SOSBE", 'F'},
-    {"0SOSBF", 'F'},
-    {"0SOSBN", 'F'},
-    {"0SOSBS", 'F'},
-    {"0SOSBV", 'F'},
-    {"0SOSC", 'F'},
-    {"0SOSE(", 'F'},
-    {"0SOSE1", 'F'},
-    {"0SOSEF", 'F'},
-    {"0SOSEK", 'F'},
-    {"0SOSEN", 'F'},
-    {"0SOSEO", 'F'},
-    {"0SOSES", 'F'},
-    {"0SOSEU", 'F'},
-    {"0SOSEV", 'F'},
-    {"0SOSF(", 'F'},
-    {"0SOSK(", 'F'},
-    {"0SOSK)", 'F'},
-    {"0SOSK1", 'F'},
-    {"0SOSKB", 'F'},
-    {"0SOSKF", 'F'},
-    {"0SOSKN", 'F'},
-    {"0SOSKS", 'F'},
-    {"0SOSKU", 'F'},
-    {"0SOSKV", 'F'},
-    {"0SOST(", 'F'},
-    {"0SOST1", 'F'},
-    {"0SOSTE", 'F'},
-    {"0SOSTF", 'F'},
-    {"0SOSTN", 'F'},
-    {"0SOSTS", 'F'},
-    {"0SOSTT", 'F'},
-    {"0SOSTV", 'F'},
-    {"0SOSU", 'F'},
-    {"0SOSU(", 'F'},
-    {"0SOSU1", 'F'},
-    {"0SOSU;", 'F'},
-    {"0SOSUC", 'F'},
-    {"0SOSUE", 'F'},
-    {"0SOSUF", 'F'},
-    {"0SOSUK", 'F'},
-    {"0SOSUO", 'F'},
-    {"0SOSUS", 'F'},
-    {"0SOSUT", 'F'},
-    {"0SOSUV", 'F'},
-    {"0SOSV(", 'F'},
-    {"0SOSVF", 'F'},
-    {"0SOSVO", 'F'},
-    {"0SOSVS", 'F'},
-    {"0SOSVU", 'F'},
-    {"0SOU(E", 'F'},
-    {"0SOUEK", 'F'},
-    {"0SOUEN", 'F'},
-    {"0SOV", 'F'},
-    {"0SOV&(", 'F'},
-    {"0SOV&1", 'F'},
-    {"0SOV&E", 'F'},
-    {"0SOV&F", 'F'},
-    {"0SOV&K", 'F'},
-    {"0SOV&N", 'F'},
-    {"0SOV&S", 'F'},
-    {"0SOV&U", 'F'},
-    {"0SOV&V", 'F'},
-    {"0SOV(E", 'F'},
-    {"0SOV(U", 'F'},
-    {"0SOV)&", 'F'},
-    {"0SOV),", 'F'},
-    {"0SOV);", 'F'},
-    {"0SOV)B", 'F'},
-    {"0SOV)C", 'F'},
-    {"0SOV)E", 'F'},
-    {"0SOV)F", 'F'},
-    {"0SOV)K", 'F'},
-    {"0SOV)O", 'F'},
-    {"0SOV)U", 'F'},
-    {"0SOV,(", 'F'},
-    {"0SOV,F", 'F'},
-    {"0SOV;", 'F'},
-    {"0SOV;C", 'F'},
-    {"0SOV;E", 'F'},
-    {"0SOV;N", 'F'},
-    {"0SOV;T", 'F'},
-    {"0SOVA(", 'F'},
-    {"0SOVAF", 'F'},
-    {"0SOVAS", 'F'},
-    {"0SOVAT", 'F'},
-    {"0SOVAV", 'F'},
-    {"0SOVB(", 'F'},
-    {"0SOVB1", 'F'},
-    {"0SOVBE", 'F'},
-    {"0SOVBF", 'F'},
-    {"0SOVBN", 'F'},
-    {"0SOVBS", 'F'},
-    {"0SOVBV", 'F'},
-    {"0SOVC", 'F'},
-    {"0SOVE(", 'F'},
-    {"0SOVE1", 'F'},
-    {"0SOVEF", 'F'},
-    {"0SOVEK", 'F'},
-    {"0SOVEN", 'F'},
-    {"0SOVEO", 'F'},
-    {"0SOVES", 'F'},
-    {"0SOVEU", 'F'},
-    {"0SOVEV", 'F'},
-    {"0SOVF(", 'F'},
-    {"0SOVK(", 'F'},
-    {"0SOVK)", 'F'},
-    {"0SOVK1", 'F'},
-    {"0SOVKB", 'F'},
-    {"0SOVKF", 'F'},
-    {"0SOVKN", 'F'},
-    {"0SOVKS", 'F'},
-    {"0SOVKU", 'F'},
-    {"0SOVKV", 'F'},
-    {"0SOVO(", 'F'},
-    {"0SOVOF", 'F'},
-    {"0SOVOK", 'F'},
-    {"0SOVOS", 'F'},
-    {"0SOVOU", 'F'},
-    {"0SOVS(", 'F'},
-    {"0SOVS1", 'F'},
-    {"0SOVSF", 'F'},
-    {"0SOVSO", 'F'},
-    {"0SOVSU", 'F'},
-    {"0SOVSV", 'F'},
-    {"0SOVT(", 'F'},
-    {"0SOVT1", 'F'},
-    {"0SOVTE", 'F'},
-    {"0SOVTF", 'F'},
-    {"0SOVTN", 'F'},
-    {"0SOVTS", 'F'},
-    {"0SOVTT", 'F'},
-    {"0SOVTV", 'F'},
-    {"0SOVU", 'F'},
-    {"0SOVU(", 'F'},
-    {"0SOVU1", 'F'},
-    {"0SOVU;", 'F'},
-    {"0SOVUC", 'F'},
-    {"0SOVUE", 'F'},
-    {"0SOVUF", 'F'},
-    {"0SOVUK", 'F'},
-    {"0SOVUO", 'F'},
-    {"0SOVUS", 'F'},
-    {"0SOVUT", 'F'},
-    {"0SOVUV", 'F'},
-    {"0ST(1)", 'F'},
-    {"0ST(1O", 'F'},
-    {"0ST(F(", 'F'},
-    {"0ST(N)", 'F'},
-    {"0ST(NO", 'F'},
-    {"0ST(S)", 'F'},
-    {"0ST(SO", 'F'},
-    {"0ST(V)", 'F'},
-    {"0ST(VO", 'F'},
-    {"0ST1(F", 'F'},
-    {"0ST1O(", 'F'},
-    {"0ST1OF", 'F'},
-    {"0ST1OS", 'F'},
-    {"0ST1OV", 'F'},
-    {"0STE(1", 'F'},
-    {"0STE(F", 'F'},
-    {"0STE(N", 'F'},
-    {"0STE(S", 'F'},
-    {"0STE(V", 'F'},
-    {"0STE1N", 'F'},
-    {"0STE1O", 'F'},
-    {"0STEF(", 'F'},
-    {"0STEK(", 'F'},
-    {"0STEK1", 'F'},
-    {"0STEKF", 'F'},
-    {"0STEKN", 'F'},
-    {"0STEKS", 'F'},
-    {"0STEKV", 'F'},
-    {"0STENN", 'F'},
-    {"0STENO", 'F'},
-    {"0STESN", 'F'},
-    {"0STESO", 'F'},
-    {"0STEVN", 'F'},
-    {"0STEVO", 'F'},
-    {"0STF()", 'F'},
-    {"0STF(1", 'F'},
-    {"0STF(F", 'F'},
-    {"0STF(N", 'F'},
-    {"0STF(S", 'F'},
-    {"0STF(V", 'F'},
-    {"0STN(1", 'F'},
-    {"0STN(F", 'F'},
-    {"0STN(S", 'F'},
-    {"0STN(V", 'F'},
-    {"0STN1C", 'F'},
-    {"0STN1O", 'F'},
-    {"0STN;E", 'F'},
-    {"0STN;N", 'F'},
-    {"0STN;T", 'F'},
-    {"0STNE(", 'F'},
-    {"0STNE1", 'F'},
-    {"0STNEF", 'F'},
-    {"0STNEN", 'F'},
-    {"0STNES", 'F'},
-    {"0STNEV", 'F'},
-    {"0STNF(", 'F'},
-    {"0STNKN", 'F'},
-    {"0STNN:", 'F'},
-    {"0STNNC", 'F'},
-    {"0STNNO", 'F'},
-    {"0STNO(", 'F'},
-    {"0STNOF", 'F'},
-    {"0STNOS", 'F'},
-    {"0STNOV", 'F'},
-    {"0STNSC", 'F'},
-    {"0STNSO", 'F'},
-    {"0STNT(", 'F'},
-    {"0STNT1", 'F'},
-    {"0STNTF", 'F'},
-    {"0STNTN", 'F'},
-    {"0STNTS", 'F'},
-    {"0STNTV", 'F'},
-    {"0STNVC", 'F'},
-    {"0STNVO", 'F'},
-    {"0STS(F", 'F'},
-    {"0STSO(", 'F'},
-    {"0STSO1", 'F'},
-    {"0STSOF", 'F'},
-    {"0STSON", 'F'},
-    {"0STSOS", 'F'},
-    {"0STSOV", 'F'},
-    {"0STTNE", 'F'},
-    {"0STTNK", 'F'},
-    {"0STTNN", 'F'},
-    {"0STTNT", 'F'},
-    {"0STV(1", 'F'},
-    {"0STV(F", 'F'},
-    {"0STVO(", 'F'},
-    {"0STVOF", 'F'},
-    {"0STVOS", 'F'},
-    {"0SU(1)", 'F'},
-    {"0SU(1O", 'F'},
-    {"0SU(E(", 'F'},
-    {"0SU(E1", 'F'},
-    {"0SU(EF", 'F'},
-    {"0SU(EK", 'F'},
-    {"0SU(EN", 'F'},
-    {"0SU(ES", 'F'},
-    {"0SU(EV", 'F'},
-    {"0SU(F(", 'F'},
-    {"0SU(N)", 'F'},
-    {"0SU(NO", 'F'},
-    {"0SU(S)", 'F'},
-    {"0SU(SO", 'F'},
-    {"0SU(V)", 'F'},
-    {"0SU(VO", 'F'},
-    {"0SU1,(", 'F'},
-    {"0SU1,F", 'F'},
-    {"0SU1C", 'F'},
-    {"0SU1O(", 'F'},
-    {"0SU1OF", 'F'},
-    {"0SU1OS", 'F'},
-    {"0SU1OV", 'F'},
-    {"0SU;", 'F'},
-    {"0SU;C", 'F'},
-    {"0SUC", 'F'},
-    {"0SUE", 'F'},
-    {"0SUE(1", 'F'},
-    {"0SUE(E", 'F'},
-    {"0SUE(F", 'F'},
-    {"0SUE(N", 'F'},
-    {"0SUE(O", 'F'},
-    {"0SUE(S", 'F'},
-    {"0SUE(V", 'F'},
-    {"0SUE1", 'F'},
-    {"0SUE1&", 'F'},
-    {"0SUE1(", 'F'},
-    {"0SUE1)", 'F'},
-    {"0SUE1,", 'F'},
-    {"0SUE1;", 'F'},
-    {"0SUE1B", 'F'},
-    {"0SUE1C", 'F'},
-    {"0SUE1F", 'F'},
-    {"0SUE1K", 'F'},
-    {"0SUE1N", 'F'},
-    {"0SUE1O", 'F'},
-    {"0SUE1S", 'F'},
-    {"0SUE1U", 'F'},
-    {"0SUE1V", 'F'},
-    {"0SUE;", 'F'},
-    {"0SUE;C", 'F'},
-    {"0SUEC", 'F'},
-    {"0SUEF", 'F'},
-    {"0SUEF(", 'F'},
-    {"0SUEF,", 'F'},
-    {"0SUEF;", 'F'},
-    {"0SUEFC", 'F'},
-    {"0SUEK", 'F'},
-    {"0SUEK(", 'F'},
-    {"0SUEK1", 'F'},
-    {"0SUEK;", 'F'},
-    {"0SUEKC", 'F'},
-    {"0SUEKF", 'F'},
-    {"0SUEKN", 'F'},
-    {"0SUEKO", 'F'},
-    {"0SUEKS", 'F'},
-    {"0SUEKV", 'F'},
-    {"0SUEN", 'F'},
-    {"0SUEN&", 'F'},
-    {"0SUEN(", 'F'},
-    {"0SUEN)", 'F'},
-    {"0SUEN,", 'F'},
-    {"0SUEN1", 'F'},
-    {"0SUEN;", 'F'},
-    {"0SUENB", 'F'},
-    {"0SUENC", 'F'},
-    {"0SUENF", 'F'},
-    {"0SUENK", 'F'},
-    {"0SUENO", 'F'},
-    {"0SUENS", 'F'},
-    {"0SUENU", 'F'},
-    {"0SUEOK", 'F'},
-    {"0SUEON", 'F'},
-    {"0SUES", 'F'},
-    {"0SUES&", 'F'},
-    {"0SUES(", 'F'},
-    {"0SUES)", 'F'},
-    {"0SUES,", 'F'},
-    {"0SUES1", 'F'},
-    {"0SUES;", 'F'},
-    {"0SUESB", 'F'},
-    {"0SUESC", 'F'},
-    {"0SUESF", 'F'},
-    {"0SUESK", 'F'},
-    {"0SUESO", 'F'},
-    {"0SUESU", 'F'},
-    {"0SUESV", 'F'},
-    {"0SUEV", 'F'},
-    {"0SUEV&", 'F'},
-    {"0SUEV(", 'F'},
-    {"0SUEV)", 'F'},
-    {"0SUEV,", 'F'},
-    {"0SUEV;", 'F'},
-    {"0SUEVB", 'F'},
-    {"0SUEVC", 'F'},
-    {"0SUEVF", 'F'},
-    {"0SUEVK", 'F'},
-    {"0SUEVN", 'F'},
-    {"0SUEVO", 'F'},
-    {"0SUEVS", 'F'},
-    {"0SUEVU", 'F'},
-    {"0SUF()", 'F'},
-    {"0SUF(1", 'F'},
-    {"0SUF(F", 'F'},
-    {"0SUF(N", 'F'},
-    {"0SUF(S", 'F'},
-    {"0SUF(V", 'F'},
-    {"0SUK(E", 'F'},
-    {"0SUO(E", 'F'},
-    {"0SUON(", 'F'},
-    {"0SUON1", 'F'},
-    {"0SUONF", 'F'},
-    {"0SUONS", 'F'},
-    {"0SUS,(", 'F'},
-    {"0SUS,F", 'F'},
-    {"0SUSC", 'F'},
-    {"0SUSO(", 'F'},
-    {"0SUSO1", 'F'},
-    {"0SUSOF", 'F'},
-    {"0SUSON", 'F'},
-    {"0SUSOS", 'F'},
-    {"0SUSOV", 'F'},
-    {"0SUTN(", 'F'},
-    {"0SUTN1", 'F'},
-    {"0SUTNF", 'F'},
-    {"0SUTNN", 'F'},
-    {"0SUTNS", 'F'},
-    {"0SUTNV", 'F'},
-    {"0SUV,(", 'F'},
-    {"0SUV,F", 'F'},
-    {"0SUVC", 'F'},
-    {"0SUVO(", 'F'},
-    {"0SUVOF", 'F'},
-    {"0SUVOS", 'F'},
-    {"0SVF()", 'F'},
-    {"0SVF(1", 'F'},
-    {"0SVF(F", 'F'},
-    {"0SVF(N", 'F'},
-    {"0SVF(S", 'F'},
-    {"0SVF(V", 'F'},
-    {"0SVO(1", 'F'},
-    {"0SVO(F", 'F'},
-    {"0SVO(N", 'F'},
-    {"0SVO(S", 'F'},
-    {"0SVO(V", 'F'},
-    {"0SVOF(", 'F'},
-    {"0SVOS(", 'F'},
-    {"0SVOS1", 'F'},
-    {"0SVOSF", 'F'},
-    {"0SVOSU", 'F'},
-    {"0SVOSV", 'F'},
-    {"0SVS;", 'F'},
-    {"0SVS;C", 'F'},
-    {"0SVSC", 'F'},
-    {"0SVSO(", 'F'},
-    {"0SVSO1", 'F'},
-    {"0SVSOF", 'F'},
-    {"0SVSON", 'F'},
-    {"0SVSOS", 'F'},
-    {"0SVSOV", 'F'},
-    {"0SVUE", 'F'},
-    {"0SVUE;", 'F'},
-    {"0SVUEC", 'F'},
-    {"0SVUEK", 'F'},
-    {"0T(1)F", 'F'},
-    {"0T(1)O", 'F'},
-    {"0T(1F(", 'F'},
-    {"0T(1N)", 'F'},
-    {"0T(1O(", 'F'},
-    {"0T(1OF", 'F'},
-    {"0T(1OS", 'F'},
-    {"0T(1OV", 'F'},
-    {"0T(1S)", 'F'},
-    {"0T(1V)", 'F'},
-    {"0T(1VO", 'F'},
-    {"0T(F()", 'F'},
-    {"0T(F(1", 'F'},
-    {"0T(F(F", 'F'},
-    {"0T(F(N", 'F'},
-    {"0T(F(S", 'F'},
-    {"0T(F(V", 'F'},
-    {"0T(N(1", 'F'},
-    {"0T(N(F", 'F'},
-    {"0T(N(S", 'F'},
-    {"0T(N(V", 'F'},
-    {"0T(N)F", 'F'},
-    {"0T(N)O", 'F'},
-    {"0T(N1)", 'F'},
-    {"0T(N1O", 'F'},
-    {"0T(NF(", 'F'},
-    {"0T(NN)", 'F'},
-    {"0T(NNO", 'F'},
-    {"0T(NO(", 'F'},
-    {"0T(NOF", 'F'},
-    {"0T(NOS", 'F'},
-    {"0T(NOV", 'F'},
-    {"0T(NS)", 'F'},
-    {"0T(NSO", 'F'},
-    {"0T(NV)", 'F'},
-    {"0T(NVO", 'F'},
-    {"0T(S)F", 'F'},
-    {"0T(S)O", 'F'},
-    {"0T(S1)", 'F'},
-    {"0T(SF(", 'F'},
-    {"0T(SN)", 'F'},
-    {"0T(SNO", 'F'},
-    {"0T(SO(", 'F'},
-    {"0T(SO1", 'F'},
-    {"0T(SOF", 'F'},
-    {"0T(SON", 'F'},
-    {"0T(SOS", 'F'},
-    {"0T(SOV", 'F'},
-    {"0T(SV)", 'F'},
-    {"0T(SVO", 'F'},
-    {"0T(V)F", 'F'},
-    {"0T(V)O", 'F'},
-    {"0T(VF(", 'F'},
-    {"0T(VO(", 'F'},
-    {"0T(VOF", 'F'},
-    {"0T(VOS", 'F'},
-    {"0T(VS)", 'F'},
-    {"0T(VSO", 'F'},
-    {"0T(VV)", 'F'},
-    {"0T1F(1", 'F'},
-    {"0T1F(F", 'F'},
-    {"0T1F(N", 'F'},
-    {"0T1F(S", 'F'},
-    {"0T1F(V", 'F'},
-    {"0T1O(1", 'F'},
-    {"0T1O(F", 'F'},
-    {"0T1O(N", 'F'},
-    {"0T1O(S", 'F'},
-    {"0T1O(V", 'F'},
-    {"0T1OF(", 'F'},
-    {"0T1OSF", 'F'},
-    {"0T1OVF", 'F'},
-    {"0T1OVO", 'F'},
-    {"0TF()F", 'F'},
-    {"0TF()O", 'F'},
-    {"0TF(1)", 'F'},
-    {"0TF(1O", 'F'},
-    {"0TF(F(", 'F'},
-    {"0TF(N)", 'F'},
-    {"0TF(NO", 'F'},
-    {"0TF(S)", 'F'},
-    {"0TF(SO", 'F'},
-    {"0TF(V)", 'F'},
-    {"0TF(VO", 'F'},
-    {"0TN(1)", 'F'},
-    {"0TN(1O", 'F'},
-    {"0TN(F(", 'F'},
-    {"0TN(S)", 'F'},
-    {"0TN(SO", 'F'},
-    {"0TN(V)", 'F'},
-    {"0TN(VO", 'F'},
-    {"0TN1;", 'F'},
-    {"0TN1;C", 'F'},
-    {"0TN1O(", 'F'},
-    {"0TN1OF", 'F'},
-    {"0TN1OS", 'F'},
-    {"0TN1OV", 'F'},
-    {"0TNF()", 'F'},
-    {"0TNF(1", 'F'},
-    {"0TNF(F", 'F'},
-    {"0TNF(N", 'F'},
-    {"0TNF(S", 'F'},
-    {"0TNF(V", 'F'},
-    {"0TNN;", 'F'},
-    {"0TNN;C", 'F'},
-    {"0TNNO(", 'F'},
-    {"0TNNOF", 'F'},
-    {"0TNNOS", 'F'},
-    {"0TNNOV", 'F'},
-    {"0TNO(1", 'F'},
-    {"0TNO(F", 'F'},
-    {"0TNO(N", 'F'},
-    {"0TNO(S", 'F'},
-    {"0TNO(V", 'F'},
-    {"0TNOF(", 'F'},
-    {"0TNOSF", 'F'},
-    {"0TNOVF", 'F'},
-    {"0TNOVO", 'F'},
-    {"0TNS;", 'F'},
-    {"0TNS;C", 'F'},
-    {"0TNSO(", 'F'},
-    {"0TNSO1", 'F'},
-    {"0TNSOF", 'F'},
-    {"0TNSON", 'F'},
-    {"0TNSOS", 'F'},
-    {"0TNSOV", 'F'},
-    {"0TNV;", 'F'},
-    {"0TNV;C", 'F'},
-    {"0TNVO(", 'F'},
-    {"0TNVOF", 'F'},
-    {"0TNVOS", 'F'},
-    {"0TSF(1", 'F'},
-    {"0TSF(F", 'F'},
-    {"0TSF(N", 'F'},
-    {"0TSF(S", 'F'},
-    {"0TSF(V", 'F'},
-    {"0TSO(1", 'F'},
-    {"0TSO(F", 'F'},
-    {"0TSO(N", 'F'},
-    {"0TSO(S", 'F'},
-    {"0TSO(V", 'F'},
-    {"0TSO1F", 'F'},
-    {"0TSOF(", 'F'},
-    {"0TSONF", 'F'},
-    {"0TSOSF", 'F'},
-    {"0TSOVF", 'F'},
-    {"0TSOVO", 'F'},
-    {"0TVF(1", 'F'},
-    {"0TVF(F", 'F'},
-    {"0TVF(N", 'F'},
-    {"0TVF(S", 'F'},
-    {"0TVF(V", 'F'},
-    {"0TVO(1", 'F'},
-    {"0TVO(F", 'F'},
-    {"0TVO(N", 'F'},
-    {"0TVO(S", 'F'},
-    {"0TVO(V", 'F'},
-    {"0TVOF(", 'F'},
-    {"0TVOSF", 'F'},
-    {"0U(E(1", 'F'},
-    {"0U(E(F", 'F'},
-    {"0U(E(K", 'F'},
-    {"0U(E(N", 'F'},
-    {"0U(E(S", 'F'},
-    {"0U(E(V", 'F'},
-    {"0U(E1)", 'F'},
-    {"0U(E1O", 'F'},
-    {"0U(EF(", 'F'},
-    {"0U(EK(", 'F'},
-    {"0U(EK1", 'F'},
-    {"0U(EKF", 'F'},
-    {"0U(EKN", 'F'},
-    {"0U(EKO", 'F'},
-    {"0U(EKS", 'F'},
-    {"0U(EKV", 'F'},
-    {"0U(EN)", 'F'},
-    {"0U(ENK", 'F'},
-    {"0U(ENO", 'F'},
-    {"0U(EOK", 'F'},
-    {"0U(ES)", 'F'},
-    {"0U(ESO", 'F'},
-    {"0U(EV)", 'F'},
-    {"0U(EVO", 'F'},
-    {"0UE(1)", 'F'},
-    {"0UE(1,", 'F'},
-    {"0UE(1O", 'F'},
-    {"0UE(F(", 'F'},
-    {"0UE(N)", 'F'},
-    {"0UE(N,", 'F'},
-    {"0UE(NO", 'F'},
-    {"0UE(S)", 'F'},
-    {"0UE(S,", 'F'},
-    {"0UE(SO", 'F'},
-    {"0UE(V)", 'F'},
-    {"0UE(V,", 'F'},
-    {"0UE(VO", 'F'},
-    {"0UE1", 'F'},
-    {"0UE1,(", 'F'},
-    {"0UE1,F", 'F'},
-    {"0UE1;", 'F'},
-    {"0UE1;C", 'F'},
-    {"0UE1C", 'F'},
-    {"0UE1K(", 'F'},
-    {"0UE1K1", 'F'},
-    {"0UE1KF", 'F'},
-    {"0UE1KN", 'F'},
-    {"0UE1KS", 'F'},
-    {"0UE1KV", 'F'},
-    {"0UE1O(", 'F'},
-    {"0UE1OF", 'F'},
-    {"0UE1OS", 'F'},
-    {"0UE1OV", 'F'},
-    {"0UEF()", 'F'},
-    {"0UEF(1", 'F'},
-    {"0UEF(F", 'F'},
-    {"0UEF(N", 'F'},
-    {"0UEF(S", 'F'},
-    {"0UEF(V", 'F'},
-    {"0UEK(1", 'F'},
-    {"0UEK(F", 'F'},
-    {"0UEK(N", 'F'},
-    {"0UEK(S", 'F'},
-    {"0UEK(V", 'F'},
-    {"0UEK1", 'F'},
-    {"0UEK1,", 'F'},
-    {"0UEK1;", 'F'},
-    {"0UEK1C", 'F'},
-    {"0UEK1K", 'F'},
-    {"0UEK1O", 'F'},
-    {"0UEKF(", 'F'},
-    {"0UEKN", 'F'},
-    {"0UEKN(", 'F'},
-    {"0UEKN,", 'F'},
-    {"0UEKN;", 'F'},
-    {"0UEKNC", 'F'},
-    {"0UEKNK", 'F'},
-    {"0UEKS", 'F'},
-    {"0UEKS,", 'F'},
-    {"0UEKS;", 'F'},
-    {"0UEKSC", 'F'},
-    {"0UEKSK", 'F'},
-    {"0UEKSO", 'F'},
-    {"0UEKV", 'F'},
-    {"0UEKV,", 'F'},
-    {"0UEKV;", 'F'},
-    {"0UEKVC", 'F'},
-    {"0UEKVK", 'F'},
-    {"0UEKVO", 'F'},
-    {"0UEN()", 'F'},
-    {"0UEN,(", 'F'},
-    {"0UEN,F", 'F'},
-    {"0UEN;", 'F'},
-    {"0UEN;C", 'F'},
-    {"0UENC", 'F'},
-    {"0UENK(", 'F'},
-    {"0UENK1", 'F'},
-    {"0UENKF", 'F'},
-    {"0UENKN", 'F'},
-    {"0UENKS", 'F'},
-    {"0UENKV", 'F'},
-    {"0UENO(", 'F'},
-    {"0UENOF", 'F'},
-    {"0UENOS", 'F'},
-    {"0UENOV", 'F'},
-    {"0UES", 'F'},
-    {"0UES,(", 'F'},
-    {"0UES,F", 'F'},
-    {"0UES;", 'F'},
-    {"0UES;C", 'F'},
-    {"0UESC", 'F'},
-    {"0UESK(", 'F'},
-    {"0UESK1", 'F'},
-    {"0UESKF", 'F'},
-    {"0UESKN", 'F'},
-    {"0UESKS", 'F'},
-    {"0UESKV", 'F'},
-    {"0UESO(", 'F'},
-    {"0UESO1", 'F'},
-    {"0UESOF", 'F'},
-    {"0UESON", 'F'},
-    {"0UESOS", 'F'},
-    {"0UESOV", 'F'},
-    {"0UEV", 'F'},
-    {"0UEV,(", 'F'},
-    {"0UEV,F", 'F'},
-    {"0UEV;", 'F'},
-    {"0UEV;C", 'F'},
-    {"0UEVC", 'F'},
-    {"0UEVK(", 'F'},
-    {"0UEVK1", 'F'},
-    {"0UEVKF", 'F'},
-    {"0UEVKN", 'F'},
-    {"0UEVKS", 'F'},
-    {"0UEVKV", 'F'},
-    {"0UEVO(", 'F'},
-    {"0UEVOF", 'F'},
-    {"0UEVOS", 'F'},
-    {"0UF(1O", 'F'},
-    {"0UF(F(", 'F'},
-    {"0UF(NO", 'F'},
-    {"0UF(SO", 'F'},
-    {"0UF(VO", 'F'},
-    {"0V&(1&", 'F'},
-    {"0V&(1)", 'F'},
-    {"0V&(1,", 'F'},
-    {"0V&(1O", 'F'},
-    {"0V&(E(", 'F'},
-    {"0V&(E1", 'F'},
-    {"0V&(EF", 'F'},
-    {"0V&(EK", 'F'},
-    {"0V&(EN", 'F'},
-    {"0V&(EO", 'F'},
-    {"0V&(ES", 'F'},
-    {"0V&(EV", 'F'},
-    {"0V&(F(", 'F'},
-    {"0V&(N&", 'F'},
-    {"0V&(N)", 'F'},
-    {"0V&(N,", 'F'},
-    {"0V&(NO", 'F'},
-    {"0V&(S&", 'F'},
-    {"0V&(S)", 'F'},
-    {"0V&(S,", 'F'},
-    {"0V&(SO", 'F'},
-    {"0V&(V&", 'F'},
-    {"0V&(V)", 'F'},
-    {"0V&(V,", 'F'},
-    {"0V&(VO", 'F'},
-    {"0V&1", 'F'},
-    {"0V&1&(", 'F'},
-    {"0V&1&1", 'F'},
-    {"0V&1&F", 'F'},
-    {"0V&1&N", 'F'},
-    {"0V&1&S", 'F'},
-    {"0V&1&V", 'F'},
-    {"0V&1)&", 'F'},
-    {"0V&1)C", 'F'},
-    {"0V&1)O", 'F'},
-    {"0V&1)U", 'F'},
-    {"0V&1;", 'F'},
-    {"0V&1;C", 'F'},
-    {"0V&1;E", 'F'},
-    {"0V&1;T", 'F'},
-    {"0V&1B(", 'F'},
-    {"0V&1B1", 'F'},
-    {"0V&1BF", 'F'},
-    {"0V&1BN", 'F'},
-    {"0V&1BS", 'F'},
-    {"0V&1BV", 'F'},
-    {"0V&1C", 'F'},
-    {"0V&1EK", 'F'},
-    {"0V&1EN", 'F'},
-    {"0V&1F(", 'F'},
-    {"0V&1K(", 'F'},
-    {"0V&1K1", 'F'},
-    {"0V&1KF", 'F'},
-    {"0V&1KN", 'F'},
-    {"0V&1KS", 'F'},
-    {"0V&1KV", 'F'},
-    {"0V&1O(", 'F'},
-    {"0V&1OF", 'F'},
-    {"0V&1OS", 'F'},
-    {"0V&1OV", 'F'},
-    {"0V&1TN", 'F'},
-    {"0V&1U", 'F'},
-    {"0V&1U(", 'F'},
-    {"0V&1U;", 'F'},
-    {"0V&1UC", 'F'},
-    {"0V&1UE", 'F'},
-    {"0V&E(1", 'F'},
-    {"0V&E(F", 'F'},
-    {"0V&E(N", 'F'},
-    {"0V&E(O", 'F'},
-    {"0V&E(S", 'F'},
-    {"0V&E(V", 'F'},
-    {"0V&E1", 'F'},
-    {"0V&E1;", 'F'},
-    {"0V&E1C", 'F'},
-    {"0V&E1K", 'F'},
-    {"0V&E1O", 'F'},
-    {"0V&EF(", 'F'},
-    {"0V&EK(", 'F'},
-    {"0V&EK1", 'F'},
-    {"0V&EKF", 'F'},
-    {"0V&EKN", 'F'},
-    {"0V&EKS", 'F'},
-    {"0V&EKV", 'F'},
-    {"0V&EN", 'F'},
-    {"0V&EN;", 'F'},
-    {"0V&ENC", 'F'},
-    {"0V&ENK", 'F'},
-    {"0V&ENO", 'F'},
-    {"0V&ES", 'F'},
-    {"0V&ES;", 'F'},
-    {"0V&ESC", 'F'},
-    {"0V&ESK", 'F'},
-    {"0V&ESO", 'F'},
-    {"0V&EV", 'F'},
-    {"0V&EV;", 'F'},
-    {"0V&EVC", 'F'},
-    {"0V&EVK", 'F'},
-    {"0V&EVO", 'F'},
-    {"0V&F()", 'F'},
-    {"0V&F(1", 'F'},
-    {"0V&F(E", 'F'},
-    {"0V&F(F", 'F'},
-    {"0V&F(N", 'F'},
-    {"0V&F(S", 'F'},
-    {"0V&F(V", 'F'},
-    {"0V&K&(", 'F'},
-    {"0V&K&1", 'F'},
-    {"0V&K&F", 'F'},
-    {"0V&K&N", 'F'},
-    {"0V&K&S", 'F'},
-    {"0V&K&V", 'F'},
-    {"0V&K(1", 'F'},
-    {"0V&K(F", 'F'},
-    {"0V&K(N", 'F'},
-    {"0V&K(S", 'F'},
-    {"0V&K(V", 'F'},
-    {"0V&K1O", 'F'},
-    {"0V&KC", 'F'},
-    {"0V&KF(", 'F'},
-    {"0V&KNK", 'F'},
-    {"0V&KO(", 'F'},
-    {"0V&KO1", 'F'},
-    {"0V&KOF", 'F'},
-    {"0V&KOK", 'F'},
-    {"0V&KON", 'F'},
-    {"0V&KOS", 'F'},
-    {"0V&KOV", 'F'},
-    {"0V&KSO", 'F'},
-    {"0V&KVO", 'F'},
-    {"0V&N", 'F'},
-    {"0V&N&(", 'F'},
-    {"0V&N&1", 'F'},
-    {"0V&N&F", 'F'},
-    {"0V&N&N", 'F'},
-    {"0V&N&S", 'F'},
-    {"0V&N&V", 'F'},
-    {"0V&N)&", 'F'},
-    {"0V&N)C", 'F'},
-    {"0V&N)O", 'F'},
-    {"0V&N)U", 'F'},
-    {"0V&N;", 'F'},
-    {"0V&N;C", 'F'},
-    {"0V&N;E", 'F'},
-    {"0V&N;T", 'F'},
-    {"0V&NB(", 'F'},
-    {"0V&NB1", 'F'},
-    {"0V&NBF", 'F'},
-    {"0V&NBN", 'F'},
-    {"0V&NBS", 'F'},
-    {"0V&NBV", 'F'},
-    {"0V&NC", 'F'},
-    {"0V&NEN", 'F'},
-    {"0V&NF(", 'F'},
-    {"0V&NK(", 'F'},
-    {"0V&NK1", 'F'},
-    {"0V&NKF", 'F'},
-    {"0V&NKN", 'F'},
-    {"0V&NKS", 'F'},
-    {"0V&NKV", 'F'},
-    {"0V&NO(", 'F'},
-    {"0V&NOF", 'F'},
-    {"0V&NOS", 'F'},
-    {"0V&NOV", 'F'},
-    {"0V&NTN", 'F'},
-    {"0V&NU", 'F'},
-    {"0V&NU(", 'F'},
-    {"0V&NU;", 'F'},
-    {"0V&NUC", 'F'},
-    {"0V&NUE", 'F'},
-    {"0V&S", 'F'},
-    {"0V&S&(", 'F'},
-    {"0V&S&1", 'F'},
-    {"0V&S&F", 'F'},
-    {"0V&S&N", 'F'},
-    {"0V&S&S", 'F'},
-    {"0V&S&V", 'F'},
-    {"0V&S)&", 'F'},
-    {"0V&S)C", 'F'},
-    {"0V&S)O", 'F'},
-    {"0V&S)U", 'F'},
-    {"0V&S1", 'F'},
-    {"0V&S1;", 'F'},
-    {"0V&S1C", 'F'},
-    {"0V&S;", 'F'},
-    {"0V&S;C", 'F'},
-    {"0V&S;E", 'F'},
-    {"0V&S;T", 'F'},
-    {"0V&SB(", 'F'},
-    {"0V&SB1", 'F'},
-    {"0V&SBF", 'F'},
-    {"0V&SBN", 'F'},
-    {"0V&SBS", 'F'},
-    {"0V&SBV", 'F'},
-    {"0V&SC", 'F'},
-    {"0V&SEK", 'F'},
-    {"0V&SEN", 'F'},
-    {"0V&SF(", 'F'},
-    {"0V&SK(", 'F'},
-    {"0V&SK1", 'F'},
-    {"0V&SKF", 'F'},
-    {"0V&SKN", 'F'},
-    {"0V&SKS", 'F'},
-    {"0V&SKV", 'F'},
-    {"0V&SO(", 'F'},
-    {"0V&SO1", 'F'},
-    {"0V&SOF", 'F'},
-    {"0V&SON", 'F'},
-    {"0V&SOS", 'F'},
-    {"0V&SOV", 'F'},
-    {"0V&STN", 'F'},
-    {"0V&SU", 'F'},
-    {"0V&SU(", 'F'},
-    {"0V&SU;", 'F'},
-    {"0V&SUC", 'F'},
-    {"0V&SUE", 'F'},
-    {"0V&SV", 'F'},
-    {"0V&SV;", 'F'},
-    {"0V&SVC", 'F'},
-    {"0V&SVO", 'F'},
-    {"0V&V", 'F'},
-    {"0V&V&(", 'F'},
-    {"0V&V&1", 'F'},
-    {"0V&V&F", 'F'},
-    {"0V&V&N", 'F'},
-    {"0V&V&S", 'F'},
-    {"0V&V&V", 'F'},
-    {"0V&V)&", 'F'},
-    {"0V&V)C", 'F'},
-    {"0V&V)O", 'F'},
-    {"0V&V)U", 'F'},
-    {"0V&V;", 'F'},
-    {"0V&V;C", 'F'},
-    {"0V&V;E", 'F'},
-    {"0V&V;T", 'F'},
-    {"0V&VB(", 'F'},
-    {"0V&VB1", 'F'},
-    {"0V&VBF", 'F'},
-    {"0V&VBN", 'F'},
-    {"0V&VBS", 'F'},
-    {"0V&VBV", 'F'},
-    {"0V&VC", 'F'},
-    {"0V&VEK", 'F'},
-    {"0V&VEN", 'F'},
-    {"0V&VF(", 'F'},
-    {"0V&VK(", 'F'},
-    {"0V&VK1", 'F'},
-    {"0V&VKF", 'F'},
-    {"0V&VKN", 'F'},
-    {"0V&VKS", 'F'},
-    {"0V&VKV", 'F'},
-    {"0V&VO(", 'F'},
-    {"0V&VOF", 'F'},
-    {"0V&VOS", 'F'},
-    {"0V&VS", 'F'},
-    {"0V&VS;", 'F'},
-    {"0V&VSC", 'F'},
-    {"0V&VSO", 'F'},
-    {"0V&VTN", 'F'},
-    {"0V&VU", 'F'},
-    {"0V&VU(", 'F'},
-    {"0V&VU;", 'F'},
-    {"0V&VUC", 'F'},
-    {"0V&VUE", 'F'},
-    {"0V(EF(", 'F'},
-    {"0V(EKF", 'F'},
-    {"0V(EKN", 'F'},
-    {"0V(ENK", 'F'},
-    {"0V(U(E", 'F'},
-    {"0V)&(1", 'F'},
-    {"0V)&(E", 'F'},
-    {"0V)&(F", 'F'},
-    {"0V)&(N", 'F'},
-    {"0V)&(S", 'F'},
-    {"0V)&(V", 'F'},
-    {"0V)&1", 'F'},
-    {"0V)&1&", 'F'},
-    {"0V)&1)", 'F'},
-    {"0V)&1;", 'F'},
-    {"0V)&1B", 'F'},
-    {"0V)&1C", 'F'},
-    {"0V)&1F", 'F'},
-    {"0V)&1O", 'F'},
-    {"0V)&1U", 'F'},
-    {"0V)&F(", 'F'},
-    {"0V)&N", 'F'},
-    {"0V)&N&", 'F'},
-    {"0V)&N)", 'F'},
-    {"0V)&N;", 'F'},
-    {"0V)&NB", 'F'},
-    {"0V)&NC", 'F'},
-    {"0V)&NF", 'F'},
-    {"0V)&NO", 'F'},
-    {"0V)&NU", 'F'},
-    {"0V)&S", 'F'},
-    {"0V)&S&", 'F'},
-    {"0V)&S)", 'F'},
-    {"0V)&S;", 'F'},
-    {"0V)&SB", 'F'},
-    {"0V)&SC", 'F'},
-    {"0V)&SF", 'F'},
-    {"0V)&SO", 'F'},
-    {"0V)&SU", 'F'},
-    {"0V)&V", 'F'},
-    {"0V)&V&", 'F'},
-    {"0V)&V)", 'F'},
-    {"0V)&V;", 'F'},
-    {"0V)&VB", 'F'},
-    {"0V)&VC", 'F'},
-    {"0V)&VF", 'F'},
-    {"0V)&VO", 'F'},
-    {"0V)&VU", 'F'},
-    {"0V),(1", 'F'},
-    {"0V),(F", 'F'},
-    {"0V),(N", 'F'},
-    {"0V),(S", 'F'},
-    {"0V),(V", 'F'},
-    {"0V);E(", 'F'},
-    {"0V);E1", 'F'},
-    {"0V);EF", 'F'},
-    {"0V);EK", 'F'},
-    {"0V);EN", 'F'},
-    {"0V);EO", 'F'},
-    {"0V);ES", 'F'},
-    {"0V);EV", 'F'},
-    {"0V);T(", 'F'},
-    {"0V);T1", 'F'},
-    {"0V);TF", 'F'},
-    {"0V);TK", 'F'},
-    {"0V);TN", 'F'},
-    {"0V);TO", 'F'},
-    {"0V);TS", 'F'},
-    {"0V);TV", 'F'},
-    {"0V)B(1", 'F'},
-    {"0V)B(F", 'F'},
-    {"0V)B(N", 'F'},
-    {"0V)B(S", 'F'},
-    {"0V)B(V", 'F'},
-    {"0V)B1", 'F'},
-    {"0V)B1&", 'F'},
-    {"0V)B1;", 'F'},
-    {"0V)B1C", 'F'},
-    {"0V)B1K", 'F'},
-    {"0V)B1N", 'F'},
-    {"0V)B1O", 'F'},
-    {"0V)B1U", 'F'},
-    {"0V)BF(", 'F'},
-    {"0V)BN", 'F'},
-    {"0V)BN&", 'F'},
-    {"0V)BN;", 'F'},
-    {"0V)BNC", 'F'},
-    {"0V)BNK", 'F'},
-    {"0V)BNO", 'F'},
-    {"0V)BNU", 'F'},
-    {"0V)BS", 'F'},
-    {"0V)BS&", 'F'},
-    {"0V)BS;", 'F'},
-    {"0V)BSC", 'F'},
-    {"0V)BSK", 'F'},
-    {"0V)BSO", 'F'},
-    {"0V)BSU", 'F'},
-    {"0V)BV", 'F'},
-    {"0V)BV&", 'F'},
-    {"0V)BV;", 'F'},
-    {"0V)BVC", 'F'},
-    {"0V)BVK", 'F'},
-    {"0V)BVO", 'F'},
-    {"0V)BVU", 'F'},
-    {"0V)C", 'F'},
-    {"0V)E(1", 'F'},
-    {"0V)E(F", 'F'},
-    {"0V)E(N", 'F'},
-    {"0V)E(S", 'F'},
-    {"0V)E(V", 'F'},
-    {"0V)E1C", 'F'},
-    {"0V)E1O", 'F'},
-    {"0V)EF(", 'F'},
-    {"0V)EK(", 'F'},
-    {"0V)EK1", 'F'},
-    {"0V)EKF", 'F'},
-    {"0V)EKN", 'F'},
-    {"0V)EKS", 'F'},
-    {"0V)EKV", 'F'},
-    {"0V)ENC", 'F'},
-    {"0V)ENO", 'F'},
-    {"0V)ESC", 'F'},
-    {"0V)ESO", 'F'},
-    {"0V)EVC", 'F'},
-    {"0V)EVO", 'F'},
-    {"0V)F(F", 'F'},
-    {"0V)K(1", 'F'},
-    {"0V)K(F", 'F'},
-    {"0V)K(N", 'F'},
-    {"0V)K(S", 'F'},
-    {"0V)K(V", 'F'},
-    {"0V)K1&", 'F'},
-    {"0V)K1;", 'F'},
-    {"0V)K1B", 'F'},
-    {"0V)K1E", 'F'},
-    {"0V)K1O", 'F'},
-    {"0V)K1U", 'F'},
-    {"0V)KB(", 'F'},
-    {"0V)KB1", 'F'},
-    {"0V)KBF", 'F'},
-    {"0V)KBN", 'F'},
-    {"0V)KBS", 'F'},
-    {"0V)KBV", 'F'},
-    {"0V)KF(", 'F'},
-    {"0V)KN&", 'F'},
-    {"0V)KN;", 'F'},
-    {"0V)KNB", 'F'},
-    {"0V)KNC", 'F'},
-    {"0V)KNE", 'F'},
-    {"0V)KNK", 'F'},
-    {"0V)KNU", 'F'},
-    {"0V)KS&", 'F'},
-    {"0V)KS;", 'F'},
-    {"0V)KSB", 'F'},
-    {"0V)KSE", 'F'},
-    {"0V)KSO", 'F'},
-    {"0V)KSU", 'F'},
-    {"0V)KUE", 'F'},
-    {"0V)KV&", 'F'},
-    {"0V)KV;", 'F'},
-    {"0V)KVB", 'F'},
-    {"0V)KVE", 'F'},
-    {"0V)KVO", 'F'},
-    {"0V)KVU", 'F'},
-    {"0V)O(1", 'F'},
-    {"0V)O(E", 'F'},
-    {"0V)O(F", 'F'},
-    {"0V)O(N", 'F'},
-    {"0V)O(S", 'F'},
-    {"0V)O(V", 'F'},
-    {"0V)O1", 'F'},
-    {"0V)O1&", 'F'},
-    {"0V)O1)", 'F'},
-    {"0V)O1;", 'F'},
-    {"0V)O1B", 'F'},
-    {"0V)O1C", 'F'},
-    {"0V)O1K", 'F'},
-    {"0V)O1U", 'F'},
-    {"0V)OF(", 'F'},
-    {"0V)ON", 'F'},
-    {"0V)ON&", 'F'},
-    {"0V)ON)", 'F'},
-    {"0V)ON;", 'F'},
-    {"0V)ONB", 'F'},
-    {"0V)ONC", 'F'},
-    {"0V)ONK", 'F'},
-    {"0V)ONU", 'F'},
-    {"0V)OS", 'F'},
-    {"0V)OS&", 'F'},
-    {"0V)OS)", 'F'},
-    {"0V)OS;", 'F'},
-    {"0V)OSB", 'F'},
-    {"0V)OSC", 'F'},
-    {"0V)OSK", 'F'},
-    {"0V)OSU", 'F'},
-    {"0V)OV", 'F'},
-    {"0V)OV&", 'F'},
-    {"0V)OV)", 'F'},
-    {"0V)OV;", 'F'},
-    {"0V)OVB", 'F'},
-    {"0V)OVC", 'F'},
-    {"0V)OVK", 'F'},
-    {"0V)OVO", 'F'},
-    {"0V)OVU", 'F'},
-    {"0V)U(E", 'F'},
-    {"0V)UE(", 'F'},
-    {"0V)UE1", 'F'},
-    {"0V)UEF", 'F'},
-    {"0V)UEK", 'F'},
-    {"0V)UEN", 'F'},
-    {"0V)UES", 'F'},
-    {"0V)UEV", 'F'},
-    {"0V,(1)", 'F'},
-    {"0V,(1O", 'F'},
-    {"0V,(E(", 'F'},
-    {"0V,(E1", 'F'},
-    {"0V,(EF", 'F'},
-    {"0V,(EK", 'F'},
-    {"0V,(EN", 'F'},
-    {"0V,(ES", 'F'},
-    {"0V,(EV", 'F'},
-    {"0V,(F(", 'F'},
-    {"0V,(N)", 'F'},
-    {"0V,(NO", 'F'},
-    {"0V,(S)", 'F'},
-    {"0V,(SO", 'F'},
-    {"0V,(V)", 'F'},
-    {"0V,(VO", 'F'},
-    {"0V,F()", 'F'},
-    {"0V,F(1", 'F'},
-    {"0V,F(F", 'F'},
-    {"0V,F(N", 'F'},
-    {"0V,F(S", 'F'},
-    {"0V,F(V", 'F'},
-    {"0V;E(1", 'F'},
-    {"0V;E(E", 'F'},
-    {"0V;E(F", 'F'},
-    {"0V;E(N", 'F'},
-    {"0V;E(S", 'F'},
-    {"0V;E(V", 'F'},
-    {"0V;E1,", 'F'},
-    {"0V;E1;", 'F'},
-    {"0V;E1C", 'F'},
-    {"0V;E1K", 'F'},
-    {"0V;E1O", 'F'},
-    {"0V;E1T", 'F'},
-    {"0V;EF(", 'F'},
-    {"0V;EK(", 'F'},
-    {"0V;EK1", 'F'},
-    {"0V;EKF", 'F'},
-    {"0V;EKN", 'F'},
-    {"0V;EKO", 'F'},
-    {"0V;EKS", 'F'},
-    {"0V;EKV", 'F'},
-    {"0V;EN,", 'F'},
-    {"0V;EN;", 'F'},
-    {"0V;ENC", 'F'},
-    {"0V;ENE", 'F'},
-    {"0V;ENK", 'F'},
-    {"0V;ENO", 'F'},
-    {"0V;ENT", 'F'},
-    {"0V;ES,", 'F'},
-    {"0V;ES;", 'F'},
-    {"0V;ESC", 'F'},
-    {"0V;ESK", 'F'},
-    {"0V;ESO", 'F'},
-    {"0V;EST", 'F'},
-    {"0V;EV,", 'F'},
-    {"0V;EV;", 'F'},
-    {"0V;EVC", 'F'},
-    {"0V;EVK", 'F'},
-    {"0V;EVO", 'F'},
-    {"0V;EVT", 'F'},
-    {"0V;N:T", 'F'},
-    {"0V;T(1", 'F'},
-    {"0V;T(C", 'F'},
-    {"0V;T(E", 'F'},
-    {"0V;T(F", 'F'},
-    {"0V;T(N", 'F'},
-    {"0V;T(S", 'F'},
-    {"0V;T(V", 'F'},
-    {"0V;T1(", 'F'},
-    {"0V;T1,", 'F'},
-    {"0V;T1;", 'F'},
-    {"0V;T1C", 'F'},
-    {"0V;T1F", 'F'},
-    {"0V;T1K", 'F'},
-    {"0V;T1O", 'F'},
-    {"0V;T1T", 'F'},
-    {"0V;T;", 'F'},
-    {"0V;T;C", 'F'},
-    {"0V;TF(", 'F'},
-    {"0V;TK(", 'F'},
-    {"0V;TK1", 'F'},
-    {"0V;TKF", 'F'},
-    {"0V;TKK", 'F'},
-    {"0V;TKN", 'F'},
-    {"0V;TKO", 'F'},
-    {"0V;TKS", 'F'},
-    {"0V;TKV", 'F'},
-    {"0V;TN(", 'F'},
-    {"0V;TN,", 'F'},
-    {"0V;TN1", 'F'},
-    {"0V;TN;", 'F'},
-    {"0V;TNC", 'F'},
-    {"0V;TNE", 'F'},
-    {"0V;TNF", 'F'},
-    {"0V;TNK", 'F'},
-    {"0V;TNN", 'F'},
-    {"0V;TNO", 'F'},
-    {"0V;TNS", 'F'},
-    {"0V;TNT", 'F'},
-    {"0V;TNV", 'F'},
-    {"0V;TO(", 'F'},
-    {"0V;TS(", 'F'},
-    {"0V;TS,", 'F'},
-    {"0V;TS;", 'F'},
-    {"0V;TSC", 'F'},
-    {"0V;TSF", 'F'},
-    {"0V;TSK", 'F'},
-    {"0V;TSO", 'F'},
-    {"0V;TST", 'F'},
-    {"0V;TTN", 'F'},
-    {"0V;TV(", 'F'},
-    {"0V;TV,", 'F'},
-    {"0V;TV;", 'F'},
-    {"0V;TVC", 'F'},
-    {"0V;TVF", 'F'},
-    {"0V;TVK", 'F'},
-    {"0V;TVO", 'F'},
-    {"0V;TVT", 'F'},
-    {"0VA(F(", 'F'},
-    {"0VA(N)", 'F'},
-    {"0VA(NO", 'F'},
-    {"0VA(S)", 'F'},
-    {"0VA(SO", 'F'},
-    {"0VA(V)", 'F'},
-    {"0VA(VO", 'F'},
-    {"0VAF()", 'F'},
-    {"0VAF(1", 'F'},
-    {"0VAF(F", 'F'},
-    {"0VAF(N", 'F'},
-    {"0VAF(S", 'F'},
-    {"0VAF(V", 'F'},
-    {"0VASO(", 'F'},
-    {"0VASO1", 'F'},
-    {"0VASOF", 'F'},
-    {"0VASON", 'F'},
-    {"0VASOS", 'F'},
-    {"0VASOV", 'F'},
-    {"0VASUE", 'F'},
-    {"0VATO(", 'F'},
-    {"0VATO1", 'F'},
-    {"0VATOF", 'F'},
-    {"0VATON", 'F'},
-    {"0VATOS", 'F'},
-    {"0VATOV", 'F'},
-    {"0VATUE", 'F'},
-    {"0VAVO(", 'F'},
-    {"0VAVOF", 'F'},
-    {"0VAVOS", 'F'},
-    {"0VAVUE", 'F'},
-    {"0VB(1)", 'F'},
-    {"0VB(1O", 'F'},
-    {"0VB(F(", 'F'},
-    {"0VB(NO", 'F'},
-    {"0VB(S)", 'F'},
-    {"0VB(SO", 'F'},
-    {"0VB(V)", 'F'},
-    {"0VB(VO", 'F'},
-    {"0VB1", 'F'},
-    {"0VB1&(", 'F'},
-    {"0VB1&1", 'F'},
-    {"0VB1&F", 'F'},
-    {"0VB1&N", 'F'},
-    {"0VB1&S", 'F'},
-    {"0VB1&V", 'F'},
-    {"0VB1,(", 'F'},
-    {"0VB1,F", 'F'},
-    {"0VB1;", 'F'},
-    {"0VB1;C", 'F'},
-    {"0VB1B(", 'F'},
-    {"0VB1B1", 'F'},
-    {"0VB1BF", 'F'},
-    {"0VB1BN", 'F'},
-    {"0VB1BS", 'F'},
-    {"0VB1BV", 'F'},
-    {"0VB1C", 'F'},
-    {"0VB1K(", 'F'},
-    {"0VB1K1", 'F'},
-    {"0VB1KF", 'F'},
-    {"0VB1KN", 'F'},
-    {"0VB1KS", 'F'},
-    {"0VB1KV", 'F'},
-    {"0VB1O(", 'F'},
-    {"0VB1OF", 'F'},
-    {"0VB1OS", 'F'},
-    {"0VB1OV", 'F'},
-    {"0VB1U(", 'F'},
-    {"0VB1UE", 'F'},
-    {"0VBE(1", 'F'},
-    {"0VBE(F", 'F'},
-    {"0VBE(N", 'F'},
-    {"0VBE(S", 'F'},
-    {"0VBE(V", 'F'},
-    {"0VBEK(", 'F'},
-    {"0VBF()", 'F'},
-    {"0VBF(1", 'F'},
-    {"0VBF(F", 'F'},
-    {"0VBF(N", 'F'},
-    {"0VBF(S", 'F'},
-    {"0VBF(V", 'F'},
-    {"0VBN", 'F'},
-    {"0VBN&(", 'F'},
-    {"0VBN&1", 'F'},
-    {"0VBN&F", 'F'},
-    {"0VBN&N", 'F'},
-    {"0VBN&S", 'F'},
-    {"0VBN&V", 'F'},
-    {"0VBN,(", 'F'},
-    {"0VBN,F", 'F'},
-    {"0VBN;", 'F'},
-    {"0VBN;C", 'F'},
-    {"0VBNB(", 'F'},
-    {"0VBNB1", 'F'},
-    {"0VBNBF", 'F'},
-    {"0VBNBN", 'F'},
-    {"0VBNBS", 'F'},
-    {"0VBNBV", 'F'},
-    {"0VBNC", 'F'},
-    {"0VBNK(", 'F'},
-    {"0VBNK1", 'F'},
-    {"0VBNKF", 'F'},
-    {"0VBNKN", 'F'},
-    {"0VBNKS", 'F'},
-    {"0VBNKV", 'F'},
-    {"0VBNO(", 'F'},
-    {"0VBNOF", 'F'},
-    {"0VBNOS", 'F'},
-    {"0VBNOV", 'F'},
-    {"0VBNU(", 'F'},
-    {"0VBNUE", 'F'},
-    {"0VBS", 'F'},
-    {"0VBS&(", 'F'},
-    {"0VBS&1", 'F'},
-    {"0VBS&F", 'F'},
-    {"0VBS&N", 'F'},
-    {"0VBS&S", 'F'},
-    {"0VBS&V", 'F'},
-    {"0VBS,(", 'F'},
-    {"0VBS,F", 'F'},
-    {"0VBS;", 'F'},
-    {"0VBS;C", 'F'},
-    {"0VBSB(", 'F'},
-    {"0VBSB1", 'F'},
-    {"0VBSBF", 'F'},
-    {"0VBSBN", 'F'},
-    {"0VBSBS", 'F'},
-    {"0VBSBV", 'F'},
-    {"0VBSC", 'F'},
-    {"0VBSK(", 'F'},
-    {"0VBSK1", 'F'},
-    {"0VBSKF", 'F'},
-    {"0VBSKN", 'F'},
-    {"0VBSKS", 'F'},
-    {"0VBSKV", 'F'},
-    {"0VBSO(", 'F'},
-    {"0VBSO1", 'F'},
-    {"0VBSOF", 'F'},
-    {"0VBSON", 'F'},
-    {"0VBSOS", 'F'},
-    {"0VBSOV", 'F'},
-    {"0VBSU(", 'F'},
-    {"0VBSUE", 'F'},
-    {"0VBV", 'F'},
-    {"0VBV&(", 'F'},
-    {"0VBV&1", 'F'},
-    {"0VBV&F", 'F'},
-    {"0VBV&N", 'F'},
-    {"0VBV&S", 'F'},
-    {"0VBV&V", 'F'},
-    {"0VBV,(", 'F'},
-    {"0VBV,F", 'F'},
-    {"0VBV;", 'F'},
-    {"0VBV;C", 'F'},
-    {"0VBVB(", 'F'},
-    {"0VBVB1", 'F'},
-    {"0VBVBF", 'F'},
-    {"0VBVBN", 'F'},
-    {"0VBVBS", 'F'},
-    {"0VBVBV", 'F'},
-    {"0VBVC", 'F'},
-    {"0VBVK(", 'F'},
-    {"0VBVK1", 'F'},
-    {"0VBVKF", 'F'},
-    {"0VBVKN", 'F'},
-    {"0VBVKS", 'F'},
-    {"0VBVKV", 'F'},
-    {"0VBVO(", 'F'},
-    {"0VBVOF", 'F'},
-    {"0VBVOS", 'F'},
-    {"0VBVU(", 'F'},
-    {"0VBVUE", 'F'},
-    {"0VC", 'F'},
-    {"0VE(1)", 'F'},
-    {"0VE(1O", 'F'},
-    {"0VE(F(", 'F'},
-    {"0VE(N)", 'F'},
-    {"0VE(NO", 'F'},
-    {"0VE(S)", 'F'},
-    {"0VE(SO", 'F'},
-    {"0VE(V)", 'F'},
-    {"0VE(VO", 'F'},
-    {"0VE1;T", 'F'},
-    {"0VE1C", 'F'},
-    {"0VE1O(", 'F'},
-    {"0VE1OF", 'F'},
-    {"0VE1OS", 'F'},
-    {"0VE1OV", 'F'},
-    {"0VE1T(", 'F'},
-    {"0VE1T1", 'F'},
-    {"0VE1TF", 'F'},
-    {"0VE1TN", 'F'},
-    {"0VE1TS", 'F'},
-    {"0VE1TV", 'F'},
-    {"0VE1UE", 'F'},
-    {"0VEF()", 'F'},
-    {"0VEF(1", 'F'},
-    {"0VEF(F", 'F'},
-    {"0VEF(N", 'F'},
-    {"0VEF(S", 'F'},
-    {"0VEF(V", 'F'},
-    {"0VEK(1", 'F'},
-    {"0VEK(E", 'F'},
-    {"0VEK(F", 'F'},
-    {"0VEK(N", 'F'},
-    {"0VEK(S", 'F'},
-    {"0VEK(V", 'F'},
-    {"0VEK1;", 'F'},
-    {"0VEK1C", 'F'},
-    {"0VEK1O", 'F'},
-    {"0VEK1T", 'F'},
-    {"0VEK1U", 'F'},
-    {"0VEKF(", 'F'},
-    {"0VEKN;", 'F'},
-    {"0VEKNC", 'F'},
-    {"0VEKNE", 'F'},
-    {"0VEKNT", 'F'},
-    {"0VEKNU", 'F'},
-    {"0VEKOK", 'F'},
-    {"0VEKS;", 'F'},
-    {"0VEKSC", 'F'},
-    {"0VEKSO", 'F'},
-    {"0VEKST", 'F'},
-    {"0VEKSU", 'F'},
-    {"0VEKU(", 'F'},
-    {"0VEKU1", 'F'},
-    {"0VEKUE", 'F'},
-    {"0VEKUF", 'F'},
-    {"0VEKUS", 'F'},
-    {"0VEKUV", 'F'},
-    {"0VEKV;", 'F'},
-    {"0VEKVC", 'F'},
-    {"0VEKVO", 'F'},
-    {"0VEKVT", 'F'},
-    {"0VEKVU", 'F'},
-    {"0VEN;T", 'F'},
-    {"0VENC", 'F'},
-    {"0VENEN", 'F'},
-    {"0VENO(", 'F'},
-    {"0VENOF", 'F'},
-    {"0VENOS", 'F'},
-    {"0VENOV", 'F'},
-    {"0VENT(", 'F'},
-    {"0VENT1", 'F'},
-    {"0VENTF", 'F'},
-    {"0VENTN", 'F'},
-    {"0VENTS", 'F'},
-    {"0VENTV", 'F'},
-    {"0VENUE", 'F'},
-    {"0VEOKN", 'F'},
-    {"0VES;T", 'F'},
-    {"0VESC", 'F'},
-    {"0VESO(", 'F'},
-    {"0VESO1", 'F'},
-    {"0VESOF", 'F'},
-    {"0VESON", 'F'},
-    {"0VESOS", 'F'},
-    {"0VESOV", 'F'},
-    {"0VEST(", 'F'},
-    {"0VEST1", 'F'},
-    {"0VESTF", 'F'},
-    {"0VESTN", 'F'},
-    {"0VESTS", 'F'},
-    {"0VESTV", 'F'},
-    {"0VESUE", 'F'},
-    {"0VEU(1", 'F'},
-    {"0VEU(F", 'F'},
-    {"0VEU(N", 'F'},
-    {"0VEU(S", 'F'},
-    {"0VEU(V", 'F'},
-    {"0VEU1,", 'F'},
-    {"0VEU1C", 'F'},
-    {"0VEU1O", 'F'},
-    {"0VEUEF", 'F'},
-    {"0VEUEK", 'F'},
-    {"0VEUF(", 'F'},
-    {"0VEUS,", 'F'},
-    {"0VEUSC", 'F'},
-    {"0VEUSO", 'F'},
-    {"0VEUV,", 'F'},
-    {"0VEUVC", 'F'},
-    {"0VEUVO", 'F'},
-    {"0VEV;T", 'F'},
-    {"0VEVC", 'F'},
-    {"0VEVO(", 'F'},
-    {"0VEVOF", 'F'},
-    {"0VEVOS", 'F'},
-    {"0VEVT(", 'F'},
-    {"0VEVT1", 'F'},
-    {"0VEVTF", 'F'},
-    {"0VEVTN", 'F'},
-    {"0VEVTS", 'F'},
-    {"0VEVTV", 'F'},
-    {"0VEVUE", 'F'},
-    {"0VF()1", 'F'},
-    {"0VF()F", 'F'},
-    {"0VF()K", 'F'},
-    {"0VF()N", 'F'},
-    {"0VF()O", 'F'},
-    {"0VF()S", 'F'},
-    {"0VF()U", 'F'},
-    {"0VF()V", 'F'},
-    {"0VF(1)", 'F'},
-    {"0VF(1N", 'F'},
-    {"0VF(1O", 'F'},
-    {"0VF(E(", 'F'},
-    {"0VF(E1", 'F'},
-    {"0VF(EF", 'F'},
-    {"0VF(EK", 'F'},
-    {"0VF(EN", 'F'},
-    {"0VF(ES", 'F'},
-    {"0VF(EV", 'F'},
-    {"0VF(F(", 'F'},
-    {"0VF(N)", 'F'},
-    {"0VF(N,", 'F'},
-    {"0VF(NO", 'F'},
-    {"0VF(S)", 'F'},
-    {"0VF(SO", 'F'},
-    {"0VF(V)", 'F'},
-    {"0VF(VO", 'F'},
-    {"0VK(1)", 'F'},
-    {"0VK(1O", 'F'},
-    {"0VK(F(", 'F'},
-    {"0VK(N)", 'F'},
-    {"0VK(NO", 'F'},
-    {"0VK(S)", 'F'},
-    {"0VK(SO", 'F'},
-    {"0VK(V)", 'F'},
-    {"0VK(VO", 'F'},
-    {"0VK)&(", 'F'},
-    {"0VK)&1", 'F'},
-    {"0VK)&F", 'F'},
-    {"0VK)&N", 'F'},
-    {"0VK)&S", 'F'},
-    {"0VK)&V", 'F'},
-    {"0VK);E", 'F'},
-    {"0VK);T", 'F'},
-    {"0VK)B(", 'F'},
-    {"0VK)B1", 'F'},
-    {"0VK)BF", 'F'},
-    {"0VK)BN", 'F'},
-    {"0VK)BS", 'F'},
-    {"0VK)BV", 'F'},
-    {"0VK)E(", 'F'},
-    {"0VK)E1", 'F'},
-    {"0VK)EF", 'F'},
-    {"0VK)EK", 'F'},
-    {"0VK)EN", 'F'},
-    {"0VK)ES", 'F'},
-    {"0VK)EV", 'F'},
-    {"0VK)F(", 'F'},
-    {"0VK)O(", 'F'},
-    {"0VK)OF", 'F'},
-    {"0VK)UE", 'F'},
-    {"0VK1", 'F'},
-    {"0VK1&(", 'F'},
-    {"0VK1&1", 'F'},
-    {"0VK1&F", 'F'},
-    {"0VK1&N", 'F'},
-    {"0VK1&S", 'F'},
-    {"0VK1&V", 'F'},
-    {"0VK1;", 'F'},
-    {"0VK1;C", 'F'},
-    {"0VK1;E", 'F'},
-    {"0VK1;T", 'F'},
-    {"0VK1B(", 'F'},
-    {"0VK1B1", 'F'},
-    {"0VK1BF", 'F'},
-    {"0VK1BN", 'F'},
-    {"0VK1BS", 'F'},
-    {"0VK1BV", 'F'},
-    {"0VK1C", 'F'},
-    {"0VK1E(", 'F'},
-    {"0VK1E1", 'F'},
-    {"0VK1EF", 'F'},
-    {"0VK1EK", 'F'},
-    {"0VK1EN", 'F'},
-    {"0VK1ES", 'F'},
-    {"0VK1EV", 'F'},
-    {"0VK1O(", 'F'},
-    {"0VK1OF", 'F'},
-    {"0VK1OS", 'F'},
-    {"0VK1OV", 'F'},
-    {"0VK1U(", 'F'},
-    {"0VK1UE", 'F'},
-    {"0VKF()", 'F'},
-    {"0VKF(1", 'F'},
-    {"0VKF(F", 'F'},
-    {"0VKF(N", 'F'},
-    {"0VKF(S", 'F'},
-    {"0VKF(V", 'F'},
-    {"0VKN", 'F'},
-    {"0VKN&(", 'F'},
-    {"0VKN&1", 'F'},
-    {"0VKN&F", 'F'},
-    {"0VKN&N", 'F'},
-    {"0VKN&S", 'F'},
-    {"0VKN&V", 'F'},
-    {"0VKN;", 'F'},
-    {"0VKN;C", 'F'},
-    {"0VKN;E", 'F'},
-    {"0VKN;T", 'F'},
-    {"0VKNB(", 'F'},
-    {"0VKNB1", 'F'},
-    {"0VKNBF", 'F'},
-    {"0VKNBN", 'F'},
-    {"0VKNBS", 'F'},
-    {"0VKNBV", 'F'},
-    {"0VKNC", 'F'},
-    {"0VKNE(", 'F'},
-    {"0VKNE1", 'F'},
-    {"0VKNEF", 'F'},
-    {"0VKNEN", 'F'},
-    {"0VKNES", 'F'},
-    {"0VKNEV", 'F'},
-    {"0VKNU(", 'F'},
-    {"0VKNUE", 'F'},
-    {"0VKS", 'F'},
-    {"0VKS&(", 'F'},
-    {"0VKS&1", 'F'},
-    {"0VKS&F", 'F'},
-    {"0VKS&N", 'F'},
-    {"0VKS&S", 'F'},
-    {"0VKS&V", 'F'},
-    {"0VKS;", 'F'},
-    {"0VKS;C", 'F'},
-    {"0VKS;E", 'F'},
-    {"0VKS;T", 'F'},
-    {"0VKSB(", 'F'},
-    {"0VKSB1", 'F'},
-    {"0VKSBF", 'F'},
-    {"0VKSBN", 'F'},
-    {"0VKSBS", 'F'},
-    {"0VKSBV", 'F'},
-    {"0VKSC", 'F'},
-    {"0VKSE(", 'F'},
-    {"0VKSE1", 'F'},
-    {"0VKSEF", 'F'},
-    {"0VKSEK", 'F'},
-    {"0VKSEN", 'F'},
-    {"0VKSES", 'F'},
-    {"0VKSEV", 'F'},
-    {"0VKSO(", 'F'},
-    {"0VKSO1", 'F'},
-    {"0VKSOF", 'F'},
-    {"0VKSON", 'F'},
-    {"0VKSOS", 'F'},
-    {"0VKSOV", 'F'},
-    {"0VKSU(", 'F'},
-    {"0VKSUE", 'F'},
-    {"0VKUE(", 'F'},
-    {"0VKUE1", 'F'},
-    {"0VKUEF", 'F'},
-    {"0VKUEK", 'F'},
-    {"0VKUEN", 'F'},
-    {"0VKUES", 'F'},
-    {"0VKUEV", 'F'},
-    {"0VKV", 'F'},
-    {"0VKV&(", 'F'},
-    {"0VKV&1", 'F'},
-    {"0VKV&F", 'F'},
-    {"0VKV&N", 'F'},
-    {"0VKV&S", 'F'},
-    {"0VKV&V", 'F'},
-    {"0VKV;", 'F'},
-    {"0VKV;C", 'F'},
-    {"0VKV;E", 'F'},
-    {"0VKV;T", 'F'},
-    {"0VKVB(", 'F'},
-    {"0VKVB1", 'F'},
-    {"0VKVBF", 'F'},
-    {"0VKVBN", 'F'},
-    {"0VKVBS", 'F'},
-    {"0VKVBV", 'F'},
-    {"0VKVC", 'F'},
-    {"0VKVE(", 'F'},
-    {"0VKVE1", 'F'},
-    {"0VKVEF", 'F'},
-    {"0VKVEK", 'F'},
-    {"0VKVEN", 'F'},
-    {"0VKVES", 'F'},
-    {"0VKVEV", 'F'},
-    {"0VKVO(", 'F'},
-    {"0VKVOF", 'F'},
-    {"0VKVOS", 'F'},
-    {"0VKVU(", 'F'},
-    {"0VKVUE", 'F'},
-    {"0VO(1&", 'F'},
-    {"0VO(1)", 'F'},
-    {"0VO(1,", 'F'},
-    {"0VO(1O", 'F'},
-    {"0VO(E(", 'F'},
-    {"0VO(E1", 'F'},
-    {"0VO(EE", 'F'},
-    {"0VO(EF", 'F'},
-    {"0VO(EK", 'F'},
-    {"0VO(EN", 'F'},
-    {"0VO(EO", 'F'},
-    {"0VO(ES", 'F'},
-    {"0VO(EV", 'F'},
-    {"0VO(F(", 'F'},
-    {"0VO(N&", 'F'},
-    {"0VO(N)", 'F'},
-    {"0VO(N,", 'F'},
-    {"0VO(NO", 'F'},
-    {"0VO(S&", 'F'},
-    {"0VO(S)", 'F'},
-    {"0VO(S,", 'F'},
-    {"0VO(SO", 'F'},
-    {"0VO(V&", 'F'},
-    {"0VO(V)", 'F'},
-    {"0VO(V,", 'F'},
-    {"0VO(VO", 'F'},
-    {"0VOF()", 'F'},
-    {"0VOF(1", 'F'},
-    {"0VOF(E", 'F'},
-    {"0VOF(F", 'F'},
-    {"0VOF(N", 'F'},
-    {"0VOF(S", 'F'},
-    {"0VOF(V", 'F'},
-    {"0VOK&(", 'F'},
-    {"0VOK&1", 'F'},
-    {"0VOK&F", 'F'},
-    {"0VOK&N", 'F'},
-    {"0VOK&S", 'F'},
-    {"0VOK&V", 'F'},
-    {"0VOK(1", 'F'},
-    {"0VOK(F", 'F'},
-    {"0VOK(N", 'F'},
-    {"0VOK(S", 'F'},
-    {"0VOK(V", 'F'},
-    {"0VOK1C", 'F'},
-    {"0VOK1O", 'F'},
-    {"0VOKF(", 'F'},
-    {"0VOKNC", 'F'},
-    {"0VOKO(", 'F'},
-    {"0VOKO1", 'F'},
-    {"0VOKOF", 'F'},
-    {"0VOKON", 'F'},
-    {"0VOKOS", 'F'},
-    {"0VOKOV", 'F'},
-    {"0VOKSC", 'F'},
-    {"0VOKSO", 'F'},
-    {"0VOKVC", 'F'},
-    {"0VOKVO", 'F'},
-    {"0VOS", 'F'},
-    {"0VOS&(", 'F'},
-    {"0VOS&1", 'F'},
-    {"0VOS&E", 'F'},
-    {"0VOS&F", 'F'},
-    {"0VOS&K", 'F'},
-    {"0VOS&N", 'F'},
-    {"0VOS&S", 'F'},
-    {"0VOS&U", 'F'},
-    {"0VOS&V", 'F'},
-    {"0VOS(E", 'F'},
-    {"0VOS(U", 'F'},
-    {"0VOS)&", 'F'},
-    {"0VOS),", 'F'},
-    {"0VOS);", 'F'},
-    {"0VOS)B", 'F'},
-    {"0VOS)C", 'F'},
-    {"0VOS)E", 'F'},
-    {"0VOS)F", 'F'},
-    {"0VOS)K", 'F'},
-    {"0VOS)O", 'F'},
-    {"0VOS)U", 'F'},
-    {"0VOS,(", 'F'},
-    {"0VOS,F", 'F'},
-    {"0VOS1(", 'F'},
-    {"0VOS1F", 'F'},
-    {"0VOS1N", 'F'},
-    {"0VOS1S", 'F'},
-    {"0VOS1U", 'F'},
-    {"0VOS1V", 'F'},
-    {"0VOS;", 'F'},
-    {"0VOS;C", 'F'},
-    {"0VOS;E", 'F'},
-    {"0VOS;N", 'F'},
-    {"0VOS;T", 'F'},
-    {"0VOSA(", 'F'},
-    {"0VOSAF", 'F'},
-    {"0VOSAS", 'F'},
-    {"0VOSAT", 'F'},
-    {"0VOSAV", 'F'},
-    {"0VOSB(", 'F'},
-    {"0VOSB1", 'F'},
-    {"0VOSBE", 'F'},
-    {"0VOSBF", 'F'},
-    {"0VOSBN", 'F'},
-    {"0VOSBS", 'F'},
-    {"0VOSBV", 'F'},
-    {"0VOSC", 'F'},
-    {"0VOSE(", 'F'},
-    {"0VOSE1", 'F'},
-    {"0VOSEF", 'F'},
-    {"0VOSEK", 'F'},
-    {"0VOSEN", 'F'},
-    {"0VOSEO", 'F'},
-    {"0VOSES", 'F'},
-    {"0VOSEU", 'F'},
-    {"0VOSEV", 'F'},
-    {"0VOSF(", 'F'},
-    {"0VOSK(", 'F'},
-    {"0VOSK)", 'F'},
-    {"0VOSK1", 'F'},
-    {"0VOSKB", 'F'},
-    {"0VOSKF", 'F'},
-    {"0VOSKN", 'F'},
-    {"0VOSKS", 'F'},
-    {"0VOSKU", 'F'},
-    {"0VOSKV", 'F'},
-    {"0VOST(", 'F'},
-    {"0VOST1", 'F'},
-    {"0VOSTE", 'F'},
-    {"0VOSTF", 'F'},
-    {"0VOSTN", 'F'},
-    {"0VOSTS", 'F'},
-    {"0VOSTT", 'F'},
-    {"0VOSTV", 'F'},
-    {"0VOSU", 'F'},
-    {"0VOSU(", 'F'},
-    {"0VOSU1", 'F'},
-    {"0VOSU;", 'F'},
-    {"0VOSUC", 'F'},
-    {"0VOSUE", 'F'},
-    {"0VOSUF", 'F'},
-    {"0VOSUK", 'F'},
-    {"0VOSUO", 'F'},
-    {"0VOSUS", 'F'},
-    {"0VOSUT", 'F'},
-    {"0VOSUV", 'F'},
-    {"0VOSV(", 'F'},
-    {"0VOSVF", 'F'},
-    {"0VOSVO", 'F'},
-    {"0VOSVS", 'F'},
-    {"0VOSVU", 'F'},
-    {"0VOU(E", 'F'},
-    {"0VOUEK", 'F'},
-    {"0VOUEN", 'F'},
-    {"0VT(1)", 'F'},
-    {"0VT(1O", 'F'},
-    {"0VT(F(", 'F'},
-    {"0VT(N)", 'F'},
-    {"0VT(NO", 'F'},
-    {"0VT(S)", 'F'},
-    {"0VT(SO", 'F'},
-    {"0VT(V)", 'F'},
-    {"0VT(VO", 'F'},
-    {"0VT1(F", 'F'},
-    {"0VT1O(", 'F'},
-    {"0VT1OF", 'F'},
-    {"0VT1OS", 'F'},
-    {"0VT1OV", 'F'},
-    {"0VTE(1", 'F'},
-    {"0VTE(F", 'F'},
-    {"0VTE(N", 'F'},
-    {"0VTE(S", 'F'},
-    {"0VTE(V", 'F'},
-    {"0VTE1N", 'F'},
-    {"0VTE1O", 'F'},
-    {"0VTEF(", 'F'},
-    {"0VTEK(", 'F'},
-    {"0VTEK1", 'F'},
-    {"0VTEKF", 'F'},
-    {"0VTEKN", 'F'},
-    {"0VTEKS", 'F'},
-    {"0VTEKV", 'F'},
-    {"0VTENN", 'F'},
-    {"0VTENO", 'F'},
-    {"0VTESN", 'F'},
-    {"0VTESO", 'F'},
-    {"0VTEVN", 'F'},
-    {"0VTEVO", 'F'},
-    {"0VTF()", 'F'},
-    {"0VTF(1", 'F'},
-    {"0VTF(F", 'F'},
-    {"0VTF(N", 'F'},
-    {"0VTF(S", 'F'},
-    {"0VTF(V", 'F'},
-    {"0VTN(1", 'F'},
-    {"0VTN(F", 'F'},
-    {"0VTN(S", 'F'},
-    {"0VTN(V", 'F'},
-    {"0VTN1C", 'F'},
-    {"0VTN1O", 'F'},
-    {"0VTN;E", 'F'},
-    {"0VTN;N", 'F'},
-    {"0VTN;T", 'F'},
-    {"0VTNE(", 'F'},
-    {"0VTNE1", 'F'},
-    {"0VTNEF", 'F'},
-    {"0VTNEN", 'F'},
-    {"0VTNES", 'F'},
-    {"0VTNEV", 'F'},
-    {"0VTNF(", 'F'},
-    {"0VTNKN", 'F'},
-    {"0VTNN:", 'F'},
-    {"0VTNNC", 'F'},
-    {"0VTNNO", 'F'},
-    {"0VTNO(", 'F'},
-    {"0VTNOF", 'F'},
-    {"0VTNOS", 'F'},
-    {"0VTNOV", 'F'},
-    {"0VTNSC", 'F'},
-    {"0VTNSO", 'F'},
-    {"0VTNT(", 'F'},
-    {"0VTNT1", 'F'},
-    {"0VTNTF", 'F'},
-    {"0VTNTN", 'F'},
-    {"0VTNTS", 'F'},
-    {"0VTNTV", 'F'},
-    {"0VTNVC", 'F'},
-    {"0VTNVO", 'F'},
-    {"0VTS(F", 'F'},
-    {"0VTSO(", 'F'},
-    {"0VTSO1", 'F'},
-    {"0VTSOF", 'F'},
-    {"0VTSON", 'F'},
-    {"0VTSOS", 'F'},
-    {"0VTSOV", 'F'},
-    {"0VTTNE", 'F'},
-    {"0VTTNK", 'F'},
-    {"0VTTNN", 'F'},
-    {"0VTTNT", 'F'},
-    {"0VTV(1", 'F'},
-    {"0VTV(F", 'F'},
-    {"0VTVO(", 'F'},
-    {"0VTVOF", 'F'},
-    {"0VTVOS", 'F'},
-    {"0VU", 'F'},
-    {"0VU(1)", 'F'},
-    {"0VU(1O", 'F'},
-    {"0VU(E(", 'F'},
-    {"0VU(E1", 'F'},
-    {"0VU(EF", 'F'},
-    {"0VU(EK", 'F'},
-    {"0VU(EN", 'F'},
-    {"0VU(ES", 'F'},
-    {"0VU(EV", 'F'},
-    {"0VU(F(", 'F'},
-    {"0VU(N)", 'F'},
-    {"0VU(NO", 'F'},
-    {"0VU(S)", 'F'},
-    {"0VU(SO", 'F'},
-    {"0VU(V)", 'F'},
-    {"0VU(VO", 'F'},
-    {"0VU1,(", 'F'},
-    {"0VU1,F", 'F'},
-    {"0VU1C", 'F'},
-    {"0VU1O(", 'F'},
-    {"0VU1OF", 'F'},
-    {"0VU1OS", 'F'},
-    {"0VU1OV", 'F'},
-    {"0VU;", 'F'},
-    {"0VU;C", 'F'},
-    {"0VUC", 'F'},
-    {"0VUE", 'F'},
-    {"0VUE(1", 'F'},
-    {"0VUE(E", 'F'},
-    {"0VUE(F", 'F'},
-    {"0VUE(N", 'F'},
-    {"0VUE(O", 'F'},
-    {"0VUE(S", 'F'},
-    {"0VUE(V", 'F'},
-    {"0VUE1", 'F'},
-    {"0VUE1&", 'F'},
-    {"0VUE1(", 'F'},
-    {"0VUE1)", 'F'},
-    {"0VUE1,", 'F'},
-    {"0VUE1;", 'F'},
-    {"0VUE1B", 'F'},
-    {"0VUE1C", 'F'},
-    {"0VUE1F", 'F'},
-    {"0VUE1K", 'F'},
-    {"0VUE1N", 'F'},
-    {"0VUE1O", 'F'},
-    {"0VUE1S", 'F'},
-    {"0VUE1U", 'F'},
-    {"0VUE1V", 'F'},
-    {"0VUE;", 'F'},
-    {"0VUE;C", 'F'},
-    {"0VUEC", 'F'},
-    {"0VUEF", 'F'},
-    {"0VUEF(", 'F'},
-    {"0VUEF,", 'F'},
-    {"0VUEF;", 'F'},
-    {"0VUEFC", 'F'},
-    {"0VUEK", 'F'},
-    {"0VUEK(", 'F'},
-    {"0VUEK1", 'F'},
-    {"0VUEK;", 'F'},
-    {"0VUEKC", 'F'},
-    {"0VUEKF", 'F'},
-    {"0VUEKN", 'F'},
-    {"0VUEKO", 'F'},
-    {"0VUEKS", 'F'},
-    {"0VUEKV", 'F'},
-    {"0VUEN", 'F'},
-    {"0VUEN&", 'F'},
-    {"0VUEN(", 'F'},
-    {"0VUEN)", 'F'},
-    {"0VUEN,", 'F'},
-    {"0VUEN1", 'F'},
-    {"0VUEN;", 'F'},
-    {"0VUENB", 'F'},
-    {"0VUENC", 'F'},
-    {"0VUENF", 'F'},
-    {"0VUENK", 'F'},
-    {"0VUENO", 'F'},
-    {"0VUENS", 'F'},
-    {"0VUENU", 'F'},
-    {"0VUEOK", 'F'},
-    {"0VUEON", 'F'},
-    {"0VUES", 'F'},
-    {"0VUES&", 'F'},
-    {"0VUES(", 'F'},
-    {"0VUES)", 'F'},
-    {"0VUES,", 'F'},
-    {"0VUES1", 'F'},
-    {"0VUES;", 'F'},
-    {"0VUESB", 'F'},
-    {"0VUESC", 'F'},
-    {"0VUESF", 'F'},
-    {"0VUESK", 'F'},
-    {"0VUESO", 'F'},
-    {"0VUESU", 'F'},
-    {"0VUESV", 'F'},
-    {"0VUEV", 'F'},
-    {"0VUEV&", 'F'},
-    {"0VUEV(", 'F'},
-    {"0VUEV)", 'F'},
-    {"0VUEV,", 'F'},
-    {"0VUEV;", 'F'},
-    {"0VUEVB", 'F'},
-    {"0VUEVC", 'F'},
-    {"0VUEVF", 'F'},
-    {"0VUEVK", 'F'},
-    {"0VUEVN", 'F'},
-    {"0VUEVO", 'F'},
-    {"0VUEVS", 'F'},
-    {"0VUEVU", 'F'},
-    {"0VUF()", 'F'},
-    {"0VUF(1", 'F'},
-    {"0VUF(F", 'F'},
-    {"0VUF(N", 'F'},
-    {"0VUF(S", 'F'},
-    {"0VUF(V", 'F'},
-    {"0VUK(E", 'F'},
-    {"0VUO(E", 'F'},
-    {"0VUON(", 'F'},
-    {"0VUON1", 'F'},
-    {"0VUONF", 'F'},
-    {"0VUONS", 'F'},
-    {"0VUS,(", 'F'},
-    {"0VUS,F", 'F'},
-    {"0VUSC", 'F'},
-    {"0VUSO(", 'F'},
-    {"0VUSO1", 'F'},
-    {"0VUSOF", 'F'},
-    {"0VUSON", 'F'},
-    {"0VUSOS", 'F'},
-    {"0VUSOV", 'F'},
-    {"0VUTN(", 'F'},
-    {"0VUTN1", 'F'},
-    {"0VUTNF", 'F'},
-    {"0VUTNN", 'F'},
-    {"0VUTNS", 'F'},
-    {"0VUTNV", 'F'},
-    {"0VUV,(", 'F'},
-    {"0VUV,F", 'F'},
-    {"0VUVC", 'F'},
-    {"0VUVO(", 'F'},
-    {"0VUVOF", 'F'},
-    {"0VUVOS", 'F'},
-    {"0X", 'F'},
-    {"::", 'o'},
-    {":=", 'o'},
-    {"<<", 'o'},
-    {"<=", 'o'},
-    {"<>", 'o'},
-    {"<@", 'o'},
-    {">=", 'o'},
-    {">>", 'o'},
-    {"@>", 'o'},
-    {"ABORT", 'k'},
-    {"ABS", 'f'},
-    {"ACCESSIBLE", 'k'},
-    {"ACOS", 'f'},
-    {"ADDDATE", 'f'},
-    {"ADDTIME", 'f'},
-    {"AES_DECRYPT", 'f'},
-    {"AES_ENCRYPT", 'f'},
-    {"AGAINST", 'k'},
-    {"AGE", 'f'},
-    {"ALL_USERS", 'k'},
-    {"ALTER", 'k'},
-    {"ALTER DOMAIN", 'k'},
-    {"ALTER TABLE", 'k'},
-    {"ANALYZE", 'k'},
-    {"AND", '&'},
-    {"ANY", 'f'},
-    {"ANYARRAY", 't'},
-    {"ANYELEMENT", 't'},
-    {"ANYNONARRY", 't'},
-    {"APPLOCK_MODE", 'f'},
-    {"APPLOCK_TEST", 'f'},
-    {"APP_NAME", 'f'},
-    {"ARRAY_AGG", 'f'},
-    {"ARRAY_CAT", 'f'},
-    {"ARRAY_DIM", 'f'},
-    {"ARRAY_FILL", 'f'},
-    {"ARRAY_LENGTH", 'f'},
-    {"ARRAY_LOWER", 'f'},
-    {"ARRAY_NDIMS", 'f'},
-    {"ARRAY_PREPEND", 'f'},
-    {"ARRAY_TO_JSON", 'f'},
-    {"ARRAY_TO_STRING", 'f'},
-    {"ARRAY_UPPER", 'f'},
-    {"AS", 'k'},
-    {"ASC", 'k'},
-    {"ASCII", 'f'},
-    {"ASENSITIVE", 'k'},
-    {"ASIN", 'f'},
-    {"ASSEMBLYPROPERTY", 'f'},
-    {"ASYMKEY_ID", 'f'},
-    {"AT TIME", 'n'},
-    {"AT TIME ZONE", 'k'},
-    {"ATAN", 'f'},
-    {"ATAN2", 'f'},
-    {"AUTOINCREMENT", 'k'},
-    {"AVG", 'f'},
-    {"BEFORE", 'k'},
-    {"BEGIN", 'T'},
-    {"BEGIN DECLARE", 'T'},
-    {"BEGIN GOTO", 'T'},
-    {"BEGIN TRY", 'T'},
-    {"BEGIN TRY DECLARE", 'T'},
-    {"BENCHMARK", 'f'},
-    {"BETWEEN", 'o'},
-    {"BIGINT", 't'},
-    {"BIGSERIAL", 't'},
-    {"BIN", 'f'},
-    {"BINARY", 't'},
-    {"BINARY_DOUBLE_INFINITY", '1'},
-    {"BINARY_DOUBLE_NAN", '1'},
-    {"BINARY_FLOAT_INFINITY", '1'},
-    {"BINARY_FLOAT_NAN", '1'},
-    {"BINBINARY", 'f'},
-    {"BIT_AND", 'f'},
-    {"BIT_COUNT", 'f'},
-    {"BIT_LENGTH", 'f'},
-    {"BIT_OR", 'f'},
-    {"BIT_XOR", 'f'},
-    {"BLOB", 'k'},
-    {"BOOLEAN", 't'},
-    {"BOOL_AND", 'f'},
-    {"BOOL_OR", 'f'},
-    {"BOTH", 'k'},
-    {"BTRIM", 'f'},
-    {"BY", 'n'},
-    {"BYTEA", 't'},
-    {"CALL", 'T'},
-    {"CASCADE", 'k'},
-    {"CASE", 'E'},
-    {"CAST", 'f'},
-    {"CBOOL", 'f'},
-    {"CBRT", 'f'},
-    {"CBYTE", 'f'},
-    {"CCUR", 'f'},
-    {"CDATE", 'f'},
-    {"CDBL", 'f'},
-    {"CEIL", 'f'},
-    {"CEILING", 'f'},
-    {"CERTENCODED", 'f'},
-    {"CERTPRIVATEKEY", 'f'},
-    {"CERT_ID", 'f'},
-    {"CERT_PROPERTY", 'f'},
-    {"CHANGE", 'k'},
-    {"CHANGES", 'f'},
-    {"CHAR", 'f'},
-    {"CHARACTER", 't'},
-    {"CHARACTER VARYING", 't'},
-    {"CHARACTER_LENGTH", 'f'},
-    {"CHARINDEX", 'f'},
-    {"CHARSET", 'f'},
-    {"CHAR_LENGTH", 'f'},
-    {"CHDIR", 'f'},
-    {"CHDRIVE", 'f'},
-    {"CHECK", 'n'},
-    {"CHECKSUM_AGG", 'f'},
-    {"CHOOSE", 'f'},
-    {"CHR", 'f'},
-    {"CINT", 'f'},
-    {"CLNG", 'f'},
-    {"CLOCK_TIMESTAMP", 'f'},
-    {"COALESCE", 'f'},
-    {"COERCIBILITY", 'f'},
-    {"COLLATE", 'A'},
-    {"COLLATION", 'f'},
-    {"COLLATIONPROPERTY", 'f'},
-    {"COLUMN", 'k'},
-    {"COLUMNPROPERTY", 'f'},
-    {"COLUMNS_UPDATED", 'f'},
-    {"COL_LENGTH", 'f'},
-    {"COL_NAME", 'f'},
-    {"COMPRESS", 'f'},
-    {"CONCAT", 'f'},
-    {"CONCAT_WS", 'f'},
-    {"CONDITION", 'k'},
-    {"CONNECTION_ID", 'f'},
-    {"CONSTRAINT", 'k'},
-    {"CONTINUE", 'k'},
-    {"CONV", 'f'},
-    {"CONVERT", 'f'},
-    {"CONVERT_FROM", 'f'},
-    {"CONVERT_TO", 'f'},
-    {"CONVERT_TZ", 'f'},
-    {"COS", 'f'},
-    {"COT", 'f'},
-    {"COUNT", 'f'},
-    {"COUNT_BIG", 'k'},
-    {"CRC32", 'f'},
-    {"CREATE", 'E'},
-    {"CREATE OR", 'n'},
-    {"CREATE OR REPLACE", 'T'},
-    {"CROSS", 'n'},
-    {"CROSS JOIN", 'k'},
-    {"CSNG", 'f'},
-    {"CSTRING", 't'},
-    {"CTXSYS.DRITHSX.SN", 'f'},
-    {"CUME_DIST", 'f'},
-    {"CURDATE", 'f'},
-    {"CURDIR", 'f'},
-    {"CURRENT DATE", 'v'},
-    {"CURRENT DEGREE", 'v'},
-    {"CURRENT FUNCTION", 'v'},
-    {"CURRENT FUNCTION PATH", 'v'},
-    {"CURRENT PATH", 'v'},
-    {"CURRENT SCHEMA", 'v'},
-    {"CURRENT SERVER", 'v'},
-    {"CURRENT TIME", 'v'},
-    {"CURRENT TIMEZONE", 'v'},
-    {"CURRENTUSER", 'f'},
-    {"CURRENT_DATABASE", 'f'},
-    {"CURRENT_DATE", 'v'},
-    {"CURRENT_PATH", 'v'},
-    {"CURRENT_QUERY", 'f'},
-    {"CURRENT_SCHEMA", 'f'},
-    {"CURRENT_SCHEMAS", 'f'},
-    {"CURRENT_SERVER", 'v'},
-    {"CURRENT_SETTING", 'f'},
-    {"CURRENT_TIME", 'v'},
-    {"CURRENT_TIMESTAMP", 'v'},
-    {"CURRENT_TIMEZONE", 'v'},
-    {"CURRENT_USER", 'v'},
-    {"CURRVAL", 'f'},
-    {"CURSOR", 'k'},
-    {"CURSOR_STATUS", 'f'},
-    {"CURTIME", 'f'},
-    {"CVAR", 'f'},
-    {"DATABASE", 'n'},
-    {"DATABASEPROPERTYEX", 'f'},
-    {"DATABASES", 'k'},
-    {"DATABASE_PRINCIPAL_ID", 'f'},
-    {"DATALENGTH", 'f'},
-    {"DATE", 'f'},
-    {"DATEADD", 'f'},
-    {"DATEDIFF", 'f'},
-    {"DATEFROMPARTS", 'f'},
-    {"DATENAME", 'f'},
-    {"DATEPART", 'f'},
-    {"DATESERIAL", 'f'},
-    {"DATETIME2FROMPARTS", 'f'},
-    {"DATETIMEFROMPARTS", 'f'},
-    {"DATETIMEOFFSETFROMPARTS", 'f'},
-    {"DATEVALUE", 'f'},
-    {"DATE_ADD", 'f'},
-    {"DATE_FORMAT", 'f'},
-    {"DATE_PART", 'f'},
-    {"DATE_SUB", 'f'},
-    {"DATE_TRUNC", 'f'},
-    {"DAVG", 'f'},
-    {"DAY", 'f'},
-    {"DAYNAME", 'f'},
-    {"DAYOFMONTH", 'f'},
-    {"DAYOFWEEK", 'f'},
-    {"DAYOFYEAR", 'f'},
-    {"DAY_HOUR", 'k'},
-    {"DAY_MICROSECOND", 'k'},
-    {"DAY_MINUTE", 'k'},
-    {"DAY_SECOND", 'k'},
-    {"DBMS_LOCK.SLEEP", 'f'},
-    {"DBMS_PIPE.RECEIVE_MESSAGE", 'f'},
-    {"DBMS_UTILITY.SQLID_TO_SQLHASH", 'f'},
-    {"DB_ID", 'f'},
-    {"DB_NAME", 'f'},
-    {"DCOUNT", 'f'},
-    {"DEC", 'k'},
-    {"DECIMAL", 't'},
-    {"DECLARE", 'T'},
-    {"DECODE", 'f'},
-    {"DECRYPTBYASMKEY", 'f'},
-    {"DECRYPTBYCERT", 'f'},
-    {"DECRYPTBYKEY", 'f'},
-    {"DECRYPTBYKEYAUTOCERT", 'f'},
-    {"DECRYPTBYPASSPHRASE", 'f'},
-    {"DEFAULT", 'k'},
-    {"DEGREES", 'f'},
-    {"DELAY", 'k'},
-    {"DELAYED", 'k'},
-    {"DELETE", 'T'},
-    {"DENSE_RANK", 'f'},
-    {"DESC", 'k'},
-    {"DESCRIBE", 'k'},
-    {"DES_DECRYPT", 'f'},
-    {"DES_ENCRYPT", 'f'},
-    {"DETERMINISTIC", 'k'},
-    {"DFIRST", 'f'},
-    {"DIFFERENCE", 'f'},
-    {"DISTINCT", 'k'},
-    {"DISTINCTROW", 'k'},
-    {"DIV", 'o'},
-    {"DLAST", 'f'},
-    {"DLOOKUP", 'f'},
-    {"DMAX", 'f'},
-    {"DMIN", 'f'},
-    {"DO", 'n'},
-    {"DOUBLE", 't'},
-    {"DOUBLE PRECISION", 't'},
-    {"DROP", 'T'},
-    {"DSUM", 'f'},
-    {"DUAL", 'n'},
-    {"EACH", 'k'},
-    {"ELSE", 'k'},
-    {"ELSEIF", 'k'},
-    {"ELT", 'f'},
-    {"ENCLOSED", 'k'},
-    {"ENCODE", 'f'},
-    {"ENCRYPT", 'f'},
-    {"ENCRYPTBYASMKEY", 'f'},
-    {"ENCRYPTBYCERT", 'f'},
-    {"ENCRYPTBYKEY", 'f'},
-    {"ENCRYPTBYPASSPHRASE", 'f'},
-    {"ENUM_FIRST", 'f'},
-    {"ENUM_LAST", 'f'},
-    {"ENUM_RANGE", 'f'},
-    {"EOMONTH", 'f'},
-    {"EQV", 'o'},
-    {"ESCAPED", 'k'},
-    {"EVENTDATA", 'f'},
-    {"EXCEPT", 'U'},
-    {"EXEC", 'T'},
-    {"EXECUTE", 'T'},
-    {"EXECUTE AS", 'E'},
-    {"EXECUTE AS LOGIN", 'E'},
-    {"EXISTS", 'f'},
-    {"EXIT", 'k'},
-    {"EXP", 'f'},
-    {"EXPLAIN", 'k'},
-    {"EXPORT_SET", 'f'},
-    {"EXTRACT", 'f'},
-    {"EXTRACTVALUE", 'f'},
-    {"EXTRACT_VALUE", 'f'},
-    {"FALSE", '1'},
-    {"FETCH", 'k'},
-    {"FIELD", 'f'},
-    {"FILEDATETIME", 'f'},
-    {"FILEGROUPPROPERTY", 'f'},
-    {"FILEGROUP_ID", 'f'},
-    {"FILEGROUP_NAME", 'f'},
-    {"FILELEN", 'f'},
-    {"FILEPROPERTY", 'f'},
-    {"FILETOBLOB", 'f'},
-    {"FILETOCLOB", 'f'},
-    {"FILE_ID", 'f'},
-    {"FILE_IDEX", 'f'},
-    {"FILE_NAME", 'f'},
-    {"FIND_IN_SET", 'f'},
-    {"FIRST_VALUE", 'f'},
-    {"FLOAT", 't'},
-    {"FLOAT4", 't'},
-    {"FLOAT8", 't'},
-    {"FLOOR", 'f'},
-    {"FN_VIRTUALFILESTATS", 'f'},
-    {"FOR", 'n'},
-    {"FOR UPDATE", 'k'},
-    {"FOR UPDATE NOWAIT", 'k'},
-    {"FOR UPDATE OF", 'k'},
-    {"FOR UPDATE SKIP", 'k'},
-    {"FOR UPDATE SKIP LOCKED", 'k'},
-    {"FOR UPDATE WAIT", 'k'},
-    {"FORCE", 'k'},
-    {"FOREIGN", 'k'},
-    {"FORMAT", 'f'},
-    {"FOUND_ROWS", 'f'},
-    {"FROM", 'k'},
-    {"FROM_BASE64", 'f'},
-    {"FROM_DAYS", 'f'},
-    {"FROM_UNIXTIME", 'f'},
-    {"FULL JOIN", 'k'},
-    {"FULL OUTER", 'k'},
-    {"FULL OUTER JOIN", 'k'},
-    {"FULLTEXT", 'k'},
-    {"FULLTEXTCATALOGPROPERTY", 'f'},
-    {"FULLTEXTSERVICEPROPERTY", 'f'},
-    {"FUNCTION", 'k'},
-    {"GENERATE_SERIES", 'f'},
-    {"GENERATE_SUBSCRIPTS", 'f'},
-    {"GETATTR", 'f'},
-    {"GETDATE", 'f'},
-    {"GETUTCDATE", 'f'},
-    {"GET_BIT", 'f'},
-    {"GET_BYTE", 'f'},
-    {"GET_FORMAT", 'f'},
-    {"GET_LOCK", 'f'},
-    {"GO", 'T'},
-    {"GOTO", 'T'},
-    {"GRANT", 'k'},
-    {"GREATEST", 'f'},
-    {"GROUP", 'n'},
-    {"GROUP BY", 'B'},
-    {"GROUPING", 'f'},
-    {"GROUPING_ID", 'f'},
-    {"GROUP_CONCAT", 'f'},
-    {"HANDLER", 'T'},
-    {"HASHBYTES", 'f'},
-    {"HAS_PERMS_BY_NAME", 'f'},
-    {"HAVING", 'B'},
-    {"HEX", 'f'},
-    {"HIGH_PRIORITY", 'k'},
-    {"HOST_NAME", 'f'},
-    {"HOUR", 'f'},
-    {"HOUR_MICROSECOND", 'k'},
-    {"HOUR_MINUTE", 'k'},
-    {"HOUR_SECOND", 'k'},
-    {"IDENTIFY", 'f'},
-    {"IDENT_CURRENT", 'f'},
-    {"IDENT_INCR", 'f'},
-    {"IDENT_SEED", 'f'},
-    {"IF", 'f'},
-    {"IF EXISTS", 'f'},
-    {"IF NOT", 'f'},
-    {"IF NOT EXISTS", 'f'},
-    {"IFF", 'f'},
-    {"IFNULL", 'f'},
-    {"IGNORE", 'k'},
-    {"IIF", 'f'},
-    {"IN", 'k'},
-    {"IN BOOLEAN", 'n'},
-    {"IN BOOLEAN MODE", 'k'},
-    {"INDEX", 'k'},
-    {"INDEXKEY_PROPERTY", 'f'},
-    {"INDEXPROPERTY", 'f'},
-    {"INDEX_COL", 'f'},
-    {"INET_ATON", 'f'},
-    {"INET_NTOA", 'f'},
-    {"INFILE", 'k'},
-    {"INITCAP", 'f'},
-    {"INNER", 'k'},
-    {"INNER JOIN", 'k'},
-    {"INOUT", 'k'},
-    {"INSENSITIVE", 'k'},
-    {"INSERT", 'E'},
-    {"INSERT DELAYED", 'E'},
-    {"INSERT DELAYED INTO", 'T'},
-    {"INSERT HIGH_PRIORITY", 'E'},
-    {"INSERT HIGH_PRIORITY INTO", 'T'},
-    {"INSERT IGNORE", 'E'},
-    {"INSERT IGNORE INTO", 'T'},
-    {"INSERT INTO", 'T'},
-    {"INSERT LOW_PRIORITY", 'E'},
-    {"INSERT LOW_PRIORITY INTO", 'T'},
-    {"INSTR", 'f'},
-    {"INSTRREV", 'f'},
-    {"INT", 't'},
-    {"INT1", 't'},
-    {"INT2", 't'},
-    {"INT3", 't'},
-    {"INT4", 't'},
-    {"INT8", 't'},
-    {"INTEGER", 't'},
-    {"INTERSECT", 'U'},
-    {"INTERSECT ALL", 'U'},
-    {"INTERVAL", 'k'},
-    {"INTO", 'k'},
-    {"INTO DUMPFILE", 'k'},
-    {"INTO OUTFILE", 'k'},
-    {"IS", 'o'},
-    {"IS DISTINCT", 'n'},
-    {"IS DISTINCT FROM", 'o'},
-    {"IS NOT", 'o'},
-    {"IS NOT DISTINCT", 'n'},
-    {"IS NOT DISTINCT FROM", 'o'},
-    {"ISDATE", 'f'},
-    {"ISEMPTY", 'f'},
-    {"ISFINITE", 'f'},
-    {"ISNULL", 'f'},
-    {"ISNUMERIC", 'f'},
-    {"IS_FREE_LOCK", 'f'},
-    {"IS_MEMBER", 'f'},
-    {"IS_OBJECTSIGNED", 'f'},
-    {"IS_ROLEMEMBER", 'f'},
-    {"IS_SRVROLEMEMBER", 'f'},
-    {"IS_USED_LOCK", 'f'},
-    {"ITERATE", 'k'},
-    {"JOIN", 'k'},
-    {"JSON_KEYS", 'f'},
-    {"JULIANDAY", 'f'},
-    {"JUSTIFY_DAYS", 'f'},
-    {"JUSTIFY_HOURS", 'f'},
-    {"JUSTIFY_INTERVAL", 'f'},
-    {"KEYS", 'k'},
-    {"KEY_GUID", 'f'},
-    {"KEY_ID", 'f'},
-    {"KILL", 'k'},
-    {"LAG", 'f'},
-    {"LASTVAL", 'f'},
-    {"LAST_INSERT_ID", 'f'},
-    {"LAST_INSERT_ROWID", 'f'},
-    {"LAST_VALUE", 'f'},
-    {"LCASE", 'f'},
-    {"LEAD", 'f'},
-    {"LEADING", 'k'},
-    {"LEAST", 'f'},
-    {"LEAVE", 'k'},
-    {"LEFT", 'f'},
-    {"LEFT JOIN", 'k'},
-    {"LEFT OUTER", 'k'},
-    {"LEFT OUTER JOIN", 'k'},
-    {"LENGTH", 'f'},
-    {"LIKE", 'o'},
-    {"LIMIT", 'B'},
-    {"LINEAR", 'k'},
-    {"LINES", 'k'},
-    {"LN", 'f'},
-    {"LOAD", 'k'},
-    {"LOAD DATA", 'T'},
-    {"LOAD XML", 'T'},
-    {"LOAD_EXTENSION", 'f'},
-    {"LOAD_FILE", 'f'},
-    {"LOCALTIME", 'v'},
-    {"LOCALTIMESTAMP", 'v'},
-    {"LOCATE", 'f'},
-    {"LOCK", 'n'},
-    {"LOCK IN", 'n'},
-    {"LOCK IN SHARE", 'n'},
-    {"LOCK IN SHARE MODE", 'k'},
-    {"LOCK TABLE", 'k'},
-    {"LOCK TABLES", 'k'},
-    {"LOG", 'f'},
-    {"LOG10", 'f'},
-    {"LOG2", 'f'},
-    {"LONGBLOB", 'k'},
-    {"LONGTEXT", 'k'},
-    {"LOOP", 'k'},
-    {"LOWER", 'f'},
-    {"LOWER_INC", 'f'},
-    {"LOWER_INF", 'f'},
-    {"LOW_PRIORITY", 'k'},
-    {"LPAD", 'f'},
-    {"LTRIM", 'f'},
-    {"MAKEDATE", 'f'},
-    {"MAKE_SET", 'f'},
-    {"MASKLEN", 'f'},
-    {"MASTER_BIND", 'k'},
-    {"MASTER_POS_WAIT", 'f'},
-    {"MASTER_SSL_VERIFY_SERVER_CERT", 'k'},
-    {"MATCH", 'k'},
-    {"MAX", 'f'},
-    {"MAXVALUE", 'k'},
-    {"MD5", 'f'},
-    {"MEDIUMBLOB", 'k'},
-    {"MEDIUMINT", 'k'},
-    {"MEDIUMTEXT", 'k'},
-    {"MERGE", 'k'},
-    {"MICROSECOND", 'f'},
-    {"MID", 'f'},
-    {"MIDDLEINT", 'k'},
-    {"MIN", 'f'},
-    {"MINUTE", 'f'},
-    {"MINUTE_MICROSECOND", 'k'},
-    {"MINUTE_SECOND", 'k'},
-    {"MKDIR", 'f'},
-    {"MOD", 'o'},
-    {"MODE", 'n'},
-    {"MODIFIES", 'k'},
-    {"MONEY", 't'},
-    {"MONTH", 'f'},
-    {"MONTHNAME", 'f'},
-    {"NAME_CONST", 'f'},
-    {"NATURAL", 'n'},
-    {"NATURAL FULL", 'k'},
-    {"NATURAL FULL OUTER JOIN", 'k'},
-    {"NATURAL INNER", 'k'},
-    {"NATURAL JOIN", 'k'},
-    {"NATURAL LEFT", 'k'},
-    {"NATURAL LEFT OUTER", 'k'},
-    {"NATURAL LEFT OUTER JOIN", 'k'},
-    {"NATURAL OUTER", 'k'},
-    {"NATURAL RIGHT", 'k'},
-    {"NATURAL RIGHT OUTER JOIN", 'k'},
-    {"NETMASK", 'f'},
-    {"NEXT VALUE", 'n'},
-    {"NEXT VALUE FOR", 'k'},
-    {"NEXTVAL", 'f'},
-    {"NOT", 'o'},
-    {"NOT BETWEEN", 'o'},
-    {"NOT IN", 'k'},
-    {"NOT LIKE", 'o'},
-    {"NOT REGEXP", 'o'},
-    {"NOT RLIKE", 'o'},
-    {"NOT SIMILAR", 'o'},
-    {"NOT SIMILAR TO", 'o'},
-    {"NOTNULL", 'k'},
-    {"NOW", 'f'},
-    {"NOWAIT", 'k'},
-    {"NO_WRITE_TO_BINLOG", 'k'},
-    {"NTH_VALUE", 'f'},
-    {"NTILE", 'f'},
-    {"NULL", 'v'},
-    {"NULLIF", 'f'},
-    {"NUMERIC", 't'},
-    {"NZ", 'f'},
-    {"OBJECTPROPERTY", 'f'},
-    {"OBJECTPROPERTYEX", 'f'},
-    {"OBJECT_DEFINITION", 'f'},
-    {"OBJECT_ID", 'f'},
-    {"OBJECT_NAME", 'f'},
-    {"OBJECT_SCHEMA_NAME", 'f'},
-    {"OCT", 'f'},
-    {"OCTET_LENGTH", 'f'},
-    {"OFFSET", 'k'},
-    {"OID", 't'},
-    {"OLD_PASSWORD", 'f'},
-    {"ONE_SHOT", 'k'},
-    {"OPEN", 'k'},
-    {"OPENDATASOURCE", 'f'},
-    {"OPENQUERY", 'f'},
-    {"OPENROWSET", 'f'},
-    {"OPENXML", 'f'},
-    {"OPTIMIZE", 'k'},
-    {"OPTION", 'k'},
-    {"OPTIONALLY", 'k'},
-    {"OR", '&'},
-    {"ORD", 'f'},
-    {"ORDER", 'n'},
-    {"ORDER BY", 'B'},
-    {"ORIGINAL_DB_NAME", 'f'},
-    {"ORIGINAL_LOGIN", 'f'},
-    {"OUT", 'n'},
-    {"OUTER", 'n'},
-    {"OUTFILE", 'k'},
-    {"OVERLAPS", 'f'},
-    {"OVERLAY", 'f'},
-    {"OWN3D", 'k'},
-    {"OWN3D BY", 'B'},
-    {"PARSENAME", 'f'},
-    {"PARTITION", 'k'},
-    {"PARTITION BY", 'B'},
-    {"PASSWORD", 'n'},
-    {"PATHINDEX", 'f'},
-    {"PATINDEX", 'f'},
-    {"PERCENTILE_COUNT", 'f'},
-    {"PERCENTILE_DISC", 'f'},
-    {"PERCENTILE_RANK", 'f'},
-    {"PERCENT_RANK", 'f'},
-    {"PERIOD_ADD", 'f'},
-    {"PERIOD_DIFF", 'f'},
-    {"PERMISSIONS", 'f'},
-    {"PG_ADVISORY_LOCK", 'f'},
-    {"PG_BACKEND_PID", 'f'},
-    {"PG_CANCEL_BACKEND", 'f'},
-    {"PG_CLIENT_ENCODING", 'f'},
-    {"PG_CONF_LOAD_TIME", 'f'},
-    {"PG_CREATE_RESTORE_POINT", 'f'},
-    {"PG_HAS_ROLE", 'f'},
-    {"PG_IS_IN_RECOVERY", 'f'},
-    {"PG_IS_OTHER_TEMP_SCHEMA", 'f'},
-    {"PG_LISTENING_CHANNELS", 'f'},
-    {"PG_LS_DIR", 'f'},
-    {"PG_MY_TEMP_SCHEMA", 'f'},
-    {"PG_POSTMASTER_START_TIME", 'f'},
-    {"PG_READ_BINARY_FILE", 'f'},
-    {"PG_READ_FILE", 'f'},
-    {"PG_RELOAD_CONF", 'f'},
-    {"PG_ROTATE_LOGFILE", 'f'},
-    {"PG_SLEEP", 'f'},
-    {"PG_START_BACKUP", 'f'},
-    {"PG_STAT_FILE", 'f'},
-    {"PG_STOP_BACKUP", 'f'},
-    {"PG_SWITCH_XLOG", 'f'},
-    {"PG_TERMINATE_BACKEND", 'f'},
-    {"PG_TRIGGER_DEPTH", 'f'},
-    {"PI", 'f'},
-    {"POSITION", 'f'},
-    {"POW", 'f'},
-    {"POWER", 'f'},
-    {"PRECISION", 'k'},
-    {"PREVIOUS VALUE", 'n'},
-    {"PREVIOUS VALUE FOR", 'k'},
-    {"PRIMARY", 'k'},
-    {"PRINT", 'T'},
-    {"PROCEDURE", 'k'},
-    {"PROCEDURE ANALYSE", 'f'},
-    {"PUBLISHINGSERVERNAME", 'f'},
-    {"PURGE", 'k'},
-    {"PWDCOMPARE", 'f'},
-    {"PWDENCRYPT", 'f'},
-    {"QUARTER", 'f'},
-    {"QUOTE", 'f'},
-    {"QUOTENAME", 'f'},
-    {"QUOTE_IDENT", 'f'},
-    {"QUOTE_LITERAL", 'f'},
-    {"QUOTE_NULLABLE", 'f'},
-    {"RADIANS", 'f'},
-    {"RAISEERROR", 'E'},
-    {"RAND", 'f'},
-    {"RANDOM", 'f'},
-    {"RANDOMBLOB", 'f'},
-    {"RANGE", 'k'},
-    {"RANK", 'f'},
-    {"READ", 'k'},
-    {"READ WRITE", 'k'},
-    {"READS", 'k'},
-    {"READ_WRITE", 'k'},
-    {"REAL", 't'},
-    {"REFERENCES", 'k'},
-    {"REGCLASS", 't'},
-    {"REGCONFIG", 't'},
-    {"REGDICTIONARY", 't'},
-    {"REGEXP", 'o'},
-    {"REGEXP_INSTR", 'f'},
-    {"REGEXP_MATCHES", 'f'},
-    {"REGEXP_REPLACE", 'f'},
-    {"REGEXP_SPLIT_TO_ARRAY", 'f'},
-    {"REGEXP_SPLIT_TO_TABLE", 'f'},
-    {"REGEXP_SUBSTR", 'f'},
-    {"REGOPER", 't'},
-    {"REGOPERATOR", 't'},
-    {"REGPROC", 't'},
-    {"REGPROCEDURE", 't'},
-    {"REGTYPE", 't'},
-    {"RELEASE", 'k'},
-    {"RELEASE_LOCK", 'f'},
-    {"RENAME", 'k'},
-    {"REPEAT", 'k'},
-    {"REPLACE", 'k'},
-    {"REPLICATE", 'f'},
-    {"REQUIRE", 'k'},
-    {"RESIGNAL", 'k'},
-    {"RESTRICT", 'k'},
-    {"RETURN", 'k'},
-    {"REVERSE", 'f'},
-    {"REVOKE", 'k'},
-    {"RIGHT", 'n'},
-    {"RIGHT JOIN", 'k'},
-    {"RIGHT OUTER", 'k'},
-    {"RIGHT OUTER JOIN", 'k'},
-    {"RLIKE", 'o'},
-    {"ROUND", 'f'},
-    {"ROW", 'f'},
-    {"ROW_COUNT", 'f'},
-    {"ROW_NUMBER", 'f'},
-    {"ROW_TO_JSON", 'f'},
-    {"RPAD", 'f'},
-    {"RTRIM", 'f'},
-    {"SCHAMA_NAME", 'f'},
-    {"SCHEMA", 'k'},
-    {"SCHEMAS", 'k'},
-    {"SCHEMA_ID", 'f'},
-    {"SCOPE_IDENTITY", 'f'},
-    {"SECOND_MICROSECOND", 'k'},
-    {"SEC_TO_TIME", 'f'},
-    {"SELECT", 'E'},
-    {"SELECT ALL", 'E'},
-    {"SELECT DISTINCT", 'E'},
-    {"SENSITIVE", 'k'},
-    {"SEPARATOR", 'k'},
-    {"SERIAL", 't'},
-    {"SERIAL2", 't'},
-    {"SERIAL4", 't'},
-    {"SERIAL8", 't'},
-    {"SERVERPROPERTY", 'f'},
-    {"SESSION_USER", 'f'},
-    {"SET", 'E'},
-    {"SETATTR", 'f'},
-    {"SETSEED", 'f'},
-    {"SETVAL", 'f'},
-    {"SET_BIT", 'f'},
-    {"SET_BYTE", 'f'},
-    {"SET_CONFIG", 'f'},
-    {"SET_MASKLEN", 'f'},
-    {"SHA", 'f'},
-    {"SHA1", 'f'},
-    {"SHA2", 'f'},
-    {"SHOW", 'n'},
-    {"SHUTDOWN", 'T'},
-    {"SIGN", 'f'},
-    {"SIGNAL", 'k'},
-    {"SIGNBYASMKEY", 'f'},
-    {"SIGNBYCERT", 'f'},
-    {"SIMILAR", 'k'},
-    {"SIMILAR TO", 'o'},
-    {"SIN", 'f'},
-    {"SLEEP", 'f'},
-    {"SMALLDATETIMEFROMPARTS", 'f'},
-    {"SMALLINT", 't'},
-    {"SMALLSERIAL", 't'},
-    {"SOME", 'f'},
-    {"SOUNDEX", 'f'},
-    {"SOUNDS", 'o'},
-    {"SOUNDS LIKE", 'o'},
-    {"SPACE", 'f'},
-    {"SPATIAL", 'k'},
-    {"SPECIFIC", 'k'},
-    {"SPLIT_PART", 'f'},
-    {"SQL", 'k'},
-    {"SQLEXCEPTION", 'k'},
-    {"SQLITE_VERSION", 'f'},
-    {"SQLSTATE", 'k'},
-    {"SQLWARNING", 'k'},
-    {"SQL_BIG_RESULT", 'k'},
-    {"SQL_BUFFER_RESULT", 'k'},
-    {"SQL_CACHE", 'k'},
-    {"SQL_CALC_FOUND_ROWS", 'k'},
-    {"SQL_NO_CACHE", 'k'},
-    {"SQL_SMALL_RESULT", 'k'},
-    {"SQL_VARIANT_PROPERTY", 'f'},
-    {"SQRT", 'f'},
-    {"SSL", 'k'},
-    {"STARTING", 'k'},
-    {"STATEMENT_TIMESTAMP", 'f'},
-    {"STATS_DATE", 'f'},
-    {"STDDEV", 'f'},
-    {"STDDEV_POP", 'f'},
-    {"STDDEV_SAMP", 'f'},
-    {"STRAIGHT_JOIN", 'k'},
-    {"STRCMP", 'f'},
-    {"STRCOMP", 'f'},
-    {"STRCONV", 'f'},
-    {"STRING_AGG", 'f'},
-    {"STRING_TO_ARRAY", 'f'},
-    {"STRPOS", 'f'},
-    {"STR_TO_DATE", 'f'},
-    {"STUFF", 'f'},
-    {"SUBDATE", 'f'},
-    {"SUBSTR", 'f'},
-    {"SUBSTRING", 'f'},
-    {"SUBSTRING_INDEX", 'f'},
-    {"SUBTIME", 'f'},
-    {"SUM", 'f'},
-    {"SUSER_ID", 'f'},
-    {"SUSER_NAME", 'f'},
-    {"SUSER_SID", 'f'},
-    {"SUSER_SNAME", 'f'},
-    {"SWITCHOFFET", 'f'},
-    {"SYS.DATABASE_NAME", 'n'},
-    {"SYS.FN_BUILTIN_PERMISSIONS", 'f'},
-    {"SYS.FN_GET_AUDIT_FILE", 'f'},
-    {"SYS.FN_MY_PERMISSIONS", 'f'},
-    {"SYS.STRAGG", 'f'},
-    {"SYSCOLUMNS", 'k'},
-    {"SYSDATE", 'f'},
-    {"SYSDATETIME", 'f'},
-    {"SYSDATETIMEOFFSET", 'f'},
-    {"SYSOBJECTS", 'k'},
-    {"SYSTEM_USER", 'f'},
-    {"SYSUSERS", 'k'},
-    {"SYSUTCDATETME", 'f'},
-    {"TABLE", 'n'},
-    {"TAN", 'f'},
-    {"TERMINATED", 'k'},
-    {"TERTIARY_WEIGHTS", 'f'},
-    {"TEXT", 't'},
-    {"TEXTPOS", 'f'},
-    {"TEXTPTR", 'f'},
-    {"TEXTVALID", 'f'},
-    {"THEN", 'k'},
-    {"TIME", 'k'},
-    {"TIMEDIFF", 'f'},
-    {"TIMEFROMPARTS", 'f'},
-    {"TIMEOFDAY", 'f'},
-    {"TIMESERIAL", 'f'},
-    {"TIMESTAMP", 't'},
-    {"TIMESTAMPADD", 'f'},
-    {"TIMEVALUE", 'f'},
-    {"TIME_FORMAT", 'f'},
-    {"TIME_TO_SEC", 'f'},
-    {"TINYBLOB", 'k'},
-    {"TINYINT", 'k'},
-    {"TINYTEXT", 'k'},
-    {"TODATETIMEOFFSET", 'f'},
-    {"TOP", 'k'},
-    {"TOTAL", 'f'},
-    {"TOTAL_CHANGES", 'f'},
-    {"TO_ASCII", 'f'},
-    {"TO_BASE64", 'f'},
-    {"TO_CHAR", 'f'},
-    {"TO_DATE", 'f'},
-    {"TO_DAYS", 'f'},
-    {"TO_HEX", 'f'},
-    {"TO_NUMBER", 'f'},
-    {"TO_SECONDS", 'f'},
-    {"TO_TIMESTAMP", 'f'},
-    {"TRAILING", 'n'},
-    {"TRANSACTION_TIMESTAMP", 'f'},
-    {"TRANSLATE", 'f'},
-    {"TRIGGER", 'k'},
-    {"TRIGGER_NESTLEVEL", 'f'},
-    {"TRIM", 'f'},
-    {"TRUE", '1'},
-    {"TRUNC", 'f'},
-    {"TRUNCATE", 'f'},
-    {"TRY", 'T'},
-    {"TRY_CAST", 'f'},
-    {"TRY_CONVERT", 'f'},
-    {"TRY_PARSE", 'f'},
-    {"TYPEOF", 'f'},
-    {"TYPEPROPERTY", 'f'},
-    {"TYPE_ID", 'f'},
-    {"TYPE_NAME", 'f'},
-    {"UCASE", 'f'},
-    {"UESCAPE", 'o'},
-    {"UNCOMPRESS", 'f'},
-    {"UNCOMPRESS_LENGTH", 'f'},
-    {"UNDO", 'k'},
-    {"UNHEX", 'f'},
-    {"UNICODE", 'f'},
-    {"UNION", 'U'},
-    {"UNION ALL", 'U'},
-    {"UNION ALL DISTINCT", 'U'},
-    {"UNION DISTINCT", 'U'},
-    {"UNION DISTINCT ALL", 'U'},
-    {"UNIQUE", 'n'},
-    {"UNIX_TIMESTAMP", 'f'},
-    {"UNI_ON", 'U'},
-    {"UNKNOWN", 'v'},
-    {"UNLOCK", 'k'},
-    {"UNNEST", 'f'},
-    {"UNSIGNED", 'k'},
-    {"UPDATE", 'E'},
-    {"UPDATEXML", 'f'},
-    {"UPPER", 'f'},
-    {"UPPER_INC", 'f'},
-    {"UPPER_INF", 'f'},
-    {"USAGE", 'k'},
-    {"USE", 'T'},
-    {"USER", 'n'},
-    {"USER_ID", 'n'},
-    {"USER_LOCK.SLEEP", 'f'},
-    {"USER_NAME", 'n'},
-    {"USING", 'f'},
-    {"UTC_DATE", 'k'},
-    {"UTC_TIME", 'k'},
-    {"UTC_TIMESTAMP", 'k'},
-    {"UTL_HTTP.REQUEST", 'f'},
-    {"UTL_INADDR.GET_HOST_ADDRESS", 'f'},
-    {"UTL_INADDR.GET_HOST_NAME", 'f'},
-    {"UUID", 'f'},
-    {"UUID_SHORT", 'f'},
-    {"VALUES", 'k'},
-    {"VAR", 'f'},
-    {"VARBINARY", 'k'},
-    {"VARCHAR", 't'},
-    {"VARCHARACTER", 'k'},
-    {"VARIANCE", 'f'},
-    {"VARP", 'f'},
-    {"VARYING", 'k'},
-    {"VAR_POP", 'f'},
-    {"VAR_SAMP", 'f'},
-    {"VERIFYSIGNEDBYASMKEY", 'f'},
-    {"VERIFYSIGNEDBYCERT", 'f'},
-    {"VERSION", 'f'},
-    {"VOID", 't'},
-    {"WAIT", 'k'},
-    {"WAITFOR", 'n'},
-    {"WAITFOR DELAY", 'E'},
-    {"WAITFOR RECEIVE", 'E'},
-    {"WAITFOR TIME", 'E'},
-    {"WEEK", 'f'},
-    {"WEEKDAY", 'f'},
-    {"WEEKDAYNAME", 'f'},
-    {"WEEKOFYEAR", 'f'},
-    {"WHEN", 'k'},
-    {"WHERE", 'k'},
-    {"WHILE", 'T'},
-    {"WIDTH_BUCKET", 'f'},
-    {"WITH", 'n'},
-    {"WITH ROLLUP", 'k'},
-    {"XMLAGG", 'f'},
-    {"XMLCOMMENT", 'f'},
-    {"XMLCONCAT", 'f'},
-    {"XMLELEMENT", 'f'},
-    {"XMLEXISTS", 'f'},
-    {"XMLFOREST", 'f'},
-    {"XMLFORMAT", 'f'},
-    {"XMLPI", 'f'},
-    {"XMLROOT", 'f'},
-    {"XMLTYPE", 'f'},
-    {"XML_IS_WELL_FORMED", 'f'},
-    {"XOR", '&'},
-    {"XPATH", 'f'},
-    {"XPATH_EXISTS", 'f'},
-    {"XP_EXECRESULTSET", 'k'},
-    {"YEAR", 'f'},
-    {"YEARWEEK", 'f'},
-    {"YEAR_MONTH", 'k'},
-    {"ZEROBLOB", 'f'},
-    {"ZEROFILL", 'k'},
-    {"^=", 'o'},
-    {"_ARMSCII8", 't'},
-    {"_ASCII", 't'},
-    {"_BIG5", 't'},
-    {"_BINARY", 't'},
-    {"_CP1250", 't'},
-    {"_CP1251", 't'},
-    {"_CP1257", 't'},
-    {"_CP850", 't'},
-    {"_CP852", 't'},
-    {"_CP866", 't'},
-    {"_CP932", 't'},
-    {"_DEC8", 't'},
-    {"_EUCJPMS", 't'},
-    {"_EUCKR", 't'},
-    {"_GB2312", 't'},
-    {"_GBK", 't'},
-    {"_GEOSTD8", 't'},
-    {"_GREEK", 't'},
-    {"_HEBREW", 't'},
-    {"_HP8", 't'},
-    {"_KEYBCS2", 't'},
-    {"_KOI8R", 't'},
-    {"_KOI8U", 't'},
-    {"_LATIN1", 't'},
-    {"_LATIN2", 't'},
-    {"_LATIN5", 't'},
-    {"_LATIN7", 't'},
-    {"_MACCE", 't'},
-    {"_MACROMAN", 't'},
-    {"_SJIS", 't'},
-    {"_SWE7", 't'},
-    {"_TIS620", 't'},
-    {"_UJIS", 't'},
-    {"_USC2", 't'},
-    {"_UTF8", 't'},
-    {"|/", 'o'},
-    {"|=", 'o'},
-    {"||", '&'},
-    {"~*", 'o'},
+    {"ALTER", 'k', 0, 1},
+    {"NATURAL LEFT OUTER", 'k', 0, 154},
+    {"CURRENT DEGREE", 'v', 0, 0},
+    {"SYSTEM_USER", 'f', 0, 0},
+    {"GETUTCDATE", 'f', 0, 0},
+    {"FOREIGN", 'k', 0, 0},
+    {"_GEOSTD8", 't', 0, 0},
+    {"PG_RELOAD_CONF", 'f', 0, 0},
+    {"PG_POSTMASTER_START_TIME", 'f', 0, 0},
+    {"IGNORE INTO", '\0', 0, 0},
+    {"LTRIM", 'f', 0, 0},
+    {"SPATIAL", 'k', 0, 0},
+    {"UNION ALL", 'U', 0, 208},
+    {"_EUCKR", 't', 0, 0},
+    {"OPENQUERY", 'f', 0, 0},
+    {"CASCADE", 'k', 0, 0},
+    {"SMALLDATETIMEFROMPARTS", 'f', 0, 0},
+    {"VARYING", 'k', 0, 0},
+    {"LOGIN", '\0', 0, 0},
+    {"LOWER_INF", 'f', 0, 0},
+    {"UPDATE OF", '\0', 0, 0},
+    {"SUSER_ID", 'f', 0, 0},
+    {"ROW_TO_JSON", 'f', 0, 0},
+    {"CALL", 'T', 0, 0},
+    {"TO", '\0', 0, 0},
+    {"NOT BETWEEN", 'o', 0, 0},
+    {"CDBL", 'f', 0, 0},
+    {"APP_NAME", 'f', 0, 0},
+    {"DBMS_LOCK", '\0', 16, 0},
+    {"CHECK", 'n', 0, 0},
+    {"_LATIN2", 't', 0, 0},
+    {"BEGIN TRY", 'T', 0, 14},
+    {"@>", 'o', 0, 0},
+    {"PASSWORD", 'n', 1, 0},
+    {"LINEAR", 'k', 0, 0},
+    {"AT", '\0', 0, 4},
+    {"CBOOL", 'f', 0, 0},
+    {"XMLTYPE", 'f', 0, 0},
+    {"UPPER_INF", 'f', 0, 0},
+    {"FULL JOIN", 'k', 0, 0},
+    {"SOUNDEX", 'f', 0, 0},
+    {"NOT", 'o', 0, 165},
+    {"IS", 'o', 0, 103},
+    {"WEEKDAY", 'f', 0, 0},
+    {"DBMS_PIPE", '\0', 16, 0},
+    {"UCASE", 'f', 0, 0},
+    {"AND", '&', 0, 0},
+    {"FILEGROUP_ID", 'f', 0, 0},
+    {"JUSTIFY_DAYS", 'f', 0, 0},
+    {"CONVERT_TO", 'f', 0, 0},
+    {"INT8", 't', 0, 0},
+    {"DATABASE_PRINCIPAL_ID", 'f', 0, 0},
+    {"VARBINARY", 'k', 0, 0},
+    {"DEGREES", 'f', 0, 0},
+    {"TABLES", '\0', 0, 0},
+    {"FILE_ID", 'f', 0, 0},
+    {"<@", 'o', 0, 0},
+    {"_BINARY", 't', 0, 0},
+    {"REAL", 't', 0, 0},
+    {"CURRENT_PATH", 'v', 0, 0},
+    {"PATHINDEX", 'f', 0, 0},
+    {"APPLOCK_TEST", 'f', 0, 0},
+    {"ADDDATE", 'f', 0, 0},
+    {"DELETE", 'T', 0, 0},
+    {"DATEVALUE", 'f', 0, 0},
+    {"_SWE7", 't', 0, 0},
+    {"*=", 'o', 0, 0},
+    {"CCUR", 'f', 0, 0},
+    {"STRAIGHT_JOIN", 'k', 0, 0},
+    {"TRY_PARSE", 'f', 0, 0},
+    {"BINBINARY", 'f', 0, 0},
+    {"DATABASES", 'k', 0, 0},
+    {"WRITE", '\0', 0, 0},
+    {"CTXSYS", '\0', 16, 0},
+    {"MAX", 'f', 0, 0},
+    {"FIRST_VALUE", 'f', 0, 0},
+    {"CEIL", 'f', 0, 0},
+    {"INTO", 'k', 0, 100},
+    {"LOW_PRIORITY", 'k', 0, 0},
+    {"NEXT", '\0', 0, 160},
+    {"DATEPART", 'f', 0, 0},
+    {"DETERMINISTIC", 'k', 0, 0},
+    {"CHECKSUM_AGG", 'f', 0, 0},
+    {"HOUR_SECOND", 'k', 0, 0},
+    {"STRING_AGG", 'f', 0, 0},
+    {"COLUMNPROPERTY", 'f', 0, 0},
+    {"ENUM_RANGE", 'f', 0, 0},
+    {"QUOTE", 'f', 0, 0},
+    {"LEFT OUTER", 'k', 0, 120},
+    {"SOME", 'f', 0, 0},
+    {"FIELD", 'f', 0, 0},
+    {"PARSENAME", 'f', 0, 0},
+    {"READ_WRITE", 'k', 0, 0},
+    {"CVAR", 'f', 0, 0},
+    {"UNCOMPRESS", 'f', 0, 0},
+    {"ALL DISTINCT", '\0', 0, 0},
+    {"ABS", 'f', 0, 0},
+    {"XMLPI", 'f', 0, 0},
+    {"REPLACE", 'k', 0, 0},
+    {"QUARTER", 'f', 0, 0},
+    {"LOAD_FILE", 'f', 0, 0},
+    {"NAME_CONST", 'f', 0, 0},
+    {"NEXTVAL", 'f', 0, 0},
+    {"CHARINDEX", 'f', 0, 0},
+    {"DATE", 'f', 0, 0},
+    {"OPTIMIZE", 'k', 0, 0},
+    {"ORIGINAL_LOGIN", 'f', 0, 0},
+    {"FILE_IDEX", 'f', 0, 0},
+    {"ENCRYPTBYKEY", 'f', 0, 0},
+    {"PG_ADVISORY_LOCK", 'f', 0, 0},
+    {"FILE_NAME", 'f', 0, 0},
+    {"OF", '\0', 0, 0},
+    {"DENSE_RANK", 'f', 0, 0},
+    {"FULLTEXTSERVICEPROPERTY", 'f', 0, 0},
+    {"AVG", 'f', 0, 0},
+    {"OBJECTPROPERTYEX", 'f', 0, 0},
+    {"BOTH", 'k', 0, 0},
+    {"NATURAL LEFT", 'k', 0, 151},
+    {"CREATE OR", 'n', 0, 21},
+    {"VERIFYSIGNEDBYCERT", 'f', 0, 0},
+    {"PWDENCRYPT", 'f', 0, 0},
+    {"DAY_HOUR", 'k', 0, 0},
+    {"OID", 't', 0, 0},
+    {"PG_START_BACKUP", 'f', 0, 0},
+    {"INSERT LOW_PRIORITY INTO", 'T', 0, 0},
+    {"ENCRYPTBYASMKEY", 'f', 0, 0},
+    {"GENERATE_SUBSCRIPTS", 'f', 0, 0},
+    {"KEY_ID", 'f', 0, 0},
+    {"DLAST", 'f', 0, 0},
+    {"ARRAY_CAT", 'f', 0, 0},
+    {"SELECT", 'E', 0, 196},
+    {"SELECT DISTINCT", 'E', 0, 0},
+    {"ARRAY_LENGTH", 'f', 0, 0},
+    {"FILEPROPERTY", 'f', 0, 0},
+    {"LIMIT", 'B', 0, 0},
+    {"COERCIBILITY", 'f', 0, 0},
+    {"|/", 'o', 0, 0},
+    {"SIMILAR TO", 'o', 0, 0},
+    {"NATURAL FULL", 'k', 0, 147},
+    {"TEXTPOS", 'f', 0, 0},
+    {"ARRAY_TO_STRING", 'f', 0, 0},
+    {"CROSS JOIN", 'k', 0, 0},
+    {"REQUIRE", 'k', 0, 0},
+    {"REGOPERATOR", 't', 0, 0},
+    {"UNION DISTINCT", 'U', 0, 210},
+    {"OWN3D", 'k', 0, 177},
+    {"RETURN", 'k', 0, 0},
+    {"CINT", 'f', 0, 0},
+    {"ANYNONARRY", 't', 0, 0},
+    {"RIGHT", 'n', 0, 190},
+    {"JULIANDAY", 'f', 0, 0},
+    {"MID", 'f', 0, 0},
+    {"BIGINT", 't', 0, 0},
+    {"LEADING", 'k', 0, 0},
+    {"EXCEPT", 'U', 0, 0},
+    {"IS DISTINCT", 'n', 0, 109},
+    {"UTL_INADDR.GET_HOST_NAME", 'f', 0, 0},
+    {"USER", 'n', 9, 0},
+    {"DISTINCT", 'k', 0, 0},
+    {"RANGE", 'k', 0, 0},
+    {"SYSUSERS", 'k', 0, 0},
+    {"SIGNAL", 'k', 0, 0},
+    {"OUTFILE", 'k', 0, 0},
+    {"CURSOR_STATUS", 'f', 0, 0},
+    {"STRCONV", 'f', 0, 0},
+    {"INSERT DELAYED", 'E', 0, 90},
+    {"SET_BYTE", 'f', 0, 0},
+    {"TIME ZONE", '\0', 0, 0},
+    {"GREATEST", 'f', 0, 0},
+    {"PG_CLIENT_ENCODING", 'f', 0, 0},
+    {"JSON_KEYS", 'f', 0, 0},
+    {"ENCODE", 'f', 0, 0},
+    {"SPECIFIC", 'k', 0, 0},
+    {"INTEGER", 't', 0, 0},
+    {"MINUTE_SECOND", 'k', 0, 0},
+    {"CRC32", 'f', 0, 0},
+    {"UNIX_TIMESTAMP", 'f', 0, 0},
+    {"BEFORE", 'k', 0, 0},
+    {"OBJECTPROPERTY", 'f', 0, 0},
+    {"_CP932", 't', 0, 0},
+    {"IDENTIFY", 'f', 0, 0},
+    {"CUME_DIST", 'f', 0, 0},
+    {"RTRIM", 'f', 0, 0},
+    {"LOCATE", 'f', 0, 0},
+    {"SEC_TO_TIME", 'f', 0, 0},
+    {"READS", 'k', 0, 0},
+    {"NZ", 'f', 0, 0},
+    {"DECRYPTBYASMKEY", 'f', 0, 0},
+    {"CURRENT_SCHEMA", 'f', 0, 0},
+    {"BINARY_DOUBLE_INFINITY", '1', 0, 0},
+    {"MATCH", 'k', 0, 0},
+    {"PREVIOUS", '\0', 0, 181},
+    {"REGPROC", 't', 0, 0},
+    {"DATESERIAL", 'f', 0, 0},
+    {"TIMEFROMPARTS", 'f', 0, 0},
+    {"LOWER", 'f', 0, 0},
+    {"AS LOGIN", '\0', 0, 0},
+    {"DESCRIBE", 'k', 0, 0},
+    {"VERIFYSIGNEDBYASMKEY", 'f', 0, 0},
+    {"UPDATE", 'E', 0, 0},
+    {"REGDICTIONARY", 't', 0, 0},
+    {"SQL_BUFFER_RESULT", 'k', 0, 0},
+    {"FN_VIRTUALFILESTATS", 'f', 0, 0},
+    {"CURDATE", 'f', 0, 0},
+    {"SUBSTRING_INDEX", 'f', 0, 0},
+    {"LPAD", 'f', 0, 0},
+    {"ANYELEMENT", 't', 0, 0},
+    {"FROM_UNIXTIME", 'f', 0, 0},
+    {"COL_NAME", 'f', 0, 0},
+    {"_UJIS", 't', 0, 0},
+    {"DMIN", 'f', 0, 0},
+    {"WAIT", 'k', 0, 0},
+    {"_EUCJPMS", 't', 0, 0},
+    {"LINES", 'k', 0, 0},
+    {"UNKNOWN", 'v', 0, 0},
+    {"UNION", 'U', 0, 203},
+    {"SOUNDS", 'o', 0, 201},
+    {"XMLELEMENT", 'f', 0, 0},
+    {"CDATE", 'f', 0, 0},
+    {"FOR UPDATE OF", 'k', 0, 0},
+    {"UNION ALL DISTINCT", 'U', 0, 0},
+    {"IDENT_SEED", 'f', 0, 0},
+    {"LAST_INSERT_ID", 'f', 0, 0},
+    {"LOAD", 'k', 0, 122},
+    {"LOG10", 'f', 0, 0},
+    {"SUBSTR", 'f', 0, 0},
+    {"MODE", 'n', 0, 0},
+    {"SUSER_SID", 'f', 0, 0},
+    {"TYPEPROPERTY", 'f', 0, 0},
+    {"LOG2", 'f', 0, 0},
+    {"PG_CANCEL_BACKEND", 'f', 0, 0},
+    {"LAG", 'f', 0, 0},
+    {"VARCHAR", 't', 0, 0},
+    {"ENUM_FIRST", 'f', 0, 0},
+    {"STR_TO_DATE", 'f', 0, 0},
+    {"_ARMSCII8", 't', 0, 0},
+    {"FULLTEXTCATALOGPROPERTY", 'f', 0, 0},
+    {"CURRENT", '\0', 0, 25},
+    {"OUTER", 'n', 0, 0},
+    {"FOR", 'n', 0, 44},
+    {"NTILE", 'f', 0, 0},
+    {"AGAINST", 'k', 0, 0},
+    {"NATURAL RIGHT OUTER", '\0', 0, 158},
+    {"TIMEDIFF", 'f', 0, 0},
+    {"CERT_ID", 'f', 0, 0},
+    {"AES_ENCRYPT", 'f', 0, 0},
+    {"UTL_INADDR.GET_HOST_ADDRESS", 'f', 0, 0},
+    {"NTH_VALUE", 'f', 0, 0},
+    {"_USC2", 't', 0, 0},
+    {"DELAYED", 'k', 0, 0},
+    {"LOCALTIMESTAMP", 'v', 1, 0},
+    {"YEAR_MONTH", 'k', 0, 0},
+    {"CTXSYS.DRITHSX.SN", 'f', 0, 0},
+    {"CONSTRAINT", 'k', 0, 0},
+    {"SIGN", 'f', 0, 0},
+    {"DBMS_LOCK.SLEEP", 'f', 0, 0},
+    {"SET_CONFIG", 'f', 0, 0},
+    {"IN SHARE MODE", '\0', 0, 0},
+    {"QUOTE_NULLABLE", 'f', 0, 0},
+    {"_CP850", 't', 0, 0},
+    {"BEGIN", 'T', 0, 9},
+    {"ASSEMBLYPROPERTY", 'f', 0, 0},
+    {"UPDATE SKIP LOCKED", '\0', 0, 0},
+    {"GET_BIT", 'f', 0, 0},
+    {"RESTRICT", 'k', 0, 0},
+    {"SYS.DATABASE_NAME", 'n', 0, 0},
+    {"NETMASK", 'f', 0, 0},
+    {"STRPOS", 'f', 0, 0},
+    {"UTL_INADDR", '\0', 16, 0},
+    {"VAR_SAMP", 'f', 0, 0},
+    {"OUT", 'n', 0, 0},
+    {"UNION DISTINCT ALL", 'U', 0, 0},
+    {"DECRYPTBYCERT", 'f', 0, 0},
+    {"DUAL", 'n', 0, 0},
+    {"TIME_FORMAT", 'f', 0, 0},
+    {"ARRAY_NDIMS", 'f', 0, 0},
+    {"DATALENGTH", 'f', 0, 0},
+    {"INTERSECT ALL", 'U', 0, 0},
+    {"DATABASE", 'n', 1, 0},
+    {"SET", 'E', 0, 0},
+    {"BENCHMARK", 'f', 0, 0},
+    {"TRANSLATE", 'f', 0, 0},
+    {"TIMEZONE", '\0', 0, 0},
+    {"DAY_SECOND", 'k', 0, 0},
+    {"DECRYPTBYPASSPHRASE", 'f', 0, 0},
+    {"EXISTS", 'f', 0, 0},
+    {"SQLSTATE", 'k', 0, 0},
+    {"INDEXPROPERTY", 'f', 0, 0},
+    {"SUBDATE", 'f', 0, 0},
+    {"CONVERT_FROM", 'f', 0, 0},
+    {"PROCEDURE ANALYSE", 'f', 0, 0},
+    {"TRUE", '1', 0, 0},
+    {"CHOOSE", 'f', 0, 0},
+    {"PG_STOP_BACKUP", 'f', 0, 0},
+    {"COLLATIONPROPERTY", 'f', 0, 0},
+    {"FROM", 'k', 0, 0},
+    {"IS_SRVROLEMEMBER", 'f', 0, 0},
+    {"REGCLASS", 't', 0, 0},
+    {"INT1", 't', 0, 0},
+    {"INNER JOIN", 'k', 0, 0},
+    {"OR REPLACE", '\0', 0, 0},
+    {"EXECUTE AS LOGIN", 'E', 0, 0},
+    {"RAND", 'f', 0, 0},
+    {"ASIN", 'f', 0, 0},
+    {"UPDATE NOWAIT", '\0', 0, 0},
+    {"CURRENT TIME", 'v', 0, 0},
+    {"TOP", 'k', 0, 0},
+    {"ORDER", 'n', 0, 175},
+    {"FULL", '\0', 0, 59},
+    {"WITH", 'n', 0, 216},
+    {"UPDATEXML", 'f', 0, 0},
+    {"_LATIN7", 't', 0, 0},
+    {"QUOTE_LITERAL", 'f', 0, 0},
+    {"CHANGE", 'k', 0, 0},
+    {"RLIKE", 'o', 0, 0},
+    {"OBJECT_DEFINITION", 'f', 0, 0},
+    {"CAST", 'f', 0, 0},
+    {"DSUM", 'f', 0, 0},
+    {"TIMESTAMP", 't', 0, 0},
+    {"STRCMP", 'f', 0, 0},
+    {"MASTER_POS_WAIT", 'f', 0, 0},
+    {"SUM", 'f', 0, 0},
+    {"|=", 'o', 0, 0},
+    {"_CP1251", 't', 0, 0},
+    {"SYSDATETIMEOFFSET", 'f', 0, 0},
+    {"TINYBLOB", 'k', 0, 0},
+    {"ANALYZE", 'k', 0, 0},
+    {"IS NOT", 'o', 0, 111},
+    {"NUMERIC", 't', 0, 0},
+    {"GROUP BY", 'B', 0, 0},
+    {"JOIN", 'k', 0, 0},
+    {"MONTH", 'f', 0, 0},
+    {"MKDIR", 'f', 0, 0},
+    {"SYS.FN_MY_PERMISSIONS", 'f', 0, 0},
+    {"SPLIT_PART", 'f', 0, 0},
+    {"UTC_TIMESTAMP", 'k', 0, 0},
+    {"TEXTPTR", 'f', 0, 0},
+    {"CONCAT_WS", 'f', 0, 0},
+    {"INT4", 't', 0, 0},
+    {"ALL_USERS", 'k', 0, 0},
+    {"PG_IS_OTHER_TEMP_SCHEMA", 'f', 0, 0},
+    {"WAITFOR RECEIVE", 'E', 0, 0},
+    {"NOT DISTINCT", '\0', 0, 0},
+    {"PATH", '\0', 0, 0},
+    {"SECOND_MICROSECOND", 'k', 0, 0},
+    {"XMLFOREST", 'f', 0, 0},
+    {"DIFFERENCE", 'f', 0, 0},
+    {"REPLICATE", 'f', 0, 0},
+    {"DATETIMEFROMPARTS", 'f', 0, 0},
+    {"ELSEIF", 'k', 0, 0},
+    {"ZEROFILL", 'k', 0, 0},
+    {"SHOW", 'n', 0, 0},
+    {"NO_WRITE_TO_BINLOG", 'k', 0, 0},
+    {"LEFT OUTER JOIN", 'k', 0, 0},
+    {"DAYOFYEAR", 'f', 0, 0},
+    {"PREVIOUS VALUE", 'n', 0, 184},
+    {"PERCENTILE_DISC", 'f', 0, 0},
+    {"FIND_IN_SET", 'f', 0, 0},
+    {"LOAD XML", 'T', 0, 0},
+    {"CROSS", 'n', 0, 23},
+    {"DAY", 'f', 0, 0},
+    {"TRIGGER", 'k', 0, 0},
+    {"CURRENT_QUERY", 'f', 0, 0},
+    {"FOUND_ROWS", 'f', 0, 0},
+    {"SQL_VARIANT_PROPERTY", 'f', 0, 0},
+    {"CHARACTER", 't', 0, 16},
+    {"IS_ROLEMEMBER", 'f', 0, 0},
+    {"PG_MY_TEMP_SCHEMA", 'f', 0, 0},
+    {"CURRENT SCHEMA", 'v', 0, 0},
+    {"CHARACTER VARYING", 't', 0, 0},
+    {"CTXSYS.DRITHSX", '\0', 16, 0},
+    {"IDENT_INCR", 'f', 0, 0},
+    {"DROP", 'T', 0, 0},
+    {"INT", 't', 0, 0},
+    {"NATURAL JOIN", 'k', 0, 0},
+    {"EXTRACT_VALUE", 'f', 0, 0},
+    {"USE", 'T', 0, 0},
+    {"ARRAY_TO_JSON", 'f', 0, 0},
+    {"INT2", 't', 0, 0},
+    {"XMLROOT", 'f', 0, 0},
+    {"UTL_HTTP", '\0', 16, 0},
+    {"BEGIN DECLARE", 'T', 0, 0},
+    {"SERIAL2", 't', 0, 0},
+    {"TERMINATED", 'k', 0, 0},
+    {"DBMS_PIPE.RECEIVE_MESSAGE", 'f', 0, 0},
+    {"OPTION", 'k', 0, 0},
+    {"SCOPE_IDENTITY", 'f', 0, 0},
+    {"UPPER", 'f', 0, 0},
+    {"OCTET_LENGTH", 'f', 0, 0},
+    {"PG_BACKEND_PID", 'f', 0, 0},
+    {"IF EXISTS", 'f', 0, 0},
+    {"CHAR_LENGTH", 'f', 0, 0},
+    {"NATURAL FULL OUTER", '\0', 0, 149},
+    {"BIT_LENGTH", 'f', 0, 0},
+    {"LAST_INSERT_ROWID", 'f', 0, 0},
+    {"OBJECT_SCHEMA_NAME", 'f', 0, 0},
+    {"STDDEV_POP", 'f', 0, 0},
+    {"INSTRREV", 'f', 0, 0},
+    {"LASTVAL", 'f', 0, 0},
+    {"NULLIF", 'f', 0, 0},
+    {"HOUR_MICROSECOND", 'k', 0, 0},
+    {"SMALLINT", 't', 0, 0},
+    {"CONNECTION_ID", 'f', 0, 0},
+    {"IS NOT DISTINCT", 'n', 0, 114},
+    {"DECRYPTBYKEYAUTOCERT", 'f', 0, 0},
+    {"RPAD", 'f', 0, 0},
+    {"XML", '\0', 0, 0},
+    {"HIGH_PRIORITY", 'k', 0, 0},
+    {"TRY_CAST", 'f', 0, 0},
+    {"HOUR_MINUTE", 'k', 0, 0},
+    {"SQLEXCEPTION", 'k', 0, 0},
+    {"BIT_OR", 'f', 0, 0},
+    {"UPPER_INC", 'f', 0, 0},
+    {"LEAD", 'f', 0, 0},
+    {"STARTING", 'k', 0, 0},
+    {"SKIP", '\0', 0, 0},
+    {"REGPROCEDURE", 't', 0, 0},
+    {"EXEC", 'T', 0, 0},
+    {"SQL_CALC_FOUND_ROWS", 'k', 0, 0},
+    {"UESCAPE", 'o', 0, 0},
+    {"_ASCII", 't', 0, 0},
+    {"/=", 'o', 0, 0},
+    {"CREATE OR REPLACE", 'T', 0, 0},
+    {"SIN", 'f', 0, 0},
+    {"INSERT DELAYED INTO", 'T', 0, 0},
+    {"SESSION_USER", 'f', 0, 0},
+    {"PRIMARY", 'k', 0, 0},
+    {"KILL", 'k', 0, 0},
+    {"PERIOD_DIFF", 'f', 0, 0},
+    {"CONTINUE", 'k', 0, 0},
+    {"REGOPER", 't', 0, 0},
+    {"NOT SIMILAR", 'o', 0, 173},
+    {"OUTER JOIN", '\0', 0, 0},
+    {"CHDIR", 'f', 0, 0},
+    {"HEX", 'f', 0, 0},
+    {"VALUE", '\0', 0, 0},
+    {"BINARY_FLOAT_INFINITY", '1', 0, 0},
+    {"_KOI8U", 't', 0, 0},
+    {"DBMS_UTILITY", '\0', 16, 0},
+    {"PURGE", 'k', 0, 0},
+    {"RELEASE", 'k', 0, 0},
+    {"ROUND", 'f', 0, 0},
+    {"XMLEXISTS", 'f', 0, 0},
+    {"SERVERPROPERTY", 'f', 0, 0},
+    {"MAKE_SET", 'f', 0, 0},
+    {"RENAME", 'k', 0, 0},
+    {"JUSTIFY_INTERVAL", 'f', 0, 0},
+    {"<<", 'o', 0, 0},
+    {"VARP", 'f', 0, 0},
+    {"OFFSET", 'k', 0, 0},
+    {"ADDTIME", 'f', 0, 0},
+    {"ANALYSE", '\0', 0, 0},
+    {"BOOL_OR", 'f', 0, 0},
+    {"LEAVE", 'k', 0, 0},
+    {"MINUTE", 'f', 0, 0},
+    {"FOR UPDATE SKIP LOCKED", 'k', 0, 0},
+    {"SYSDATETIME", 'f', 0, 0},
+    {"UPDATE WAIT", '\0', 0, 0},
+    {"OPENXML", 'f', 0, 0},
+    {"CURDIR", 'f', 0, 0},
+    {"TINYTEXT", 'k', 0, 0},
+    {"EQV", 'o', 0, 0},
+    {"REGEXP", 'o', 0, 0},
+    {"RESIGNAL", 'k', 0, 0},
+    {"!!", 'o', 0, 0},
+    {"INT3", 't', 0, 0},
+    {"TRANSACTION_TIMESTAMP", 'f', 0, 0},
+    {"BIT_XOR", 'f', 0, 0},
+    {"PERCENT_RANK", 'f', 0, 0},
+    {"INOUT", 'k', 0, 0},
+    {"PARTITION", 'k', 0, 179},
+    {"SET_MASKLEN", 'f', 0, 0},
+    {"NATURAL OUTER", 'k', 0, 0},
+    {"DECRYPTBYKEY", 'f', 0, 0},
+    {"POSITION", 'f', 0, 0},
+    {"CERTENCODED", 'f', 0, 0},
+    {"CURRENT_SERVER", 'v', 0, 0},
+    {"COLLATION", 'f', 0, 0},
+    {"TIMESERIAL", 'f', 0, 0},
+    {"CHR", 'f', 0, 0},
+    {"LOCKED", '\0', 0, 0},
+    {"MIN", 'f', 0, 0},
+    {"FOR UPDATE NOWAIT", 'k', 0, 0},
+    {"DB_NAME", 'f', 0, 0},
+    {"DAYNAME", 'f', 0, 0},
+    {"IF NOT", 'f', 0, 71},
+    {"ACOS", 'f', 0, 0},
+    {"SUBTIME", 'f', 0, 0},
+    {"CURRENTUSER", 'f', 0, 0},
+    {"_KOI8R", 't', 0, 0},
+    {"NEXT VALUE FOR", 'k', 0, 0},
+    {"DATETIMEOFFSETFROMPARTS", 'f', 0, 0},
+    {"STATS_DATE", 'f', 0, 0},
+    {"SUBSTRING", 'f', 0, 0},
+    {"INSERT HIGH_PRIORITY", 'E', 0, 92},
+    {"CURRENT_TIMESTAMP", 'v', 1, 0},
+    {"DUMPFILE", '\0', 0, 0},
+    {"BINARY_DOUBLE_NAN", '1', 0, 0},
+    {"DFIRST", 'f', 0, 0},
+    {"NEXT VALUE", 'n', 0, 163},
+    {"SYSOBJECTS", 'k', 0, 0},
+    {"ISFINITE", 'f', 0, 0},
+    {"PG_SLEEP", 'f', 0, 0},
+    {"DELAYED INTO", '\0', 0, 0},
+    {"PERIOD_ADD", 'f', 0, 0},
+    {"RANK", 'f', 0, 0},
+    {"QUOTE_IDENT", 'f', 0, 0},
+    {"HIGH_PRIORITY INTO", '\0', 0, 0},
+    {"BIN", 'f', 0, 0},
+    {"IIF", 'f', 0, 0},
+    {"IN SHARE", '\0', 0, 0},
+    {"-=", 'o', 0, 0},
+    {"SYS.STRAGG", 'f', 0, 0},
+    {"UTL_HTTP.REQUEST", 'f', 0, 0},
+    {"INSERT INTO", 'T', 0, 0},
+    {"PG_IS_IN_RECOVERY", 'f', 0, 0},
+    {"FILELEN", 'f', 0, 0},
+    {"FILEGROUPPROPERTY", 'f', 0, 0},
+    {"_MACROMAN", 't', 0, 0},
+    {"ROLLUP", '\0', 0, 0},
+    {"ATAN2", 'f', 0, 0},
+    {"TEXT", 't', 0, 0},
+    {"STUFF", 'f', 0, 0},
+    {"ARRAY_DIM", 'f', 0, 0},
+    {"ABORT", 'k', 0, 0},
+    {"OPTIONALLY", 'k', 0, 0},
+    {"MAKEDATE", 'f', 0, 0},
+    {"LOCALTIME", 'v', 1, 0},
+    {"PG_LS_DIR", 'f', 0, 0},
+    {"CREATE", 'E', 0, 18},
+    {"ROW_NUMBER", 'f', 0, 0},
+    {"ARRAY_FILL", 'f', 0, 0},
+    {"HOST_NAME", 'f', 0, 0},
+    {"MASTER_SSL_VERIFY_SERVER_CERT", 'k', 0, 0},
+    {"DLOOKUP", 'f', 0, 0},
+    {"TRY_CONVERT", 'f', 0, 0},
+    {"ASYMKEY_ID", 'f', 0, 0},
+    {"XMLFORMAT", 'f', 0, 0},
+    {"OBJECT_ID", 'f', 0, 0},
+    {"SYS", '\0', 16, 0},
+    {"TOTAL_CHANGES", 'f', 0, 0},
+    {"DES_ENCRYPT", 'f', 0, 0},
+    {"IS_MEMBER", 'f', 0, 0},
+    {"COUNT_BIG", 'k', 0, 0},
+    {"PG_HAS_ROLE", 'f', 0, 0},
+    {"FULL OUTER JOIN", 'k', 0, 0},
+    {"LENGTH", 'f', 0, 0},
+    {"IFNULL", 'f', 0, 0},
+    {"SMALLSERIAL", 't', 0, 0},
+    {"READ", 'k', 0, 188},
+    {"LAST_VALUE", 'f', 0, 0},
+    {"UNI_ON", 'U', 0, 0},
+    {"LOCK", 'n', 0, 125},
+    {"SHARE MODE", '\0', 0, 0},
+    {"OBJECT_NAME", 'f', 0, 0},
+    {"RANDOM", 'f', 0, 0},
+    {"GOTO", 'T', 0, 0},
+    {"TRAILING", 'n', 0, 0},
+    {"FORMAT", 'f', 0, 0},
+    {"REPEAT", 'k', 0, 0},
+    {"KEY_GUID", 'f', 0, 0},
+    {"LOCK IN SHARE MODE", 'k', 0, 0},
+    {"DISTINCT ALL", '\0', 0, 0},
+    {"PERMISSIONS", 'f', 0, 0},
+    {"RIGHT OUTER", 'k', 0, 194},
+    {"SQL", 'k', 0, 0},
+    {"NOT REGEXP", 'o', 0, 0},
+    {"USING", 'f', 0, 0},
+    {"SQL_BIG_RESULT", 'k', 0, 0},
+    {"CONV", 'f', 0, 0},
+    {"QUOTENAME", 'f', 0, 0},
+    {"TO_NUMBER", 'f', 0, 0},
+    {"TERTIARY_WEIGHTS", 'f', 0, 0},
+    {"NATURAL INNER", 'k', 0, 0},
+    {"GENERATE_SERIES", 'f', 0, 0},
+    {"PG_CREATE_RESTORE_POINT", 'f', 0, 0},
+    {"ORIGINAL_DB_NAME", 'f', 0, 0},
+    {"PERCENTILE_COUNT", 'f', 0, 0},
+    {"OPENROWSET", 'f', 0, 0},
+    {"FOR UPDATE", 'k', 0, 51},
+    {"_HP8", 't', 0, 0},
+    {"PG_TERMINATE_BACKEND", 'f', 0, 0},
+    {"VALUES", 'k', 0, 0},
+    {"NOT RLIKE", 'o', 0, 0},
+    {"THEN", 'k', 0, 0},
+    {"ORD", 'f', 0, 0},
+    {"FROM_DAYS", 'f', 0, 0},
+    {"NOWAIT", 'k', 0, 0},
+    {"AES_DECRYPT", 'f', 0, 0},
+    {"ZONE", '\0', 0, 0},
+    {"ARRAY_AGG", 'f', 0, 0},
+    {"EXIT", 'k', 0, 0},
+    {"NATURAL RIGHT OUTER JOIN", 'k', 0, 0},
+    {"INDEXKEY_PROPERTY", 'f', 0, 0},
+    {"OLD_PASSWORD", 'f', 0, 0},
+    {">=", 'o', 0, 0},
+    {"KEYS", 'k', 0, 0},
+    {"WEEKDAYNAME", 'f', 0, 0},
+    {"%=", 'o', 0, 0},
+    {"NOT LIKE", 'o', 4, 0},
+    {"EVENTDATA", 'f', 0, 0},
+    {"SHA", 'f', 0, 0},
+    {"ISEMPTY", 'f', 0, 0},
+    {"STDDEV_SAMP", 'f', 0, 0},
+    {"FILETOCLOB", 'f', 0, 0},
+    {"CURRENT_TIME", 'v', 1, 0},
+    {"CEILING", 'f', 0, 0},
+    {"DELAY", 'k', 0, 0},
+    {"COUNT", 'f', 0, 0},
+    {"UNDO", 'k', 0, 0},
+    {"CURRENT_SCHEMAS", 'f', 0, 0},
+    {"RADIANS", 'f', 0, 0},
+    {"TRUNCATE", 'f', 0, 0},
+    {"GETDATE", 'f', 0, 0},
+    {"DECLARE", 'T', 0, 0},
+    {"DATE_PART", 'f', 0, 0},
+    {"REGEXP_SPLIT_TO_TABLE", 'f', 0, 0},
+    {"BEGIN GOTO", 'T', 0, 0},
+    {"HAS_PERMS_BY_NAME", 'f', 0, 0},
+    {"PROCEDURE", 'k', 0, 186},
+    {"TRY DECLARE", '\0', 0, 0},
+    {"NOTNULL", 'k', 0, 0},
+    {"TAN", 'f', 0, 0},
+    {"_GREEK", 't', 0, 0},
+    {"LCASE", 'f', 0, 0},
+    {"NATURAL LEFT OUTER JOIN", 'k', 0, 0},
+    {"MODIFIES", 'k', 0, 0},
+    {"TIMEOFDAY", 'f', 0, 0},
+    {"TO_DATE", 'f', 0, 0},
+    {"PI", 'f', 0, 0},
+    {"VALUE FOR", '\0', 0, 0},
+    {"LOCK IN", 'n', 0, 131},
+    {"YEARWEEK", 'f', 0, 0},
+    {"PG_ROTATE_LOGFILE", 'f', 0, 0},
+    {"FILETOBLOB", 'f', 0, 0},
+    {"MONEY", 't', 0, 0},
+    {"YEAR", 'f', 0, 0},
+    {"LOCK TABLE", 'k', 0, 0},
+    {"ELSE", 'k', 0, 0},
+    {"USER_LOCK.SLEEP", 'f', 0, 0},
+    {"_CP1250", 't', 0, 0},
+    {"RANDOMBLOB", 'f', 0, 0},
+    {"DO", 'n', 0, 0},
+    {"EXP", 'f', 0, 0},
+    {"CONDITION", 'k', 0, 0},
+    {"EXECUTE AS", 'E', 0, 42},
+    {"MERGE", 'k', 0, 0},
+    {"CURRENT FUNCTION", 'v', 0, 35},
+    {"VARCHARACTER", 'k', 0, 0},
+    {"TYPEOF", 'f', 0, 0},
+    {"DATE_SUB", 'f', 0, 0},
+    {"RIGHT OUTER JOIN", 'k', 0, 0},
+    {"IN", 'k', 2, 73},
+    {"TABLE", 'n', 0, 0},
+    {"DAY_MINUTE", 'k', 0, 0},
+    {"WHERE", 'k', 0, 0},
+    {"TO_BASE64", 'f', 0, 0},
+    {"DATE_FORMAT", 'f', 0, 0},
+    {"CLOCK_TIMESTAMP", 'f', 0, 0},
+    {"SCHEMAS", 'k', 0, 0},
+    {"TO_CHAR", 'f', 0, 0},
+    {"VAR_POP", 'f', 0, 0},
+    {"IF NOT EXISTS", 'f', 0, 0},
+    {"UTC_DATE", 'k', 0, 0},
+    {"AT TIME ZONE", 'k', 0, 0},
+    {"OPEN", 'k', 0, 0},
+    {"LONGTEXT", 'k', 0, 0},
+    {"STRING_TO_ARRAY", 'f', 0, 0},
+    {"LEFT", 'f', 0, 116},
+    {"SUSER_NAME", 'f', 0, 0},
+    {"UUID", 'f', 0, 0},
+    {"CURSOR", 'k', 0, 0},
+    {"DATEDIFF", 'f', 0, 0},
+    {"INTERVAL", 'k', 0, 0},
+    {"FETCH", 'k', 0, 0},
+    {"INET_ATON", 'f', 0, 0},
+    {"AGE", 'f', 0, 0},
+    {"MEDIUMBLOB", 'k', 0, 0},
+    {"COLLATE", 'A', 0, 0},
+    {"CURRENT PATH", 'v', 0, 0},
+    {"PG_STAT_FILE", 'f', 0, 0},
+    {"SHARE", '\0', 0, 0},
+    {"SHA2", 'f', 0, 0},
+    {"EACH", 'k', 0, 0},
+    {"LOCK TABLES", 'k', 0, 0},
+    {"STATEMENT_TIMESTAMP", 'f', 0, 0},
+    {"SERVER", '\0', 0, 0},
+    {"CURRENT_USER", 'v', 1, 0},
+    {"DAYOFWEEK", 'f', 0, 0},
+    {"PWDCOMPARE", 'f', 0, 0},
+    {"XPATH_EXISTS", 'f', 0, 0},
+    {"_BIG5", 't', 0, 0},
+    {"SKIP LOCKED", '\0', 0, 0},
+    {"SYSUTCDATETME", 'f', 0, 0},
+    {"SYS.FN_BUILTIN_PERMISSIONS", 'f', 0, 0},
+    {"CURRENT DATE", 'v', 0, 0},
+    {"DOUBLE PRECISION", 't', 0, 0},
+    {"_GB2312", 't', 0, 0},
+    {"LOWER_INC", 'f', 0, 0},
+    {"TRUNC", 'f', 0, 0},
+    {"SOUNDS LIKE", 'o', 0, 0},
+    {"ASENSITIVE", 'k', 0, 0},
+    {"ISDATE", 'f', 0, 0},
+    {"TIMESTAMPADD", 'f', 0, 0},
+    {"TRIM", 'f', 0, 0},
+    {"CHARACTER_LENGTH", 'f', 0, 0},
+    {"CURTIME", 'f', 0, 0},
+    {"REGTYPE", 't', 0, 0},
+    {"CONVERT", 'f', 0, 0},
+    {"SETVAL", 'f', 0, 0},
+    {"COT", 'f', 0, 0},
+    {"COS", 'f', 0, 0},
+    {"DEGREE", '\0', 0, 0},
+    {"SIGNBYASMKEY", 'f', 0, 0},
+    {"UNNEST", 'f', 0, 0},
+    {"TO_HEX", 'f', 0, 0},
+    {"BY", 'n', 0, 0},
+    {"ENCRYPTBYCERT", 'f', 0, 0},
+    {"XML_IS_WELL_FORMED", 'f', 0, 0},
+    {"SSL", 'k', 0, 0},
+    {"COMPRESS", 'f', 0, 0},
+    {"GROUP_CONCAT", 'f', 0, 0},
+    {"_UTF8", 't', 0, 0},
+    {"LOG", 'f', 0, 0},
+    {"CURRVAL", 'f', 0, 0},
+    {"BYTEA", 't', 0, 0},
+    {"LEAST", 'f', 0, 0},
+    {"SETSEED", 'f', 0, 0},
+    {"MICROSECOND", 'f', 0, 0},
+    {"UNCOMPRESS_LENGTH", 'f', 0, 0},
+    {"IS_FREE_LOCK", 'f', 0, 0},
+    {"CHAR", 'f', 0, 0},
+    {"USER_LOCK", '\0', 16, 0},
+    {"REGEXP_SUBSTR", 'f', 0, 0},
+    {"ANY", 'f', 0, 0},
+    {"UNSIGNED", 'k', 0, 0},
+    {"XPATH", 'f', 0, 0},
+    {"DISTINCTROW", 'k', 0, 0},
+    {"TO_ASCII", 'f', 0, 0},
+    {"DATA", '\0', 0, 0},
+    {"ROW_COUNT", 'f', 0, 0},
+    {"INITCAP", 'f', 0, 0},
+    {"SQL_NO_CACHE", 'k', 0, 0},
+    {"INSERT IGNORE", 'E', 0, 94},
+    {"_SJIS", 't', 0, 0},
+    {"INET_NTOA", 'f', 0, 0},
+    {"&=", 'o', 0, 0},
+    {"WAITFOR DELAY", 'E', 0, 0},
+    {"INFILE", 'k', 0, 0},
+    {"EXPORT_SET", 'f', 0, 0},
+    {"SERIAL8", 't', 0, 0},
+    {"VERSION", 'f', 0, 0},
+    {"PARTITION BY", 'B', 0, 0},
+    {"RIGHT JOIN", 'k', 0, 0},
+    {"IS NOT DISTINCT FROM", 'o', 0, 0},
+    {"DATEADD", 'f', 0, 0},
+    {"INSERT IGNORE INTO", 'T', 0, 0},
+    {"NOT SIMILAR TO", 'o', 0, 0},
+    {"CSNG", 'f', 0, 0},
+    {"<>", 'o', 0, 0},
+    {"DAVG", 'f', 0, 0},
+    {"BETWEEN", 'o', 0, 0},
+    {"ALTER TABLE", 'k', 0, 0},
+    {"SERIAL", 't', 0, 0},
+    {"SYS.FN_GET_AUDIT_FILE", 'f', 0, 0},
+    {"BOOL_AND", 'f', 0, 0},
+    {"NOT DISTINCT FROM", '\0', 0, 0},
+    {"HOUR", 'f', 0, 0},
+    {"TIMEVALUE", 'f', 0, 0},
+    {"XMLAGG", 'f', 0, 0},
+    {"TYPE_NAME", 'f', 0, 0},
+    {"ORDER BY", 'B', 0, 0},
+    {"LOAD_EXTENSION", 'f', 0, 0},
+    {"TIME_TO_SEC", 'f', 0, 0},
+    {"MONTHNAME", 'f', 0, 0},
+    {"INSERT HIGH_PRIORITY INTO", 'T', 0, 0},
+    {"NOW", 'f', 0, 0},
+    {"PG_READ_BINARY_FILE", 'f', 0, 0},
+    {"DECIMAL", 't', 0, 0},
+    {"_GBK", 't', 0, 0},
+    {"INSTR", 'f', 0, 0},
+    {"!<", 'o', 0, 0},
+    {"USER_NAME", 'n', 1, 0},
+    {"OWN3D BY", 'B', 0, 0},
+    {"CURRENT_DATE", 'v', 1, 0},
+    {"ATAN", 'f', 0, 0},
+    {"IDENT_CURRENT", 'f', 0, 0},
+    {"XMLCONCAT", 'f', 0, 0},
+    {"PG_CONF_LOAD_TIME", 'f', 0, 0},
+    {"PUBLISHINGSERVERNAME", 'f', 0, 0},
+    {"REGEXP_SPLIT_TO_ARRAY", 'f', 0, 0},
+    {"NATURAL FULL OUTER JOIN", 'k', 0, 0},
+    {"SHUTDOWN", 'T', 0, 0},
+    {"DOMAIN", '\0', 0, 0},
+    {"_CP1257", 't', 0, 0},
+    {"FUNCTION", 'k', 0, 0},
+    {"EXECUTE", 'T', 0, 39},
+    {"IS_OBJECTSIGNED", 'f', 0, 0},
+    {"_LATIN5", 't', 0, 0},
+    {"DIV", 'o', 0, 0},
+    {"~*", 'o', 0, 0},
+    {"PERCENTILE_RANK", 'f', 0, 0},
+    {"LIKE", 'o', 4, 0},
+    {"LONGBLOB", 'k', 0, 0},
+    {"ENCLOSED", 'k', 0, 0},
+    {"GROUP", 'n', 0, 65},
+    {"EXTRACT", 'f', 0, 0},
+    {"SCHEMA_ID", 'f', 0, 0},
+    {"TIME", 'k', 0, 0},
+    {"BIT_AND", 'f', 0, 0},
+    {"CURRENT_TIMEZONE", 'v', 0, 0},
+    {"TRIGGER_NESTLEVEL", 'f', 0, 0},
+    {"ROW", 'f', 0, 0},
+    {"_DEC8", 't', 0, 0},
+    {"FULL OUTER", 'k', 0, 63},
+    {"XOR", '&', 0, 0},
+    {"DMAX", 'f', 0, 0},
+    {"<=", 'o', 0, 0},
+    {"SIGNBYCERT", 'f', 0, 0},
+    {"SHA1", 'f', 0, 0},
+    {"MINUTE_MICROSECOND", 'k', 0, 0},
+    {"ALL", '\0', 0, 0},
+    {"FILEDATETIME", 'f', 0, 0},
+    {"TEXTVALID", 'f', 0, 0},
+    {"SWITCHOFFET", 'f', 0, 0},
+    {"WITH ROLLUP", 'k', 0, 0},
+    {"CURRENT TIMEZONE", 'v', 0, 0},
+    {"NATURAL RIGHT", 'k', 0, 156},
+    {"CASE", 'E', 0, 0},
+    {"DATETIME2FROMPARTS", 'f', 0, 0},
+    {"TYPE_ID", 'f', 0, 0},
+    {"CURRENT_SETTING", 'f', 0, 0},
+    {"FUNCTION PATH", '\0', 0, 0},
+    {"CLNG", 'f', 0, 0},
+    {"USAGE", 'k', 0, 0},
+    {"BTRIM", 'f', 0, 0},
+    {"INTERSECT", 'U', 0, 98},
+    {"DBMS_UTILITY.SQLID_TO_SQLHASH", 'f', 0, 0},
+    {"CURRENT SERVER", 'v', 0, 0},
+    {"FLOAT4", 't', 0, 0},
+    {"CBRT", 'f', 0, 0},
+    {"LOW_PRIORITY INTO", '\0', 0, 0},
+    {"BINARY_FLOAT_NAN", '1', 0, 0},
+    {"MAXVALUE", 'k', 0, 0},
+    {"CERTPRIVATEKEY", 'f', 0, 0},
+    {"_KEYBCS2", 't', 0, 0},
+    {"::", 'o', 0, 0},
+    {"MASKLEN", 'f', 0, 0},
+    {"INSENSITIVE", 'k', 0, 0},
+    {"SERIAL4", 't', 0, 0},
+    {"BEGIN TRY DECLARE", 'T', 0, 0},
+    {"BINARY", 't', 0, 0},
+    {"RELEASE_LOCK", 'f', 0, 0},
+    {"ESCAPED", 'k', 0, 0},
+    {"DCOUNT", 'f', 0, 0},
+    {"ONE_SHOT", 'k', 0, 0},
+    {"ENUM_LAST", 'f', 0, 0},
+    {"AS", 'k', 0, 0},
+    {"PREVIOUS VALUE FOR", 'k', 0, 0},
+    {"WEEKOFYEAR", 'f', 0, 0},
+    {"SETATTR", 'f', 0, 0},
+    {"REGEXP_MATCHES", 'f', 0, 0},
+    {"SEPARATOR", 'k', 0, 0},
+    {"DOUBLE", 't', 0, 37},
+    {"INSERT LOW_PRIORITY", 'E', 0, 96},
+    {"+=", 'o', 0, 0},
+    {"PG_READ_FILE", 'f', 0, 0},
+    {"ISNULL", 'f', 0, 0},
+    {"USER_ID", 'n', 1, 0},
+    {"MIDDLEINT", 'k', 0, 0},
+    {"MD5", 'f', 0, 0},
+    {"ARRAY_LOWER", 'f', 0, 0},
+    {"DESC", 'k', 0, 0},
+    {"WAITFOR TIME", 'E', 0, 0},
+    {"UNHEX", 'f', 0, 0},
+    {"WEEK", 'f', 0, 0},
+    {"SET_BIT", 'f', 0, 0},
+    {"DATENAME", 'f', 0, 0},
+    {"_CP852", 't', 0, 0},
+    {"PG_SWITCH_XLOG", 'f', 0, 0},
+    {"ACCESSIBLE", 'k', 0, 0},
+    {"_LATIN1", 't', 0, 0},
+    {"COLUMNS_UPDATED", 'f', 0, 0},
+    {"NULL", 'v', 0, 0},
+    {"INTO DUMPFILE", 'k', 0, 0},
+    {"CURRENT_DATABASE", 'f', 0, 0},
+    {"INDEX_COL", 'f', 0, 0},
+    {"OPENDATASOURCE", 'f', 0, 0},
+    {"ELT", 'f', 0, 0},
+    {"XMLCOMMENT", 'f', 0, 0},
+    {"DB_ID", 'f', 0, 0},
+    {"SPACE", 'f', 0, 0},
+    {"_MACCE", 't', 0, 0},
+    {"DISTINCT FROM", '\0', 0, 0},
+    {"SCHAMA_NAME", 'f', 0, 0},
+    {"SIMILAR", 'k', 0, 199},
+    {"CHDRIVE", 'f', 0, 0},
+    {"DATE_ADD", 'f', 0, 0},
+    {"CONVERT_TZ", 'f', 0, 0},
+    {"UPDATE SKIP", '\0', 0, 0},
+    {"REVERSE", 'f', 0, 0},
+    {"IFF", 'f', 0, 0},
+    {"POW", 'f', 0, 0},
+    {"IN BOOLEAN", 'n', 0, 76},
+    {"FOR UPDATE SKIP", 'k', 0, 57},
+    {"UNIQUE", 'n', 0, 0},
+    {"FALSE", '1', 0, 0},
+    {"IGNORE", 'k', 0, 0},
+    {"REGEXP_INSTR", 'f', 0, 0},
+    {"VARIANCE", 'f', 0, 0},
+    {"BOOLEAN MODE", '\0', 0, 0},
+    {"ASC", 'k', 0, 0},
+    {"RECEIVE", '\0', 0, 0},
+    {"GO", 'T', 0, 0},
+    {"CONCAT", 'f', 0, 0},
+    {"STRCOMP", 'f', 0, 0},
+    {"READ WRITE", 'k', 0, 0},
+    {"GET_BYTE", 'f', 0, 0},
+    {"GETATTR", 'f', 0, 0},
+    {"GROUPING_ID", 'f', 0, 0},
+    {"TO_SECONDS", 'f', 0, 0},
+    {"VAR", 'f', 0, 0},
+    {"!>", 'o', 0, 0},
+    {"INTO OUTFILE", 'k', 0, 0},
+    {"LOOP", 'k', 0, 0},
+    {"OVERLAPS", 'f', 0, 0},
+    {"STDDEV", 'f', 0, 0},
+    {"PRINT", 'T', 0, 0},
+    {"IS DISTINCT FROM", 'o', 0, 0},
+    {"GET_LOCK", 'f', 0, 0},
+    {"UNICODE", 'f', 0, 0},
+    {"UNLOCK", 'k', 0, 0},
+    {"!=", 'o', 0, 0},
+    {"FOR UPDATE WAIT", 'k', 0, 0},
+    {"WIDTH_BUCKET", 'f', 0, 0},
+    {"FROM_BASE64", 'f', 0, 0},
+    {"WHILE", 'T', 0, 0},
+    {"DEFAULT", 'k', 0, 0},
+    {"CHANGES", 'f', 0, 0},
+    {"WHEN", 'k', 0, 0},
+    {"TODATETIMEOFFSET", 'f', 0, 0},
+    {"REGEXP_REPLACE", 'f', 0, 0},
+    {"REGCONFIG", 't', 0, 0},
+    {"GRANT", 'k', 0, 0},
+    {"ZEROBLOB", 'f', 0, 0},
+    {"EXTRACTVALUE", 'f', 0, 0},
+    {"UTC_TIME", 'k', 0, 0},
+    {"TO_DAYS", 'f', 0, 0},
+    {"COL_LENGTH", 'f', 0, 0},
+    {"OR", '&', 0, 0},
+    {"CHARSET", 'f', 0, 0},
+    {"BOOLEAN", 't', 0, 0},
+    {"ARRAY_PREPEND", 'f', 0, 0},
+    {"LOCK IN SHARE", 'n', 0, 134},
+    {"SUSER_SNAME", 'f', 0, 0},
+    {"CERT_PROPERTY", 'f', 0, 0},
+    {"FLOAT", 't', 0, 0},
+    {"PRECISION", 'k', 0, 0},
+    {"TRY", 'T', 0, 0},
+    {"UUID_SHORT", 'f', 0, 0},
+    {"FULLTEXT", 'k', 0, 0},
+    {"ASCII", 'f', 0, 0},
+    {"EOMONTH", 'f', 0, 0},
+    {"SYSCOLUMNS", 'k', 0, 0},
+    {"SQLITE_VERSION", 'f', 0, 0},
+    {"LOAD DATA", 'T', 0, 0},
+    {"DECODE", 'f', 0, 0},
+    {"APPLOCK_MODE", 'f', 0, 0},
+    {"MEDIUMINT", 'k', 0, 0},
+    {"GROUPING", 'f', 0, 0},
+    {"MEDIUMTEXT", 'k', 0, 0},
+    {"DAYOFMONTH", 'f', 0, 0},
+    {"DAY_MICROSECOND", 'k', 0, 0},
+    {"&&", '&', 0, 0},
+    {"XP_EXECRESULTSET", 'k', 0, 0},
+    {"_CP866", 't', 0, 0},
+    {"COALESCE", 'f', 0, 0},
+    {"DES_DECRYPT", 'f', 0, 0},
+    {"COLUMN", 'k', 0, 0},
+    {"INDEX", 'k', 0, 0},
+    {"ARRAY_UPPER", 'f', 0, 0},
+    {"IF", 'f', 0, 67},
+    {"_TIS620", 't', 0, 0},
+    {"SQL_SMALL_RESULT", 'k', 0, 0},
+    {"DATEFROMPARTS", 'f', 0, 0},
+    {"BIT_COUNT", 'f', 0, 0},
+    {"^=", 'o', 0, 0},
+    {"MOD", 'o', 0, 0},
+    {"IN BOOLEAN MODE", 'k', 0, 0},
+    {"FLOOR", 'f', 0, 0},
+    {"SELECT ALL", 'E', 0, 0},
+    {"LN", 'f', 0, 0},
+    {"DATABASEPROPERTYEX", 'f', 0, 0},
+    {"BIGSERIAL", 't', 0, 0},
+    {">>", 'o', 0, 0},
+    {"TO_TIMESTAMP", 'f', 0, 0},
+    {"HANDLER", 'T', 0, 0},
+    {"SCHEMA", 'k', 0, 0},
+    {"GET_FORMAT", 'f', 0, 0},
+    {"FORCE", 'k', 0, 0},
+    {"VOID", 't', 0, 0},
+    {"OCT", 'f', 0, 0},
+    {"INSERT", 'E', 0, 80},
+    {"PG_TRIGGER_DEPTH", 'f', 0, 0},
+    {"CSTRING", 't', 0, 0},
+    {"FLOAT8", 't', 0, 0},
+    {"ENCRYPTBYPASSPHRASE", 'f', 0, 0},
+    {"OVERLAY", 'f', 0, 0},
+    {"_HEBREW", 't', 0, 0},
+    {"DEC", 'k', 0, 0},
+    {"RAISEERROR", 'E', 0, 0},
+    {"CBYTE", 'f', 0, 0},
+    {"INNER", 'k', 0, 78},
+    {"ITERATE", 'k', 0, 0},
+    {"CURRENT FUNCTION PATH", 'v', 0, 0},
+    {"PATINDEX", 'f', 0, 0},
+    {"REFERENCES", 'k', 0, 0},
+    {"SENSITIVE", 'k', 0, 0},
+    {"NATURAL", 'n', 0, 136},
+    {"WAITFOR", 'n', 0, 212},
+    {"HASHBYTES", 'f', 0, 0},
+    {"BLOB", 'k', 0, 0},
+    {"EXPLAIN", 'k', 0, 0},
+    {":=", 'o', 0, 0},
+    {"ALTER DOMAIN", 'k', 0, 0},
+    {"JUSTIFY_HOURS", 'f', 0, 0},
+    {"AUTOINCREMENT", 'k', 0, 0},
+    {"DATE_TRUNC", 'f', 0, 0},
+    {"FILEGROUP_NAME", 'f', 0, 0},
+    {"ENCRYPT", 'f', 0, 0},
+    {"SQRT", 'f', 0, 0},
+    {"SLEEP", 'f', 0, 0},
+    {"REVOKE", 'k', 0, 0},
+    {"SYSDATE", 'f', 0, 0},
+    {"HAVING", 'B', 0, 0},
+    {"NOT EXISTS", '\0', 0, 0},
+    {"ANYARRAY", 't', 0, 0},
+    {"IS_USED_LOCK", 'f', 0, 0},
+    {"||", '&', 0, 0},
+    {"SQL_CACHE", 'k', 0, 0},
+    {"SQLWARNING", 'k', 0, 0},
+    {"LEFT JOIN", 'k', 0, 0},
+    {"TOTAL", 'f', 0, 0},
+    {"MASTER_BIND", 'k', 0, 0},
+    {"AT TIME", 'n', 0, 7},
+    {"POWER", 'f', 0, 0},
+    {"TINYINT", 'k', 0, 0},
+    {"NOT IN", 'k', 2, 0},
+    {"PG_LISTENING_CHANNELS", 'f', 0, 0},
+    {"ISNUMERIC", 'f', 0, 0},
+};
+static const size_t sql_keywords_sz = 1050;
+
+static const unsigned int sql_keywords_disp[] = {
+    78, 7, 0, 0, 7, 5, 18, 15, 1, 20, 15, 62, 5, 28, 0, 7, 5, 1, 13, 0, 1, 7, 0,
+    89, 0, 31, 1, 40, 17, 0, 20, 2, 0, 2, 0, 2, 4, 17, 4, 57, 2, 0, 21, 27, 96,
+    1, 3, 1, 4, 15, 47, 1, 38, 48, 13, 70, 4, 8, 40, 19, 3, 18, 20, 8, 26, 0,
+    14, 6, 0, 2, 64, 0, 3, 3, 46, 34, 11, 8, 5, 13, 0, 17, 0, 26, 0, 28, 6, 18,
+    16, 6, 0, 0, 9, 5, 3, 5, 6, 0, 6, 25, 20, 7, 0, 4, 18, 58, 0, 27, 40, 30,
+    16, 3, 20, 11, 53, 92, 0, 36, 28, 33, 21, 6, 43, 0, 17, 77, 0, 27, 22, 7,
+    61, 2, 21, 8, 90, 5, 18, 47, 1, 86, 12, 9, 1, 0, 19, 24, 0, 16, 0, 0, 46, 2,
+    21, 4, 51, 21, 35, 21, 3, 0, 3, 4, 99, 8, 7, 6, 138, 9, 42, 0, 7, 58, 0, 38,
+    0, 5, 13, 2, 9, 39, 0, 30, 20, 364, 25, 7, 90, 6, 1, 16, 2, 2, 6, 20, 62,
+    11, 24, 5, 50, 39, 5, 2, 83, 23, 94, 0, 11, 112, 212, 0, 1, 0, 5, 2, 18, 18,
+    74, 184, 0, 45, 10, 3, 0, 9, 54, 28, 1, 82, 5, 69, 2, 27, 26, 20, 42, 35, 1,
+    94, 109, 1, 209, 8, 7, 22, 6, 63, 38, 35, 147, 13, 18, 19, 5, 111, 0, 652,
+    287, 64, 44, 20, 72, 14, 239, 1, 0, 0, 2, 143, 6, 0, 15, 4, 6, 1, 0, 142,
+    133, 1, 23, 48, 14, 26, 11, 100, 11, 134, 72, 3, 275, 6, 0, 167, 148, 86,
+    114, 418, 7, 31, 0, 0, 116, 167, 2, 67, 85, 117, 37, 0, 20, 3, 144, 0, 178,
+    7, 822, 160, 26, 196, 46, 453, 105, 299, 1, 0, 0, 8, 335, 10, 568, 9, 240,
+    11, 78, 38, 211, 17, 0, 143, 166, 181, 560, 661, 35, 68, 0, 14, 1038, 3,
+    181, 5,
+};
+static const size_t sql_keywords_disp_sz = 350;
+
+static const phrase_t sql_phrases[] = {
+    {0, 0},
+    {794, 1025},
+    {654, 763},
+    {0, 0},
+    {809, 1045},
+    {168, 665},
+    {0, 0},
+    {590, 665},
+    {0, 0},
+    {615, 382},
+    {557, 618},
+    {959, 32},
+    {621, 851},
+    {0, 0},
+    {615, 851},
+    {0, 0},
+    {18, 370},
+    {0, 0},
+    {950, 119},
+    {301, 423},
+    {0, 0},
+    {99, 423},
+    {0, 0},
+    {331, 142},
+    {0, 0},
+    {105, 696},
+    {713, 3},
+    {796, 648},
+    {833, 1015},
+    {344, 680},
+    {998, 369},
+    {687, 839},
+    {809, 306},
+    {283, 827},
+    {0, 0},
+    {344, 1015},
+    {0, 0},
+    {958, 697},
+    {0, 0},
+    {858, 646},
+    {197, 302},
+    {0, 0},
+    {19, 302},
+    {0, 0},
+    {200, 580},
+    {305, 483},
+    {21, 220},
+    {900, 905},
+    {263, 456},
+    {458, 934},
+    {0, 0},
+    {588, 483},
+    {112, 220},
+    {416, 905},
+    {693, 456},
+    {212, 934},
+    {0, 0},
+    {481, 456},
+    {0, 0},
+    {331, 40},
+    {239, 815},
+    {433, 546},
+    {0, 0},
+    {331, 546},
+    {0, 0},
+    {717, 330},
+    {0, 0},
+    {286, 391},
+    {42, 486},
+    {1036, 663},
+    {0, 0},
+    {286, 663},
+    {0, 0},
+    {952, 904},
+    {911, 989},
+    {0, 0},
+    {227, 989},
+    {0, 0},
+    {331, 300},
+    {0, 0},
+    {250, 166},
+    {504, 425},
+    {408, 495},
+    {508, 776},
+    {908, 744},
+    {10, 757},
+    {78, 515},
+    {79, 865},
+    {842, 125},
+    {0, 0},
+    {78, 425},
+    {0, 0},
+    {78, 776},
+    {0, 0},
+    {78, 757},
+    {0, 0},
+    {78, 125},
+    {0, 0},
+    {822, 278},
+    {0, 0},
+    {497, 885},
+    {163, 924},
+    {0, 0},
+    {159, 156},
+    {894, 929},
+    {42, 328},
+    {343, 404},
+    {767, 755},
+    {0, 0},
+    {296, 929},
+    {0, 0},
+    {159, 404},
+    {894, 755},
+    {0, 0},
+    {296, 755},
+    {0, 0},
+    {331, 1042},
+    {239, 89},
+    {433, 354},
+    {0, 0},
+    {331, 354},
+    {0, 0},
+    {740, 966},
+    {407, 359},
+    {0, 0},
+    {653, 632},
+    {511, 954},
+    {258, 562},
+    {654, 638},
+    {55, 685},
+    {0, 0},
+    {682, 954},
+    {554, 562},
+    {0, 0},
+    {227, 562},
+    {0, 0},
+    {309, 139},
+    {546, 792},
+    {1013, 574},
+    {331, 375},
+    {669, 118},
+    {89, 2},
+    {354, 626},
+    {239, 473},
+    {150, 828},
+    {652, 593},
+    {0, 0},
+    {433, 792},
+    {0, 0},
+    {331, 792},
+    {0, 0},
+    {239, 2},
+    {433, 626},
+    {0, 0},
+    {331, 626},
+    {0, 0},
+    {433, 593},
+    {0, 0},
+    {331, 593},
+    {0, 0},
+    {436, 500},
+    {631, 491},
+    {0, 0},
+    {240, 491},
+    {0, 0},
+    {762, 26},
+    {653, 1048},
+    {803, 600},
+    {463, 567},
+    {315, 584},
+    {896, 432},
+    {138, 758},
+    {0, 0},
+    {25, 758},
+    {0, 0},
+    {717, 772},
+    {0, 0},
+    {717, 784},
+    {0, 0},
+    {717, 753},
+    {0, 0},
+    {436, 356},
+    {631, 859},
+    {0, 0},
+    {240, 859},
+    {0, 0},
+    {452, 291},
+    {0, 0},
+    {73, 917},
+    {0, 0},
+    {331, 754},
+    {239, 565},
+    {433, 652},
+    {0, 0},
+    {331, 652},
+    {0, 0},
+    {822, 991},
+    {159, 132},
+    {0, 0},
+    {25, 138},
+    {0, 0},
+    {803, 701},
+    {0, 0},
+    {822, 13},
+    {96, 221},
+    {159, 145},
+    {563, 272},
+    {0, 0},
+    {159, 221},
+    {0, 0},
+    {822, 272},
+    {0, 0},
+    {608, 748},
+    {913, 342},
+    {809, 874},
+    {0, 0},
+    {520, 826},
+    {0, 0},
+};
+
+
+static const unsigned char sql_fingerprint_codes[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 0, 0, 4, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 8, 9, 10, 0, 11, 12, 0, 0, 0,
+    0, 13, 0, 0, 14, 15, 0, 0, 0, 16, 17, 18, 19, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 9, 10, 0, 11, 12, 0, 0, 0, 0, 13, 0, 0, 14, 15, 0, 0, 0, 16, 17, 18, 19,
+    0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#ifndef LIBINJECTION_SQLI_REFERENCE_MATCH
+static const unsigned int sql_fingerprint_next[] = {
+    2062506, 610340, 262146, 1048478, 131072, 653348, 4, 610340, 507834, 966590,
+    610340, 6148, 442270, 1, 610336, 294912, 4, 294912, 294912, 294912, 4, 2048,
+    620580, 264192, 310930, 4100, 149504, 724996, 612388, 1, 913444, 4, 872492,
+    264222, 880644, 790528, 743460, 769189, 364544, 8196, 612384, 914074, 8196,
+    4, 645156, 307902, 8192, 832186, 389786, 751656, 610336, 41232, 4, 8464,
+    41232, 41232, 620580, 309906, 4100, 884736, 149504, 724996, 612388, 1,
+    905252, 4, 872492, 880644, 294912, 743460, 769188, 620580, 264192, 310930,
+    4100, 872448, 149504, 724996, 612388, 1, 913444, 4, 872492, 880676, 743460,
+    769188, 364544, 610336, 36864, 4, 643108, 36864, 36864, 2048, 618532, 4,
+    620580, 264192, 310930, 4100, 149504, 724996, 612388, 1, 913444, 4, 872492,
+    339972, 743460, 769189, 32776, 4, 32776, 32776, 32776, 593924, 2048, 610344,
+    593924, 2048, 610340, 2048, 69636, 2048, 2048, 618532, 612384, 441995,
+    880676, 4, 644134, 441994, 966315, 507531, 28672, 4, 610340, 4, 133120,
+    610340, 1, 618532, 4, 872996, 610340, 2052, 612384, 4, 618532, 64, 782500,
+    610304, 4, 294912, 294912, 294912, 610336, 304787, 8196, 4, 304787, 304787,
+    304787, 610336, 427136, 4, 905252, 429184, 8192, 427136, 596004, 427136,
+    612392, 610336, 301698, 298627, 4, 265859, 298627, 2048, 298627, 4096,
+    593952, 262144, 4096, 610340, 2052, 612384, 4, 643110, 65536, 933822, 2052,
+    507807, 4, 2048, 33921, 610336, 32772, 618532, 4, 784548, 32772, 16384,
+    32772, 612384, 33808, 1025, 1, 652453, 4, 4, 16388, 33808, 16384, 33808, 4,
+    69636, 33921, 2048, 2048, 16384, 643098, 618532, 4, 36926, 561210, 102426,
+    610340, 304259, 4100, 4, 610340, 4, 610340, 9352, 593924, 1152, 2052, 33921,
+    4096, 4, 645160, 612384, 914074, 8196, 4, 275134, 8196, 832186, 373402,
+    610340, 593952, 304259, 4100, 32896, 4, 610340, 4, 610340, 593924, 2052,
+    16388, 610340, 304259, 4100, 1153, 4, 610340, 4, 610340, 610340, 2052,
+    33921, 610340, 304259, 4100, 4, 610340, 4, 610340, 42121, 69636, 33921,
+    2052, 1048498, 32794, 651300, 4, 20, 32794, 32794, 16, 32794, 32776, 4,
+    32776, 32776, 32776, 4100, 593924, 610340, 593924, 610344, 4100, 593924,
+    610340, 4100, 593924, 610340, 610340, 4100, 593924, 610340, 69636, 612384,
+    441995, 618532, 4, 644134, 307850, 966314, 507531, 610340, 4, 133120,
+    610340, 618532, 4, 872996, 610340, 2052, 612384, 4, 593924, 1152, 2048,
+    33920, 618532, 64, 782500, 610304, 4, 294912, 294912, 294912, 610336,
+    304787, 8196, 4, 304786, 304787, 304787, 610336, 427136, 4, 426112, 8192,
+    427136, 596004, 427136, 612392, 610336, 301698, 298627, 4, 264835, 298627,
+    2048, 298627, 612384, 4, 643110, 65536, 933822, 2052, 507806, 606240, 2048,
+    610336, 32772, 618532, 4, 784548, 32772, 16384, 32772, 612384, 33808, 1025,
+    1, 652453, 4, 4, 16388, 33808, 16384, 33808, 612384, 441995, 618532, 4,
+    644134, 441995, 966315, 507531, 28672, 4, 610340, 4, 133120, 610340, 1,
+    618532, 4, 872996, 610340, 2052, 612384, 4, 4, 1024, 1152, 2048, 33921,
+    618532, 64, 782500, 610304, 4, 294912, 294912, 294912, 610336, 304787, 8196,
+    4, 304787, 304787, 304787, 610336, 427136, 4, 905252, 429184, 8192, 427136,
+    596004, 427136, 612392, 610336, 301698, 298627, 4, 265859, 298627, 2048,
+    298627, 612384, 1015710, 4, 643110, 474046, 933823, 2052, 507807, 610336,
+    32772, 618532, 4, 784548, 32772, 16384, 32772, 612384, 33808, 1025, 1,
+    652453, 4, 4, 16388, 33808, 16384, 33808, 4, 69636, 33920, 2048, 643080, 4,
+    643116, 577576, 626696, 4, 593924, 610344, 593952, 32896, 4, 32896, 593924,
+    32896, 32896, 4, 610340, 4, 69636, 651300, 610336, 42129, 4, 610340, 42132,
+    42129, 42129, 610336, 612384, 441995, 618532, 4, 644134, 441995, 966315,
+    507531, 28672, 4, 610340, 4, 133120, 610340, 1, 618532, 4, 872996, 610340,
+    2052, 612384, 4, 618532, 64, 782500, 610304, 4, 294912, 294912, 294912,
+    610336, 304787, 8196, 4, 304787, 304787, 304787, 610336, 427136, 4, 905252,
+    429184, 8192, 427136, 596004, 427136, 612392, 610336, 301698, 298627, 4,
+    265859, 298627, 2048, 298627, 612384, 4, 643110, 933823, 2052, 610336,
+    32772, 618532, 4, 784548, 32772, 16384, 32772, 612384, 33808, 1025, 1,
+    652453, 4, 4, 16388, 33808, 16384, 33808, 294912, 593924, 610344, 294912,
+    593924, 294912, 610340, 294912, 69636, 610336, 4, 790564, 364548, 618532,
+    294912, 32776, 4, 32776, 32776, 32776, 610336, 4, 790564, 364548, 618532,
+    610336, 872452, 4, 266276, 790564, 364548, 618532, 610336, 4, 790564,
+    618532, 24576, 610336, 40960, 4, 610340, 40960, 40960, 40960, 32794, 651300,
+    4, 32794, 32794, 32794, 610340, 295938, 134145, 610340, 1, 24576, 4, 610340,
+    593924, 16384, 3205, 643104, 42113, 4, 872484, 42113, 42113, 2048, 42113,
+    612392, 610340, 610336, 32768, 1, 4, 8192, 618532, 32768, 32768, 610340,
+    295938, 134145, 610340, 1, 16384, 4, 610340, 593924, 16384, 3205, 610340,
+    295938, 1153, 134145, 610340, 1, 24576, 4, 610340, 610340, 16384, 3205,
+    33921, 610340, 295938, 134145, 610340, 1, 24576, 4, 610340, 69636, 33921,
+    16384, 3205, 4, 20480, 8192, 2048, 612384, 300683, 4, 300683, 300683,
+    300683, 610336, 651300, 651300, 610336, 320643, 4, 304259, 304259, 304259,
+    610336, 33792, 4, 610340, 33792, 33792, 33792, 4096, 610336, 297602, 610340,
+    4, 274050, 297602, 2048, 297602, 612384, 272011, 4, 272010, 272011, 304779,
+    2048, 618532, 32776, 618532, 4, 32776, 32776, 32776, 610344, 612384, 173200,
+    4, 643108, 175248, 173200, 173200, 131072, 613408, 177300, 1025, 4, 651300,
+    783540, 4, 177300, 16384, 177300, 4, 32776, 32776, 32776, 610344, 610340,
+    2048, 610340, 2048, 69636, 2048, 32776, 4, 32768, 32776, 32776, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610336, 4, 610344, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610340, 4100, 1025, 610340, 1,
+    610340, 610340, 2052, 610340, 4100, 1025, 610340, 1, 610340, 69636, 2052,
+    32776, 4, 32776, 32776, 32776, 131072, 1, 593924, 610340, 2048, 610344,
+    612384, 427136, 4, 396416, 8192, 427136, 596004, 427136, 131072, 1, 16384,
+    593924, 610340, 2048, 16384, 131072, 1, 610340, 610340, 2048, 610336, 33808,
+    12288, 4, 33808, 33808, 131072, 1, 69636, 610340, 2048, 913440, 49160,
+    618532, 4, 32792, 32776, 32776, 32768, 4, 32776, 32776, 32776, 610340,
+    133120, 610340, 618532, 4, 4100, 2048, 610340, 134145, 610340, 1, 618532,
+    593924, 2052, 610344, 610340, 134145, 610340, 1, 610340, 2052, 610340,
+    134145, 610340, 1, 618532, 610340, 2052, 618532, 610340, 134145, 610340, 1,
+    618532, 69636, 2052, 4, 32768, 4, 32776, 32776, 2048, 4, 610336, 33792, 4,
+    33792, 33792, 33792, 2048, 619685, 32794, 653348, 4, 32794, 32794, 32794,
+    612392, 610340, 610336, 33792, 4, 1024, 610340, 33792, 33792, 262144,
+    882724, 264192, 310930, 4100, 872452, 150529, 724996, 612388, 1, 913444, 4,
+    873004, 743460, 769189, 364548, 2048, 24576, 882724, 264192, 310930, 4100,
+    150529, 724996, 612388, 1, 913444, 4, 873004, 339972, 823332, 743460,
+    769189, 610344, 9345, 1025, 1, 69636, 32776, 4, 32776, 32776, 32776, 4096,
+    593924, 610336, 49152, 4, 610340, 49152, 49152, 49152, 610344, 593952,
+    33792, 149504, 610340, 4, 16384, 33856, 593924, 33792, 610340, 33792, 4096,
+    610340, 157696, 4128, 69636, 32776, 618532, 4, 32776, 32776, 32776, 4100, 1,
+    593924, 1, 645152, 915103, 1025, 1, 1173, 644261, 390847, 24576, 833215,
+    390815, 610344, 2048, 2048, 69668, 4100, 1, 610340, 610340, 4100, 1, 69636,
+    610344, 610336, 4, 790564, 1025, 1, 610340, 9345, 12288, 1024, 610340,
+    915122, 4096, 4, 8, 593924, 8, 32776, 612384, 32778, 4, 610340, 32778,
+    32778, 32778, 612392, 610340, 593952, 915122, 4096, 32776, 4, 593924,
+    610340, 915122, 4096, 8, 4, 610340, 32776, 610340, 915122, 4096, 4, 69636,
+    32776, 612384, 32776, 4, 32776, 32776, 32776, 610340, 134149, 1, 16384,
+    610340, 2048, 610336, 4, 2048, 610336, 32776, 4, 32776, 32776, 32776,
+    610344, 612384, 40968, 4, 271497, 40968, 40968, 262144, 1025, 1, 16384,
+    612384, 4, 799422, 373406, 1025, 1, 2048, 618532, 1025, 1, 69636, 4, 4096,
+    914098, 32794, 618532, 4, 32794, 8, 32794, 32794, 643102, 618532, 4, 36926,
+    561214, 102430, 610340, 304259, 4100, 4, 610340, 4, 610340, 9353, 593924,
+    13441, 2052, 46209, 4096, 4, 645160, 610340, 593952, 304259, 4100, 42113, 4,
+    610340, 4, 610340, 2052, 610336, 16388, 610340, 304259, 4100, 13441, 4,
+    610340, 4, 610340, 610340, 2052, 46209, 610340, 304259, 4100, 4, 610340, 4,
+    610340, 69636, 46209, 2052, 612384, 32776, 4, 32776, 32776, 32776, 32768, 4,
+    32776, 32776, 610340, 134149, 1, 16384, 610340, 2048, 610336, 4, 1025,
+    593924, 2048, 610336, 32776, 4, 32776, 32776, 32776, 610344, 612384, 40968,
+    4, 272024, 40968, 40968, 612384, 4, 799422, 373406, 2048, 618532, 2048,
+    8192, 612384, 32776, 4, 32776, 32776, 32776, 610340, 134149, 1, 16384,
+    610340, 2048, 610336, 4, 1025, 1, 2048, 610336, 32776, 4, 32776, 32776,
+    32776, 610344, 612384, 40968, 4, 271497, 40968, 40968, 612384, 881310, 4,
+    275134, 799422, 373406, 2048, 618532, 1025, 1, 69636, 612384, 32776, 4,
+    32776, 32776, 32776, 610340, 134149, 1, 16384, 610340, 2048, 610336, 4,
+    2048, 610336, 32776, 4, 32776, 32776, 32776, 610344, 612384, 40968, 4,
+    271497, 40968, 40968, 262144, 1025, 1, 16384, 593924, 612384, 4, 799422,
+    1025, 1, 610340, 2048, 618532, 620580, 610340, 905220, 149504, 724996,
+    612388, 1, 913444, 4, 872492, 301118, 880676, 823332, 743460, 769189,
+    364548, 610340, 1048499, 4100, 593924, 612384, 40970, 4, 643108, 40970,
+    8192, 40970, 40970, 612392, 8, 4100, 610340, 1048499, 4100, 593924, 610340,
+    1048499, 4100, 610340, 4100, 610340, 1048499, 4100, 69636, 41232, 593924,
+    610344, 41232, 593924, 41232, 610340, 41232, 69636, 610336, 4, 610304, 4,
+    32768, 32768, 610336, 294912, 4, 262144, 294912, 294912, 610336, 4, 536884,
+    110868, 41232, 32776, 4, 32776, 32776, 32776, 610336, 4, 610304, 4, 32768,
+    32768, 610336, 294912, 4, 262144, 294912, 294912, 610336, 4, 610304, 4,
+    32768, 32768, 610336, 294912, 4, 262144, 294912, 294912, 610336, 618772, 4,
+    12596, 536884, 110868, 610336, 4, 610304, 4, 32768, 32768, 610336, 294912,
+    4, 262144, 294912, 294912, 610336, 4, 536884, 32794, 651300, 4, 32794,
+    32794, 32794, 610340, 295938, 134145, 610340, 1, 24576, 4, 610340, 593924,
+    16384, 3205, 643104, 42113, 4, 610340, 42112, 42113, 42113, 612392, 610340,
+    610336, 32768, 1, 4, 8192, 618532, 32768, 32768, 593956, 295938, 134144,
+    593956, 4, 593956, 593924, 3205, 610340, 295938, 1153, 134145, 610340, 1,
+    24576, 4, 610340, 610340, 16384, 3205, 33921, 610340, 295938, 134145,
+    610340, 1, 24576, 4, 610340, 69636, 33921, 16384, 3205, 612384, 300683, 4,
+    300683, 300683, 300683, 610336, 651300, 651300, 610336, 320643, 4, 304259,
+    304259, 304259, 610336, 33792, 4, 610340, 33792, 33792, 33792, 4096, 610336,
+    297602, 610340, 4, 274050, 297602, 2048, 297602, 612384, 272010, 4, 272010,
+    272011, 304779, 2048, 618532, 32776, 618532, 4, 32768, 32776, 32776, 610344,
+    610336, 4, 790564, 364548, 1025, 1, 9345, 1025, 1, 69636, 612384, 173200, 4,
+    643108, 175248, 173200, 173200, 131072, 613408, 177300, 1025, 4, 634916,
+    785588, 4, 177300, 16384, 177300, 4, 32776, 32776, 32776, 610344, 610340,
+    2048, 610340, 2048, 69636, 2048, 32778, 4, 32770, 32778, 32778, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610336, 4, 610344, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610340, 4100, 1025, 610340, 1,
+    610340, 610340, 2052, 610340, 4100, 1025, 610340, 1, 610340, 69636, 2052,
+    32776, 4, 32776, 32776, 32776, 131072, 1, 593924, 610340, 2048, 610344,
+    131072, 593924, 610340, 2048, 16384, 131072, 1, 610340, 610340, 2048,
+    610336, 33808, 12288, 4, 33808, 33808, 131072, 1, 69636, 610340, 2048,
+    913440, 32776, 618532, 4, 32784, 32776, 32776, 32776, 4, 32768, 32776,
+    32776, 610340, 133120, 610340, 618532, 4, 4100, 2048, 610340, 134144,
+    610340, 1, 618532, 593924, 2052, 610344, 593956, 134144, 610340, 593956,
+    2052, 610340, 134145, 610340, 1, 618532, 610340, 2052, 618532, 610340,
+    134145, 610340, 1, 618532, 69636, 2052, 32794, 653348, 4, 32794, 32794,
+    32794, 612392, 4, 610336, 33792, 4, 1024, 610340, 33792, 33792, 262144,
+    882724, 264192, 310930, 4100, 872452, 134145, 724996, 612388, 1, 913444, 4,
+    873004, 743460, 769189, 364548, 2048, 24576, 882724, 264192, 310930, 4100,
+    150529, 724996, 612388, 1, 913444, 4, 873004, 339972, 823332, 743460,
+    769189, 262144, 262144, 262144, 262144, 9345, 32776, 4, 32776, 32776, 32776,
+    4096, 593924, 610336, 49152, 4, 610340, 49152, 49152, 49152, 610344, 593952,
+    33792, 149504, 610340, 4, 16384, 33856, 593924, 33792, 610340, 33792, 4096,
+    610340, 157696, 4128, 69636, 32776, 618532, 4, 32776, 32776, 32776, 4100, 1,
+    593924, 1, 645152, 915103, 1025, 1, 1173, 644261, 374463, 24576, 833215,
+    390815, 610344, 2048, 2048, 69668, 4100, 1, 610340, 610340, 4100, 1, 69636,
+    32794, 651300, 4, 32794, 32794, 32794, 610340, 295938, 134145, 610340, 1,
+    24576, 4, 610340, 593924, 16384, 3205, 643104, 42113, 4, 610340, 42113,
+    42113, 42113, 612392, 610340, 610336, 32768, 1, 4, 8192, 618532, 32768,
+    32768, 610340, 295938, 134145, 610340, 1, 16384, 4, 610340, 593924, 16384,
+    3205, 610340, 295938, 1153, 134145, 610340, 1, 24576, 4, 610340, 610340,
+    16384, 3205, 33921, 610340, 295938, 134145, 610340, 1, 24576, 4, 610340,
+    69636, 33921, 16384, 3205, 4, 20480, 8192, 2048, 612384, 300683, 4, 300683,
+    300683, 300683, 610336, 651300, 651300, 610336, 320643, 4, 304259, 304259,
+    304259, 610336, 33792, 4, 610340, 33792, 33792, 33792, 4096, 610336, 297602,
+    610340, 4, 274050, 297602, 2048, 297602, 612384, 272011, 4, 272010, 272011,
+    304779, 2048, 618532, 32776, 618532, 4, 32776, 32776, 32776, 610344, 610344,
+    1, 1025, 1, 9345, 1025, 1, 69636, 612384, 173200, 4, 643108, 175248, 173200,
+    173200, 131072, 613408, 177300, 1025, 4, 651300, 785588, 4, 177300, 16384,
+    177300, 4, 32776, 32776, 32776, 610344, 610340, 2048, 610340, 2048, 69636,
+    2048, 32776, 4, 32768, 32776, 32776, 610340, 4100, 1025, 610340, 1, 610340,
+    593924, 2052, 610336, 4, 610344, 610340, 4100, 1025, 610340, 1, 610340,
+    593924, 2052, 610340, 4100, 1025, 610340, 1, 610340, 610340, 2052, 610340,
+    4100, 1025, 610340, 1, 610340, 69636, 2052, 32776, 4, 32776, 32776, 32776,
+    131072, 1, 593924, 610340, 2048, 610344, 612384, 427136, 4, 396416, 8192,
+    427136, 596004, 427136, 131072, 1, 16384, 593924, 610340, 2048, 16384,
+    131072, 1, 610340, 610340, 2048, 610336, 33808, 12288, 4, 33808, 33808,
+    131072, 1, 69636, 610340, 2048, 913440, 49160, 618532, 4, 32792, 32776,
+    32776, 32776, 4, 32776, 32776, 32776, 610340, 133120, 610340, 618532, 4,
+    4100, 2048, 610340, 134145, 610340, 1, 618532, 593924, 2052, 610344, 610340,
+    134145, 610340, 1, 610340, 2052, 610340, 134145, 610340, 1, 618532, 610340,
+    2052, 618532, 610340, 134145, 610340, 1, 618532, 69636, 2052, 32794, 653348,
+    4, 32794, 32794, 32794, 882724, 264192, 310930, 4100, 150529, 724996,
+    612388, 1, 913444, 4, 873004, 264214, 786432, 743460, 769189, 364548,
+    612392, 610340, 610336, 33792, 4, 1024, 610340, 33792, 33792, 882724,
+    858144, 310930, 4100, 819204, 150529, 724996, 612388, 905252, 4, 856620,
+    262144, 743460, 769189, 882724, 264192, 310930, 4100, 872452, 150529,
+    724996, 612388, 1, 913444, 4, 873004, 743460, 769189, 364548, 2048, 24576,
+    882724, 264192, 310930, 4100, 150529, 724996, 612388, 1, 913444, 4, 873004,
+    339972, 823332, 743460, 769189, 32776, 4, 32776, 32776, 32776, 4096, 593924,
+    610336, 49152, 4, 610340, 49152, 49152, 49152, 610344, 593952, 33792,
+    149504, 610340, 4, 16384, 33856, 593924, 33792, 610340, 33792, 4096, 610340,
+    157696, 4128, 69636, 32776, 618532, 4, 32776, 32776, 32776, 4100, 1, 593924,
+    1, 645152, 915103, 1025, 1, 1173, 644261, 374463, 24576, 833215, 390815,
+    610344, 2048, 2048, 69668, 4100, 1, 610340, 610340, 4100, 1, 69636, 610344,
+    610336, 4, 790564, 1025, 1, 610340, 9345, 36864, 4, 8, 593924, 8, 32776,
+    610344, 593952, 36864, 32776, 4, 32776, 593924, 32776, 32776, 36864, 8, 4,
+    32776, 610340, 32776, 36864, 4, 69636, 32776, 8, 610336, 610336, 4, 4096,
+    36864, 36864, 32776, 4, 32776, 32776, 32776, 32776, 4, 32776, 32776, 1025,
+    593924, 610344, 1025, 593924, 610336, 4, 4096, 36864, 1025, 610340, 1025,
+    69636, 610336, 610336, 4096, 4, 4096, 4096, 36864, 610336, 610336, 4, 4096,
+    618528, 32776, 4, 643108, 40968, 8192, 32776, 32776, 32792, 4, 32792, 32792,
+    32792, 4100, 1025, 1, 610340, 593924, 610344, 610336, 42129, 4, 9365, 42129,
+    42129, 8, 4100, 1025, 1, 610340, 593924, 4100, 1025, 1, 610340, 610340,
+    4100, 1025, 1, 610340, 69636, 32768, 4, 32768, 32768, 32768, 32794, 651300,
+    4, 32794, 32794, 32794, 610340, 295938, 134145, 610340, 1, 24576, 4, 610340,
+    593924, 16384, 3205, 643104, 42113, 4, 610340, 42113, 42113, 42113, 612392,
+    610340, 610336, 32768, 1, 4, 8192, 618532, 32768, 32768, 610340, 295938,
+    134145, 610340, 1, 16384, 4, 610340, 593924, 16384, 3205, 610340, 295938,
+    1153, 134145, 610340, 1, 24576, 4, 610340, 610340, 16384, 3205, 33921,
+    610340, 295938, 134145, 610340, 1, 24576, 4, 610340, 69636, 33921, 16384,
+    3205, 4, 20480, 8192, 2048, 612384, 300683, 4, 300683, 300683, 300683,
+    610336, 651300, 651300, 610336, 320643, 4, 304259, 304259, 304259, 610336,
+    33792, 4, 610340, 33792, 33792, 33792, 4096, 610336, 297602, 610340, 4,
+    274050, 297602, 2048, 297602, 612384, 272011, 4, 272011, 272011, 304779,
+    2048, 618532, 32776, 618532, 4, 32776, 32776, 32776, 610344, 612384, 173200,
+    4, 643108, 175248, 173200, 173200, 131072, 613408, 177300, 1025, 4, 651300,
+    785588, 4, 177300, 16384, 177300, 4, 32776, 32776, 32776, 610344, 610340,
+    2048, 610340, 2048, 69636, 2048, 32776, 4, 32768, 32776, 32776, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610336, 4, 610344, 610340,
+    4100, 1025, 610340, 1, 610340, 593924, 2052, 610340, 4100, 1025, 610340, 1,
+    610340, 610340, 2052, 610340, 4100, 1025, 610340, 1, 610340, 69636, 2052,
+    32776, 4, 32776, 32776, 32776, 131072, 1, 593924, 610340, 2048, 610344,
+    612384, 427136, 4, 396416, 8192, 427136, 596004, 427136, 131072, 1, 16384,
+    593924, 610340, 2048, 16384, 131072, 1, 610340, 610340, 2048, 610336, 33808,
+    12288, 4, 33808, 33808, 131072, 1, 69636, 610340, 2048, 913440, 49160,
+    618532, 4, 32792, 32776, 32776, 32776, 4, 32776, 32776, 32776, 610340,
+    133120, 610340, 618532, 4, 4100, 2048, 610340, 134145, 610340, 1, 618532,
+    593924, 2052, 610344, 610340, 134145, 610340, 1, 610340, 2052, 610340,
+    134145, 610340, 1, 618532, 610340, 2052, 618532, 610340, 134145, 610340, 1,
+    618532, 69636, 2052, 32794, 653348, 4, 32794, 32794, 32794, 612392, 610340,
+    610336, 33792, 4, 1024, 610340, 33792, 33792, 882724, 264192, 310930, 4100,
+    872452, 150529, 724996, 612388, 1, 913444, 4, 873004, 743460, 769189,
+    364548, 2048, 24576, 32776, 4, 32776, 32776, 32776, 4096, 593924, 610336,
+    49152, 4, 610340, 49152, 49152, 49152, 610344, 593952, 33792, 149504,
+    610340, 4, 16384, 33856, 593924, 33792, 610340, 33792, 4096, 610340, 157696,
+    4128, 69636, 32776, 618532, 4, 32776, 32776, 32776, 4100, 1, 593924, 1,
+    645152, 915103, 1025, 1, 1173, 644261, 374463, 24576, 833215, 390815,
+    610344, 2048, 2048, 69668, 4100, 1, 610340, 610340, 4100, 1, 69636, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+static const unsigned short sql_fingerprint_child[] = {
+    1, 14, 20, 22, 39, 40, 49, 50, 56, 71, 87, 93, 96, 0, 110, 115, 117, 118,
+    120, 122, 124, 125, 126, 134, 136, 146, 148, 151, 156, 0, 163, 172, 173,
+    181, 187, 194, 197, 205, 216, 220, 222, 228, 240, 242, 243, 251, 262, 263,
+    274, 285, 294, 299, 303, 304, 307, 311, 315, 323, 332, 334, 338, 341, 346,
+    0, 353, 361, 362, 370, 377, 379, 387, 398, 406, 408, 418, 420, 425, 428,
+    433, 0, 440, 449, 450, 458, 466, 474, 485, 489, 494, 496, 497, 504, 506,
+    508, 509, 516, 517, 525, 527, 537, 539, 542, 547, 0, 554, 563, 564, 572,
+    577, 585, 596, 598, 599, 601, 603, 605, 609, 610, 616, 620, 621, 627, 628,
+    631, 632, 633, 640, 646, 657, 665, 666, 675, 686, 699, 711, 714, 715, 721,
+    722, 724, 0, 730, 737, 738, 746, 752, 754, 760, 761, 768, 769, 779, 783,
+    784, 786, 788, 790, 795, 803, 805, 806, 814, 822, 830, 835, 840, 841, 849,
+    855, 856, 861, 867, 872, 879, 884, 891, 898, 899, 905, 912, 913, 920, 921,
+    925, 926, 927, 933, 935, 941, 942, 950, 951, 966, 968, 983, 984, 985, 988,
+    993, 995, 1002, 1003, 1014, 1016, 1017, 1019, 1025, 1028, 0, 1029, 1039,
+    1040, 1041, 1043, 1046, 1047, 1050, 1051, 1054, 1057, 1058, 1059, 1060,
+    1068, 1075, 1076, 1083, 1090, 1096, 1102, 1108, 1110, 1111, 1117, 1118,
+    1124, 1128, 1132, 1134, 1136, 1139, 1140, 1141, 1149, 1155, 1167, 1169,
+    1170, 1180, 1182, 1193, 1203, 1209, 1213, 1219, 1221, 1223, 1224, 1230,
+    1231, 1237, 1241, 1243, 1245, 1251, 1257, 1259, 1261, 1262, 1268, 1269,
+    1275, 1281, 1283, 1286, 1292, 1298, 1300, 1301, 1307, 1308, 1314, 1319,
+    1322, 1325, 1327, 1343, 1347, 1355, 1356, 1358, 1362, 1366, 1367, 1371,
+    1373, 1374, 1376, 1378, 1380, 1382, 1386, 1392, 1396, 1402, 1404, 1408,
+    1414, 1416, 1420, 1426, 1432, 1434, 1438, 1444, 1447, 1453, 1464, 1471,
+    1472, 1481, 1489, 1502, 1514, 1520, 1521, 1523, 1529, 1536, 1537, 1545,
+    1551, 1553, 1559, 1560, 1564, 1566, 1567, 1570, 1577, 1578, 1588, 1592,
+    1593, 1595, 1597, 1599, 1604, 1612, 1614, 1615, 1623, 1631, 1639, 1644,
+    1649, 1650, 1654, 1655, 1660, 1666, 1671, 1678, 1683, 1690, 1697, 1698,
+    1703, 1710, 1711, 1718, 1724, 1725, 1733, 1734, 1749, 1751, 1766, 1770,
+    1771, 1776, 1778, 1785, 1786, 1797, 1799, 1800, 1802, 1808, 1811, 0, 1812,
+    1822, 1823, 1824, 1826, 1829, 1830, 1833, 1839, 1850, 1857, 1858, 1867,
+    1878, 1891, 1903, 1906, 1907, 1913, 1914, 1916, 0, 1922, 1929, 1930, 1938,
+    1944, 1946, 1952, 1953, 1954, 1955, 1957, 1958, 1961, 1968, 1969, 1979,
+    1983, 1984, 1986, 1988, 1990, 1995, 2003, 2005, 2006, 2014, 2022, 2030,
+    2035, 2040, 2041, 2049, 2055, 2056, 2061, 2067, 2072, 2079, 2084, 2091,
+    2098, 2099, 2105, 2112, 2113, 2120, 2126, 2142, 2143, 2151, 2165, 2180,
+    2182, 2197, 2202, 2204, 2211, 2212, 2223, 2225, 2226, 2228, 2234, 2237, 0,
+    2238, 2248, 2249, 2250, 2252, 2255, 2256, 2259, 2260, 2263, 2266, 2267,
+    2273, 2274, 2282, 2288, 2293, 2294, 2298, 2304, 2308, 2310, 2311, 2313,
+    2317, 2319, 2321, 2322, 2328, 2329, 2332, 2340, 2345, 2350, 2351, 2357,
+    2363, 2368, 2373, 2378, 2384, 2395, 2402, 2403, 2412, 2423, 2436, 2448,
+    2451, 2452, 2458, 2459, 2461, 0, 2467, 2474, 2475, 2483, 2489, 2491, 2497,
+    2498, 2505, 2506, 2516, 2520, 2521, 2523, 2525, 2527, 2532, 2540, 2542,
+    2543, 2551, 2559, 2567, 2572, 2577, 2578, 2586, 2592, 2593, 2598, 2604,
+    2609, 2616, 2621, 2628, 2635, 2636, 2642, 2649, 2650, 2657, 2663, 2664,
+    2672, 2687, 2689, 2694, 2696, 2703, 2704, 2715, 2717, 2718, 2720, 2726,
+    2729, 0, 2730, 2740, 2741, 2742, 2744, 2747, 2748, 2751, 2753, 2757, 2763,
+    2765, 2769, 2771, 2777, 2779, 2782, 2787, 2788, 2793, 2798, 2805, 2807,
+    2809, 2810, 2812, 2814, 2816, 2821, 2822, 2827, 2832, 2839, 2844, 2850,
+    2851, 2855, 2860, 2865, 2872, 2877, 2878, 2883, 2890, 2892, 2897, 2899,
+    2900, 2906, 2908, 2910, 2912, 2916, 2924, 2925, 2929, 2933, 2937, 2943,
+    2947, 2950, 0, 2956, 2958, 2959, 2965, 2969, 2970, 2974, 2980, 2984, 2985,
+    2992, 2996, 3000, 3001, 3005, 3012, 3018, 3023, 0, 3024, 3025, 3026, 3033,
+    3034, 3035, 3041, 3045, 3048, 0, 3054, 3055, 3056, 3062, 3066, 3067, 3071,
+    3077, 3081, 3083, 3086, 0, 3092, 3094, 3095, 3101, 3107, 3108, 3112, 3115,
+    3121, 3125, 3128, 0, 3134, 3136, 3137, 3143, 3146, 3149, 3150, 3154, 3155,
+    3157, 3158, 3159, 3165, 3173, 3174, 3182, 3190, 3198, 3203, 3211, 3219,
+    3224, 3231, 3232, 3238, 3244, 3250, 3255, 3257, 3258, 3264, 3266, 3268,
+    3270, 3271, 3276, 3282, 3288, 3289, 3296, 3302, 3303, 3309, 3315, 3322,
+    3323, 3330, 3337, 3345, 3346, 3353, 3355, 3362, 3363, 3365, 3367, 3369,
+    3375, 3381, 3387, 3388, 3395, 3402, 3408, 3414, 3415, 3422, 3430, 3431,
+    3432, 3440, 3452, 3453, 3461, 3462, 3470, 3471, 3473, 3475, 3477, 3483,
+    3489, 3490, 3496, 3497, 3500, 3501, 3503, 3504, 3505, 3507, 3509, 3515,
+    3517, 3518, 0, 3524, 3530, 3534, 3536, 3541, 3542, 3548, 3554, 3556, 3557,
+    0, 3563, 3569, 3573, 3575, 3581, 3583, 3584, 0, 3590, 3596, 3602, 3604,
+    3610, 3612, 3613, 0, 3619, 3625, 3628, 3630, 3632, 3633, 3635, 3637, 3639,
+    0, 3640, 3644, 3650, 3651, 3657, 3663, 3668, 3669, 3674, 3675, 3680, 3686,
+    3691, 0, 3692, 3693, 3697, 3703, 3704, 3705, 0, 3706, 3712, 3718, 3719,
+    3724, 3727, 3729, 3730, 3733, 3736, 0, 3737, 3740, 3746, 3747, 3755, 3758,
+    3765, 3766, 3769, 3771, 3773, 3774, 3775, 3777, 3779, 3781, 3787, 3789,
+    3795, 3802, 3803, 3805, 3806, 3812, 3815, 0, 3821, 3828, 3832, 3834, 3840,
+    3846, 3849, 0, 3855, 3861, 3863, 3869, 3872, 0, 3878, 3885, 3891, 3893,
+    3900, 3906, 3909, 0, 3915, 3922, 3925, 3927, 3928, 3929, 3930, 3932, 3934,
+    3935, 3936, 3941, 3943, 3944, 3946, 3948, 3950, 3951, 3960, 3964, 3973,
+    3974, 3978, 3982, 3986, 3993, 3999, 4004, 4006, 4007, 4008, 4014, 4016,
+    4018, 4019, 4028, 4030, 4040, 4042, 4048, 4052, 4057, 0, 4064, 4073, 4074,
+    4083, 4091, 4102, 4107, 4108, 4110, 4119, 4121, 4131, 4133, 4137, 4142, 0,
+    4149, 4158, 4159, 4168, 4173, 4179, 4187, 4198, 4204, 4207, 0, 4208, 4211,
+    4213, 4214, 4216, 4218, 4220, 4221, 4225, 4230, 4232, 4233, 4239, 4241,
+    4243, 4245, 4251, 4255, 4257, 4260, 4266, 4267, 4268, 4271, 4275, 4277,
+    4283, 4285, 4286, 4292, 4296, 4298, 4301, 4303, 4310, 4311, 4313, 4315,
+    4317, 0, 4319, 0, 4323, 4330, 4344, 0, 4345, 4349, 4358, 4372, 4374, 4387,
+    4400, 4406, 4407, 4408, 4412, 0, 4414, 4420, 4426, 0, 4428, 4431, 4437,
+    4442, 4443, 4448, 0, 4449, 4455, 4458, 4460, 4461, 4467, 4480, 4481, 4482,
+    4483, 4487, 4488, 4490, 4496, 4499, 4500, 4506, 4509, 4512, 4515, 4522,
+    4528, 4532, 4545, 4546, 4548, 4549, 4553, 4559, 4572, 4573, 4574, 4575,
+    4581, 4583, 4589, 4602, 4603, 4604, 4607, 4609, 4615, 4617, 4618, 4620,
+    4622, 4624, 4630, 0, 4634, 4635, 4641, 4642, 4647, 4648, 4649, 4654, 4656,
+    4657, 4659, 4661, 4663, 4669, 4675, 4678, 4679, 4684, 4687, 4690, 4691, 0,
+    4692, 4693, 4699, 4700, 4711, 4722, 0, 4723, 4724, 4731, 0, 4732, 4735,
+    4736, 4737, 4749, 4753, 4760, 4761, 4765, 4766, 4770, 4774, 4783, 4790,
+    4791, 4798, 4806, 4813, 4819, 4825, 4827, 4828, 4834, 4835, 4841, 4845,
+    4849, 4853, 4855, 4860, 4861, 4862, 4870, 4876, 4880, 4886, 4888, 4892,
+    4893, 4899, 4900, 4906, 4908, 4913, 4915, 4921, 4927, 4929, 4933, 4934,
+    4940, 4941, 4947, 4953, 4955, 4960, 4966, 4972, 4974, 4975, 4981, 4982,
+    4988, 4991, 4996, 4998, 5004, 5006, 5007, 5009, 5011, 5013, 5014, 5015,
+    5017, 5019, 5025, 0, 5029, 5030, 5036, 5037, 5042, 5043, 5044, 5048, 5049,
+    5054, 5056, 5057, 5059, 5061, 5063, 5069, 5075, 5078, 5079, 5086, 5089,
+    5092, 5098, 5099, 5110, 5121, 5122, 5129, 5130, 5131, 5137, 5139, 5140,
+    5142, 5144, 5146, 5152, 0, 5156, 5157, 5163, 5164, 5169, 5170, 0, 5171,
+    5172, 5177, 5179, 5180, 5182, 5184, 5186, 5192, 5198, 5201, 5202, 5207,
+    5210, 5213, 5219, 5231, 5232, 5242, 5253, 5264, 5265, 5272, 0, 5273, 5276,
+    5282, 5284, 5285, 5287, 5289, 5291, 5297, 0, 5301, 5302, 5308, 5309, 5314,
+    5315, 5316, 5321, 5323, 5324, 5326, 5328, 5330, 5336, 5342, 5345, 5346,
+    5351, 5354, 5357, 5358, 0, 5359, 5360, 5364, 5370, 5371, 5382, 0, 5383,
+    5389, 5390, 5397, 5405, 5411, 5418, 5421, 5426, 0, 5433, 5442, 5443, 5451,
+    5460, 5468, 5474, 5482, 5493, 5498, 5504, 5520, 5522, 5526, 5532, 5536,
+    5537, 5544, 5548, 5549, 5553, 5557, 5564, 5565, 5567, 5573, 5589, 5591,
+    5595, 5601, 5617, 5619, 5625, 5627, 5633, 5649, 5651, 5654, 5658, 5662,
+    5668, 5672, 5676, 5680, 5686, 5690, 5693, 5698, 5699, 5703, 5704, 5705,
+    5706, 5711, 5713, 5714, 5715, 5717, 5719, 5724, 5725, 5732, 5739, 5743,
+    5745, 5746, 5748, 5750, 5752, 5757, 5758, 5762, 5763, 5764, 5765, 5770,
+    5772, 5773, 5774, 5776, 5778, 5783, 5784, 5788, 5789, 5790, 5791, 5796,
+    5798, 5799, 5800, 5802, 5804, 5809, 5817, 5818, 5824, 5831, 5838, 5843,
+    5844, 5848, 5849, 5850, 5851, 5856, 5858, 5859, 5860, 5862, 5864, 5869,
+    5870, 5877, 5881, 5889, 5890, 5894, 5898, 5902, 5908, 5912, 5915, 0, 5921,
+    5923, 5924, 5930, 5934, 5935, 5939, 5945, 5949, 5950, 5956, 5960, 5964,
+    5968, 5975, 5981, 5986, 0, 5987, 5988, 5989, 5996, 5997, 5998, 6003, 6007,
+    6010, 6015, 6016, 6021, 6025, 6029, 6035, 6039, 6041, 6044, 0, 6050, 6052,
+    6053, 6059, 6065, 6066, 6070, 6073, 6079, 6083, 6086, 0, 6092, 6094, 6095,
+    6101, 6104, 6107, 6108, 6112, 6118, 6126, 6127, 6135, 6143, 6151, 6156,
+    6164, 6172, 6177, 6184, 6185, 6191, 6197, 6203, 6208, 6210, 6211, 6217,
+    6219, 6221, 6223, 6224, 6229, 6235, 6241, 6242, 6249, 6255, 6256, 6262,
+    6268, 6275, 6276, 6283, 6290, 6298, 6299, 6306, 6308, 6315, 6316, 6317,
+    6319, 6321, 6327, 6332, 6333, 6338, 6343, 0, 6344, 6347, 0, 6348, 6351,
+    6357, 6363, 6364, 6371, 6378, 6384, 6390, 6391, 6398, 6406, 6407, 6408,
+    6415, 6428, 6429, 6437, 6438, 6446, 6447, 6449, 6451, 6453, 6459, 6465,
+    6466, 6472, 6473, 6476, 6477, 6480, 6481, 6483, 6486, 6489, 6495, 6497,
+    6498, 0, 6504, 6510, 6514, 6516, 6521, 6522, 6528, 6534, 6536, 6537, 0,
+    6543, 6549, 6553, 6555, 6561, 6563, 6564, 0, 6570, 6576, 6582, 6584, 6590,
+    6592, 6593, 0, 6599, 6605, 6608, 6610, 6612, 6613, 6615, 6617, 6619, 0,
+    6620, 6624, 6630, 6631, 6637, 6638, 6642, 6648, 6649, 6650, 0, 6651, 6657,
+    6663, 6664, 6669, 6672, 6674, 6675, 6678, 6681, 0, 6682, 6685, 6691, 6692,
+    6700, 6702, 6709, 6710, 6712, 6714, 6716, 6718, 6719, 6720, 6722, 6724,
+    6730, 6732, 6738, 6745, 6746, 6748, 6749, 6755, 6758, 0, 6764, 6771, 6775,
+    6777, 6783, 6788, 6791, 6797, 6802, 6804, 6810, 6813, 0, 6819, 6826, 6832,
+    6834, 6841, 6847, 6850, 0, 6856, 6863, 6866, 6868, 6872, 6881, 6882, 6886,
+    6890, 6894, 6901, 6902, 6907, 6909, 6910, 6911, 6917, 6919, 6921, 6922,
+    6931, 6933, 6943, 6945, 6951, 6954, 6959, 0, 6966, 6975, 6976, 6985, 6993,
+    7004, 7009, 7010, 7012, 7021, 7023, 7033, 7035, 7039, 7044, 0, 7051, 7060,
+    7061, 7070, 7075, 7081, 7089, 7100, 7101, 7102, 7103, 7104, 7107, 7109,
+    7110, 7112, 7114, 7116, 7117, 7121, 7126, 7128, 7129, 7135, 7137, 7139,
+    7141, 7147, 7151, 7153, 7156, 7162, 7163, 7164, 7167, 7171, 7173, 7179,
+    7181, 7182, 7188, 7192, 7194, 7197, 7199, 7206, 7207, 7209, 7211, 7213, 0,
+    7215, 0, 7219, 7226, 7240, 0, 7241, 7245, 7254, 7267, 7269, 7282, 7295,
+    7301, 7302, 7303, 7307, 0, 7309, 7315, 7321, 0, 7323, 7326, 7330, 7338,
+    7339, 7343, 7347, 7351, 7357, 7361, 7364, 0, 7370, 7372, 7373, 7379, 7383,
+    7384, 7388, 7394, 7398, 7399, 7405, 7409, 7413, 7417, 7424, 7430, 7435, 0,
+    7436, 7437, 7438, 7445, 7446, 7447, 7453, 7457, 7460, 0, 7466, 7467, 7468,
+    7474, 7478, 7479, 7483, 7489, 7493, 7495, 7498, 0, 7504, 7506, 7507, 7513,
+    7519, 7520, 7524, 7527, 7533, 7537, 7540, 0, 7546, 7548, 7549, 7555, 7558,
+    7561, 7562, 7566, 7567, 7569, 7570, 7571, 7577, 7585, 7586, 7594, 7602,
+    7610, 7615, 7623, 7631, 7636, 7643, 7644, 7650, 7656, 7662, 7667, 7669,
+    7670, 7676, 7678, 7680, 7682, 7683, 7688, 7694, 7700, 7701, 7708, 7714,
+    7715, 7721, 7727, 7734, 7735, 7742, 7749, 7757, 7758, 7765, 7767, 7774,
+    7775, 7777, 7779, 7781, 7787, 0, 7793, 0, 7794, 7797, 0, 7798, 7801, 7807,
+    7813, 7814, 7821, 7828, 7834, 7840, 7841, 7848, 7856, 7857, 7858, 7866,
+    7879, 7880, 7888, 7889, 7897, 7898, 7900, 7902, 7904, 7910, 7916, 7917,
+    7923, 7924, 7927, 7928, 7930, 7931, 7932, 7934, 7936, 7942, 7944, 7945, 0,
+    7951, 7957, 7961, 7963, 7968, 7969, 7975, 7981, 7983, 7984, 0, 7990, 7996,
+    8000, 8002, 8008, 8010, 8011, 0, 8017, 8023, 8029, 8031, 8037, 8039, 8040,
+    0, 8046, 8052, 8055, 8057, 8059, 8060, 8062, 8064, 8066, 0, 8067, 8071,
+    8077, 8078, 8084, 8090, 8095, 8096, 8101, 8102, 8107, 8113, 8118, 0, 8119,
+    8120, 8124, 8130, 8131, 8132, 0, 8133, 8139, 8145, 8146, 8151, 8154, 8156,
+    8157, 8160, 8163, 0, 8164, 8167, 8173, 8174, 8182, 8185, 8192, 8193, 8196,
+    8198, 8200, 8202, 8203, 8205, 8207, 8209, 8215, 8217, 8223, 8230, 8231,
+    8233, 8234, 8240, 8243, 0, 8249, 8256, 8260, 8262, 8268, 8274, 8277, 0,
+    8283, 8289, 8291, 8297, 8300, 0, 8306, 8313, 8319, 8321, 8328, 8334, 8337,
+    0, 8343, 8350, 8353, 8355, 8359, 8368, 8369, 8373, 8377, 8381, 8390, 8392,
+    8402, 8404, 8408, 8413, 0, 8420, 8429, 8430, 8439, 8444, 8446, 8454, 8465,
+    8470, 8477, 8483, 8488, 8490, 8491, 8492, 8498, 8500, 8502, 8511, 8517,
+    8527, 8529, 8533, 8537, 8542, 8549, 8557, 8558, 8566, 8567, 8575, 8586,
+    8595, 8597, 8607, 8609, 8615, 8619, 8624, 0, 8631, 8640, 8641, 8650, 8658,
+    8669, 8674, 8675, 8677, 8686, 8688, 8698, 8700, 8704, 8709, 0, 8716, 8725,
+    8726, 8735, 8740, 8746, 8754, 8765, 8767, 8768, 8770, 8772, 8774, 8775,
+    8779, 8784, 8786, 8787, 8793, 8795, 8797, 8799, 8805, 8809, 8811, 8814,
+    8820, 8821, 8822, 8825, 8829, 8831, 8837, 8839, 8840, 8846, 8850, 8852,
+    8855, 8857, 8864, 8865, 8867, 8869, 8871, 0, 8873, 0, 8877, 8884, 8898, 0,
+    8899, 8903, 8912, 8925, 8927, 8940, 8953, 8959, 8960, 8961, 8965, 0, 8967,
+    8973, 8979, 0, 8981, 8984, 8990, 8995, 8996, 9001, 0, 9002, 9008, 9011,
+    9013, 9014, 9015, 9019, 9020, 9022, 9028, 9032, 9034, 9036, 9037, 9039,
+    9043, 9045, 9047, 9049, 9050, 9051, 9053, 9059, 9061, 9063, 9064, 9067,
+    9069, 9070, 9075, 9080, 9081, 9082, 9084, 9086, 9088, 9089, 9091, 9093,
+    9095, 9097, 9098, 9100, 9102, 9103, 9107, 9113, 9114, 9118, 9123, 9124,
+    9125, 9127, 9128, 9134, 9135, 9138, 9143, 9148, 9149, 9150, 9151, 9152,
+    9154, 9159, 9164, 9165, 9166, 9172, 9174, 9175, 9182, 9185, 9186, 9188,
+    9190, 9193, 9194, 9197, 9200, 9203, 9205, 0, 9206, 9212, 9216, 9222, 9227,
+    9232, 9233, 9238, 9243, 9248, 9249, 9251, 0, 9252, 9258, 9262, 9264, 0,
+    9265, 9271, 9277, 9279, 0, 9280, 9286, 9289, 9290, 9291, 9292, 9293, 9294,
+    9298, 9306, 9307, 9311, 9315, 9319, 9325, 9329, 9332, 0, 9338, 9340, 9341,
+    9347, 9351, 9352, 9356, 9362, 9366, 9367, 9373, 9377, 9381, 9385, 9392,
+    9398, 9403, 0, 9404, 9405, 9406, 9413, 9414, 9415, 9421, 9425, 9428, 0,
+    9434, 9435, 9436, 9442, 9446, 9447, 9451, 9457, 9461, 9463, 9466, 0, 9472,
+    9474, 9475, 9481, 9487, 9488, 9492, 9495, 9501, 9505, 9508, 0, 9514, 9516,
+    9517, 9523, 9526, 9529, 9530, 9534, 9535, 9537, 9538, 9539, 9545, 9553,
+    9554, 9562, 9570, 9578, 9583, 9591, 9599, 9604, 9611, 9612, 9618, 9624,
+    9630, 9635, 9637, 9638, 9644, 9646, 9648, 9650, 9651, 9656, 9662, 9668,
+    9669, 9676, 9682, 9683, 9689, 9695, 9702, 9703, 9710, 9717, 9725, 9726,
+    9733, 9735, 9742, 9743, 9745, 9747, 9749, 9755, 9761, 9767, 9768, 9775,
+    9782, 9788, 9794, 9795, 9802, 9810, 9811, 9812, 9820, 9833, 9834, 9842,
+    9843, 9851, 9852, 9854, 9856, 9858, 9864, 9870, 9871, 9877, 9878, 9881,
+    9882, 9884, 9885, 9886, 9888, 9890, 9896, 9898, 9899, 0, 9905, 9911, 9915,
+    9917, 9922, 9923, 9929, 9935, 9937, 9938, 0, 9944, 9950, 9954, 9956, 9962,
+    9964, 9965, 0, 9971, 9977, 9983, 9985, 9991, 9993, 9994, 0, 10000, 10006,
+    10009, 10011, 10013, 10014, 10016, 10018, 10020, 0, 10021, 10025, 10031,
+    10032, 10038, 10044, 10049, 10050, 10055, 10056, 10061, 10067, 10072, 0,
+    10073, 10074, 10078, 10084, 10085, 10086, 0, 10087, 10093, 10099, 10100,
+    10105, 10108, 10110, 10111, 10114, 10117, 0, 10118, 10121, 10127, 10128,
+    10136, 10139, 10146, 10147, 10150, 10152, 10154, 10156, 10157, 10159, 10161,
+    10163, 10169, 10171, 10177, 10184, 10185, 10187, 10188, 10194, 10197, 0,
+    10203, 10210, 10214, 10216, 10222, 10228, 10231, 0, 10237, 10243, 10245,
+    10251, 10254, 0, 10260, 10267, 10273, 10275, 10282, 10288, 10291, 0, 10297,
+    10304, 10307, 10309, 10313, 10322, 10323, 10327, 10331, 10335, 10342, 10348,
+    10353, 10355, 10356, 10357, 10363, 10365, 10367, 10376, 10378, 10388, 10390,
+    10396, 10400, 10405, 0, 10412, 10421, 10422, 10431, 10439, 10450, 10455,
+    10456, 10458, 10460, 10461, 10463, 10465, 10467, 10468, 10472, 10477, 10479,
+    10480, 10486, 10488, 10490, 10492, 10498, 10502, 10504, 10507, 10513, 10514,
+    10515, 10518, 10522, 10524, 10530, 10532, 10533, 10539, 10543, 10545, 10548,
+    10550, 10557, 10558, 10560, 10562, 10564, 0, 10566, 0, 10570, 10577, 10591,
+    0, 10592, 10596, 10605, 10618, 10620, 10633, 10646, 10652, 10653, 10654,
+    10658, 0, 10660, 10666, 10672, 0, 10674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+typedef enum {
+    WHITELIST_NONE,
+    WHITELIST_UNION,
+    WHITELIST_PAIR,
+    WHITELIST_BAREWORD_COMMENT,
+    WHITELIST_NUMBER_COMMENT,
+    WHITELIST_STRING_CONCAT,
+    WHITELIST_SHORT_LOGIC,
+    WHITELIST_INTO,
+} whitelist_guard_t;
+
+#define WHITELIST_SP_PASSWORD 0x80
+#define WHITELIST_CASES 32
+
+static const unsigned char sql_fingerprint_guard[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 0, 8, 8, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 8, 0, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 11, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 0, 8, 8, 0, 8, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 8, 0, 8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 13, 0, 0, 0, 13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 13, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 13, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0,
+    0, 13, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 13, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 14, 0, 14, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned char sql_whitelist_guard[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 132, 132, 2, 2, 132, 132, 2, 2, 132, 132, 2, 2,
+    132, 132, 2, 2, 132, 132, 2, 2, 132, 132, 2, 2, 132, 132, 2, 2, 132, 132, 1,
+    1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1,
+    2, 2, 1, 1, 2, 2, 2, 2, 130, 131, 2, 2, 130, 131, 2, 2, 130, 131, 2, 2, 130,
+    131, 2, 2, 130, 131, 2, 2, 130, 131, 2, 2, 130, 131, 2, 2, 130, 131, 2, 2,
+    130, 130, 2, 2, 130, 130, 2, 2, 130, 130, 2, 2, 130, 130, 2, 2, 130, 130, 2,
+    2, 130, 130, 2, 2, 130, 130, 2, 2, 130, 130, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+    0, 6, 6, 6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0,
+    6, 6, 6, 6, 0, 0, 0, 0, 128, 128, 128, 128, 0, 0, 0, 0, 128, 128, 128, 128,
+    0, 0, 0, 0, 128, 128, 128, 128, 0, 0, 0, 0, 128, 128, 128, 128, 0, 0, 7, 7,
+    0, 0, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 0,
+    0, 7, 7, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6,
+    0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0, 0, 0, 0, 0, 6, 0, 6, 0, 0, 0, 0, 0, 6, 0,
+    6, 0, 0, 0, 0, 0, 6, 0, 6, 0, 0, 0, 0, 0, 6, 0, 6, 0, 0, 0, 0, 0, 5, 0, 5,
+    0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 5, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128,
+};
+#else
+static const char *const sql_fingerprint_list[] = {
+    "&(1)O", "&(1)U", "&(1O(", "&(1OF", "&(1OS", "&(1OV", "&(F()", "&(F(1",
+    "&(F(F", "&(F(N", "&(F(S", "&(F(V", "&(N)O", "&(N)U", "&(NO(", "&(NOF",
+    "&(NOS", "&(NOV", "&(S)O", "&(S)U", "&(SO(", "&(SO1", "&(SOF", "&(SON",
+    "&(SOS", "&(SOV", "&(V)O", "&(V)U", "&(VO(", "&(VOF", "&(VOS", "&1O(1",
+    "&1O(F", "&1O(N", "&1O(S", "&1O(V", "&1OF(", "&1OS(", "&1OS1", "&1OSF",
+    "&1OSU", "&1OSV", "&1OV(", "&1OVF", "&1OVO", "&1OVS", "&1OVU", "&1UE(",
+    "&1UE1", "&1UEF", "&1UEK", "&1UEN", "&1UES", "&1UEV", "&F()O", "&F()U",
+    "&F(1)", "&F(1O", "&F(F(", "&F(N)", "&F(NO", "&F(S)", "&F(SO", "&F(V)",
+    "&F(VO", "&NO(1", "&NO(F", "&NO(N", "&NO(S", "&NO(V", "&NOF(", "&NOS(",
+    "&NOS1", "&NOSF", "&NOSU", "&NOSV", "&NOV(", "&NOVF", "&NOVO", "&NOVS",
+    "&NOVU", "&NUE(", "&NUE1", "&NUEF", "&NUEK", "&NUEN", "&NUES", "&NUEV",
+    "&SO(1", "&SO(F", "&SO(N", "&SO(S", "&SO(V", "&SO1(", "&SO1F", "&SO1N",
+    "&SO1S", "&SO1U", "&SO1V", "&SOF(", "&SON(", "&SON1", "&SONF", "&SONU",
+    "&SOS(", "&SOS1", "&SOSF", "&SOSU", "&SOSV", "&SOV(", "&SOVF", "&SOVO",
+    "&SOVS", "&SOVU", "&SUE(", "&SUE1", "&SUEF", "&SUEK", "&SUEN", "&SUES",
+    "&SUEV", "&VO(1", "&VO(F", "&VO(N", "&VO(S", "&VO(V", "&VOF(", "&VOS(",
+    "&VOS1", "&VOSF", "&VOSU", "&VOSV", "&VUE(", "&VUE1", "&VUEF", "&VUEK",
+    "&VUEN", "&VUES", "&VUEV", ")&(EK", ")&(EN", ")UE(1", ")UE(F", ")UE(N",
+    ")UE(S", ")UE(V", ")UE1K", ")UE1O", ")UEF(", ")UEK(", ")UEK1", ")UEKF",
+    ")UEKN", ")UEKS", ")UEKV", ")UENK", ")UENO", ")UESK", ")UESO", ")UEVK",
+    ")UEVO", "1&(1&", "1&(1)", "1&(1,", "1&(1O", "1&(E(", "1&(E1", "1&(EF",
+    "1&(EK", "1&(EN", "1&(EO", "1&(ES", "1&(EV", "1&(F(", "1&(N&", "1&(N)",
+    "1&(N,", "1&(NO", "1&(S&", "1&(S)", "1&(S,", "1&(SO", "1&(V&", "1&(V)",
+    "1&(V,", "1&(VO", "1&1", "1&1&(", "1&1&1", "1&1&F", "1&1&N", "1&1&S",
+    "1&1&V", "1&1)&", "1&1)C", "1&1)O", "1&1)U", "1&1;", "1&1;C", "1&1;E",
+    "1&1;T", "1&1B(", "1&1B1", "1&1BF", "1&1BN", "1&1BS", "1&1BV", "1&1C",
+    "1&1EK", "1&1EN", "1&1F(", "1&1K(", "1&1K1", "1&1KF", "1&1KN", "1&1KS",
+    "1&1KV", "1&1O(", "1&1OF", "1&1OS", "1&1OV", "1&1TN", "1&1U", "1&1U(",
+    "1&1U;", "1&1UC", "1&1UE", "1&E(1", "1&E(F", "1&E(N", "1&E(O", "1&E(S",
+    "1&E(V", "1&E1", "1&E1;", "1&E1C", "1&E1K", "1&E1O", "1&EF(", "1&EK(",
+    "1&EK1", "1&EKF", "1&EKN", "1&EKS", "1&EKU", "1&EKV", "1&EN", "1&EN;",
+    "1&ENC", "1&ENK", "1&ENO", "1&ES", "1&ES;", "1&ESC", "1&ESK", "1&ESO",
+    "1&EUE", "1&EV", "1&EV;", "1&EVC", "1&EVK", "1&EVO", "1&F()", "1&F(1",
+    "1&F(E", "1&F(F", "1&F(N", "1&F(S", "1&F(V", "1&K&(", "1&K&1", "1&K&F",
+    "1&K&N", "1&K&S", "1&K&V", "1&K(1", "1&K(F", "1&K(N", "1&K(S", "1&K(V",
+    "1&K1O", "1&KC", "1&KF(", "1&KNK", "1&KO(", "1&KO1", "1&KOF", "1&KOK",
+    "1&KON", "1&KOS", "1&KOV", "1&KSO", "1&KVO", "1&N&(", "1&N&1", "1&N&F",
+    "1&N&N", "1&N&S", "1&N&V", "1&N)&", "1&N)C", "1&N)O", "1&N)U", "1&N;",
+    "1&N;C", "1&N;E", "1&N;T", "1&NB(", "1&NB1", "1&NBF", "1&NBN", "1&NBS",
+    "1&NBV", "1&NC", "1&NEN", "1&NF(", "1&NK(", "1&NK1", "1&NKF", "1&NKN",
+    "1&NKS", "1&NKV", "1&NO(", "1&NOF", "1&NOS", "1&NOV", "1&NTN", "1&NU",
+    "1&NU(", "1&NU;", "1&NUC", "1&NUE", "1&S", "1&S&(", "1&S&1", "1&S&F",
+    "1&S&N", "1&S&S", "1&S&V", "1&S)&", "1&S)C", "1&S)O", "1&S)U", "1&S1",
+    "1&S1;", "1&S1C", "1&S;", "1&S;C", "1&S;E", "1&S;T", "1&SB(", "1&SB1",
+    "1&SBF", "1&SBN", "1&SBS", "1&SBV", "1&SC", "1&SEK", "1&SEN", "1&SF(",
+    "1&SK(", "1&SK1", "1&SKF", "1&SKN", "1&SKS", "1&SKV", "1&SO(", "1&SO1",
+    "1&SOF", "1&SON", "1&SOS", "1&SOV", "1&STN", "1&SU", "1&SU(", "1&SU;",
+    "1&SUC", "1&SUE", "1&SV", "1&SV;", "1&SVC", "1&SVO", "1&V", "1&V&(",
+    "1&V&1", "1&V&F", "1&V&N", "1&V&S", "1&V&V", "1&V)&", "1&V)C", "1&V)O",
+    "1&V)U", "1&V;", "1&V;C", "1&V;E", "1&V;T", "1&VB(", "1&VB1", "1&VBF",
+    "1&VBN", "1&VBS", "1&VBV", "1&VC", "1&VEK", "1&VEN", "1&VF(", "1&VK(",
+    "1&VK1", "1&VKF", "1&VKN", "1&VKS", "1&VKV", "1&VO(", "1&VOF", "1&VOS",
+    "1&VS", "1&VS;", "1&VSC", "1&VSO", "1&VTN", "1&VU", "1&VU(", "1&VU;",
+    "1&VUC", "1&VUE", "1(EF(", "1(EKF", "1(EKN", "1(ENK", "1(U(E", "1)&(1",
+    "1)&(E", "1)&(F", "1)&(N", "1)&(S", "1)&(V", "1)&1", "1)&1&", "1)&1)",
+    "1)&1;", "1)&1B", "1)&1C", "1)&1F", "1)&1O", "1)&1U", "1)&F(", "1)&N",
+    "1)&N&", "1)&N)", "1)&N;", "1)&NB", "1)&NC", "1)&NF", "1)&NO", "1)&NU",
+    "1)&S", "1)&S&", "1)&S)", "1)&S;", "1)&SB", "1)&SC", "1)&SF", "1)&SO",
+    "1)&SU", "1)&V", "1)&V&", "1)&V)", "1)&V;", "1)&VB", "1)&VC", "1)&VF",
+    "1)&VO", "1)&VU", "1),(1", "1),(F", "1),(N", "1),(S", "1),(V", "1);E(",
+    "1);E1", "1);EF", "1);EK", "1);EN", "1);EO", "1);ES", "1);EV", "1);T(",
+    "1);T1", "1);TF", "1);TK", "1);TN", "1);TO", "1);TS", "1);TV", "1)B(1",
+    "1)B(F", "1)B(N", "1)B(S", "1)B(V", "1)B1", "1)B1&", "1)B1;", "1)B1C",
+    "1)B1K", "1)B1N", "1)B1O", "1)B1U", "1)BF(", "1)BN", "1)BN&", "1)BN;",
+    "1)BNC", "1)BNK", "1)BNO", "1)BNU", "1)BS", "1)BS&", "1)BS;", "1)BSC",
+    "1)BSK", "1)BSO", "1)BSU", "1)BV", "1)BV&", "1)BV;", "1)BVC", "1)BVK",
+    "1)BVO", "1)BVU", "1)C", "1)E(1", "1)E(F", "1)E(N", "1)E(S", "1)E(V",
+    "1)E1C", "1)E1O", "1)EF(", "1)EK(", "1)EK1", "1)EKF", "1)EKN", "1)EKS",
+    "1)EKV", "1)ENC", "1)ENO", "1)ESC", "1)ESO", "1)EVC", "1)EVO", "1)F(F",
+    "1)K(1", "1)K(F", "1)K(N", "1)K(S", "1)K(V", "1)K1&", "1)K1;", "1)K1B",
+    "1)K1E", "1)K1O", "1)K1U", "1)KB(", "1)KB1", "1)KBF", "1)KBN", "1)KBS",
+    "1)KBV", "1)KF(", "1)KN&", "1)KN;", "1)KNB", "1)KNC", "1)KNE", "1)KNK",
+    "1)KNU", "1)KS&", "1)KS;", "1)KSB", "1)KSE", "1)KSO", "1)KSU", "1)KUE",
+    "1)KV&", "1)KV;", "1)KVB", "1)KVE", "1)KVO", "1)KVU", "1)O(1", "1)O(E",
+    "1)O(F", "1)O(N", "1)O(S", "1)O(V", "1)O1", "1)O1&", "1)O1)", "1)O1;",
+    "1)O1B", "1)O1C", "1)O1K", "1)O1U", "1)OF(", "1)ON&", "1)ON)", "1)ON;",
+    "1)ONB", "1)ONC", "1)ONK", "1)ONU", "1)OS", "1)OS&", "1)OS)", "1)OS;",
+    "1)OSB", "1)OSC", "1)OSK", "1)OSU", "1)OV", "1)OV&", "1)OV)", "1)OV;",
+    "1)OVB", "1)OVC", "1)OVK", "1)OVO", "1)OVU", "1)U(E", "1)UE(", "1)UE1",
+    "1)UEF", "1)UEK", "1)UEN", "1)UES", "1)UEV", "1,(1)", "1,(1O", "1,(E(",
+    "1,(E1", "1,(EF", "1,(EK", "1,(EN", "1,(ES", "1,(EV", "1,(F(", "1,(N)",
+    "1,(NO", "1,(S)", "1,(SO", "1,(V)", "1,(VO", "1,F()", "1,F(1", "1,F(F",
+    "1,F(N", "1,F(S", "1,F(V", "1;E(1", "1;E(E", "1;E(F", "1;E(N", "1;E(S",
+    "1;E(V", "1;E1,", "1;E1;", "1;E1C", "1;E1K", "1;E1O", "1;E1T", "1;EF(",
+    "1;EK(", "1;EK1", "1;EKF", "1;EKN", "1;EKO", "1;EKS", "1;EKV", "1;EN,",
+    "1;EN;", "1;ENC", "1;ENE", "1;ENK", "1;ENO", "1;ENT", "1;ES,", "1;ES;",
+    "1;ESC", "1;ESK", "1;ESO", "1;EST", "1;EV,", "1;EV;", "1;EVC", "1;EVK",
+    "1;EVO", "1;EVT", "1;N:T", "1;T(1", "1;T(C", "1;T(E", "1;T(F", "1;T(N",
+    "1;T(S", "1;T(V", "1;T1(", "1;T1,", "1;T1;", "1;T1C", "1;T1F", "1;T1K",
+    "1;T1O", "1;T1T", "1;T;", "1;T;C", "1;TF(", "1;TK(", "1;TK1", "1;TKF",
+    "1;TKK", "1;TKN", "1;TKO", "1;TKS", "1;TKV", "1;TN(", "1;TN,", "1;TN1",
+    "1;TN;", "1;TNC", "1;TNF", "1;TNK", "1;TNN", "1;TNO", "1;TNS", "1;TNT",
+    "1;TNV", "1;TO(", "1;TS(", "1;TS,", "1;TS;", "1;TSC", "1;TSF", "1;TSK",
+    "1;TSO", "1;TST", "1;TTN", "1;TV(", "1;TV,", "1;TV;", "1;TVC", "1;TVF",
+    "1;TVK", "1;TVO", "1;TVT", "1A(F(", "1A(N)", "1A(NO", "1A(S)", "1A(SO",
+    "1A(V)", "1A(VO", "1AF()", "1AF(1", "1AF(F", "1AF(N", "1AF(S", "1AF(V",
+    "1ASO(", "1ASO1", "1ASOF", "1ASON", "1ASOS", "1ASOV", "1ASUE", "1ATO(",
+    "1ATO1", "1ATOF", "1ATON", "1ATOS", "1ATOV", "1ATUE", "1AVO(", "1AVOF",
+    "1AVOS", "1AVUE", "1B(1)", "1B(1O", "1B(F(", "1B(NO", "1B(S)", "1B(SO",
+    "1B(V)", "1B(VO", "1B1", "1B1&(", "1B1&1", "1B1&F", "1B1&N", "1B1&S",
+    "1B1&V", "1B1,(", "1B1,F", "1B1;", "1B1;C", "1B1B(", "1B1B1", "1B1BF",
+    "1B1BN", "1B1BS", "1B1BV", "1B1C", "1B1K(", "1B1K1", "1B1KF", "1B1KN",
+    "1B1KS", "1B1KV", "1B1O(", "1B1OF", "1B1OS", "1B1OV", "1B1U(", "1B1UE",
+    "1BE(1", "1BE(F", "1BE(N", "1BE(S", "1BE(V", "1BEK(", "1BF()", "1BF(1",
+    "1BF(F", "1BF(N", "1BF(S", "1BF(V", "1BN", "1BN&(", "1BN&1", "1BN&F",
+    "1BN&N", "1BN&S", "1BN&V", "1BN,(", "1BN,F", "1BN;", "1BN;C", "1BNB(",
+    "1BNB1", "1BNBF", "1BNBN", "1BNBS", "1BNBV", "1BNC", "1BNK(", "1BNK1",
+    "1BNKF", "1BNKN", "1BNKS", "1BNKV", "1BNO(", "1BNOF", "1BNOS", "1BNOV",
+    "1BNU(", "1BNUE", "1BS", "1BS&(", "1BS&1", "1BS&F", "1BS&N", "1BS&S",
+    "1BS&V", "1BS,(", "1BS,F", "1BS;", "1BS;C", "1BSB(", "1BSB1", "1BSBF",
+    "1BSBN", "1BSBS", "1BSBV", "1BSC", "1BSK(", "1BSK1", "1BSKF", "1BSKN",
+    "1BSKS", "1BSKV", "1BSO(", "1BSO1", "1BSOF", "1BSON", "1BSOS", "1BSOV",
+    "1BSU(", "1BSUE", "1BV", "1BV&(", "1BV&1", "1BV&F", "1BV&N", "1BV&S",
+    "1BV&V", "1BV,(", "1BV,F", "1BV;", "1BV;C", "1BVB(", "1BVB1", "1BVBF",
+    "1BVBN", "1BVBS", "1BVBV", "1BVC", "1BVK(", "1BVK1", "1BVKF", "1BVKN",
+    "1BVKS", "1BVKV", "1BVO(", "1BVOF", "1BVOS", "1BVU(", "1BVUE", "1C",
+    "1E(1)", "1E(1O", "1E(F(", "1E(N)", "1E(NO", "1E(S)", "1E(SO", "1E(V)",
+    "1E(VO", "1E1;T", "1E1C", "1E1O(", "1E1OF", "1E1OS", "1E1OV", "1E1T(",
+    "1E1T1", "1E1TF", "1E1TN", "1E1TS", "1E1TV", "1E1UE", "1EF()", "1EF(1",
+    "1EF(F", "1EF(N", "1EF(S", "1EF(V", "1EK(1", "1EK(E", "1EK(F", "1EK(N",
+    "1EK(S", "1EK(V", "1EK1;", "1EK1C", "1EK1O", "1EK1T", "1EK1U", "1EKF(",
+    "1EKN;", "1EKNC", "1EKNE", "1EKNT", "1EKNU", "1EKOK", "1EKS;", "1EKSC",
+    "1EKSO", "1EKST", "1EKSU", "1EKU(", "1EKU1", "1EKUE", "1EKUF", "1EKUS",
+    "1EKUV", "1EKV;", "1EKVC", "1EKVO", "1EKVT", "1EKVU", "1EN;T", "1ENC",
+    "1ENEN", "1ENO(", "1ENOF", "1ENOS", "1ENOV", "1ENT(", "1ENT1", "1ENTF",
+    "1ENTN", "1ENTS", "1ENTV", "1ENUE", "1EOKN", "1ES;T", "1ESC", "1ESO(",
+    "1ESO1", "1ESOF", "1ESON", "1ESOS", "1ESOV", "1EST(", "1EST1", "1ESTF",
+    "1ESTN", "1ESTS", "1ESTV", "1ESUE", "1EU(1", "1EU(F", "1EU(N", "1EU(S",
+    "1EU(V", "1EU1,", "1EU1C", "1EU1O", "1EUEF", "1EUEK", "1EUF(", "1EUS,",
+    "1EUSC", "1EUSO", "1EUV,", "1EUVC", "1EUVO", "1EV;T", "1EVC", "1EVO(",
+    "1EVOF", "1EVOS", "1EVT(", "1EVT1", "1EVTF", "1EVTN", "1EVTS", "1EVTV",
+    "1EVUE", "1F()1", "1F()F", "1F()K", "1F()N", "1F()O", "1F()S", "1F()U",
+    "1F()V", "1F(1)", "1F(1N", "1F(1O", "1F(E(", "1F(E1", "1F(EF", "1F(EK",
+    "1F(EN", "1F(ES", "1F(EV", "1F(F(", "1F(N)", "1F(N,", "1F(NO", "1F(S)",
+    "1F(SO", "1F(V)", "1F(VO", "1K(1O", "1K(F(", "1K(N)", "1K(NO", "1K(S)",
+    "1K(SO", "1K(V)", "1K(VO", "1K)&(", "1K)&1", "1K)&F", "1K)&N", "1K)&S",
+    "1K)&V", "1K);E", "1K);T", "1K)B(", "1K)B1", "1K)BF", "1K)BN", "1K)BS",
+    "1K)BV", "1K)E(", "1K)E1", "1K)EF", "1K)EK", "1K)EN", "1K)ES", "1K)EV",
+    "1K)F(", "1K)O(", "1K)OF", "1K)UE", "1K1", "1K1&(", "1K1&1", "1K1&F",
+    "1K1&N", "1K1&S", "1K1&V", "1K1;", "1K1;C", "1K1;E", "1K1;T", "1K1B(",
+    "1K1B1", "1K1BF", "1K1BN", "1K1BS", "1K1BV", "1K1C", "1K1E(", "1K1E1",
+    "1K1EF", "1K1EK", "1K1EN", "1K1ES", "1K1EV", "1K1O(", "1K1OF", "1K1OS",
+    "1K1OV", "1K1U(", "1K1UE", "1KF()", "1KF(1", "1KF(F", "1KF(N", "1KF(S",
+    "1KF(V", "1KN", "1KN&(", "1KN&1", "1KN&F", "1KN&N", "1KN&S", "1KN&V",
+    "1KN;", "1KN;C", "1KN;E", "1KN;T", "1KNB(", "1KNB1", "1KNBF", "1KNBN",
+    "1KNBS", "1KNBV", "1KNC", "1KNE(", "1KNE1", "1KNEF", "1KNEN", "1KNES",
+    "1KNEV", "1KNU(", "1KNUE", "1KS", "1KS&(", "1KS&1", "1KS&F", "1KS&N",
+    "1KS&S", "1KS&V", "1KS;", "1KS;C", "1KS;E", "1KS;T", "1KSB(", "1KSB1",
+    "1KSBF", "1KSBN", "1KSBS", "1KSBV", "1KSC", "1KSE(", "1KSE1", "1KSEF",
+    "1KSEK", "1KSEN", "1KSES", "1KSEV", "1KSO(", "1KSO1", "1KSOF", "1KSON",
+    "1KSOS", "1KSOV", "1KSU(", "1KSUE", "1KUE(", "1KUE1", "1KUEF", "1KUEK",
+    "1KUEN", "1KUES", "1KUEV", "1KV", "1KV&(", "1KV&1", "1KV&F", "1KV&N",
+    "1KV&S", "1KV&V", "1KV;", "1KV;C", "1KV;E", "1KV;T", "1KVB(", "1KVB1",
+    "1KVBF", "1KVBN", "1KVBS", "1KVBV", "1KVC", "1KVE(", "1KVE1", "1KVEF",
+    "1KVEK", "1KVEN", "1KVES", "1KVEV", "1KVO(", "1KVOF", "1KVOS", "1KVU(",
+    "1KVUE", "1N&F(", "1N(1O", "1N(F(", "1N(S)", "1N(SO", "1N(V)", "1N(VO",
+    "1N)UE", "1N,F(", "1NE(1", "1NE(F", "1NE(N", "1NE(S", "1NE(V", "1NE1C",
+    "1NE1O", "1NEF(", "1NENC", "1NENO", "1NESC", "1NESO", "1NEVC", "1NEVO",
+    "1NU(E", "1NUE", "1NUE(", "1NUE1", "1NUE;", "1NUEC", "1NUEF", "1NUEK",
+    "1NUEN", "1NUES", "1NUEV", "1O(1&", "1O(1)", "1O(1,", "1O(1O", "1O(E(",
+    "1O(E1", "1O(EE", "1O(EF", "1O(EK", "1O(EN", "1O(EO", "1O(ES", "1O(EV",
+    "1O(F(", "1O(N&", "1O(N)", "1O(N,", "1O(NO", "1O(S&", "1O(S)", "1O(S,",
+    "1O(SO", "1O(V&", "1O(V)", "1O(V,", "1O(VO", "1OF()", "1OF(1", "1OF(E",
+    "1OF(F", "1OF(N", "1OF(S", "1OF(V", "1OK&(", "1OK&1", "1OK&F", "1OK&N",
+    "1OK&S", "1OK&V", "1OK(1", "1OK(F", "1OK(N", "1OK(S", "1OK(V", "1OK1C",
+    "1OK1O", "1OKF(", "1OKNC", "1OKO(", "1OKO1", "1OKOF", "1OKON", "1OKOS",
+    "1OKOV", "1OKSC", "1OKSO", "1OKVC", "1OKVO", "1ONSU", "1OS&(", "1OS&1",
+    "1OS&E", "1OS&F", "1OS&K", "1OS&N", "1OS&S", "1OS&U", "1OS&V", "1OS(E",
+    "1OS(U", "1OS)&", "1OS),", "1OS);", "1OS)B", "1OS)C", "1OS)E", "1OS)F",
+    "1OS)K", "1OS)O", "1OS)U", "1OS,(", "1OS,F", "1OS1(", "1OS1F", "1OS1N",
+    "1OS1S", "1OS1U", "1OS1V", "1OS;", "1OS;C", "1OS;E", "1OS;N", "1OS;T",
+    "1OSA(", "1OSAF", "1OSAS", "1OSAT", "1OSAV", "1OSB(", "1OSB1", "1OSBE",
+    "1OSBF", "1OSBN", "1OSBS", "1OSBV", "1OSC", "1OSE(", "1OSE1", "1OSEF",
+    "1OSEK", "1OSEN", "1OSEO", "1OSES", "1OSEU", "1OSEV", "1OSF(", "1OSK(",
+    "1OSK)", "1OSK1", "1OSKB", "1OSKF", "1OSKN", "1OSKS", "1OSKU", "1OSKV",
+    "1OST(", "1OST1", "1OSTE", "1OSTF", "1OSTN", "1OSTS", "1OSTT", "1OSTV",
+    "1OSU", "1OSU(", "1OSU1", "1OSU;", "1OSUC", "1OSUE", "1OSUF", "1OSUK",
+    "1OSUO", "1OSUS", "1OSUT", "1OSUV", "1OSV(", "1OSVF", "1OSVO", "1OSVS",
+    "1OSVU", "1OU(E", "1OUEK", "1OUEN", "1OV", "1OV&(", "1OV&1", "1OV&E",
+    "1OV&F", "1OV&K", "1OV&N", "1OV&S", "1OV&U", "1OV&V", "1OV(E", "1OV(U",
+    "1OV)&", "1OV),", "1OV);", "1OV)B", "1OV)C", "1OV)E", "1OV)F", "1OV)K",
+    "1OV)O", "1OV)U", "1OV,(", "1OV,F", "1OV;", "1OV;C", "1OV;E", "1OV;N",
+    "1OV;T", "1OVA(", "1OVAF", "1OVAS", "1OVAT", "1OVAV", "1OVB(", "1OVB1",
+    "1OVBE", "1OVBF", "1OVBN", "1OVBS", "1OVBV", "1OVC", "1OVE(", "1OVE1",
+    "1OVEF", "1OVEK", "1OVEN", "1OVEO", "1OVES", "1OVEU", "1OVEV", "1OVF(",
+    "1OVK(", "1OVK)", "1OVK1", "1OVKB", "1OVKF", "1OVKN", "1OVKS", "1OVKU",
+    "1OVKV", "1OVO(", "1OVOF", "1OVOK", "1OVOS", "1OVOU", "1OVS(", "1OVS1",
+    "1OVSF", "1OVSO", "1OVSU", "1OVSV", "1OVT(", "1OVT1", "1OVTE", "1OVTF",
+    "1OVTN", "1OVTS", "1OVTT", "1OVTV", "1OVU", "1OVU(", "1OVU1", "1OVU;",
+    "1OVUC", "1OVUE", "1OVUF", "1OVUK", "1OVUO", "1OVUS", "1OVUT", "1OVUV",
+    "1SF()", "1SF(1", "1SF(F", "1SF(N", "1SF(S", "1SF(V", "1SUE", "1SUE;",
+    "1SUEC", "1SUEK", "1SV", "1SV;", "1SV;C", "1SVC", "1SVO(", "1SVOF", "1SVOS",
+    "1T(1)", "1T(1O", "1T(F(", "1T(N)", "1T(NO", "1T(S)", "1T(SO", "1T(V)",
+    "1T(VO", "1T1(F", "1T1O(", "1T1OF", "1T1OS", "1T1OV", "1TE(1", "1TE(F",
+    "1TE(N", "1TE(S", "1TE(V", "1TE1N", "1TE1O", "1TEF(", "1TEK(", "1TEK1",
+    "1TEKF", "1TEKN", "1TEKS", "1TEKV", "1TENN", "1TENO", "1TESN", "1TESO",
+    "1TEVN", "1TEVO", "1TF()", "1TF(1", "1TF(F", "1TF(N", "1TF(S", "1TF(V",
+    "1TN(1", "1TN(F", "1TN(S", "1TN(V", "1TN1C", "1TN1O", "1TN;E", "1TN;N",
+    "1TN;T", "1TNE(", "1TNE1", "1TNEF", "1TNEN", "1TNES", "1TNEV", "1TNF(",
+    "1TNKN", "1TNN:", "1TNNC", "1TNNO", "1TNO(", "1TNOF", "1TNOS", "1TNOV",
+    "1TNSC", "1TNSO", "1TNT(", "1TNT1", "1TNTF", "1TNTN", "1TNTS", "1TNTV",
+    "1TNVC", "1TNVO", "1TS(F", "1TSO(", "1TSO1", "1TSOF", "1TSON", "1TSOS",
+    "1TSOV", "1TTNE", "1TTNK", "1TTNN", "1TTNT", "1TV(1", "1TV(F", "1TVO(",
+    "1TVOF", "1TVOS", "1U", "1U(1)", "1U(1O", "1U(E(", "1U(E1", "1U(EF",
+    "1U(EK", "1U(EN", "1U(ES", "1U(EV", "1U(F(", "1U(N)", "1U(NO", "1U(S)",
+    "1U(SO", "1U(V)", "1U(VO", "1U1,(", "1U1,F", "1U1C", "1U1O(", "1U1OF",
+    "1U1OS", "1U1OV", "1U;", "1U;C", "1UC", "1UE", "1UE(1", "1UE(E", "1UE(F",
+    "1UE(N", "1UE(O", "1UE(S", "1UE(V", "1UE1", "1UE1&", "1UE1(", "1UE1)",
+    "1UE1,", "1UE1;", "1UE1B", "1UE1C", "1UE1F", "1UE1K", "1UE1N", "1UE1O",
+    "1UE1S", "1UE1U", "1UE1V", "1UE;", "1UE;C", "1UEC", "1UEF", "1UEF(",
+    "1UEF,", "1UEF;", "1UEFC", "1UEK", "1UEK(", "1UEK1", "1UEK;", "1UEKC",
+    "1UEKF", "1UEKN", "1UEKO", "1UEKS", "1UEKV", "1UEN", "1UEN&", "1UEN(",
+    "1UEN)", "1UEN,", "1UEN1", "1UEN;", "1UENB", "1UENC", "1UENF", "1UENK",
+    "1UENN", "1UENO", "1UENS", "1UENU", "1UEOK", "1UEON", "1UES", "1UES&",
+    "1UES(", "1UES)", "1UES,", "1UES1", "1UES;", "1UESB", "1UESC", "1UESF",
+    "1UESK", "1UESO", "1UESU", "1UESV", "1UEV", "1UEV&", "1UEV(", "1UEV)",
+    "1UEV,", "1UEV;", "1UEVB", "1UEVC", "1UEVF", "1UEVK", "1UEVN", "1UEVO",
+    "1UEVS", "1UEVU", "1UF()", "1UF(1", "1UF(F", "1UF(N", "1UF(S", "1UF(V",
+    "1UK(E", "1UO(E", "1UON(", "1UON1", "1UONF", "1UONS", "1US,(", "1US,F",
+    "1USC", "1USO(", "1USO1", "1USOF", "1USON", "1USOS", "1USOV", "1UTN(",
+    "1UTN1", "1UTNF", "1UTNN", "1UTNS", "1UTNV", "1UV,(", "1UV,F", "1UVC",
+    "1UVO(", "1UVOF", "1UVOS", "1VF()", "1VF(1", "1VF(F", "1VF(N", "1VF(S",
+    "1VF(V", "1VO(1", "1VO(F", "1VO(N", "1VO(S", "1VO(V", "1VOF(", "1VOS(",
+    "1VOS1", "1VOSF", "1VOSU", "1VOSV", "1VS", "1VS;", "1VS;C", "1VSC", "1VSO(",
+    "1VSO1", "1VSOF", "1VSON", "1VSOS", "1VSOV", "1VUE", "1VUE;", "1VUEC",
+    "1VUEK", ";T(EF", ";T(EK", ";TKNC", "E(1&(", "E(1&1", "E(1&F", "E(1&N",
+    "E(1&S", "E(1&V", "E(1)&", "E(1),", "E(1)1", "E(1);", "E(1)B", "E(1)C",
+    "E(1)F", "E(1)K", "E(1)N", "E(1)O", "E(1)S", "E(1)U", "E(1)V", "E(1,F",
+    "E(1F(", "E(1N)", "E(1O(", "E(1OF", "E(1OS", "E(1OV", "E(1S)", "E(1V)",
+    "E(1VO", "E(E(1", "E(E(E", "E(E(F", "E(E(N", "E(E(S", "E(E(V", "E(E1&",
+    "E(E1)", "E(E1O", "E(EF(", "E(EK(", "E(EK1", "E(EKF", "E(EKN", "E(EKS",
+    "E(EKV", "E(EN&", "E(EN)", "E(ENO", "E(ES&", "E(ES)", "E(ESO", "E(EV&",
+    "E(EV)", "E(EVO", "E(F()", "E(F(1", "E(F(E", "E(F(F", "E(F(N", "E(F(S",
+    "E(F(V", "E(N&(", "E(N&1", "E(N&F", "E(N&N", "E(N&S", "E(N&V", "E(N(1",
+    "E(N(F", "E(N(S", "E(N(V", "E(N)&", "E(N),", "E(N)1", "E(N);", "E(N)B",
+    "E(N)C", "E(N)F", "E(N)K", "E(N)N", "E(N)O", "E(N)S", "E(N)U", "E(N)V",
+    "E(N,F", "E(N1)", "E(N1O", "E(NF(", "E(NO(", "E(NOF", "E(NOS", "E(NOV",
+    "E(S&(", "E(S&1", "E(S&F", "E(S&N", "E(S&S", "E(S&V", "E(S)&", "E(S),",
+    "E(S)1", "E(S);", "E(S)B", "E(S)C", "E(S)F", "E(S)K", "E(S)N", "E(S)O",
+    "E(S)S", "E(S)U", "E(S)V", "E(S,F", "E(S1)", "E(SF(", "E(SO(", "E(SO1",
+    "E(SOF", "E(SON", "E(SOS", "E(SOV", "E(SV)", "E(SVO", "E(V&(", "E(V&1",
+    "E(V&F", "E(V&N", "E(V&S", "E(V&V", "E(V)&", "E(V),", "E(V)1", "E(V);",
+    "E(V)B", "E(V)C", "E(V)F", "E(V)K", "E(V)N", "E(V)O", "E(V)S", "E(V)U",
+    "E(V)V", "E(V,F", "E(VF(", "E(VO(", "E(VOF", "E(VOS", "E(VS)", "E(VSO",
+    "E1&(1", "E1&(E", "E1&(F", "E1&(N", "E1&(S", "E1&(V", "E1&1)", "E1&1O",
+    "E1&F(", "E1&N)", "E1&NO", "E1&S)", "E1&SO", "E1&V)", "E1&VO", "E1)",
+    "E1)&(", "E1)&1", "E1)&F", "E1)&N", "E1)&S", "E1)&V", "E1);", "E1);(",
+    "E1);C", "E1);E", "E1);T", "E1)C", "E1)KN", "E1)O(", "E1)O1", "E1)OF",
+    "E1)ON", "E1)OS", "E1)OV", "E1)UE", "E1,(1", "E1,(F", "E1,(N", "E1,(S",
+    "E1,(V", "E1,F(", "E1;(E", "E1B(1", "E1B(F", "E1B(N", "E1B(S", "E1B(V",
+    "E1B1)", "E1B1O", "E1BF(", "E1BN)", "E1BNO", "E1BS)", "E1BSO", "E1BV)",
+    "E1BVO", "E1F()", "E1F(1", "E1F(F", "E1F(N", "E1F(S", "E1F(V", "E1K(1",
+    "E1K(E", "E1K(F", "E1K(N", "E1K(S", "E1K(V", "E1K1)", "E1K1K", "E1K1O",
+    "E1KF(", "E1KN", "E1KN)", "E1KN;", "E1KNC", "E1KNK", "E1KNU", "E1KS)",
+    "E1KSK", "E1KSO", "E1KV)", "E1KVK", "E1KVO", "E1N)U", "E1N;", "E1N;C",
+    "E1NC", "E1NKN", "E1O(1", "E1O(E", "E1O(F", "E1O(N", "E1O(S", "E1O(V",
+    "E1OF(", "E1OS&", "E1OS(", "E1OS)", "E1OS,", "E1OS1", "E1OS;", "E1OSB",
+    "E1OSF", "E1OSK", "E1OSU", "E1OSV", "E1OV&", "E1OV(", "E1OV)", "E1OV,",
+    "E1OV;", "E1OVB", "E1OVF", "E1OVK", "E1OVO", "E1OVS", "E1OVU", "E1S;",
+    "E1S;C", "E1SC", "E1U(E", "E1UE(", "E1UE1", "E1UEF", "E1UEK", "E1UEN",
+    "E1UES", "E1UEV", "E1V", "E1V;", "E1V;C", "E1VC", "E1VO(", "E1VOF", "E1VOS",
+    "EE(F(", "EEK(F", "EF()&", "EF(),", "EF()1", "EF();", "EF()B", "EF()F",
+    "EF()K", "EF()N", "EF()O", "EF()S", "EF()U", "EF()V", "EF(1&", "EF(1)",
+    "EF(1,", "EF(1O", "EF(E(", "EF(E1", "EF(EF", "EF(EK", "EF(EN", "EF(ES",
+    "EF(EV", "EF(F(", "EF(N&", "EF(N)", "EF(N,", "EF(NO", "EF(O)", "EF(S&",
+    "EF(S)", "EF(S,", "EF(SO", "EF(V&", "EF(V)", "EF(V,", "EF(VO", "EK(1&",
+    "EK(1(", "EK(1)", "EK(1,", "EK(1F", "EK(1N", "EK(1O", "EK(1S", "EK(1V",
+    "EK(E(", "EK(E1", "EK(EF", "EK(EK", "EK(EN", "EK(ES", "EK(EV", "EK(F(",
+    "EK(N&", "EK(N(", "EK(N)", "EK(N,", "EK(N1", "EK(NF", "EK(NO", "EK(S&",
+    "EK(S(", "EK(S)", "EK(S,", "EK(S1", "EK(SF", "EK(SO", "EK(SV", "EK(V&",
+    "EK(V(", "EK(V)", "EK(V,", "EK(VF", "EK(VO", "EK(VS", "EK1&(", "EK1&1",
+    "EK1&F", "EK1&N", "EK1&S", "EK1&V", "EK1)", "EK1)&", "EK1);", "EK1)C",
+    "EK1)K", "EK1)O", "EK1)U", "EK1,(", "EK1,F", "EK1;(", "EK1B(", "EK1B1",
+    "EK1BF", "EK1BN", "EK1BS", "EK1BV", "EK1F(", "EK1K(", "EK1K1", "EK1KF",
+    "EK1KN", "EK1KS", "EK1KV", "EK1N", "EK1N)", "EK1N;", "EK1NC", "EK1NK",
+    "EK1O(", "EK1OF", "EK1OS", "EK1OV", "EK1S", "EK1S;", "EK1SC", "EK1SF",
+    "EK1SK", "EK1U(", "EK1UE", "EK1V", "EK1V;", "EK1VC", "EK1VF", "EK1VK",
+    "EK1VO", "EKE(F", "EKEK(", "EKF()", "EKF(1", "EKF(E", "EKF(F", "EKF(N",
+    "EKF(O", "EKF(S", "EKF(V", "EKN&(", "EKN&1", "EKN&F", "EKN&N", "EKN&S",
+    "EKN&V", "EKN(1", "EKN(F", "EKN(S", "EKN(V", "EKN)", "EKN)&", "EKN);",
+    "EKN)C", "EKN)K", "EKN)O", "EKN)U", "EKN,(", "EKN,F", "EKN1", "EKN1;",
+    "EKN1C", "EKN1K", "EKN1O", "EKN;(", "EKNB(", "EKNB1", "EKNBF", "EKNBN",
+    "EKNBS", "EKNBV", "EKNF(", "EKNK(", "EKNK1", "EKNKF", "EKNKN", "EKNKS",
+    "EKNKV", "EKNU(", "EKNUE", "EKO(1", "EKO(F", "EKO(N", "EKO(S", "EKO(V",
+    "EKOK(", "EKOKN", "EKS&(", "EKS&1", "EKS&F", "EKS&N", "EKS&S", "EKS&V",
+    "EKS)", "EKS)&", "EKS);", "EKS)C", "EKS)K", "EKS)O", "EKS)U", "EKS,(",
+    "EKS,F", "EKS1", "EKS1;", "EKS1C", "EKS1F", "EKS1K", "EKS;(", "EKSB(",
+    "EKSB1", "EKSBF", "EKSBN", "EKSBS", "EKSBV", "EKSF(", "EKSK(", "EKSK1",
+    "EKSKF", "EKSKN", "EKSKS", "EKSKV", "EKSO(", "EKSO1", "EKSOF", "EKSON",
+    "EKSOS", "EKSOV", "EKSU(", "EKSUE", "EKSV", "EKSV;", "EKSVC", "EKSVF",
+    "EKSVK", "EKSVO", "EKV&(", "EKV&1", "EKV&F", "EKV&N", "EKV&S", "EKV&V",
+    "EKV)", "EKV)&", "EKV);", "EKV)C", "EKV)K", "EKV)O", "EKV)U", "EKV,(",
+    "EKV,F", "EKV;(", "EKVB(", "EKVB1", "EKVBF", "EKVBN", "EKVBS", "EKVBV",
+    "EKVF(", "EKVK(", "EKVK1", "EKVKF", "EKVKN", "EKVKS", "EKVKV", "EKVO(",
+    "EKVOF", "EKVOS", "EKVS", "EKVS;", "EKVSC", "EKVSF", "EKVSK", "EKVSO",
+    "EKVU(", "EKVUE", "EN&(1", "EN&(E", "EN&(F", "EN&(N", "EN&(S", "EN&(V",
+    "EN&1)", "EN&1O", "EN&F(", "EN&N)", "EN&NO", "EN&S)", "EN&SO", "EN&V)",
+    "EN&VO", "EN(1O", "EN(F(", "EN(S)", "EN(SO", "EN(V)", "EN(VO", "EN)",
+    "EN)&(", "EN)&1", "EN)&F", "EN)&N", "EN)&S", "EN)&V", "EN);", "EN);(",
+    "EN);C", "EN);E", "EN);T", "EN)C", "EN)KN", "EN)O(", "EN)O1", "EN)OF",
+    "EN)ON", "EN)OS", "EN)OV", "EN)UE", "EN,(1", "EN,(F", "EN,(N", "EN,(S",
+    "EN,(V", "EN,F(", "EN1;", "EN1;C", "EN1O(", "EN1OF", "EN1OS", "EN1OV",
+    "EN;(E", "ENB(1", "ENB(F", "ENB(N", "ENB(S", "ENB(V", "ENB1)", "ENB1O",
+    "ENBF(", "ENBN)", "ENBNO", "ENBS)", "ENBSO", "ENBV)", "ENBVO", "ENF()",
+    "ENF(1", "ENF(F", "ENF(N", "ENF(S", "ENF(V", "ENK(1", "ENK(E", "ENK(F",
+    "ENK(N", "ENK(S", "ENK(V", "ENK1)", "ENK1K", "ENK1O", "ENKF(", "ENKN)",
+    "ENKN,", "ENKN;", "ENKNB", "ENKNC", "ENKNK", "ENKNU", "ENKS)", "ENKSK",
+    "ENKSO", "ENKV)", "ENKVK", "ENKVO", "ENO(1", "ENO(E", "ENO(F", "ENO(N",
+    "ENO(S", "ENO(V", "ENOF(", "ENOS&", "ENOS(", "ENOS)", "ENOS,", "ENOS1",
+    "ENOS;", "ENOSB", "ENOSF", "ENOSK", "ENOSU", "ENOSV", "ENOV&", "ENOV(",
+    "ENOV)", "ENOV,", "ENOV;", "ENOVB", "ENOVF", "ENOVK", "ENOVO", "ENOVS",
+    "ENOVU", "ENU(E", "ENUE(", "ENUE1", "ENUEF", "ENUEK", "ENUEN", "ENUES",
+    "ENUEV", "EOK(E", "EOKNK", "ES&(1", "ES&(E", "ES&(F", "ES&(N", "ES&(S",
+    "ES&(V", "ES&1)", "ES&1O", "ES&F(", "ES&N)", "ES&NO", "ES&S)", "ES&SO",
+    "ES&V)", "ES&VO", "ES)", "ES)&(", "ES)&1", "ES)&F", "ES)&N", "ES)&S",
+    "ES)&V", "ES);", "ES);(", "ES);C", "ES);E", "ES);T", "ES)C", "ES)KN",
+    "ES)O(", "ES)O1", "ES)OF", "ES)ON", "ES)OS", "ES)OV", "ES)UE", "ES,(1",
+    "ES,(F", "ES,(N", "ES,(S", "ES,(V", "ES,F(", "ES1", "ES1;", "ES1;C", "ES1C",
+    "ES;(E", "ESB(1", "ESB(F", "ESB(N", "ESB(S", "ESB(V", "ESB1)", "ESB1O",
+    "ESBF(", "ESBN)", "ESBNO", "ESBS)", "ESBSO", "ESBV)", "ESBVO", "ESF()",
+    "ESF(1", "ESF(F", "ESF(N", "ESF(S", "ESF(V", "ESK(1", "ESK(E", "ESK(F",
+    "ESK(N", "ESK(S", "ESK(V", "ESK1)", "ESK1K", "ESK1O", "ESKF(", "ESKN",
+    "ESKN)", "ESKN;", "ESKNC", "ESKNK", "ESKNU", "ESKS)", "ESKSK", "ESKSO",
+    "ESKV)", "ESKVK", "ESKVO", "ESO(1", "ESO(E", "ESO(F", "ESO(N", "ESO(S",
+    "ESO(V", "ESO1&", "ESO1(", "ESO1)", "ESO1,", "ESO1;", "ESO1B", "ESO1F",
+    "ESO1K", "ESO1N", "ESO1S", "ESO1U", "ESO1V", "ESOF(", "ESON&", "ESON(",
+    "ESON)", "ESON,", "ESON1", "ESON;", "ESONB", "ESONF", "ESONK", "ESONU",
+    "ESOS&", "ESOS(", "ESOS)", "ESOS,", "ESOS1", "ESOS;", "ESOSB", "ESOSF",
+    "ESOSK", "ESOSU", "ESOSV", "ESOV&", "ESOV(", "ESOV)", "ESOV,", "ESOV;",
+    "ESOVB", "ESOVF", "ESOVK", "ESOVO", "ESOVS", "ESOVU", "ESU(E", "ESUE(",
+    "ESUE1", "ESUEF", "ESUEK", "ESUEN", "ESUES", "ESUEV", "ESV", "ESV;",
+    "ESV;C", "ESVC", "ESVO(", "ESVOF", "ESVOS", "EV&(1", "EV&(E", "EV&(F",
+    "EV&(N", "EV&(S", "EV&(V", "EV&1)", "EV&1O", "EV&F(", "EV&N)", "EV&NO",
+    "EV&S)", "EV&SO", "EV&V)", "EV&VO", "EV)", "EV)&(", "EV)&1", "EV)&F",
+    "EV)&N", "EV)&S", "EV)&V", "EV);", "EV);(", "EV);C", "EV);E", "EV);T",
+    "EV)C", "EV)KN", "EV)O(", "EV)O1", "EV)OF", "EV)ON", "EV)OS", "EV)OV",
+    "EV)UE", "EV,(1", "EV,(F", "EV,(N", "EV,(S", "EV,(V", "EV,F(", "EV;(E",
+    "EVB(1", "EVB(F", "EVB(N", "EVB(S", "EVB(V", "EVB1)", "EVB1O", "EVBF(",
+    "EVBN)", "EVBNO", "EVBS)", "EVBSO", "EVBV)", "EVBVO", "EVF()", "EVF(1",
+    "EVF(F", "EVF(N", "EVF(S", "EVF(V", "EVK(1", "EVK(E", "EVK(F", "EVK(N",
+    "EVK(S", "EVK(V", "EVK1)", "EVK1K", "EVK1O", "EVKF(", "EVKN", "EVKN)",
+    "EVKN;", "EVKNC", "EVKNK", "EVKNU", "EVKS)", "EVKSK", "EVKSO", "EVKV)",
+    "EVKVK", "EVKVO", "EVN", "EVN)U", "EVN;", "EVN;C", "EVNC", "EVNKN", "EVNO(",
+    "EVNOF", "EVNOS", "EVNOV", "EVO(1", "EVO(E", "EVO(F", "EVO(N", "EVO(S",
+    "EVO(V", "EVOF(", "EVOS&", "EVOS(", "EVOS)", "EVOS,", "EVOS1", "EVOS;",
+    "EVOSB", "EVOSF", "EVOSK", "EVOSU", "EVOSV", "EVS", "EVS;", "EVS;C", "EVSC",
+    "EVSO(", "EVSO1", "EVSOF", "EVSON", "EVSOS", "EVSOV", "EVU(E", "EVUE(",
+    "EVUE1", "EVUEF", "EVUEK", "EVUEN", "EVUES", "EVUEV", "F()&(", "F()&1",
+    "F()&E", "F()&F", "F()&K", "F()&N", "F()&S", "F()&V", "F(),(", "F(),1",
+    "F(),F", "F(),N", "F(),S", "F(),V", "F()1(", "F()1F", "F()1N", "F()1O",
+    "F()1S", "F()1U", "F()1V", "F();E", "F();N", "F();T", "F()A(", "F()AF",
+    "F()AS", "F()AT", "F()AV", "F()B(", "F()B1", "F()BE", "F()BF", "F()BN",
+    "F()BS", "F()BV", "F()C", "F()E(", "F()E1", "F()EF", "F()EK", "F()EN",
+    "F()EO", "F()ES", "F()EU", "F()EV", "F()F(", "F()K(", "F()K)", "F()K1",
+    "F()KF", "F()KN", "F()KS", "F()KU", "F()KV", "F()N&", "F()N(", "F()N)",
+    "F()N,", "F()N1", "F()NE", "F()NF", "F()NO", "F()NU", "F()O(", "F()O1",
+    "F()OF", "F()OK", "F()ON", "F()OS", "F()OU", "F()OV", "F()S(", "F()S1",
+    "F()SF", "F()SO", "F()SU", "F()SV", "F()T(", "F()T1", "F()TE", "F()TF",
+    "F()TN", "F()TS", "F()TT", "F()TV", "F()U", "F()U(", "F()U1", "F()U;",
+    "F()UC", "F()UE", "F()UF", "F()UK", "F()UO", "F()US", "F()UT", "F()UV",
+    "F()V(", "F()VF", "F()VO", "F()VS", "F()VU", "F(1&(", "F(1&1", "F(1&F",
+    "F(1&N", "F(1&S", "F(1&V", "F(1)", "F(1)&", "F(1),", "F(1)1", "F(1);",
+    "F(1)A", "F(1)B", "F(1)C", "F(1)E", "F(1)F", "F(1)K", "F(1)N", "F(1)O",
+    "F(1)S", "F(1)T", "F(1)U", "F(1)V", "F(1,(", "F(1,F", "F(1O(", "F(1OF",
+    "F(1OS", "F(1OV", "F(E(1", "F(E(E", "F(E(F", "F(E(N", "F(E(S", "F(E(V",
+    "F(E1&", "F(E1)", "F(E1K", "F(E1O", "F(EF(", "F(EK(", "F(EK1", "F(EKF",
+    "F(EKN", "F(EKO", "F(EKS", "F(EKV", "F(EN&", "F(EN)", "F(ENK", "F(ENO",
+    "F(EOK", "F(ES&", "F(ES)", "F(ESK", "F(ESO", "F(EV&", "F(EV)", "F(EVK",
+    "F(EVO", "F(F()", "F(F(1", "F(F(E", "F(F(F", "F(F(N", "F(F(S", "F(F(V",
+    "F(K()", "F(K,(", "F(K,F", "F(N&(", "F(N&1", "F(N&F", "F(N&N", "F(N&S",
+    "F(N&V", "F(N)", "F(N)&", "F(N),", "F(N)1", "F(N);", "F(N)A", "F(N)B",
+    "F(N)C", "F(N)E", "F(N)F", "F(N)K", "F(N)N", "F(N)O", "F(N)S", "F(N)T",
+    "F(N)U", "F(N)V", "F(N,(", "F(N,F", "F(NO(", "F(NOF", "F(NOS", "F(NOV",
+    "F(S&(", "F(S&1", "F(S&F", "F(S&N", "F(S&S", "F(S&V", "F(S)", "F(S)&",
+    "F(S),", "F(S)1", "F(S);", "F(S)A", "F(S)B", "F(S)C", "F(S)E", "F(S)F",
+    "F(S)K", "F(S)N", "F(S)O", "F(S)S", "F(S)T", "F(S)U", "F(S)V", "F(S,(",
+    "F(S,F", "F(SO(", "F(SO1", "F(SOF", "F(SON", "F(SOS", "F(SOV", "F(T,(",
+    "F(T,F", "F(V&(", "F(V&1", "F(V&F", "F(V&N", "F(V&S", "F(V&V", "F(V)",
+    "F(V)&", "F(V),", "F(V)1", "F(V);", "F(V)A", "F(V)B", "F(V)C", "F(V)E",
+    "F(V)F", "F(V)K", "F(V)N", "F(V)O", "F(V)S", "F(V)T", "F(V)U", "F(V)V",
+    "F(V,(", "F(V,F", "F(VO(", "F(VOF", "F(VOS", "K(1),", "K(1)A", "K(1)K",
+    "K(1)O", "K(1O(", "K(1OF", "K(1OS", "K(1OV", "K(F()", "K(F(1", "K(F(F",
+    "K(F(N", "K(F(S", "K(F(V", "K(N),", "K(N)A", "K(N)K", "K(N)O", "K(NO(",
+    "K(NOF", "K(NOS", "K(NOV", "K(S),", "K(S)A", "K(S)K", "K(S)O", "K(SO(",
+    "K(SO1", "K(SOF", "K(SON", "K(SOS", "K(SOV", "K(V),", "K(V)A", "K(V)K",
+    "K(V)O", "K(VO(", "K(VOF", "K(VOS", "K1,(1", "K1,(F", "K1,(N", "K1,(S",
+    "K1,(V", "K1,F(", "K1A(F", "K1A(N", "K1A(S", "K1A(V", "K1AF(", "K1ASO",
+    "K1AVO", "K1K(1", "K1K(F", "K1K(N", "K1K(S", "K1K(V", "K1K1O", "K1K1U",
+    "K1KF(", "K1KNU", "K1KSO", "K1KSU", "K1KVO", "K1KVU", "K1O(1", "K1O(F",
+    "K1O(N", "K1O(S", "K1O(V", "K1OF(", "K1OS(", "K1OS,", "K1OS1", "K1OSA",
+    "K1OSF", "K1OSK", "K1OSV", "K1OV(", "K1OV,", "K1OVA", "K1OVF", "K1OVK",
+    "K1OVO", "K1OVS", "KF(),", "KF()A", "KF()K", "KF()O", "KF(1)", "KF(1O",
+    "KF(F(", "KF(N)", "KF(NO", "KF(S)", "KF(SO", "KF(V)", "KF(VO", "KN,(1",
+    "KN,(F", "KN,(N", "KN,(S", "KN,(V", "KN,F(", "KNA(F", "KNA(N", "KNA(S",
+    "KNA(V", "KNAF(", "KNASO", "KNAVO", "KNK(1", "KNK(F", "KNK(N", "KNK(S",
+    "KNK(V", "KNK1O", "KNK1U", "KNKF(", "KNKNU", "KNKSO", "KNKSU", "KNKVO",
+    "KNKVU", "KS,(1", "KS,(F", "KS,(N", "KS,(S", "KS,(V", "KS,F(", "KSA(F",
+    "KSA(N", "KSA(S", "KSA(V", "KSAF(", "KSASO", "KSAVO", "KSK(1", "KSK(F",
+    "KSK(N", "KSK(S", "KSK(V", "KSK1O", "KSK1U", "KSKF(", "KSKNU", "KSKSO",
+    "KSKSU", "KSKVO", "KSKVU", "KSO(1", "KSO(F", "KSO(N", "KSO(S", "KSO(V",
+    "KSO1(", "KSO1,", "KSO1A", "KSO1F", "KSO1K", "KSO1N", "KSO1S", "KSO1V",
+    "KSOF(", "KSON(", "KSON,", "KSON1", "KSONA", "KSONF", "KSONK", "KSOS(",
+    "KSOS,", "KSOS1", "KSOSA", "KSOSF", "KSOSK", "KSOSV", "KSOV(", "KSOV,",
+    "KSOVA", "KSOVF", "KSOVK", "KSOVO", "KSOVS", "KV,(1", "KV,(F", "KV,(N",
+    "KV,(S", "KV,(V", "KV,F(", "KVA(F", "KVA(N", "KVA(S", "KVA(V", "KVAF(",
+    "KVASO", "KVAVO", "KVK(1", "KVK(F", "KVK(N", "KVK(S", "KVK(V", "KVK1O",
+    "KVK1U", "KVKF(", "KVKNU", "KVKSO", "KVKSU", "KVKVO", "KVKVU", "KVO(1",
+    "KVO(F", "KVO(N", "KVO(S", "KVO(V", "KVOF(", "KVOS(", "KVOS,", "KVOS1",
+    "KVOSA", "KVOSF", "KVOSK", "KVOSV", "N&(1&", "N&(1)", "N&(1,", "N&(1O",
+    "N&(E(", "N&(E1", "N&(EF", "N&(EK", "N&(EN", "N&(EO", "N&(ES", "N&(EV",
+    "N&(F(", "N&(N&", "N&(N)", "N&(N,", "N&(NO", "N&(S&", "N&(S)", "N&(S,",
+    "N&(SO", "N&(V&", "N&(V)", "N&(V,", "N&(VO", "N&1", "N&1&(", "N&1&1",
+    "N&1&F", "N&1&N", "N&1&S", "N&1&V", "N&1)&", "N&1)C", "N&1)O", "N&1)U",
+    "N&1;", "N&1;C", "N&1;E", "N&1;T", "N&1B(", "N&1B1", "N&1BF", "N&1BN",
+    "N&1BS", "N&1BV", "N&1C", "N&1EK", "N&1EN", "N&1F(", "N&1K(", "N&1K1",
+    "N&1KF", "N&1KN", "N&1KS", "N&1KV", "N&1O(", "N&1OF", "N&1OS", "N&1OV",
+    "N&1TN", "N&1U", "N&1U(", "N&1U;", "N&1UC", "N&1UE", "N&E(1", "N&E(F",
+    "N&E(N", "N&E(O", "N&E(S", "N&E(V", "N&E1", "N&E1;", "N&E1C", "N&E1K",
+    "N&E1O", "N&EF(", "N&EK(", "N&EK1", "N&EKF", "N&EKN", "N&EKS", "N&EKV",
+    "N&EN;", "N&ENC", "N&ENK", "N&ENO", "N&ES", "N&ES;", "N&ESC", "N&ESK",
+    "N&ESO", "N&EV", "N&EV;", "N&EVC", "N&EVK", "N&EVO", "N&F()", "N&F(1",
+    "N&F(E", "N&F(F", "N&F(N", "N&F(S", "N&F(V", "N&K&(", "N&K&1", "N&K&F",
+    "N&K&N", "N&K&S", "N&K&V", "N&K(1", "N&K(F", "N&K(N", "N&K(S", "N&K(V",
+    "N&K1O", "N&KC", "N&KF(", "N&KNK", "N&KO(", "N&KO1", "N&KOF", "N&KOK",
+    "N&KON", "N&KOS", "N&KOV", "N&KSO", "N&KVO", "N&N&(", "N&N&1", "N&N&F",
+    "N&N&S", "N&N&V", "N&N)&", "N&N)C", "N&N)O", "N&N)U", "N&N;C", "N&N;E",
+    "N&N;T", "N&NB(", "N&NB1", "N&NBF", "N&NBS", "N&NBV", "N&NF(", "N&NK(",
+    "N&NK1", "N&NKF", "N&NKS", "N&NKV", "N&NO(", "N&NOF", "N&NOS", "N&NOV",
+    "N&NU", "N&NU(", "N&NU;", "N&NUC", "N&NUE", "N&S&(", "N&S&1", "N&S&F",
+    "N&S&N", "N&S&S", "N&S&V", "N&S)&", "N&S)C", "N&S)O", "N&S)U", "N&S1",
+    "N&S1;", "N&S1C", "N&S;", "N&S;C", "N&S;E", "N&S;T", "N&SB(", "N&SB1",
+    "N&SBF", "N&SBN", "N&SBS", "N&SBV", "N&SC", "N&SEK", "N&SEN", "N&SF(",
+    "N&SK(", "N&SK1", "N&SKF", "N&SKN", "N&SKS", "N&SKV", "N&SO(", "N&SO1",
+    "N&SOF", "N&SON", "N&SOS", "N&SOV", "N&STN", "N&SU", "N&SU(", "N&SU;",
+    "N&SUC", "N&SUE", "N&SV", "N&SV;", "N&SVC", "N&SVO", "N&V", "N&V&(",
+    "N&V&1", "N&V&F", "N&V&N", "N&V&S", "N&V&V", "N&V)&", "N&V)C", "N&V)O",
+    "N&V)U", "N&V;", "N&V;C", "N&V;E", "N&V;T", "N&VB(", "N&VB1", "N&VBF",
+    "N&VBN", "N&VBS", "N&VBV", "N&VC", "N&VEK", "N&VEN", "N&VF(", "N&VK(",
+    "N&VK1", "N&VKF", "N&VKN", "N&VKS", "N&VKV", "N&VO(", "N&VOF", "N&VOS",
+    "N&VS", "N&VS;", "N&VSC", "N&VSO", "N&VTN", "N&VU", "N&VU(", "N&VU;",
+    "N&VUC", "N&VUE", "N)&(1", "N)&(E", "N)&(F", "N)&(N", "N)&(S", "N)&(V",
+    "N)&1", "N)&1&", "N)&1)", "N)&1;", "N)&1B", "N)&1C", "N)&1F", "N)&1O",
+    "N)&1U", "N)&F(", "N)&N", "N)&N&", "N)&N)", "N)&N;", "N)&NB", "N)&NC",
+    "N)&NF", "N)&NO", "N)&NU", "N)&S", "N)&S&", "N)&S)", "N)&S;", "N)&SB",
+    "N)&SC", "N)&SF", "N)&SO", "N)&SU", "N)&V", "N)&V&", "N)&V)", "N)&V;",
+    "N)&VB", "N)&VC", "N)&VF", "N)&VO", "N)&VU", "N),(1", "N),(F", "N),(N",
+    "N),(S", "N),(V", "N);E(", "N);E1", "N);EF", "N);EK", "N);EN", "N);EO",
+    "N);ES", "N);EV", "N);T(", "N);T1", "N);TF", "N);TK", "N);TN", "N);TO",
+    "N);TS", "N);TV", "N)B(1", "N)B(F", "N)B(N", "N)B(S", "N)B(V", "N)B1",
+    "N)B1&", "N)B1;", "N)B1C", "N)B1K", "N)B1N", "N)B1O", "N)B1U", "N)BF(",
+    "N)BN", "N)BN&", "N)BN;", "N)BNC", "N)BNK", "N)BNO", "N)BNU", "N)BS",
+    "N)BS&", "N)BS;", "N)BSC", "N)BSK", "N)BSO", "N)BSU", "N)BV", "N)BV&",
+    "N)BV;", "N)BVC", "N)BVK", "N)BVO", "N)BVU", "N)E(1", "N)E(F", "N)E(N",
+    "N)E(S", "N)E(V", "N)E1C", "N)E1O", "N)EF(", "N)EK(", "N)EK1", "N)EKF",
+    "N)EKN", "N)EKS", "N)EKV", "N)ENC", "N)ENO", "N)ESC", "N)ESO", "N)EVC",
+    "N)EVO", "N)F(F", "N)K(1", "N)K(F", "N)K(N", "N)K(S", "N)K(V", "N)K1&",
+    "N)K1;", "N)K1B", "N)K1E", "N)K1O", "N)K1U", "N)KB(", "N)KB1", "N)KBF",
+    "N)KBN", "N)KBS", "N)KBV", "N)KF(", "N)KN&", "N)KN;", "N)KNB", "N)KNC",
+    "N)KNE", "N)KNK", "N)KNU", "N)KS&", "N)KS;", "N)KSB", "N)KSE", "N)KSO",
+    "N)KSU", "N)KUE", "N)KV&", "N)KV;", "N)KVB", "N)KVE", "N)KVO", "N)KVU",
+    "N)O(1", "N)O(E", "N)O(F", "N)O(N", "N)O(S", "N)O(V", "N)O1&", "N)O1)",
+    "N)O1;", "N)O1B", "N)O1C", "N)O1K", "N)O1U", "N)OF(", "N)ON&", "N)ON)",
+    "N)ON;", "N)ONB", "N)ONC", "N)ONK", "N)ONU", "N)OS", "N)OS&", "N)OS)",
+    "N)OS;", "N)OSB", "N)OSC", "N)OSK", "N)OSU", "N)OV", "N)OV&", "N)OV)",
+    "N)OV;", "N)OVB", "N)OVC", "N)OVK", "N)OVO", "N)OVU", "N)U(E", "N)UE(",
+    "N)UE1", "N)UEF", "N)UEK", "N)UEN", "N)UES", "N)UEV", "N,(1)", "N,(1O",
+    "N,(E(", "N,(E1", "N,(EF", "N,(EK", "N,(EN", "N,(ES", "N,(EV", "N,(F(",
+    "N,(NO", "N,(S)", "N,(SO", "N,(V)", "N,(VO", "N,F()", "N,F(1", "N,F(F",
+    "N,F(N", "N,F(S", "N,F(V", "N1O(1", "N1O(F", "N1O(N", "N1O(S", "N1O(V",
+    "N1OF(", "N1OS(", "N1OS1", "N1OSF", "N1OSU", "N1OSV", "N1OV(", "N1OVF",
+    "N1OVO", "N1OVS", "N1OVU", "N1S;", "N1S;C", "N1SC", "N1UE", "N1UE;",
+    "N1UEC", "N1UEK", "N1V;", "N1V;C", "N1VC", "N1VO(", "N1VOF", "N1VOS",
+    "N;E(1", "N;E(E", "N;E(F", "N;E(N", "N;E(S", "N;E(V", "N;E1,", "N;E1;",
+    "N;E1C", "N;E1K", "N;E1O", "N;E1T", "N;EF(", "N;EK(", "N;EK1", "N;EKF",
+    "N;EKN", "N;EKO", "N;EKS", "N;EKV", "N;EN,", "N;EN;", "N;ENC", "N;ENE",
+    "N;ENK", "N;ENO", "N;ENT", "N;ES,", "N;ES;", "N;ESC", "N;ESK", "N;ESO",
+    "N;EST", "N;EV,", "N;EV;", "N;EVC", "N;EVK", "N;EVO", "N;EVT", "N;N:T",
+    "N;T(1", "N;T(C", "N;T(E", "N;T(F", "N;T(N", "N;T(S", "N;T(V", "N;T1(",
+    "N;T1,", "N;T1;", "N;T1C", "N;T1F", "N;T1K", "N;T1O", "N;T1T", "N;T;",
+    "N;T;C", "N;TF(", "N;TK(", "N;TK1", "N;TKF", "N;TKK", "N;TKO", "N;TKS",
+    "N;TKV", "N;TN(", "N;TN,", "N;TN1", "N;TN;", "N;TNC", "N;TNE", "N;TNF",
+    "N;TNK", "N;TNN", "N;TNO", "N;TNS", "N;TNT", "N;TNV", "N;TO(", "N;TS(",
+    "N;TS,", "N;TS;", "N;TSC", "N;TSF", "N;TSK", "N;TSO", "N;TST", "N;TTN",
+    "N;TV(", "N;TV,", "N;TV;", "N;TVC", "N;TVF", "N;TVK", "N;TVO", "N;TVT",
+    "NA(F(", "NA(N)", "NA(NO", "NA(S)", "NA(SO", "NA(V)", "NA(VO", "NAF()",
+    "NAF(1", "NAF(F", "NAF(N", "NAF(S", "NAF(V", "NASO(", "NASO1", "NASOF",
+    "NASON", "NASOS", "NASOV", "NASUE", "NATO(", "NATO1", "NATOF", "NATON",
+    "NATOS", "NATOV", "NATUE", "NAVO(", "NAVOF", "NAVOS", "NAVUE", "NB(1&",
+    "NB(1)", "NB(1O", "NB(F(", "NB(N&", "NB(NO", "NB(S&", "NB(S)", "NB(SO",
+    "NB(V&", "NB(V)", "NB(VO", "NB1", "NB1&(", "NB1&1", "NB1&F", "NB1&N",
+    "NB1&S", "NB1&V", "NB1,(", "NB1,F", "NB1;", "NB1;C", "NB1B(", "NB1B1",
+    "NB1BF", "NB1BN", "NB1BS", "NB1BV", "NB1C", "NB1K(", "NB1K1", "NB1KF",
+    "NB1KN", "NB1KS", "NB1KV", "NB1O(", "NB1OF", "NB1OS", "NB1OV", "NB1U(",
+    "NB1UE", "NBE(1", "NBE(F", "NBE(N", "NBE(S", "NBE(V", "NBEK(", "NBF()",
+    "NBF(1", "NBF(F", "NBF(N", "NBF(S", "NBF(V", "NBN&(", "NBN&1", "NBN&F",
+    "NBN&N", "NBN&S", "NBN&V", "NBN,(", "NBN,F", "NBN;", "NBN;C", "NBNB(",
+    "NBNB1", "NBNBF", "NBNBN", "NBNBS", "NBNBV", "NBNC", "NBNK(", "NBNK1",
+    "NBNKF", "NBNKN", "NBNKS", "NBNKV", "NBNO(", "NBNOF", "NBNOS", "NBNOV",
+    "NBNU(", "NBNUE", "NBS", "NBS&(", "NBS&1", "NBS&F", "NBS&N", "NBS&S",
+    "NBS&V", "NBS,(", "NBS,F", "NBS;", "NBS;C", "NBSB(", "NBSB1", "NBSBF",
+    "NBSBN", "NBSBS", "NBSBV", "NBSC", "NBSK(", "NBSK1", "NBSKF", "NBSKN",
+    "NBSKS", "NBSKV", "NBSO(", "NBSO1", "NBSOF", "NBSON", "NBSOS", "NBSOV",
+    "NBSU(", "NBSUE", "NBV", "NBV&(", "NBV&1", "NBV&F", "NBV&N", "NBV&S",
+    "NBV&V", "NBV,(", "NBV,F", "NBV;", "NBV;C", "NBVB(", "NBVB1", "NBVBF",
+    "NBVBN", "NBVBS", "NBVBV", "NBVC", "NBVK(", "NBVK1", "NBVKF", "NBVKN",
+    "NBVKS", "NBVKV", "NBVO(", "NBVOF", "NBVOS", "NBVU(", "NBVUE", "NC",
+    "NE(1)", "NE(1O", "NE(F(", "NE(N)", "NE(NO", "NE(S)", "NE(SO", "NE(V)",
+    "NE(VO", "NE1;T", "NE1C", "NE1O(", "NE1OF", "NE1OS", "NE1OV", "NE1T(",
+    "NE1T1", "NE1TF", "NE1TN", "NE1TS", "NE1TV", "NE1UE", "NEF()", "NEF(1",
+    "NEF(F", "NEF(N", "NEF(S", "NEF(V", "NEN;T", "NENO(", "NENOF", "NENOS",
+    "NENOV", "NENT(", "NENT1", "NENTF", "NENTN", "NENTS", "NENTV", "NENUE",
+    "NEOKN", "NES;T", "NESC", "NESO(", "NESO1", "NESOF", "NESON", "NESOS",
+    "NESOV", "NEST(", "NEST1", "NESTF", "NESTN", "NESTS", "NESTV", "NESUE",
+    "NEU(1", "NEU(F", "NEU(N", "NEU(S", "NEU(V", "NEU1,", "NEU1C", "NEU1O",
+    "NEUEF", "NEUEK", "NEUF(", "NEUS,", "NEUSC", "NEUSO", "NEUV,", "NEUVC",
+    "NEUVO", "NEV;T", "NEVC", "NEVO(", "NEVOF", "NEVOS", "NEVT(", "NEVT1",
+    "NEVTF", "NEVTN", "NEVTS", "NEVTV", "NEVUE", "NF()1", "NF()F", "NF()K",
+    "NF()N", "NF()O", "NF()S", "NF()U", "NF()V", "NF(1)", "NF(1O", "NF(E(",
+    "NF(E1", "NF(EF", "NF(EK", "NF(EN", "NF(ES", "NF(EV", "NF(F(", "NF(N,",
+    "NF(NO", "NF(S)", "NF(SO", "NF(V)", "NF(VO", "NK(1)", "NK(1O", "NK(F(",
+    "NK(NO", "NK(S)", "NK(SO", "NK(V)", "NK(VO", "NK)&(", "NK)&1", "NK)&F",
+    "NK)&N", "NK)&S", "NK)&V", "NK);E", "NK);T", "NK)B(", "NK)B1", "NK)BF",
+    "NK)BN", "NK)BS", "NK)BV", "NK)E(", "NK)E1", "NK)EF", "NK)EK", "NK)EN",
+    "NK)ES", "NK)EV", "NK)F(", "NK)O(", "NK)OF", "NK)UE", "NK1", "NK1&(",
+    "NK1&1", "NK1&F", "NK1&N", "NK1&S", "NK1&V", "NK1;C", "NK1;E", "NK1;T",
+    "NK1B(", "NK1B1", "NK1BF", "NK1BN", "NK1BS", "NK1BV", "NK1C", "NK1E(",
+    "NK1E1", "NK1EF", "NK1EK", "NK1EN", "NK1ES", "NK1EV", "NK1O(", "NK1OF",
+    "NK1OS", "NK1OV", "NK1U(", "NK1UE", "NKF()", "NKF(1", "NKF(F", "NKF(N",
+    "NKF(S", "NKF(V", "NKN", "NKN&(", "NKN&1", "NKN&F", "NKN&S", "NKN&V",
+    "NKN;C", "NKN;E", "NKN;T", "NKNB(", "NKNB1", "NKNBF", "NKNBN", "NKNBS",
+    "NKNBV", "NKNE(", "NKNE1", "NKNEF", "NKNES", "NKNEV", "NKNU(", "NKNUE",
+    "NKS", "NKS&(", "NKS&1", "NKS&F", "NKS&N", "NKS&S", "NKS&V", "NKS;",
+    "NKS;C", "NKS;E", "NKS;T", "NKSB(", "NKSB1", "NKSBF", "NKSBN", "NKSBS",
+    "NKSBV", "NKSC", "NKSE(", "NKSE1", "NKSEF", "NKSEK", "NKSEN", "NKSES",
+    "NKSEV", "NKSO(", "NKSO1", "NKSOF", "NKSON", "NKSOS", "NKSOV", "NKSU(",
+    "NKSUE", "NKUE(", "NKUE1", "NKUEF", "NKUEK", "NKUEN", "NKUES", "NKUEV",
+    "NKV", "NKV&(", "NKV&1", "NKV&F", "NKV&N", "NKV&S", "NKV&V", "NKV;",
+    "NKV;C", "NKV;E", "NKV;T", "NKVB(", "NKVB1", "NKVBF", "NKVBN", "NKVBS",
+    "NKVBV", "NKVC", "NKVE(", "NKVE1", "NKVEF", "NKVEK", "NKVEN", "NKVES",
+    "NKVEV", "NKVO(", "NKVOF", "NKVOS", "NKVU(", "NKVUE", "NO(1&", "NO(1)",
+    "NO(1,", "NO(1O", "NO(E(", "NO(E1", "NO(EE", "NO(EF", "NO(EK", "NO(EN",
+    "NO(EO", "NO(ES", "NO(EV", "NO(F(", "NO(N&", "NO(N)", "NO(N,", "NO(NO",
+    "NO(S&", "NO(S)", "NO(S,", "NO(SO", "NO(V&", "NO(V)", "NO(V,", "NO(VO",
+    "NOF()", "NOF(1", "NOF(E", "NOF(F", "NOF(N", "NOF(S", "NOF(V", "NOK&(",
+    "NOK(1", "NOK(F", "NOK(N", "NOK(S", "NOK(V", "NOK1C", "NOK1O", "NOKF(",
+    "NOKNC", "NOKO(", "NOKO1", "NOKOF", "NOKON", "NOKOS", "NOKOV", "NOKSC",
+    "NOKSO", "NOKVC", "NOKVO", "NONSU", "NOS&(", "NOS&1", "NOS&E", "NOS&F",
+    "NOS&K", "NOS&N", "NOS&S", "NOS&U", "NOS&V", "NOS(E", "NOS(U", "NOS)&",
+    "NOS),", "NOS);", "NOS)B", "NOS)C", "NOS)E", "NOS)F", "NOS)K", "NOS)O",
+    "NOS)U", "NOS,(", "NOS,F", "NOS1(", "NOS1F", "NOS1N", "NOS1S", "NOS1U",
+    "NOS1V", "NOS;", "NOS;C", "NOS;E", "NOS;T", "NOSA(", "NOSAF", "NOSAS",
+    "NOSAT", "NOSAV", "NOSB(", "NOSB1", "NOSBE", "NOSBF", "NOSBN", "NOSBS",
+    "NOSBV", "NOSC", "NOSE(", "NOSE1", "NOSEF", "NOSEK", "NOSEN", "NOSEO",
+    "NOSES", "NOSEU", "NOSEV", "NOSF(", "NOSK(", "NOSK)", "NOSK1", "NOSKB",
+    "NOSKF", "NOSKN", "NOSKS", "NOSKU", "NOSKV", "NOST(", "NOST1", "NOSTE",
+    "NOSTF", "NOSTN", "NOSTS", "NOSTT", "NOSTV", "NOSU", "NOSU(", "NOSU1",
+    "NOSU;", "NOSUC", "NOSUE", "NOSUF", "NOSUK", "NOSUO", "NOSUS", "NOSUT",
+    "NOSUV", "NOSV(", "NOSVF", "NOSVO", "NOSVS", "NOSVU", "NOU(E", "NOUEK",
+    "NOUEN", "NOV&(", "NOV&1", "NOV&E", "NOV&F", "NOV&K", "NOV&N", "NOV&S",
+    "NOV&U", "NOV&V", "NOV(E", "NOV(U", "NOV)&", "NOV),", "NOV);", "NOV)B",
+    "NOV)C", "NOV)E", "NOV)F", "NOV)K", "NOV)O", "NOV)U", "NOV,(", "NOV,F",
+    "NOV;", "NOV;C", "NOV;E", "NOV;N", "NOV;T", "NOVA(", "NOVAF", "NOVAS",
+    "NOVAT", "NOVAV", "NOVB(", "NOVB1", "NOVBE", "NOVBF", "NOVBN", "NOVBS",
+    "NOVBV", "NOVC", "NOVE(", "NOVE1", "NOVEF", "NOVEK", "NOVEN", "NOVEO",
+    "NOVES", "NOVEU", "NOVEV", "NOVF(", "NOVK(", "NOVK)", "NOVK1", "NOVKB",
+    "NOVKF", "NOVKN", "NOVKS", "NOVKU", "NOVKV", "NOVO(", "NOVOF", "NOVOK",
+    "NOVOS", "NOVOU", "NOVS(", "NOVS1", "NOVSF", "NOVSO", "NOVSU", "NOVSV",
+    "NOVT(", "NOVT1", "NOVTE", "NOVTF", "NOVTN", "NOVTS", "NOVTT", "NOVTV",
+    "NOVU", "NOVU(", "NOVU1", "NOVU;", "NOVUC", "NOVUE", "NOVUF", "NOVUK",
+    "NOVUO", "NOVUS", "NOVUT", "NOVUV", "NSO1U", "NSONU", "NSOSU", "NSOVU",
+    "NSUE", "NSUE;", "NSUEC", "NSUEK", "NT(1)", "NT(1O", "NT(F(", "NT(N)",
+    "NT(NO", "NT(S)", "NT(SO", "NT(V)", "NT(VO", "NT1(F", "NT1O(", "NT1OF",
+    "NT1OS", "NT1OV", "NTE(1", "NTE(F", "NTE(N", "NTE(S", "NTE(V", "NTE1N",
+    "NTE1O", "NTEF(", "NTEK(", "NTEK1", "NTEKF", "NTEKN", "NTEKS", "NTEKV",
+    "NTENN", "NTENO", "NTESN", "NTESO", "NTEVN", "NTEVO", "NTF()", "NTF(1",
+    "NTF(F", "NTF(N", "NTF(S", "NTF(V", "NTN(1", "NTN(F", "NTN(S", "NTN(V",
+    "NTN1C", "NTN1O", "NTN;E", "NTN;N", "NTN;T", "NTNE(", "NTNE1", "NTNEF",
+    "NTNEN", "NTNES", "NTNEV", "NTNF(", "NTNKN", "NTNN:", "NTNNC", "NTNNO",
+    "NTNO(", "NTNOF", "NTNOS", "NTNOV", "NTNSC", "NTNSO", "NTNT(", "NTNT1",
+    "NTNTF", "NTNTN", "NTNTS", "NTNTV", "NTNVC", "NTNVO", "NTS(F", "NTSO(",
+    "NTSO1", "NTSOF", "NTSON", "NTSOS", "NTSOV", "NTTNE", "NTTNK", "NTTNN",
+    "NTTNT", "NTV(1", "NTV(F", "NTVO(", "NTVOF", "NTVOS", "NU(1)", "NU(1O",
+    "NU(E(", "NU(E1", "NU(EF", "NU(EK", "NU(EN", "NU(ES", "NU(EV", "NU(F(",
+    "NU(N)", "NU(NO", "NU(S)", "NU(SO", "NU(V)", "NU(VO", "NU1,(", "NU1,F",
+    "NU1C", "NU1O(", "NU1OF", "NU1OS", "NU1OV", "NU;", "NU;C", "NUC", "NUE",
+    "NUE(1", "NUE(E", "NUE(F", "NUE(N", "NUE(O", "NUE(S", "NUE(V", "NUE1",
+    "NUE1&", "NUE1(", "NUE1)", "NUE1,", "NUE1;", "NUE1B", "NUE1C", "NUE1F",
+    "NUE1K", "NUE1N", "NUE1O", "NUE1S", "NUE1U", "NUE1V", "NUE;", "NUE;C",
+    "NUEC", "NUEF", "NUEF(", "NUEF,", "NUEF;", "NUEFC", "NUEK", "NUEK(",
+    "NUEK1", "NUEK;", "NUEKC", "NUEKF", "NUEKN", "NUEKO", "NUEKS", "NUEKV",
+    "NUEN", "NUEN&", "NUEN(", "NUEN)", "NUEN,", "NUEN1", "NUEN;", "NUENB",
+    "NUENC", "NUENF", "NUENK", "NUENO", "NUENS", "NUENU", "NUEOK", "NUEON",
+    "NUES", "NUES&", "NUES(", "NUES)", "NUES,", "NUES1", "NUES;", "NUESB",
+    "NUESC", "NUESF", "NUESK", "NUESO", "NUESU", "NUESV", "NUEV", "NUEV&",
+    "NUEV(", "NUEV)", "NUEV,", "NUEV;", "NUEVB", "NUEVC", "NUEVF", "NUEVK",
+    "NUEVN", "NUEVO", "NUEVS", "NUEVU", "NUF()", "NUF(1", "NUF(F", "NUF(N",
+    "NUF(S", "NUF(V", "NUK(E", "NUO(E", "NUON(", "NUON1", "NUONF", "NUONS",
+    "NUS,(", "NUS,F", "NUSC", "NUSO(", "NUSO1", "NUSOF", "NUSON", "NUSOS",
+    "NUSOV", "NUTN(", "NUTN1", "NUTNF", "NUTNN", "NUTNS", "NUTNV", "NUV,(",
+    "NUV,F", "NUVC", "NUVO(", "NUVOF", "NUVOS", "S&(1&", "S&(1)", "S&(1,",
+    "S&(1O", "S&(E(", "S&(E1", "S&(EF", "S&(EK", "S&(EN", "S&(EO", "S&(ES",
+    "S&(EV", "S&(F(", "S&(N&", "S&(N)", "S&(N,", "S&(NO", "S&(S&", "S&(S)",
+    "S&(S,", "S&(SO", "S&(V&", "S&(V)", "S&(V,", "S&(VO", "S&1", "S&1&(",
+    "S&1&1", "S&1&F", "S&1&N", "S&1&S", "S&1&V", "S&1)&", "S&1)C", "S&1)O",
+    "S&1)U", "S&1;", "S&1;C", "S&1;E", "S&1;T", "S&1B(", "S&1B1", "S&1BF",
+    "S&1BN", "S&1BS", "S&1BV", "S&1C", "S&1EK", "S&1EN", "S&1F(", "S&1K(",
+    "S&1K1", "S&1KF", "S&1KN", "S&1KS", "S&1KV", "S&1O(", "S&1OF", "S&1OS",
+    "S&1OV", "S&1TN", "S&1U", "S&1U(", "S&1U;", "S&1UC", "S&1UE", "S&E(1",
+    "S&E(F", "S&E(N", "S&E(O", "S&E(S", "S&E(V", "S&E1", "S&E1;", "S&E1C",
+    "S&E1K", "S&E1O", "S&EF(", "S&EK(", "S&EK1", "S&EKF", "S&EKN", "S&EKS",
+    "S&EKV", "S&EN", "S&EN;", "S&ENC", "S&ENK", "S&ENO", "S&ES", "S&ES;",
+    "S&ESC", "S&ESK", "S&ESO", "S&EV", "S&EV;", "S&EVC", "S&EVK", "S&EVO",
+    "S&F()", "S&F(1", "S&F(E", "S&F(F", "S&F(N", "S&F(S", "S&F(V", "S&K&(",
+    "S&K&1", "S&K&F", "S&K&N", "S&K&S", "S&K&V", "S&K(1", "S&K(F", "S&K(N",
+    "S&K(S", "S&K(V", "S&K1O", "S&KC", "S&KF(", "S&KNK", "S&KO(", "S&KO1",
+    "S&KOF", "S&KOK", "S&KON", "S&KOS", "S&KOV", "S&KSO", "S&KVO", "S&N",
+    "S&N&(", "S&N&1", "S&N&F", "S&N&N", "S&N&S", "S&N&V", "S&N)&", "S&N)C",
+    "S&N)O", "S&N)U", "S&N;", "S&N;C", "S&N;E", "S&N;T", "S&NB(", "S&NB1",
+    "S&NBF", "S&NBN", "S&NBS", "S&NBV", "S&NC", "S&NEN", "S&NF(", "S&NK(",
+    "S&NK1", "S&NKF", "S&NKN", "S&NKS", "S&NKV", "S&NO(", "S&NOF", "S&NOS",
+    "S&NOV", "S&NTN", "S&NU", "S&NU(", "S&NU;", "S&NUC", "S&NUE", "S&S",
+    "S&S&(", "S&S&1", "S&S&F", "S&S&N", "S&S&S", "S&S&V", "S&S)&", "S&S)C",
+    "S&S)O", "S&S)U", "S&S1", "S&S1;", "S&S1C", "S&S;", "S&S;C", "S&S;E",
+    "S&S;T", "S&SB(", "S&SB1", "S&SBF", "S&SBN", "S&SBS", "S&SBV", "S&SC",
+    "S&SEK", "S&SEN", "S&SF(", "S&SK(", "S&SK1", "S&SKF", "S&SKN", "S&SKS",
+    "S&SKV", "S&SO(", "S&SO1", "S&SOF", "S&SON", "S&SOS", "S&SOV", "S&STN",
+    "S&SU", "S&SU(", "S&SU;", "S&SUC", "S&SUE", "S&SV", "S&SV;", "S&SVC",
+    "S&SVO", "S&V", "S&V&(", "S&V&1", "S&V&F", "S&V&N", "S&V&S", "S&V&V",
+    "S&V)&", "S&V)C", "S&V)O", "S&V)U", "S&V;", "S&V;C", "S&V;E", "S&V;T",
+    "S&VB(", "S&VB1", "S&VBF", "S&VBN", "S&VBS", "S&VBV", "S&VC", "S&VEK",
+    "S&VEN", "S&VF(", "S&VK(", "S&VK1", "S&VKF", "S&VKN", "S&VKS", "S&VKV",
+    "S&VO(", "S&VOF", "S&VOS", "S&VS", "S&VS;", "S&VSC", "S&VSO", "S&VTN",
+    "S&VU", "S&VU(", "S&VU;", "S&VUC", "S&VUE", "S(EF(", "S(EKF", "S(EKN",
+    "S(ENK", "S(U(E", "S)&(1", "S)&(E", "S)&(F", "S)&(N", "S)&(S", "S)&(V",
+    "S)&1", "S)&1&", "S)&1)", "S)&1;", "S)&1B", "S)&1C", "S)&1F", "S)&1O",
+    "S)&1U", "S)&F(", "S)&N", "S)&N&", "S)&N)", "S)&N;", "S)&NB", "S)&NC",
+    "S)&NF", "S)&NO", "S)&NU", "S)&S", "S)&S&", "S)&S)", "S)&S;", "S)&SB",
+    "S)&SC", "S)&SF", "S)&SO", "S)&SU", "S)&V", "S)&V&", "S)&V)", "S)&V;",
+    "S)&VB", "S)&VC", "S)&VF", "S)&VO", "S)&VU", "S),(1", "S),(F", "S),(N",
+    "S),(S", "S),(V", "S);E(", "S);E1", "S);EF", "S);EK", "S);EN", "S);EO",
+    "S);ES", "S);EV", "S);T(", "S);T1", "S);TF", "S);TK", "S);TN", "S);TO",
+    "S);TS", "S);TV", "S)B(1", "S)B(F", "S)B(N", "S)B(S", "S)B(V", "S)B1",
+    "S)B1&", "S)B1;", "S)B1C", "S)B1K", "S)B1N", "S)B1O", "S)B1U", "S)BF(",
+    "S)BN", "S)BN&", "S)BN;", "S)BNC", "S)BNK", "S)BNO", "S)BNU", "S)BS",
+    "S)BS&", "S)BS;", "S)BSC", "S)BSK", "S)BSO", "S)BSU", "S)BV", "S)BV&",
+    "S)BV;", "S)BVC", "S)BVK", "S)BVO", "S)BVU", "S)C", "S)E(1", "S)E(F",
+    "S)E(N", "S)E(S", "S)E(V", "S)E1C", "S)E1O", "S)EF(", "S)EK(", "S)EK1",
+    "S)EKF", "S)EKN", "S)EKS", "S)EKV", "S)ENC", "S)ENO", "S)ESC", "S)ESO",
+    "S)EVC", "S)EVO", "S)F(F", "S)K(1", "S)K(F", "S)K(N", "S)K(S", "S)K(V",
+    "S)K1&", "S)K1;", "S)K1B", "S)K1E", "S)K1O", "S)K1U", "S)KB(", "S)KB1",
+    "S)KBF", "S)KBN", "S)KBS", "S)KBV", "S)KF(", "S)KN&", "S)KN;", "S)KNB",
+    "S)KNC", "S)KNE", "S)KNK", "S)KNU", "S)KS&", "S)KS;", "S)KSB", "S)KSE",
+    "S)KSO", "S)KSU", "S)KUE", "S)KV&", "S)KV;", "S)KVB", "S)KVE", "S)KVO",
+    "S)KVU", "S)O(1", "S)O(E", "S)O(F", "S)O(N", "S)O(S", "S)O(V", "S)O1",
+    "S)O1&", "S)O1)", "S)O1;", "S)O1B", "S)O1C", "S)O1K", "S)O1U", "S)OF(",
+    "S)ON&", "S)ON)", "S)ON;", "S)ONB", "S)ONC", "S)ONK", "S)ONU", "S)OS",
+    "S)OS&", "S)OS)", "S)OS;", "S)OSB", "S)OSC", "S)OSK", "S)OSU", "S)OV",
+    "S)OV&", "S)OV)", "S)OV;", "S)OVB", "S)OVC", "S)OVK", "S)OVO", "S)OVU",
+    "S)U(E", "S)UE(", "S)UE1", "S)UEF", "S)UEK", "S)UEN", "S)UES", "S)UEV",
+    "S,(1)", "S,(1O", "S,(E(", "S,(E1", "S,(EF", "S,(EK", "S,(EN", "S,(ES",
+    "S,(EV", "S,(F(", "S,(N)", "S,(NO", "S,(S)", "S,(SO", "S,(V)", "S,(VO",
+    "S,F()", "S,F(1", "S,F(F", "S,F(N", "S,F(S", "S,F(V", "S1F()", "S1F(1",
+    "S1F(F", "S1F(N", "S1F(S", "S1F(V", "S1NC", "S1S;", "S1S;C", "S1SC", "S1UE",
+    "S1UE;", "S1UEC", "S1UEK", "S1V", "S1V;", "S1V;C", "S1VC", "S1VO(", "S1VOF",
+    "S1VOS", "S;E(1", "S;E(E", "S;E(F", "S;E(N", "S;E(S", "S;E(V", "S;E1,",
+    "S;E1;", "S;E1C", "S;E1K", "S;E1O", "S;E1T", "S;EF(", "S;EK(", "S;EK1",
+    "S;EKF", "S;EKN", "S;EKO", "S;EKS", "S;EKV", "S;EN,", "S;EN;", "S;ENC",
+    "S;ENE", "S;ENK", "S;ENO", "S;ENT", "S;ES,", "S;ES;", "S;ESC", "S;ESK",
+    "S;ESO", "S;EST", "S;EV,", "S;EV;", "S;EVC", "S;EVK", "S;EVO", "S;EVT",
+    "S;N:T", "S;T(1", "S;T(C", "S;T(E", "S;T(F", "S;T(N", "S;T(S", "S;T(V",
+    "S;T1(", "S;T1,", "S;T1;", "S;T1C", "S;T1F", "S;T1K", "S;T1O", "S;T1T",
+    "S;T;", "S;T;C", "S;TF(", "S;TK(", "S;TK1", "S;TKF", "S;TKK", "S;TKN",
+    "S;TKO", "S;TKS", "S;TKV", "S;TN(", "S;TN,", "S;TN1", "S;TN;", "S;TNC",
+    "S;TNE", "S;TNF", "S;TNK", "S;TNN", "S;TNO", "S;TNS", "S;TNT", "S;TNV",
+    "S;TO(", "S;TS(", "S;TS,", "S;TS;", "S;TSC", "S;TSF", "S;TSK", "S;TSO",
+    "S;TST", "S;TTN", "S;TV(", "S;TV,", "S;TV;", "S;TVC", "S;TVF", "S;TVK",
+    "S;TVO", "S;TVT", "SA(F(", "SA(N)", "SA(NO", "SA(S)", "SA(SO", "SA(V)",
+    "SA(VO", "SAF()", "SAF(1", "SAF(F", "SAF(N", "SAF(S", "SAF(V", "SASO(",
+    "SASO1", "SASOF", "SASON", "SASOS", "SASOV", "SASUE", "SATO(", "SATO1",
+    "SATOF", "SATON", "SATOS", "SATOV", "SATUE", "SAVO(", "SAVOF", "SAVOS",
+    "SAVUE", "SB(1)", "SB(1O", "SB(F(", "SB(NO", "SB(S)", "SB(SO", "SB(V)",
+    "SB(VO", "SB1", "SB1&(", "SB1&1", "SB1&F", "SB1&N", "SB1&S", "SB1&V",
+    "SB1,(", "SB1,F", "SB1;", "SB1;C", "SB1B(", "SB1B1", "SB1BF", "SB1BN",
+    "SB1BS", "SB1BV", "SB1C", "SB1K(", "SB1K1", "SB1KF", "SB1KN", "SB1KS",
+    "SB1KV", "SB1O(", "SB1OF", "SB1OS", "SB1OV", "SB1U(", "SB1UE", "SBE(1",
+    "SBE(F", "SBE(N", "SBE(S", "SBE(V", "SBEK(", "SBF()", "SBF(1", "SBF(F",
+    "SBF(N", "SBF(S", "SBF(V", "SBN", "SBN&(", "SBN&1", "SBN&F", "SBN&N",
+    "SBN&S", "SBN&V", "SBN,(", "SBN,F", "SBN;", "SBN;C", "SBNB(", "SBNB1",
+    "SBNBF", "SBNBN", "SBNBS", "SBNBV", "SBNC", "SBNK(", "SBNK1", "SBNKF",
+    "SBNKN", "SBNKS", "SBNKV", "SBNO(", "SBNOF", "SBNOS", "SBNOV", "SBNU(",
+    "SBNUE", "SBS", "SBS&(", "SBS&1", "SBS&F", "SBS&N", "SBS&S", "SBS&V",
+    "SBS,(", "SBS,F", "SBS;", "SBS;C", "SBSB(", "SBSB1", "SBSBF", "SBSBN",
+    "SBSBS", "SBSBV", "SBSC", "SBSK(", "SBSK1", "SBSKF", "SBSKN", "SBSKS",
+    "SBSKV", "SBSO(", "SBSO1", "SBSOF", "SBSON", "SBSOS", "SBSOV", "SBSU(",
+    "SBSUE", "SBV", "SBV&(", "SBV&1", "SBV&F", "SBV&N", "SBV&S", "SBV&V",
+    "SBV,(", "SBV,F", "SBV;", "SBV;C", "SBVB(", "SBVB1", "SBVBF", "SBVBN",
+    "SBVBS", "SBVBV", "SBVC", "SBVK(", "SBVK1", "SBVKF", "SBVKN", "SBVKS",
+    "SBVKV", "SBVO(", "SBVOF", "SBVOS", "SBVU(", "SBVUE", "SC", "SE(1)",
+    "SE(1O", "SE(F(", "SE(N)", "SE(NO", "SE(S)", "SE(SO", "SE(V)", "SE(VO",
+    "SE1;T", "SE1C", "SE1O(", "SE1OF", "SE1OS", "SE1OV", "SE1T(", "SE1T1",
+    "SE1TF", "SE1TN", "SE1TS", "SE1TV", "SE1UE", "SEF()", "SEF(1", "SEF(F",
+    "SEF(N", "SEF(S", "SEF(V", "SEK(1", "SEK(E", "SEK(F", "SEK(N", "SEK(S",
+    "SEK(V", "SEK1;", "SEK1C", "SEK1O", "SEK1T", "SEK1U", "SEKF(", "SEKN;",
+    "SEKNC", "SEKNE", "SEKNT", "SEKNU", "SEKOK", "SEKS;", "SEKSC", "SEKSO",
+    "SEKST", "SEKSU", "SEKU(", "SEKU1", "SEKUE", "SEKUF", "SEKUS", "SEKUV",
+    "SEKV;", "SEKVC", "SEKVO", "SEKVT", "SEKVU", "SEN;T", "SENC", "SENEN",
+    "SENO(", "SENOF", "SENOS", "SENOV", "SENT(", "SENT1", "SENTF", "SENTN",
+    "SENTS", "SENTV", "SENUE", "SEOKN", "SES;T", "SESC", "SESO(", "SESO1",
+    "SESOF", "SESON", "SESOS", "SESOV", "SEST(", "SEST1", "SESTF", "SESTN",
+    "SESTS", "SESTV", "SESUE", "SEU(1", "SEU(F", "SEU(N", "SEU(S", "SEU(V",
+    "SEU1,", "SEU1C", "SEU1O", "SEUEF", "SEUEK", "SEUF(", "SEUS,", "SEUSC",
+    "SEUSO", "SEUV,", "SEUVC", "SEUVO", "SEV;T", "SEVC", "SEVO(", "SEVOF",
+    "SEVOS", "SEVT(", "SEVT1", "SEVTF", "SEVTN", "SEVTS", "SEVTV", "SEVUE",
+    "SF()1", "SF()F", "SF()K", "SF()N", "SF()O", "SF()S", "SF()U", "SF()V",
+    "SF(1)", "SF(1N", "SF(1O", "SF(E(", "SF(E1", "SF(EF", "SF(EK", "SF(EN",
+    "SF(ES", "SF(EV", "SF(F(", "SF(N)", "SF(N,", "SF(NO", "SF(S)", "SF(SO",
+    "SF(V)", "SF(VO", "SK(1)", "SK(1O", "SK(F(", "SK(N)", "SK(NO", "SK(S)",
+    "SK(SO", "SK(V)", "SK(VO", "SK)&(", "SK)&1", "SK)&F", "SK)&N", "SK)&S",
+    "SK)&V", "SK);E", "SK);T", "SK)B(", "SK)B1", "SK)BF", "SK)BN", "SK)BS",
+    "SK)BV", "SK)E(", "SK)E1", "SK)EF", "SK)EK", "SK)EN", "SK)ES", "SK)EV",
+    "SK)F(", "SK)O(", "SK)OF", "SK)UE", "SK1", "SK1&(", "SK1&1", "SK1&F",
+    "SK1&N", "SK1&S", "SK1&V", "SK1;", "SK1;C", "SK1;E", "SK1;T", "SK1B(",
+    "SK1B1", "SK1BF", "SK1BN", "SK1BS", "SK1BV", "SK1C", "SK1E(", "SK1E1",
+    "SK1EF", "SK1EK", "SK1EN", "SK1ES", "SK1EV", "SK1O(", "SK1OF", "SK1OS",
+    "SK1OV", "SK1U(", "SK1UE", "SKF()", "SKF(1", "SKF(F", "SKF(N", "SKF(S",
+    "SKF(V", "SKN", "SKN&(", "SKN&1", "SKN&F", "SKN&N", "SKN&S", "SKN&V",
+    "SKN;", "SKN;C", "SKN;E", "SKN;T", "SKNB(", "SKNB1", "SKNBF", "SKNBN",
+    "SKNBS", "SKNBV", "SKNC", "SKNE(", "SKNE1", "SKNEF", "SKNEN", "SKNES",
+    "SKNEV", "SKNU(", "SKNUE", "SKS", "SKS&(", "SKS&1", "SKS&F", "SKS&N",
+    "SKS&S", "SKS&V", "SKS;", "SKS;C", "SKS;E", "SKS;T", "SKSB(", "SKSB1",
+    "SKSBF", "SKSBN", "SKSBS", "SKSBV", "SKSC", "SKSE(", "SKSE1", "SKSEF",
+    "SKSEK", "SKSEN", "SKSES", "SKSEV", "SKSO(", "SKSO1", "SKSOF", "SKSON",
+    "SKSOS", "SKSOV", "SKSU(", "SKSUE", "SKUE(", "SKUE1", "SKUEF", "SKUEK",
+    "SKUEN", "SKUES", "SKUEV", "SKV", "SKV&(", "SKV&1", "SKV&F", "SKV&N",
+    "SKV&S", "SKV&V", "SKV;", "SKV;C", "SKV;E", "SKV;T", "SKVB(", "SKVB1",
+    "SKVBF", "SKVBN", "SKVBS", "SKVBV", "SKVC", "SKVE(", "SKVE1", "SKVEF",
+    "SKVEK", "SKVEN", "SKVES", "SKVEV", "SKVO(", "SKVOF", "SKVOS", "SKVU(",
+    "SKVUE", "SO(1&", "SO(1)", "SO(1,", "SO(1O", "SO(E(", "SO(E1", "SO(EE",
+    "SO(EF", "SO(EK", "SO(EN", "SO(EO", "SO(ES", "SO(EV", "SO(F(", "SO(N&",
+    "SO(N)", "SO(N,", "SO(NO", "SO(S&", "SO(S)", "SO(S,", "SO(SO", "SO(V&",
+    "SO(V)", "SO(V,", "SO(VO", "SO1&(", "SO1&1", "SO1&E", "SO1&F", "SO1&K",
+    "SO1&N", "SO1&S", "SO1&U", "SO1&V", "SO1(E", "SO1(U", "SO1)&", "SO1),",
+    "SO1);", "SO1)B", "SO1)C", "SO1)E", "SO1)F", "SO1)K", "SO1)O", "SO1)U",
+    "SO1,(", "SO1,F", "SO1;", "SO1;C", "SO1;E", "SO1;N", "SO1;T", "SO1A(",
+    "SO1AF", "SO1AS", "SO1AT", "SO1AV", "SO1B(", "SO1B1", "SO1BE", "SO1BF",
+    "SO1BN", "SO1BS", "SO1BV", "SO1C", "SO1E(", "SO1E1", "SO1EF", "SO1EK",
+    "SO1EN", "SO1EO", "SO1ES", "SO1EU", "SO1EV", "SO1F(", "SO1K(", "SO1K)",
+    "SO1K1", "SO1KB", "SO1KF", "SO1KN", "SO1KS", "SO1KU", "SO1KV", "SO1N&",
+    "SO1N(", "SO1N,", "SO1NE", "SO1NU", "SO1SU", "SO1SV", "SO1T(", "SO1T1",
+    "SO1TE", "SO1TF", "SO1TN", "SO1TS", "SO1TT", "SO1TV", "SO1U", "SO1U(",
+    "SO1U1", "SO1U;", "SO1UC", "SO1UE", "SO1UF", "SO1UK", "SO1UO", "SO1US",
+    "SO1UT", "SO1UV", "SO1V(", "SO1VF", "SO1VO", "SO1VS", "SO1VU", "SOF()",
+    "SOF(1", "SOF(E", "SOF(F", "SOF(N", "SOF(S", "SOF(V", "SOK&(", "SOK&1",
+    "SOK&F", "SOK&N", "SOK&S", "SOK&V", "SOK(1", "SOK(F", "SOK(N", "SOK(S",
+    "SOK(V", "SOK1C", "SOK1O", "SOKF(", "SOKNC", "SOKO(", "SOKO1", "SOKOF",
+    "SOKON", "SOKOS", "SOKOV", "SOKSC", "SOKSO", "SOKVC", "SOKVO", "SON&(",
+    "SON&1", "SON&E", "SON&F", "SON&K", "SON&N", "SON&S", "SON&U", "SON&V",
+    "SON(1", "SON(E", "SON(F", "SON(S", "SON(U", "SON(V", "SON)&", "SON),",
+    "SON);", "SON)B", "SON)C", "SON)E", "SON)F", "SON)K", "SON)O", "SON)U",
+    "SON,(", "SON,F", "SON1(", "SON1O", "SON1U", "SON1V", "SON;", "SON;C",
+    "SON;E", "SON;N", "SON;T", "SONA(", "SONAF", "SONAS", "SONAT", "SONAV",
+    "SONB(", "SONB1", "SONBE", "SONBF", "SONBN", "SONBS", "SONBV", "SONE(",
+    "SONE1", "SONEF", "SONEN", "SONEO", "SONES", "SONEU", "SONEV", "SONF(",
+    "SONK(", "SONK)", "SONK1", "SONKB", "SONKF", "SONKS", "SONKU", "SONKV",
+    "SONSU", "SONT(", "SONT1", "SONTE", "SONTF", "SONTN", "SONTS", "SONTT",
+    "SONTV", "SONU", "SONU(", "SONU1", "SONU;", "SONUC", "SONUE", "SONUF",
+    "SONUK", "SONUO", "SONUS", "SONUT", "SONUV", "SOS", "SOS&(", "SOS&1",
+    "SOS&E", "SOS&F", "SOS&K", "SOS&N", "SOS&S", "SOS&U", "SOS&V", "SOS(E",
+    "SOS(U", "SOS)&", "SOS),", "SOS);", "SOS)B", "SOS)C", "SOS)E", "SOS)F",
+    "SOS)K", "SOS)O", "SOS)U", "SOS,(", "SOS,F", "SOS1(", "SOS1F", "SOS1N",
+    "SOS1S", "SOS1U", "SOS1V", "SOS;", "SOS;C", "SOS;E", "SOS;N", "SOS;T",
+    "SOSA(", "SOSAF", "SOSAS", "SOSAT", "SOSAV", "SOSB(", "SOSB1", "SOSBE",
+    "SOSBF", "SOSBN", "SOSBS", "SOSBV", "SOSC", "SOSE(", "SOSE1", "SOSEF",
+    "SOSEK", "SOSEN", "SOSEO", "SOSES", "SOSEU", "SOSEV", "SOSF(", "SOSK(",
+    "SOSK)", "SOSK1", "SOSKB", "SOSKF", "SOSKN", "SOSKS", "SOSKU", "SOSKV",
+    "SOST(", "SOST1", "SOSTE", "SOSTF", "SOSTN", "SOSTS", "SOSTT", "SOSTV",
+    "SOSU", "SOSU(", "SOSU1", "SOSU;", "SOSUC", "SOSUE", "SOSUF", "SOSUK",
+    "SOSUO", "SOSUS", "SOSUT", "SOSUV", "SOSV(", "SOSVF", "SOSVO", "SOSVS",
+    "SOSVU", "SOU(E", "SOUEK", "SOUEN", "SOV", "SOV&(", "SOV&1", "SOV&E",
+    "SOV&F", "SOV&K", "SOV&N", "SOV&S", "SOV&U", "SOV&V", "SOV(E", "SOV(U",
+    "SOV)&", "SOV),", "SOV);", "SOV)B", "SOV)C", "SOV)E", "SOV)F", "SOV)K",
+    "SOV)O", "SOV)U", "SOV,(", "SOV,F", "SOV;", "SOV;C", "SOV;E", "SOV;N",
+    "SOV;T", "SOVA(", "SOVAF", "SOVAS", "SOVAT", "SOVAV", "SOVB(", "SOVB1",
+    "SOVBE", "SOVBF", "SOVBN", "SOVBS", "SOVBV", "SOVC", "SOVE(", "SOVE1",
+    "SOVEF", "SOVEK", "SOVEN", "SOVEO", "SOVES", "SOVEU", "SOVEV", "SOVF(",
+    "SOVK(", "SOVK)", "SOVK1", "SOVKB", "SOVKF", "SOVKN", "SOVKS", "SOVKU",
+    "SOVKV", "SOVO(", "SOVOF", "SOVOK", "SOVOS", "SOVOU", "SOVS(", "SOVS1",
+    "SOVSF", "SOVSO", "SOVSU", "SOVSV", "SOVT(", "SOVT1", "SOVTE", "SOVTF",
+    "SOVTN", "SOVTS", "SOVTT", "SOVTV", "SOVU", "SOVU(", "SOVU1", "SOVU;",
+    "SOVUC", "SOVUE", "SOVUF", "SOVUK", "SOVUO", "SOVUS", "SOVUT", "SOVUV",
+    "ST(1)", "ST(1O", "ST(F(", "ST(N)", "ST(NO", "ST(S)", "ST(SO", "ST(V)",
+    "ST(VO", "ST1(F", "ST1O(", "ST1OF", "ST1OS", "ST1OV", "STE(1", "STE(F",
+    "STE(N", "STE(S", "STE(V", "STE1N", "STE1O", "STEF(", "STEK(", "STEK1",
+    "STEKF", "STEKN", "STEKS", "STEKV", "STENN", "STENO", "STESN", "STESO",
+    "STEVN", "STEVO", "STF()", "STF(1", "STF(F", "STF(N", "STF(S", "STF(V",
+    "STN(1", "STN(F", "STN(S", "STN(V", "STN1C", "STN1O", "STN;E", "STN;N",
+    "STN;T", "STNE(", "STNE1", "STNEF", "STNEN", "STNES", "STNEV", "STNF(",
+    "STNKN", "STNN:", "STNNC", "STNNO", "STNO(", "STNOF", "STNOS", "STNOV",
+    "STNSC", "STNSO", "STNT(", "STNT1", "STNTF", "STNTN", "STNTS", "STNTV",
+    "STNVC", "STNVO", "STS(F", "STSO(", "STSO1", "STSOF", "STSON", "STSOS",
+    "STSOV", "STTNE", "STTNK", "STTNN", "STTNT", "STV(1", "STV(F", "STVO(",
+    "STVOF", "STVOS", "SU(1)", "SU(1O", "SU(E(", "SU(E1", "SU(EF", "SU(EK",
+    "SU(EN", "SU(ES", "SU(EV", "SU(F(", "SU(N)", "SU(NO", "SU(S)", "SU(SO",
+    "SU(V)", "SU(VO", "SU1,(", "SU1,F", "SU1C", "SU1O(", "SU1OF", "SU1OS",
+    "SU1OV", "SU;", "SU;C", "SUC", "SUE", "SUE(1", "SUE(E", "SUE(F", "SUE(N",
+    "SUE(O", "SUE(S", "SUE(V", "SUE1", "SUE1&", "SUE1(", "SUE1)", "SUE1,",
+    "SUE1;", "SUE1B", "SUE1C", "SUE1F", "SUE1K", "SUE1N", "SUE1O", "SUE1S",
+    "SUE1U", "SUE1V", "SUE;", "SUE;C", "SUEC", "SUEF", "SUEF(", "SUEF,",
+    "SUEF;", "SUEFC", "SUEK", "SUEK(", "SUEK1", "SUEK;", "SUEKC", "SUEKF",
+    "SUEKN", "SUEKO", "SUEKS", "SUEKV", "SUEN", "SUEN&", "SUEN(", "SUEN)",
+    "SUEN,", "SUEN1", "SUEN;", "SUENB", "SUENC", "SUENF", "SUENK", "SUENO",
+    "SUENS", "SUENU", "SUEOK", "SUEON", "SUES", "SUES&", "SUES(", "SUES)",
+    "SUES,", "SUES1", "SUES;", "SUESB", "SUESC", "SUESF", "SUESK", "SUESO",
+    "SUESU", "SUESV", "SUEV", "SUEV&", "SUEV(", "SUEV)", "SUEV,", "SUEV;",
+    "SUEVB", "SUEVC", "SUEVF", "SUEVK", "SUEVN", "SUEVO", "SUEVS", "SUEVU",
+    "SUF()", "SUF(1", "SUF(F", "SUF(N", "SUF(S", "SUF(V", "SUK(E", "SUO(E",
+    "SUON(", "SUON1", "SUONF", "SUONS", "SUS,(", "SUS,F", "SUSC", "SUSO(",
+    "SUSO1", "SUSOF", "SUSON", "SUSOS", "SUSOV", "SUTN(", "SUTN1", "SUTNF",
+    "SUTNN", "SUTNS", "SUTNV", "SUV,(", "SUV,F", "SUVC", "SUVO(", "SUVOF",
+    "SUVOS", "SVF()", "SVF(1", "SVF(F", "SVF(N", "SVF(S", "SVF(V", "SVO(1",
+    "SVO(F", "SVO(N", "SVO(S", "SVO(V", "SVOF(", "SVOS(", "SVOS1", "SVOSF",
+    "SVOSU", "SVOSV", "SVS;", "SVS;C", "SVSC", "SVSO(", "SVSO1", "SVSOF",
+    "SVSON", "SVSOS", "SVSOV", "SVUE", "SVUE;", "SVUEC", "SVUEK", "T(1)F",
+    "T(1)O", "T(1F(", "T(1N)", "T(1O(", "T(1OF", "T(1OS", "T(1OV", "T(1S)",
+    "T(1V)", "T(1VO", "T(F()", "T(F(1", "T(F(F", "T(F(N", "T(F(S", "T(F(V",
+    "T(N(1", "T(N(F", "T(N(S", "T(N(V", "T(N)F", "T(N)O", "T(N1)", "T(N1O",
+    "T(NF(", "T(NN)", "T(NNO", "T(NO(", "T(NOF", "T(NOS", "T(NOV", "T(NS)",
+    "T(NSO", "T(NV)", "T(NVO", "T(S)F", "T(S)O", "T(S1)", "T(SF(", "T(SN)",
+    "T(SNO", "T(SO(", "T(SO1", "T(SOF", "T(SON", "T(SOS", "T(SOV", "T(SV)",
+    "T(SVO", "T(V)F", "T(V)O", "T(VF(", "T(VO(", "T(VOF", "T(VOS", "T(VS)",
+    "T(VSO", "T(VV)", "T1F(1", "T1F(F", "T1F(N", "T1F(S", "T1F(V", "T1O(1",
+    "T1O(F", "T1O(N", "T1O(S", "T1O(V", "T1OF(", "T1OSF", "T1OVF", "T1OVO",
+    "TF()F", "TF()O", "TF(1)", "TF(1O", "TF(F(", "TF(N)", "TF(NO", "TF(S)",
+    "TF(SO", "TF(V)", "TF(VO", "TN(1)", "TN(1O", "TN(F(", "TN(S)", "TN(SO",
+    "TN(V)", "TN(VO", "TN1;", "TN1;C", "TN1O(", "TN1OF", "TN1OS", "TN1OV",
+    "TNF()", "TNF(1", "TNF(F", "TNF(N", "TNF(S", "TNF(V", "TNN;", "TNN;C",
+    "TNNO(", "TNNOF", "TNNOS", "TNNOV", "TNO(1", "TNO(F", "TNO(N", "TNO(S",
+    "TNO(V", "TNOF(", "TNOSF", "TNOVF", "TNOVO", "TNS;", "TNS;C", "TNSO(",
+    "TNSO1", "TNSOF", "TNSON", "TNSOS", "TNSOV", "TNV;", "TNV;C", "TNVO(",
+    "TNVOF", "TNVOS", "TSF(1", "TSF(F", "TSF(N", "TSF(S", "TSF(V", "TSO(1",
+    "TSO(F", "TSO(N", "TSO(S", "TSO(V", "TSO1F", "TSOF(", "TSONF", "TSOSF",
+    "TSOVF", "TSOVO", "TVF(1", "TVF(F", "TVF(N", "TVF(S", "TVF(V", "TVO(1",
+    "TVO(F", "TVO(N", "TVO(S", "TVO(V", "TVOF(", "TVOSF", "U(E(1", "U(E(F",
+    "U(E(K", "U(E(N", "U(E(S", "U(E(V", "U(E1)", "U(E1O", "U(EF(", "U(EK(",
+    "U(EK1", "U(EKF", "U(EKN", "U(EKO", "U(EKS", "U(EKV", "U(EN)", "U(ENK",
+    "U(ENO", "U(EOK", "U(ES)", "U(ESO", "U(EV)", "U(EVO", "UE(1)", "UE(1,",
+    "UE(1O", "UE(F(", "UE(N)", "UE(N,", "UE(NO", "UE(S)", "UE(S,", "UE(SO",
+    "UE(V)", "UE(V,", "UE(VO", "UE1", "UE1,(", "UE1,F", "UE1;", "UE1;C", "UE1C",
+    "UE1K(", "UE1K1", "UE1KF", "UE1KN", "UE1KS", "UE1KV", "UE1O(", "UE1OF",
+    "UE1OS", "UE1OV", "UEF()", "UEF(1", "UEF(F", "UEF(N", "UEF(S", "UEF(V",
+    "UEK(1", "UEK(F", "UEK(N", "UEK(S", "UEK(V", "UEK1", "UEK1,", "UEK1;",
+    "UEK1C", "UEK1K", "UEK1O", "UEKF(", "UEKN", "UEKN(", "UEKN,", "UEKN;",
+    "UEKNC", "UEKNK", "UEKS", "UEKS,", "UEKS;", "UEKSC", "UEKSK", "UEKSO",
+    "UEKV", "UEKV,", "UEKV;", "UEKVC", "UEKVK", "UEKVO", "UEN()", "UEN,(",
+    "UEN,F", "UEN;", "UEN;C", "UENC", "UENK(", "UENK1", "UENKF", "UENKN",
+    "UENKS", "UENKV", "UENO(", "UENOF", "UENOS", "UENOV", "UES", "UES,(",
+    "UES,F", "UES;", "UES;C", "UESC", "UESK(", "UESK1", "UESKF", "UESKN",
+    "UESKS", "UESKV", "UESO(", "UESO1", "UESOF", "UESON", "UESOS", "UESOV",
+    "UEV", "UEV,(", "UEV,F", "UEV;", "UEV;C", "UEVC", "UEVK(", "UEVK1", "UEVKF",
+    "UEVKN", "UEVKS", "UEVKV", "UEVO(", "UEVOF", "UEVOS", "UF(1O", "UF(F(",
+    "UF(NO", "UF(SO", "UF(VO", "V&(1&", "V&(1)", "V&(1,", "V&(1O", "V&(E(",
+    "V&(E1", "V&(EF", "V&(EK", "V&(EN", "V&(EO", "V&(ES", "V&(EV", "V&(F(",
+    "V&(N&", "V&(N)", "V&(N,", "V&(NO", "V&(S&", "V&(S)", "V&(S,", "V&(SO",
+    "V&(V&", "V&(V)", "V&(V,", "V&(VO", "V&1", "V&1&(", "V&1&1", "V&1&F",
+    "V&1&N", "V&1&S", "V&1&V", "V&1)&", "V&1)C", "V&1)O", "V&1)U", "V&1;",
+    "V&1;C", "V&1;E", "V&1;T", "V&1B(", "V&1B1", "V&1BF", "V&1BN", "V&1BS",
+    "V&1BV", "V&1C", "V&1EK", "V&1EN", "V&1F(", "V&1K(", "V&1K1", "V&1KF",
+    "V&1KN", "V&1KS", "V&1KV", "V&1O(", "V&1OF", "V&1OS", "V&1OV", "V&1TN",
+    "V&1U", "V&1U(", "V&1U;", "V&1UC", "V&1UE", "V&E(1", "V&E(F", "V&E(N",
+    "V&E(O", "V&E(S", "V&E(V", "V&E1", "V&E1;", "V&E1C", "V&E1K", "V&E1O",
+    "V&EF(", "V&EK(", "V&EK1", "V&EKF", "V&EKN", "V&EKS", "V&EKV", "V&EN",
+    "V&EN;", "V&ENC", "V&ENK", "V&ENO", "V&ES", "V&ES;", "V&ESC", "V&ESK",
+    "V&ESO", "V&EV", "V&EV;", "V&EVC", "V&EVK", "V&EVO", "V&F()", "V&F(1",
+    "V&F(E", "V&F(F", "V&F(N", "V&F(S", "V&F(V", "V&K&(", "V&K&1", "V&K&F",
+    "V&K&N", "V&K&S", "V&K&V", "V&K(1", "V&K(F", "V&K(N", "V&K(S", "V&K(V",
+    "V&K1O", "V&KC", "V&KF(", "V&KNK", "V&KO(", "V&KO1", "V&KOF", "V&KOK",
+    "V&KON", "V&KOS", "V&KOV", "V&KSO", "V&KVO", "V&N", "V&N&(", "V&N&1",
+    "V&N&F", "V&N&N", "V&N&S", "V&N&V", "V&N)&", "V&N)C", "V&N)O", "V&N)U",
+    "V&N;", "V&N;C", "V&N;E", "V&N;T", "V&NB(", "V&NB1", "V&NBF", "V&NBN",
+    "V&NBS", "V&NBV", "V&NC", "V&NEN", "V&NF(", "V&NK(", "V&NK1", "V&NKF",
+    "V&NKN", "V&NKS", "V&NKV", "V&NO(", "V&NOF", "V&NOS", "V&NOV", "V&NTN",
+    "V&NU", "V&NU(", "V&NU;", "V&NUC", "V&NUE", "V&S", "V&S&(", "V&S&1",
+    "V&S&F", "V&S&N", "V&S&S", "V&S&V", "V&S)&", "V&S)C", "V&S)O", "V&S)U",
+    "V&S1", "V&S1;", "V&S1C", "V&S;", "V&S;C", "V&S;E", "V&S;T", "V&SB(",
+    "V&SB1", "V&SBF", "V&SBN", "V&SBS", "V&SBV", "V&SC", "V&SEK", "V&SEN",
+    "V&SF(", "V&SK(", "V&SK1", "V&SKF", "V&SKN", "V&SKS", "V&SKV", "V&SO(",
+    "V&SO1", "V&SOF", "V&SON", "V&SOS", "V&SOV", "V&STN", "V&SU", "V&SU(",
+    "V&SU;", "V&SUC", "V&SUE", "V&SV", "V&SV;", "V&SVC", "V&SVO", "V&V",
+    "V&V&(", "V&V&1", "V&V&F", "V&V&N", "V&V&S", "V&V&V", "V&V)&", "V&V)C",
+    "V&V)O", "V&V)U", "V&V;", "V&V;C", "V&V;E", "V&V;T", "V&VB(", "V&VB1",
+    "V&VBF", "V&VBN", "V&VBS", "V&VBV", "V&VC", "V&VEK", "V&VEN", "V&VF(",
+    "V&VK(", "V&VK1", "V&VKF", "V&VKN", "V&VKS", "V&VKV", "V&VO(", "V&VOF",
+    "V&VOS", "V&VS", "V&VS;", "V&VSC", "V&VSO", "V&VTN", "V&VU", "V&VU(",
+    "V&VU;", "V&VUC", "V&VUE", "V(EF(", "V(EKF", "V(EKN", "V(ENK", "V(U(E",
+    "V)&(1", "V)&(E", "V)&(F", "V)&(N", "V)&(S", "V)&(V", "V)&1", "V)&1&",
+    "V)&1)", "V)&1;", "V)&1B", "V)&1C", "V)&1F", "V)&1O", "V)&1U", "V)&F(",
+    "V)&N", "V)&N&", "V)&N)", "V)&N;", "V)&NB", "V)&NC", "V)&NF", "V)&NO",
+    "V)&NU", "V)&S", "V)&S&", "V)&S)", "V)&S;", "V)&SB", "V)&SC", "V)&SF",
+    "V)&SO", "V)&SU", "V)&V", "V)&V&", "V)&V)", "V)&V;", "V)&VB", "V)&VC",
+    "V)&VF", "V)&VO", "V)&VU", "V),(1", "V),(F", "V),(N", "V),(S", "V),(V",
+    "V);E(", "V);E1", "V);EF", "V);EK", "V);EN", "V);EO", "V);ES", "V);EV",
+    "V);T(", "V);T1", "V);TF", "V);TK", "V);TN", "V);TO", "V);TS", "V);TV",
+    "V)B(1", "V)B(F", "V)B(N", "V)B(S", "V)B(V", "V)B1", "V)B1&", "V)B1;",
+    "V)B1C", "V)B1K", "V)B1N", "V)B1O", "V)B1U", "V)BF(", "V)BN", "V)BN&",
+    "V)BN;", "V)BNC", "V)BNK", "V)BNO", "V)BNU", "V)BS", "V)BS&", "V)BS;",
+    "V)BSC", "V)BSK", "V)BSO", "V)BSU", "V)BV", "V)BV&", "V)BV;", "V)BVC",
+    "V)BVK", "V)BVO", "V)BVU", "V)C", "V)E(1", "V)E(F", "V)E(N", "V)E(S",
+    "V)E(V", "V)E1C", "V)E1O", "V)EF(", "V)EK(", "V)EK1", "V)EKF", "V)EKN",
+    "V)EKS", "V)EKV", "V)ENC", "V)ENO", "V)ESC", "V)ESO", "V)EVC", "V)EVO",
+    "V)F(F", "V)K(1", "V)K(F", "V)K(N", "V)K(S", "V)K(V", "V)K1&", "V)K1;",
+    "V)K1B", "V)K1E", "V)K1O", "V)K1U", "V)KB(", "V)KB1", "V)KBF", "V)KBN",
+    "V)KBS", "V)KBV", "V)KF(", "V)KN&", "V)KN;", "V)KNB", "V)KNC", "V)KNE",
+    "V)KNK", "V)KNU", "V)KS&", "V)KS;", "V)KSB", "V)KSE", "V)KSO", "V)KSU",
+    "V)KUE", "V)KV&", "V)KV;", "V)KVB", "V)KVE", "V)KVO", "V)KVU", "V)O(1",
+    "V)O(E", "V)O(F", "V)O(N", "V)O(S", "V)O(V", "V)O1", "V)O1&", "V)O1)",
+    "V)O1;", "V)O1B", "V)O1C", "V)O1K", "V)O1U", "V)OF(", "V)ON", "V)ON&",
+    "V)ON)", "V)ON;", "V)ONB", "V)ONC", "V)ONK", "V)ONU", "V)OS", "V)OS&",
+    "V)OS)", "V)OS;", "V)OSB", "V)OSC", "V)OSK", "V)OSU", "V)OV", "V)OV&",
+    "V)OV)", "V)OV;", "V)OVB", "V)OVC", "V)OVK", "V)OVO", "V)OVU", "V)U(E",
+    "V)UE(", "V)UE1", "V)UEF", "V)UEK", "V)UEN", "V)UES", "V)UEV", "V,(1)",
+    "V,(1O", "V,(E(", "V,(E1", "V,(EF", "V,(EK", "V,(EN", "V,(ES", "V,(EV",
+    "V,(F(", "V,(N)", "V,(NO", "V,(S)", "V,(SO", "V,(V)", "V,(VO", "V,F()",
+    "V,F(1", "V,F(F", "V,F(N", "V,F(S", "V,F(V", "V;E(1", "V;E(E", "V;E(F",
+    "V;E(N", "V;E(S", "V;E(V", "V;E1,", "V;E1;", "V;E1C", "V;E1K", "V;E1O",
+    "V;E1T", "V;EF(", "V;EK(", "V;EK1", "V;EKF", "V;EKN", "V;EKO", "V;EKS",
+    "V;EKV", "V;EN,", "V;EN;", "V;ENC", "V;ENE", "V;ENK", "V;ENO", "V;ENT",
+    "V;ES,", "V;ES;", "V;ESC", "V;ESK", "V;ESO", "V;EST", "V;EV,", "V;EV;",
+    "V;EVC", "V;EVK", "V;EVO", "V;EVT", "V;N:T", "V;T(1", "V;T(C", "V;T(E",
+    "V;T(F", "V;T(N", "V;T(S", "V;T(V", "V;T1(", "V;T1,", "V;T1;", "V;T1C",
+    "V;T1F", "V;T1K", "V;T1O", "V;T1T", "V;T;", "V;T;C", "V;TF(", "V;TK(",
+    "V;TK1", "V;TKF", "V;TKK", "V;TKN", "V;TKO", "V;TKS", "V;TKV", "V;TN(",
+    "V;TN,", "V;TN1", "V;TN;", "V;TNC", "V;TNE", "V;TNF", "V;TNK", "V;TNN",
+    "V;TNO", "V;TNS", "V;TNT", "V;TNV", "V;TO(", "V;TS(", "V;TS,", "V;TS;",
+    "V;TSC", "V;TSF", "V;TSK", "V;TSO", "V;TST", "V;TTN", "V;TV(", "V;TV,",
+    "V;TV;", "V;TVC", "V;TVF", "V;TVK", "V;TVO", "V;TVT", "VA(F(", "VA(N)",
+    "VA(NO", "VA(S)", "VA(SO", "VA(V)", "VA(VO", "VAF()", "VAF(1", "VAF(F",
+    "VAF(N", "VAF(S", "VAF(V", "VASO(", "VASO1", "VASOF", "VASON", "VASOS",
+    "VASOV", "VASUE", "VATO(", "VATO1", "VATOF", "VATON", "VATOS", "VATOV",
+    "VATUE", "VAVO(", "VAVOF", "VAVOS", "VAVUE", "VB(1)", "VB(1O", "VB(F(",
+    "VB(NO", "VB(S)", "VB(SO", "VB(V)", "VB(VO", "VB1", "VB1&(", "VB1&1",
+    "VB1&F", "VB1&N", "VB1&S", "VB1&V", "VB1,(", "VB1,F", "VB1;", "VB1;C",
+    "VB1B(", "VB1B1", "VB1BF", "VB1BN", "VB1BS", "VB1BV", "VB1C", "VB1K(",
+    "VB1K1", "VB1KF", "VB1KN", "VB1KS", "VB1KV", "VB1O(", "VB1OF", "VB1OS",
+    "VB1OV", "VB1U(", "VB1UE", "VBE(1", "VBE(F", "VBE(N", "VBE(S", "VBE(V",
+    "VBEK(", "VBF()", "VBF(1", "VBF(F", "VBF(N", "VBF(S", "VBF(V", "VBN",
+    "VBN&(", "VBN&1", "VBN&F", "VBN&N", "VBN&S", "VBN&V", "VBN,(", "VBN,F",
+    "VBN;", "VBN;C", "VBNB(", "VBNB1", "VBNBF", "VBNBN", "VBNBS", "VBNBV",
+    "VBNC", "VBNK(", "VBNK1", "VBNKF", "VBNKN", "VBNKS", "VBNKV", "VBNO(",
+    "VBNOF", "VBNOS", "VBNOV", "VBNU(", "VBNUE", "VBS", "VBS&(", "VBS&1",
+    "VBS&F", "VBS&N", "VBS&S", "VBS&V", "VBS,(", "VBS,F", "VBS;", "VBS;C",
+    "VBSB(", "VBSB1", "VBSBF", "VBSBN", "VBSBS", "VBSBV", "VBSC", "VBSK(",
+    "VBSK1", "VBSKF", "VBSKN", "VBSKS", "VBSKV", "VBSO(", "VBSO1", "VBSOF",
+    "VBSON", "VBSOS", "VBSOV", "VBSU(", "VBSUE", "VBV", "VBV&(", "VBV&1",
+    "VBV&F", "VBV&N", "VBV&S", "VBV&V", "VBV,(", "VBV,F", "VBV;", "VBV;C",
+    "VBVB(", "VBVB1", "VBVBF", "VBVBN", "VBVBS", "VBVBV", "VBVC", "VBVK(",
+    "VBVK1", "VBVKF", "VBVKN", "VBVKS", "VBVKV", "VBVO(", "VBVOF", "VBVOS",
+    "VBVU(", "VBVUE", "VC", "VE(1)", "VE(1O", "VE(F(", "VE(N)", "VE(NO",
+    "VE(S)", "VE(SO", "VE(V)", "VE(VO", "VE1;T", "VE1C", "VE1O(", "VE1OF",
+    "VE1OS", "VE1OV", "VE1T(", "VE1T1", "VE1TF", "VE1TN", "VE1TS", "VE1TV",
+    "VE1UE", "VEF()", "VEF(1", "VEF(F", "VEF(N", "VEF(S", "VEF(V", "VEK(1",
+    "VEK(E", "VEK(F", "VEK(N", "VEK(S", "VEK(V", "VEK1;", "VEK1C", "VEK1O",
+    "VEK1T", "VEK1U", "VEKF(", "VEKN;", "VEKNC", "VEKNE", "VEKNT", "VEKNU",
+    "VEKOK", "VEKS;", "VEKSC", "VEKSO", "VEKST", "VEKSU", "VEKU(", "VEKU1",
+    "VEKUE", "VEKUF", "VEKUS", "VEKUV", "VEKV;", "VEKVC", "VEKVO", "VEKVT",
+    "VEKVU", "VEN;T", "VENC", "VENEN", "VENO(", "VENOF", "VENOS", "VENOV",
+    "VENT(", "VENT1", "VENTF", "VENTN", "VENTS", "VENTV", "VENUE", "VEOKN",
+    "VES;T", "VESC", "VESO(", "VESO1", "VESOF", "VESON", "VESOS", "VESOV",
+    "VEST(", "VEST1", "VESTF", "VESTN", "VESTS", "VESTV", "VESUE", "VEU(1",
+    "VEU(F", "VEU(N", "VEU(S", "VEU(V", "VEU1,", "VEU1C", "VEU1O", "VEUEF",
+    "VEUEK", "VEUF(", "VEUS,", "VEUSC", "VEUSO", "VEUV,", "VEUVC", "VEUVO",
+    "VEV;T", "VEVC", "VEVO(", "VEVOF", "VEVOS", "VEVT(", "VEVT1", "VEVTF",
+    "VEVTN", "VEVTS", "VEVTV", "VEVUE", "VF()1", "VF()F", "VF()K", "VF()N",
+    "VF()O", "VF()S", "VF()U", "VF()V", "VF(1)", "VF(1N", "VF(1O", "VF(E(",
+    "VF(E1", "VF(EF", "VF(EK", "VF(EN", "VF(ES", "VF(EV", "VF(F(", "VF(N)",
+    "VF(N,", "VF(NO", "VF(S)", "VF(SO", "VF(V)", "VF(VO", "VK(1)", "VK(1O",
+    "VK(F(", "VK(N)", "VK(NO", "VK(S)", "VK(SO", "VK(V)", "VK(VO", "VK)&(",
+    "VK)&1", "VK)&F", "VK)&N", "VK)&S", "VK)&V", "VK);E", "VK);T", "VK)B(",
+    "VK)B1", "VK)BF", "VK)BN", "VK)BS", "VK)BV", "VK)E(", "VK)E1", "VK)EF",
+    "VK)EK", "VK)EN", "VK)ES", "VK)EV", "VK)F(", "VK)O(", "VK)OF", "VK)UE",
+    "VK1", "VK1&(", "VK1&1", "VK1&F", "VK1&N", "VK1&S", "VK1&V", "VK1;",
+    "VK1;C", "VK1;E", "VK1;T", "VK1B(", "VK1B1", "VK1BF", "VK1BN", "VK1BS",
+    "VK1BV", "VK1C", "VK1E(", "VK1E1", "VK1EF", "VK1EK", "VK1EN", "VK1ES",
+    "VK1EV", "VK1O(", "VK1OF", "VK1OS", "VK1OV", "VK1U(", "VK1UE", "VKF()",
+    "VKF(1", "VKF(F", "VKF(N", "VKF(S", "VKF(V", "VKN", "VKN&(", "VKN&1",
+    "VKN&F", "VKN&N", "VKN&S", "VKN&V", "VKN;", "VKN;C", "VKN;E", "VKN;T",
+    "VKNB(", "VKNB1", "VKNBF", "VKNBN", "VKNBS", "VKNBV", "VKNC", "VKNE(",
+    "VKNE1", "VKNEF", "VKNEN", "VKNES", "VKNEV", "VKNU(", "VKNUE", "VKS",
+    "VKS&(", "VKS&1", "VKS&F", "VKS&N", "VKS&S", "VKS&V", "VKS;", "VKS;C",
+    "VKS;E", "VKS;T", "VKSB(", "VKSB1", "VKSBF", "VKSBN", "VKSBS", "VKSBV",
+    "VKSC", "VKSE(", "VKSE1", "VKSEF", "VKSEK", "VKSEN", "VKSES", "VKSEV",
+    "VKSO(", "VKSO1", "VKSOF", "VKSON", "VKSOS", "VKSOV", "VKSU(", "VKSUE",
+    "VKUE(", "VKUE1", "VKUEF", "VKUEK", "VKUEN", "VKUES", "VKUEV", "VKV",
+    "VKV&(", "VKV&1", "VKV&F", "VKV&N", "VKV&S", "VKV&V", "VKV;", "VKV;C",
+    "VKV;E", "VKV;T", "VKVB(", "VKVB1", "VKVBF", "VKVBN", "VKVBS", "VKVBV",
+    "VKVC", "VKVE(", "VKVE1", "VKVEF", "VKVEK", "VKVEN", "VKVES", "VKVEV",
+    "VKVO(", "VKVOF", "VKVOS", "VKVU(", "VKVUE", "VO(1&", "VO(1)", "VO(1,",
+    "VO(1O", "VO(E(", "VO(E1", "VO(EE", "VO(EF", "VO(EK", "VO(EN", "VO(EO",
+    "VO(ES", "VO(EV", "VO(F(", "VO(N&", "VO(N)", "VO(N,", "VO(NO", "VO(S&",
+    "VO(S)", "VO(S,", "VO(SO", "VO(V&", "VO(V)", "VO(V,", "VO(VO", "VOF()",
+    "VOF(1", "VOF(E", "VOF(F", "VOF(N", "VOF(S", "VOF(V", "VOK&(", "VOK&1",
+    "VOK&F", "VOK&N", "VOK&S", "VOK&V", "VOK(1", "VOK(F", "VOK(N", "VOK(S",
+    "VOK(V", "VOK1C", "VOK1O", "VOKF(", "VOKNC", "VOKO(", "VOKO1", "VOKOF",
+    "VOKON", "VOKOS", "VOKOV", "VOKSC", "VOKSO", "VOKVC", "VOKVO", "VOS",
+    "VOS&(", "VOS&1", "VOS&E", "VOS&F", "VOS&K", "VOS&N", "VOS&S", "VOS&U",
+    "VOS&V", "VOS(E", "VOS(U", "VOS)&", "VOS),", "VOS);", "VOS)B", "VOS)C",
+    "VOS)E", "VOS)F", "VOS)K", "VOS)O", "VOS)U", "VOS,(", "VOS,F", "VOS1(",
+    "VOS1F", "VOS1N", "VOS1S", "VOS1U", "VOS1V", "VOS;", "VOS;C", "VOS;E",
+    "VOS;N", "VOS;T", "VOSA(", "VOSAF", "VOSAS", "VOSAT", "VOSAV", "VOSB(",
+    "VOSB1", "VOSBE", "VOSBF", "VOSBN", "VOSBS", "VOSBV", "VOSC", "VOSE(",
+    "VOSE1", "VOSEF", "VOSEK", "VOSEN", "VOSEO", "VOSES", "VOSEU", "VOSEV",
+    "VOSF(", "VOSK(", "VOSK)", "VOSK1", "VOSKB", "VOSKF", "VOSKN", "VOSKS",
+    "VOSKU", "VOSKV", "VOST(", "VOST1", "VOSTE", "VOSTF", "VOSTN", "VOSTS",
+    "VOSTT", "VOSTV", "VOSU", "VOSU(", "VOSU1", "VOSU;", "VOSUC", "VOSUE",
+    "VOSUF", "VOSUK", "VOSUO", "VOSUS", "VOSUT", "VOSUV", "VOSV(", "VOSVF",
+    "VOSVO", "VOSVS", "VOSVU", "VOU(E", "VOUEK", "VOUEN", "VT(1)", "VT(1O",
+    "VT(F(", "VT(N)", "VT(NO", "VT(S)", "VT(SO", "VT(V)", "VT(VO", "VT1(F",
+    "VT1O(", "VT1OF", "VT1OS", "VT1OV", "VTE(1", "VTE(F", "VTE(N", "VTE(S",
+    "VTE(V", "VTE1N", "VTE1O", "VTEF(", "VTEK(", "VTEK1", "VTEKF", "VTEKN",
+    "VTEKS", "VTEKV", "VTENN", "VTENO", "VTESN", "VTESO", "VTEVN", "VTEVO",
+    "VTF()", "VTF(1", "VTF(F", "VTF(N", "VTF(S", "VTF(V", "VTN(1", "VTN(F",
+    "VTN(S", "VTN(V", "VTN1C", "VTN1O", "VTN;E", "VTN;N", "VTN;T", "VTNE(",
+    "VTNE1", "VTNEF", "VTNEN", "VTNES", "VTNEV", "VTNF(", "VTNKN", "VTNN:",
+    "VTNNC", "VTNNO", "VTNO(", "VTNOF", "VTNOS", "VTNOV", "VTNSC", "VTNSO",
+    "VTNT(", "VTNT1", "VTNTF", "VTNTN", "VTNTS", "VTNTV", "VTNVC", "VTNVO",
+    "VTS(F", "VTSO(", "VTSO1", "VTSOF", "VTSON", "VTSOS", "VTSOV", "VTTNE",
+    "VTTNK", "VTTNN", "VTTNT", "VTV(1", "VTV(F", "VTVO(", "VTVOF", "VTVOS",
+    "VU", "VU(1)", "VU(1O", "VU(E(", "VU(E1", "VU(EF", "VU(EK", "VU(EN",
+    "VU(ES", "VU(EV", "VU(F(", "VU(N)", "VU(NO", "VU(S)", "VU(SO", "VU(V)",
+    "VU(VO", "VU1,(", "VU1,F", "VU1C", "VU1O(", "VU1OF", "VU1OS", "VU1OV",
+    "VU;", "VU;C", "VUC", "VUE", "VUE(1", "VUE(E", "VUE(F", "VUE(N", "VUE(O",
+    "VUE(S", "VUE(V", "VUE1", "VUE1&", "VUE1(", "VUE1)", "VUE1,", "VUE1;",
+    "VUE1B", "VUE1C", "VUE1F", "VUE1K", "VUE1N", "VUE1O", "VUE1S", "VUE1U",
+    "VUE1V", "VUE;", "VUE;C", "VUEC", "VUEF", "VUEF(", "VUEF,", "VUEF;",
+    "VUEFC", "VUEK", "VUEK(", "VUEK1", "VUEK;", "VUEKC", "VUEKF", "VUEKN",
+    "VUEKO", "VUEKS", "VUEKV", "VUEN", "VUEN&", "VUEN(", "VUEN)", "VUEN,",
+    "VUEN1", "VUEN;", "VUENB", "VUENC", "VUENF", "VUENK", "VUENO", "VUENS",
+    "VUENU", "VUEOK", "VUEON", "VUES", "VUES&", "VUES(", "VUES)", "VUES,",
+    "VUES1", "VUES;", "VUESB", "VUESC", "VUESF", "VUESK", "VUESO", "VUESU",
+    "VUESV", "VUEV", "VUEV&", "VUEV(", "VUEV)", "VUEV,", "VUEV;", "VUEVB",
+    "VUEVC", "VUEVF", "VUEVK", "VUEVN", "VUEVO", "VUEVS", "VUEVU", "VUF()",
+    "VUF(1", "VUF(F", "VUF(N", "VUF(S", "VUF(V", "VUK(E", "VUO(E", "VUON(",
+    "VUON1", "VUONF", "VUONS", "VUS,(", "VUS,F", "VUSC", "VUSO(", "VUSO1",
+    "VUSOF", "VUSON", "VUSOS", "VUSOV", "VUTN(", "VUTN1", "VUTNF", "VUTNN",
+    "VUTNS", "VUTNV", "VUV,(", "VUV,F", "VUVC", "VUVO(", "VUVOF", "VUVOS", "X",
+};
+static const size_t sql_fingerprint_list_sz = 8367;
+#endif
+
+typedef enum {
+    FOLD_GUARD_NONE,
+    FOLD_GUARD_UNARY_OP,
+    FOLD_GUARD_ARITHMETIC_OP,
+    FOLD_GUARD_MERGE_WORDS,
+    FOLD_GUARD_WORD_IF,
+    FOLD_GUARD_WORD_FUNCTION,
+    FOLD_GUARD_WORD_IN,
+    FOLD_GUARD_WORD_LIKE,
+    FOLD_GUARD_WORD_USER,
+    FOLD_GUARD_HAS_UNDERSCORE,
+    FOLD_GUARD_IS_EMPTY,
+    FOLD_GUARD_IS_CAST,
+} fold_guard_t;
+
+typedef enum { FOLD_LEFT_KEEP, FOLD_LEFT_ZERO, FOLD_LEFT_BACK } fold_left_t;
+
+typedef enum {
+    FOLD_NEXT_RESTART,
+    FOLD_NEXT_STOP,
+    FOLD_NEXT_EVIL
+} fold_next_t;
+
+typedef struct {
+    unsigned int third; /* classes matching tokenvec[left + 2] */
+    unsigned char guard;
+    unsigned char set_at; /* tokenvec[left + set_at].type = set_type */
+    char set_type;
+    unsigned char copy_to; /* tokenvec[left + copy_to] = [left + copy_from] */
+    unsigned char copy_from;
+    unsigned char pos;
+    unsigned char folds;
+    unsigned char left;
+    unsigned char next;
+} fold_rule_t;
+
+#define SQL_FOLD_TYPES 23
+static const unsigned char sql_fold_type[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 6, 17, 0, 0, 20, 0, 22, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 15, 21, 0, 0, 11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 9, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 7, 0, 0, 8, 3, 0, 0, 0, 1, 5, 0, 13, 0, 0, 0, 0,
+    18, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const fold_rule_t sql_fold_rules[] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    /* s s */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* ; ; */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* o& o */
+    {0x00000000U, FOLD_GUARD_UNARY_OP, 0, 0, 0, 0, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* o& t */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* ( o */
+    {0x00000000U, FOLD_GUARD_UNARY_OP, 0, 0, 0, 0, 1, 1, FOLD_LEFT_BACK,
+     FOLD_NEXT_RESTART},
+    /* knoUfETt knoUfETt& */
+    {0x00000000U, FOLD_GUARD_MERGE_WORDS, 0, 0, 0, 0, 1, 1, FOLD_LEFT_BACK,
+     FOLD_NEXT_RESTART},
+    /* ; f */
+    {0x00000000U, FOLD_GUARD_WORD_IF, 1, 'T', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* nv ( */
+    {0x00000000U, FOLD_GUARD_WORD_FUNCTION, 0, 'f', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* k ( */
+    {0x00000000U, FOLD_GUARD_WORD_IN, 0, 'o', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* k * */
+    {0x00000000U, FOLD_GUARD_WORD_IN, 0, 'n', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_RESTART},
+    /* o ( */
+    {0x00000000U, FOLD_GUARD_WORD_LIKE, 0, 'f', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_STOP},
+    /* o * */
+    {0x00000000U, FOLD_GUARD_WORD_LIKE, 0, 0, 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_STOP},
+    /* t n1t(fvs */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 1, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* A n */
+    {0x00000000U, FOLD_GUARD_HAS_UNDERSCORE, 1, 't', 0, 0, 0, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_STOP},
+    /* A n */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_STOP},
+    /* \ o */
+    {0x00000000U, FOLD_GUARD_ARITHMETIC_OP, 0, '1', 0, 0, 0, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* \ * */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 1, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* ( ( */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* ) ) */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* { n */
+    {0x00000000U, FOLD_GUARD_IS_EMPTY, 1, 'X', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_EVIL},
+    /* { n */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 2, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* * } */
+    {0x00000000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 1, 1, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* 1 o 1 */
+    {0x00004000U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* o !( o */
+    {0x00000008U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* & * & */
+    {0x00000010U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* v o v1n */
+    {0x00006100U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* n1 o 1n */
+    {0x00004100U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* n1vs o t */
+    {0x00000020U, FOLD_GUARD_IS_CAST, 0, 0, 0, 0, 2, 2, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* n1sv , 1nsv */
+    {0x00006102U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* EB, o ( */
+    {0x00000040U, FOLD_GUARD_UNARY_OP, 0, 0, 1, 2, 1, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* kEB o 1nvsf */
+    {0x00006502U, FOLD_GUARD_UNARY_OP, 0, 0, 1, 2, 1, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* , o 1nvs */
+    {0x00006102U, FOLD_GUARD_UNARY_OP, 0, 0, 1, 2, 3, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* , o f */
+    {0x00000400U, FOLD_GUARD_UNARY_OP, 0, 0, 1, 2, 1, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* n . n */
+    {0x00000100U, FOLD_GUARD_NONE, 0, 0, 0, 0, 2, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* E . n */
+    {0x00000100U, FOLD_GUARD_NONE, 0, 0, 1, 2, 1, 0, FOLD_LEFT_ZERO,
+     FOLD_NEXT_RESTART},
+    /* f ( !) */
+    {0x007DFFFFU, FOLD_GUARD_WORD_USER, 0, 'n', 0, 0, 0, 0, FOLD_LEFT_KEEP,
+     FOLD_NEXT_STOP},
+};
+
+static const unsigned char sql_fold_two[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 9, 9, 9, 11, 15,
+    18, 22, 15, 15, 15, 15, 15, 15, 9, 9, 9, 9, 9, 9, 25, 9, 9, 9, 0, 0, 0, 28,
+    0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 32, 0, 34, 34,
+    36, 32, 34, 36, 34, 36, 34, 34, 32, 32, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 39,
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 43, 43, 43, 45,
+    45, 45, 48, 45, 45, 45, 45, 45, 45, 43, 43, 43, 43, 43, 43, 51, 43, 43, 43,
+    0, 0, 0, 34, 34, 34, 54, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 59,
+    59, 59, 61, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 64,
+    59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+static const unsigned char sql_fold_three[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 76, 76, 76, 76,
+    76, 0, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 85, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned char sql_fold_cands[] = {
+    0, 22, 0, 1, 0, 2, 0, 7, 0, 12, 0, 3, 6, 12, 0, 6, 12, 0, 4, 6, 12, 0, 11,
+    12, 0, 12, 22, 0, 3, 0, 4, 0, 13, 0, 6, 0, 6, 13, 0, 5, 0, 18, 0, 10, 0, 6,
+    10, 0, 9, 10, 0, 10, 22, 0, 8, 0, 14, 15, 0, 17, 0, 16, 17, 0, 17, 22, 0,
+    19, 0, 20, 21, 0, 28, 0, 29, 0, 24, 0, 25, 0, 31, 0, 27, 28, 0, 34, 0, 36,
+    0, 30, 31, 0, 35, 0, 26, 28, 0, 23, 27, 28, 0, 30, 32, 33, 0,
 };
-static const size_t sql_keywords_sz = 9352;
 #endif
@@ -2,8 +2,10 @@
 #include "libinjection_xss.h"
 #include "libinjection.h"
 #include "libinjection_html5.h"
+#include "libinjection_shape_stats.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #define IS_HEX_ENTITY_PREFIX(src) (*(src + 2) == 'x' || *(src + 2) == 'X')
 
@@ -20,14 +22,15 @@ static int is_black_tag(const char *s, size_t len);
 static int is_black_url(const char *s, size_t len);
 static int cstrcasecmp_with_null(const char *a, const char *b, size_t n);
 static int html_decode_char_at(const char *src, size_t len, size_t *consumed);
-static int htmlencode_startswith(const char *a /* prefix */,
-                                 const char *b /* src */, size_t n);
 
 typedef struct stringtype {
     const char *name;
     attribute_t atype;
 } stringtype_t;
 
+/* tag, attribute and event names, generated from xss_words.txt */
+#include "libinjection_xss_data.h"
+
 static const int gsHexDecodeMap[256] = {
     256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
     256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
@@ -157,709 +160,6 @@ static int html_decode_char_at(const char *src, size_t len, size_t *consumed) {
     }
 }
 
-/*
- * These were extracted from multiple browser sources:
- * - WebKit:
- * https://github.com/WebKit/WebKit/blob/main/Source/WebCore/dom/EventNames.json
- * - Chromium/Blink:
- * https://chromium.googlesource.com/chromium/src/+/main/third_party/blink/renderer/core/dom/global_event_handlers.idl
- * - Firefox/Gecko:
- * https://github.com/mozilla-firefox/firefox/blob/main/dom/events/EventNameList.h
- * - W3C/WHATWG specifications where applicable
- *
- * view-source:
- * data:
- * javascript:
- * events:
- */
-static stringtype_t BLACKATTREVENT[] = {
-    {"ABORT", TYPE_BLACK},
-    {"ACCESSKEYNOTFOUND",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"ACTIVATE", TYPE_BLACK},
-    {"ACTIVE", TYPE_BLACK},
-    {"ADDSOURCEBUFFER", TYPE_BLACK},
-    {"ADDSTREAM", TYPE_BLACK},
-    {"ADDTRACK", TYPE_BLACK},
-    {"AFTERPAINT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"AFTERPRINT", TYPE_BLACK},
-    {"AFTERSCRIPTEXECUTE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"ANIMATIONCANCEL", TYPE_BLACK},
-    {"ANIMATIONEND", TYPE_BLACK},
-    {"ANIMATIONITERATION", TYPE_BLACK},
-    {"ANIMATIONSTART", TYPE_BLACK},
-    {"AUDIOEND", TYPE_BLACK},
-    {"AUDIOCOMPLETE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"AUDIOPROCESS", TYPE_BLACK},
-    {"AUDIOSTART", TYPE_BLACK},
-    {"AUTOCOMPLETE", TYPE_BLACK},
-    {"AUTOCOMPLETEERROR", TYPE_BLACK},
-    {"AUXCLICK", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl,
-                                 WebKit: EventNames.json */
-    {"BACKGROUNDFETCHABORT", TYPE_BLACK},
-    {"BACKGROUNDFETCHCLICK", TYPE_BLACK},
-    {"BACKGROUNDFETCHFAIL", TYPE_BLACK},
-    {"BACKGROUNDFETCHSUCCESS", TYPE_BLACK},
-    {"BEFOREACTIVATE", TYPE_BLACK},
-    {"BEFORECOPY", TYPE_BLACK},
-    {"BEFORECUT", TYPE_BLACK},
-    {"BEFOREINPUT", TYPE_BLACK},
-    {"BEFORELOAD", TYPE_BLACK},
-    {"BEFOREMATCH",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, WebKit:
-                     EventNames.json, Firefox: EventNameList.h */
-    {"BEFOREPASTE", TYPE_BLACK},
-    {"BEFOREPRINT", TYPE_BLACK},
-    {"BEFORESCRIPTEXECUTE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"BEFORETOGGLE", TYPE_BLACK},
-    {"BEFOREUNLOAD", TYPE_BLACK},
-    {"BEGINEVENT", TYPE_BLACK},
-    {"BLOCKED", TYPE_BLACK},
-    {"BLUR", TYPE_BLACK},
-    {"BOUNDARY", TYPE_BLACK},
-    {"BUFFEREDAMOUNTLOW", TYPE_BLACK},
-    {"BUFFEREDCHANGE", TYPE_BLACK},
-    {"CACHED", TYPE_BLACK},
-    {"CANCEL", TYPE_BLACK},
-    {"CANPLAY", TYPE_BLACK},
-    {"CANPLAYTHROUGH", TYPE_BLACK},
-    {"CHANGE", TYPE_BLACK},
-    {"CHARGINGCHANGE", TYPE_BLACK},
-    {"CHARGINGTIMECHANGE", TYPE_BLACK},
-    {"CHECKING", TYPE_BLACK},
-    {"CLICK", TYPE_BLACK},
-    {"CLOSE", TYPE_BLACK},
-    {"CLOSING", TYPE_BLACK},
-    {"COMPLETE", TYPE_BLACK},
-    {"COMPOSITIONEND", TYPE_BLACK},
-    {"COMPOSITIONSTART", TYPE_BLACK},
-    {"COMPOSITIONCHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"COMPOSITIONUPDATE", TYPE_BLACK},
-    {"COMMAND", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, WebKit:
-                                EventNames.json, Firefox: EventNameList.h */
-    {"CONFIGURATIONCHANGE", TYPE_BLACK},
-    {"CONNECT", TYPE_BLACK},
-    {"CONNECTING", TYPE_BLACK},
-    {"CONNECTIONSTATECHANGE", TYPE_BLACK},
-    {"CONTENTVISIBILITYAUTOSTATECHANGE", TYPE_BLACK},
-    {"CONTEXTLOST",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, WebKit:
-                     EventNames.json, Firefox: EventNameList.h */
-    {"CONTEXTMENU", TYPE_BLACK},
-    {"CONTEXTRESTORED",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, WebKit:
-                     EventNames.json, Firefox: EventNameList.h */
-    {"CONTROLLERCHANGE", TYPE_BLACK},
-    {"COOKIECHANGE", TYPE_BLACK},
-    {"COORDINATORSTATECHANGE", TYPE_BLACK},
-    {"COPY", TYPE_BLACK},
-    {"COUPONCODECHANGED", TYPE_BLACK},
-    {"CUECHANGE", TYPE_BLACK},
-    {"CURRENTENTRYCHANGE", TYPE_BLACK},
-    {"CUT", TYPE_BLACK},
-    {"DATAAVAILABLE", TYPE_BLACK},
-    {"DATACHANNEL", TYPE_BLACK},
-    {"DBLCLICK", TYPE_BLACK},
-    {"DEQUEUE", TYPE_BLACK},
-    {"DEVICECHANGE", TYPE_BLACK},
-    {"DEVICELIGHT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"DEVICEMOTION", TYPE_BLACK},
-    {"DEVICEORIENTATION", TYPE_BLACK},
-    {"DEVICEORIENTATIONABSOLUTE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"DISCHARGINGTIMECHANGE", TYPE_BLACK},
-    {"DISCONNECT", TYPE_BLACK},
-    {"DISPOSE", TYPE_BLACK},
-    {"DOMACTIVATE", TYPE_BLACK},
-    {"DOMCHARACTERDATAMODIFIED", TYPE_BLACK},
-    {"DOMCONTENTLOADED", TYPE_BLACK},
-    {"DOMNODEINSERTED", TYPE_BLACK},
-    {"DOMNODEINSERTEDINTODOCUMENT", TYPE_BLACK},
-    {"DOMNODEREMOVED", TYPE_BLACK},
-    {"DOMNODEREMOVEDFROMDOCUMENT", TYPE_BLACK},
-    {"DOMSUBTREEMODIFIED", TYPE_BLACK},
-    {"DOWNLOADING", TYPE_BLACK},
-    {"DRAG", TYPE_BLACK},
-    {"DRAGEND", TYPE_BLACK},
-    {"DRAGENTER", TYPE_BLACK},
-    {"DRAGLEAVE", TYPE_BLACK},
-    {"DRAGEXIT", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl,
-                                 Firefox: EventNameList.h */
-    {"DRAGOVER", TYPE_BLACK},
-    {"DRAGSTART", TYPE_BLACK},
-    {"DROP", TYPE_BLACK},
-    {"DURATIONCHANGE", TYPE_BLACK},
-    {"EMPTIED", TYPE_BLACK},
-    {"ENCRYPTED", TYPE_BLACK},
-    {"EDGEUICANCELED",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"EDGEUICOMPLETED",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"EDGEUISTARTED",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"EDITORBEFOREINPUT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"EDITORINPUT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"END", TYPE_BLACK},
-    {"ENDED", TYPE_BLACK},
-    {"ENDEVENT", TYPE_BLACK},
-    {"ENDSTREAMING", TYPE_BLACK},
-    {"ENTER", TYPE_BLACK},
-    {"ENTERPICTUREINPICTURE", TYPE_BLACK},
-    {"ERROR", TYPE_BLACK},
-    {"EXIT", TYPE_BLACK},
-    {"FENCEDTREECLICK",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl */
-    {"FETCH", TYPE_BLACK},
-    {"FINISH", TYPE_BLACK},
-    {"FOCUS", TYPE_BLACK},
-    {"FOCUSIN", TYPE_BLACK},
-    {"FOCUSOUT", TYPE_BLACK},
-    {"FORMCHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMCHECKBOXSTATECHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMDATA", TYPE_BLACK},
-    {"FORMINVALID",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMRADIOSTATECHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMRESET",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMSELECT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FORMSUBMIT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"FULLSCREENCHANGE", TYPE_BLACK},
-    {"FULLSCREENERROR", TYPE_BLACK},
-    {"GAMEPADAXISMOVE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"GAMEPADBUTTONDOWN",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"GAMEPADBUTTONUP",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"GAMEPADCONNECTED", TYPE_BLACK},
-    {"GAMEPADDISCONNECTED", TYPE_BLACK},
-    {"GATHERINGSTATECHANGE", TYPE_BLACK},
-    {"GESTURECHANGE", TYPE_BLACK},
-    {"GESTUREEND", TYPE_BLACK},
-    {"GESTURESCROLLEND", TYPE_BLACK},
-    {"GESTURESCROLLSTART", TYPE_BLACK},
-    {"GESTURESCROLLUPDATE", TYPE_BLACK},
-    {"GESTURESTART", TYPE_BLACK},
-    {"GESTURETAP", TYPE_BLACK},
-    {"GESTURETAPDOWN", TYPE_BLACK},
-    {"GOTPOINTERCAPTURE", TYPE_BLACK},
-    {"HASHCHANGE", TYPE_BLACK},
-    {"ICECANDIDATE", TYPE_BLACK},
-    {"ICECANDIDATEERROR", TYPE_BLACK},
-    {"ICECONNECTIONSTATECHANGE", TYPE_BLACK},
-    {"ICEGATHERINGSTATECHANGE", TYPE_BLACK},
-    {"IMAGEABORT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"INACTIVE", TYPE_BLACK},
-    {"INPUT", TYPE_BLACK},
-    {"INPUTSOURCESCHANGE", TYPE_BLACK},
-    {"INSTALL", TYPE_BLACK},
-    {"INVALID", TYPE_BLACK},
-    {"INVOKE", TYPE_BLACK},
-    {"KEYDOWN", TYPE_BLACK},
-    {"KEYPRESS", TYPE_BLACK},
-    {"KEYSTATUSESCHANGE", TYPE_BLACK},
-    {"KEYUP", TYPE_BLACK},
-    {"LANGUAGECHANGE", TYPE_BLACK},
-    {"LEAVEPICTUREINPICTURE", TYPE_BLACK},
-    {"LEGACYATTRMODIFIED",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYCHARACTERDATAMODIFIED",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYDOMACTIVATE",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYDOMFOCUSIN",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYDOMFOCUSOUT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYMOUSELINEORPAGESCROLL",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYMOUSEPIXELSCROLL",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYNODEINSERTED",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYNODEINSERTEDINTODOCUMENT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYNODEREMOVED",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYNODEREMOVEDFROMDOCUMENT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYSUBTREEMODIFIED",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEGACYTEXTINPUT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"LEVELCHANGE", TYPE_BLACK},
-    {"LOAD", TYPE_BLACK},
-    {"LOADEDDATA", TYPE_BLACK},
-    {"LOADEDMETADATA", TYPE_BLACK},
-    {"LOADEND", TYPE_BLACK},
-    {"LOADING", TYPE_BLACK},
-    {"LOADINGDONE", TYPE_BLACK},
-    {"LOADINGERROR", TYPE_BLACK},
-    {"LOADSTART", TYPE_BLACK},
-    {"LOSTPOINTERCAPTURE", TYPE_BLACK},
-    {"MAGNIFYGESTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MAGNIFYGESTURESTART",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MAGNIFYGESTUREUPDATE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MARK", TYPE_BLACK},
-    {"MEDIARECORDERDATAAVAILABLE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MEDIARECORDERSTOP",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MEDIARECORDERWARNING",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MERCHANTVALIDATION", TYPE_BLACK},
-    {"MESSAGE", TYPE_BLACK},
-    {"MESSAGEERROR", TYPE_BLACK},
-    {"MOUSEDOUBLECLICK",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOUSEDOWN", TYPE_BLACK},
-    {"MOUSEENTER", TYPE_BLACK},
-    {"MOUSEEXPLOREBYTOUCH",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOUSEHITTEST",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOUSELEAVE", TYPE_BLACK},
-    {"MOUSELONGTAP",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOUSEMOVE", TYPE_BLACK},
-    {"MOUSEOUT", TYPE_BLACK},
-    {"MOUSEOVER", TYPE_BLACK},
-    {"MOUSEUP", TYPE_BLACK},
-    {"MOUSEWHEEL", TYPE_BLACK},
-    {"MOZFULLSCREENCHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOZFULLSCREENERROR",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOZPOINTERLOCKCHANGE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOZPOINTERLOCKERROR",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOZVISUALRESIZE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MOZVISUALSCROLL",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"MUTE", TYPE_BLACK},
-    {"NAVIGATE", TYPE_BLACK},
-    {"NAVIGATEERROR", TYPE_BLACK},
-    {"NAVIGATESUCCESS", TYPE_BLACK},
-    {"NEGOTIATIONNEEDED", TYPE_BLACK},
-    {"NEXTTRACK", TYPE_BLACK},
-    {"NOMATCH", TYPE_BLACK},
-    {"NOTIFICATIONCLICK", TYPE_BLACK},
-    {"NOTIFICATIONCLOSE", TYPE_BLACK},
-    {"NOUPDATE", TYPE_BLACK},
-    {"OBSOLETE", TYPE_BLACK},
-    {"OFFLINE", TYPE_BLACK},
-    {"ONLINE", TYPE_BLACK},
-    {"OPEN", TYPE_BLACK},
-    {"ORIENTATIONCHANGE", TYPE_BLACK},
-    {"OVERFLOWCHANGED", TYPE_BLACK},
-    {"OVERSCROLL", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl */
-    {"PAGEHIDE", TYPE_BLACK},
-    {"PAGEREVEAL", TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"PAGESHOW", TYPE_BLACK},
-    {"PAGESWAP", TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"PASTE", TYPE_BLACK},
-    {"PAUSE", TYPE_BLACK},
-    {"PAYERDETAILCHANGE", TYPE_BLACK},
-    {"PAYMENTAUTHORIZED", TYPE_BLACK},
-    {"PAYMENTMETHODCHANGE", TYPE_BLACK},
-    {"PAYMENTMETHODSELECTED", TYPE_BLACK},
-    {"PLAY", TYPE_BLACK},
-    {"PLAYING", TYPE_BLACK},
-    {"POINTERAUXCLICK",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"POINTERCANCEL", TYPE_BLACK},
-    {"POINTERCLICK",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"POINTERDOWN", TYPE_BLACK},
-    {"POINTERENTER", TYPE_BLACK},
-    {"POINTERGOTCAPTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"POINTERLEAVE", TYPE_BLACK},
-    {"POINTERLOCKCHANGE", TYPE_BLACK},
-    {"POINTERLOCKERROR", TYPE_BLACK},
-    {"POINTERLOSTCAPTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"POINTERMOVE", TYPE_BLACK},
-    {"POINTEROUT", TYPE_BLACK},
-    {"POINTEROVER", TYPE_BLACK},
-    {"POINTERRAWUPDATE",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, Firefox:
-                     EventNameList.h */
-    {"POINTERUP", TYPE_BLACK},
-    {"POPSTATE", TYPE_BLACK},
-    {"PRESSTAPGESTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"PREVIOUSTRACK", TYPE_BLACK},
-    {"PROPERTYCHANGE", TYPE_BLACK},
-    {"PROCESSORERROR", TYPE_BLACK},
-    {"PROGRESS", TYPE_BLACK},
-    {"PUSH", TYPE_BLACK},
-    {"PUSHNOTIFICATION", TYPE_BLACK},
-    {"PUSHSUBSCRIPTIONCHANGE", TYPE_BLACK},
-    {"QUALITYCHANGE", TYPE_BLACK},
-    {"RATECHANGE", TYPE_BLACK},
-    {"READYSTATECHANGE", TYPE_BLACK},
-    {"REDRAW", TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"REJECTIONHANDLED", TYPE_BLACK},
-    {"RELEASE", TYPE_BLACK},
-    {"REMOVE", TYPE_BLACK},
-    {"REMOVESOURCEBUFFER", TYPE_BLACK},
-    {"REMOVESTREAM", TYPE_BLACK},
-    {"REMOVETRACK", TYPE_BLACK},
-    {"REPEAT", TYPE_BLACK},      /* WebKit: EventNames.json - SVG animation */
-    {"REPEATEVENT", TYPE_BLACK}, /* WebKit: EventNames.json, Firefox:
-                                    EventNameList.h - SVG animation */
-    {"RESET", TYPE_BLACK},
-    {"RESIZE", TYPE_BLACK},
-    {"RESOURCETIMINGBUFFERFULL", TYPE_BLACK},
-    {"RESULT", TYPE_BLACK},
-    {"RESUME", TYPE_BLACK},
-    {"ROTATEGESTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"ROTATEGESTURESTART",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"ROTATEGESTUREUPDATE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"RTCTRANSFORM", TYPE_BLACK},
-    {"SCROLL", TYPE_BLACK},
-    {"SCROLLEDAREACHANGED",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SCROLLEND",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl, WebKit:
-                     EventNames.json, Firefox: EventNameList.h */
-    {"SCROLLPORTOVERFLOW",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"SCROLLPORTUNDERFLOW",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"SCROLLSNAPCHANGE", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl
-                                         - CSS Scroll Snap */
-    {"SCROLLSNAPCHANGING",
-     TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl - CSS Scroll Snap
-                   */
-    {"SEARCH", TYPE_BLACK},
-    {"SECURITYPOLICYVIOLATION", TYPE_BLACK},
-    {"SEEKED", TYPE_BLACK},
-    {"SEEKING", TYPE_BLACK},
-    {"SELECT", TYPE_BLACK},
-    {"SELECTEDCANDIDATEPAIRCHANGE", TYPE_BLACK},
-    {"SELECTEND", TYPE_BLACK},
-    {"SELECTIONCHANGE", TYPE_BLACK},
-    {"SELECTSTART", TYPE_BLACK},
-    {"SHIPPINGADDRESSCHANGE", TYPE_BLACK},
-    {"SHIPPINGCONTACTSELECTED", TYPE_BLACK},
-    {"SHIPPINGMETHODSELECTED", TYPE_BLACK},
-    {"SHIPPINGOPTIONCHANGE", TYPE_BLACK},
-    {"SHOW", TYPE_BLACK},
-    {"SIGNALINGSTATECHANGE", TYPE_BLACK},
-    {"SLOTCHANGE", TYPE_BLACK},
-    {"SMILBEGINEVENT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - SVG/SMIL */
-    {"SMILENDEVENT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - SVG/SMIL */
-    {"SMILREPEATEVENT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - SVG/SMIL */
-    {"SORT", TYPE_BLACK}, /* Chromium: Blink GlobalEventHandlers.idl */
-    {"SOUNDEND", TYPE_BLACK},
-    {"SOUNDSTART", TYPE_BLACK},
-    {"SOURCECLOSE", TYPE_BLACK},
-    {"SOURCEENDED", TYPE_BLACK},
-    {"SOURCEOPEN", TYPE_BLACK},
-    {"SPEECHEND", TYPE_BLACK},
-    {"SPEECHSTART", TYPE_BLACK},
-    {"SQUEEZE", TYPE_BLACK},
-    {"SQUEEZEEND", TYPE_BLACK},
-    {"SQUEEZESTART", TYPE_BLACK},
-    {"STALLED", TYPE_BLACK},
-    {"START", TYPE_BLACK},
-    {"STARTED", TYPE_BLACK},
-    {"STARTSTREAMING", TYPE_BLACK},
-    {"STATECHANGE", TYPE_BLACK},
-    {"STOP", TYPE_BLACK},
-    {"STORAGE", TYPE_BLACK},
-    {"SUBMIT", TYPE_BLACK},
-    {"SVGLOAD",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SVGSCROLL",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SWIPEGESTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SWIPEGESTUREEND",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SWIPEGESTUREMAYSTART",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SWIPEGESTURESTART",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SWIPEGESTUREUPDATE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"SUCCESS", TYPE_BLACK},
-    {"SUSPEND", TYPE_BLACK},
-    {"TAPGESTURE",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"TEXTINPUT", TYPE_BLACK},
-    {"TIMEOUT", TYPE_BLACK},
-    {"TIMEUPDATE", TYPE_BLACK},
-    {"TOGGLE", TYPE_BLACK},
-    {"TONECHANGE", TYPE_BLACK},
-    {"TOUCHCANCEL", TYPE_BLACK},
-    {"TOUCHEND", TYPE_BLACK},
-    {"TOUCHFORCECHANGE", TYPE_BLACK},
-    {"TOUCHMOVE", TYPE_BLACK},
-    {"TOUCHSTART", TYPE_BLACK},
-    {"TRACK", TYPE_BLACK},
-    {"TRANSITIONCANCEL", TYPE_BLACK},
-    {"TRANSITIONEND", TYPE_BLACK},
-    {"TRANSITIONRUN", TYPE_BLACK},
-    {"TRANSITIONSTART", TYPE_BLACK},
-    {"UNCAPTUREDERROR", TYPE_BLACK},
-    {"UNHANDLEDREJECTION", TYPE_BLACK},
-    {"UNIDENTIFIEDEVENT",
-     TYPE_BLACK}, /* Firefox: mozilla-firefox/firefox/dom/events/EventNameList.h
-                   */
-    {"UNLOAD", TYPE_BLACK},
-    {"UNMUTE", TYPE_BLACK},
-    {"USERPROXIMITY",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - deprecated
-                   */
-    {"UPDATE", TYPE_BLACK},
-    {"UPDATEEND", TYPE_BLACK},
-    {"UPDATEFOUND", TYPE_BLACK},
-    {"UPDATEREADY", TYPE_BLACK},
-    {"UPDATESTART", TYPE_BLACK},
-    {"UPGRADENEEDED", TYPE_BLACK},
-    {"VALIDATEMERCHANT", TYPE_BLACK},
-    {"VERSIONCHANGE", TYPE_BLACK},
-    {"VISIBILITYCHANGE", TYPE_BLACK},
-    {"VOICESCHANGED", TYPE_BLACK},
-    {"VOLUMECHANGE", TYPE_BLACK},
-    {"VRDISPLAYACTIVATE",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - WebVR
-                     deprecated */
-    {"VRDISPLAYCONNECT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - WebVR
-                     deprecated */
-    {"VRDISPLAYDEACTIVATE",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - WebVR
-                     deprecated */
-    {"VRDISPLAYDISCONNECT",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - WebVR
-                     deprecated */
-    {"VRDISPLAYPRESENTCHANGE",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - WebVR
-                     deprecated */
-    {"WAITING", TYPE_BLACK},
-    {"WAITINGFORKEY", TYPE_BLACK},
-    {"WEBGLCONTEXTCREATIONERROR", TYPE_BLACK},
-    {"WEBGLCONTEXTLOST", TYPE_BLACK},
-    {"WEBGLCONTEXTRESTORED", TYPE_BLACK},
-    {"WEBKITANIMATIONEND", TYPE_BLACK},
-    {"WEBKITANIMATIONITERATION", TYPE_BLACK},
-    {"WEBKITANIMATIONSTART", TYPE_BLACK},
-    {"WEBKITASSOCIATEFORMCONTROLS", TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"WEBKITAUTOFILLREQUEST", TYPE_BLACK},       /* WebKit: EventNames.json */
-    {"WEBKITBEFORETEXTINSERTED", TYPE_BLACK},
-    {"WEBKITBEGINFULLSCREEN", TYPE_BLACK},
-    {"WEBKITCURRENTPLAYBACKTARGETISWIRELESSCHANGED", TYPE_BLACK},
-    {"WEBKITENDFULLSCREEN", TYPE_BLACK},
-    {"WEBKITFULLSCREENCHANGE", TYPE_BLACK},
-    {"WEBKITFULLSCREENERROR", TYPE_BLACK},
-    {"WEBKITKEYADDED", TYPE_BLACK},
-    {"WEBKITKEYERROR", TYPE_BLACK},
-    {"WEBKITKEYMESSAGE", TYPE_BLACK},
-    {"WEBKITMEDIASESSIONMETADATACHANGED",
-     TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"WEBKITMOUSEFORCECHANGED", TYPE_BLACK},
-    {"WEBKITMOUSEFORCEDOWN", TYPE_BLACK},
-    {"WEBKITMOUSEFORCEUP", TYPE_BLACK},
-    {"WEBKITMOUSEFORCEWILLBEGIN", TYPE_BLACK},
-    {"WEBKITNEEDKEY", TYPE_BLACK},
-    {"WEBKITNETWORKINFOCHANGE", TYPE_BLACK},
-    {"WEBKITPLAYBACKTARGETAVAILABILITYCHANGED", TYPE_BLACK},
-    {"WEBKITPRESENTATIONMODECHANGED", TYPE_BLACK},
-    {"WEBKITREMOVESOURCEBUFFER", TYPE_BLACK},
-    {"WEBKITSHADOWROOTATTACHED", TYPE_BLACK}, /* WebKit: EventNames.json */
-    {"WEBKITSOURCECLOSE", TYPE_BLACK},
-    {"WEBKITSOURCEENDED", TYPE_BLACK},
-    {"WEBKITSOURCEOPEN", TYPE_BLACK},
-    {"WEBKITTRANSITIONEND", TYPE_BLACK},
-    {"WHEEL", TYPE_BLACK},
-    {"WRITE", TYPE_BLACK},
-    {"WRITEEND", TYPE_BLACK},
-    {"WRITESTART", TYPE_BLACK},
-    {"XULBROADCAST",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULCOMMANDUPDATE",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULPOPUPHIDDEN",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULPOPUPHIDING",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULPOPUPSHOWING",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULPOPUPSHOWN",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"XULSYSTEMSTATUSBARCLICK",
-     TYPE_BLACK}, /* Firefox: gecko-dev/dom/events/EventNameList.h - XUL
-                     specific */
-    {"ZOOM", TYPE_BLACK},
-    {NULL, TYPE_NONE}};
-
-/*
- * view-source:
- * data:
- * javascript:
- */
-static stringtype_t BLACKATTR[] = {
-    {"ACTION", TYPE_ATTR_URL}, /* form */
-    {"ATTRIBUTENAME",
-     TYPE_ATTR_INDIRECT},  /* SVG allow indirection of attribute names */
-    {"BY", TYPE_ATTR_URL}, /* SVG */
-    {"BACKGROUND", TYPE_ATTR_URL}, /* IE6, O11 */
-    {"DATAFORMATAS", TYPE_BLACK},  /* IE */
-    {"DATASRC", TYPE_BLACK},       /* IE */
-    {"DYNSRC", TYPE_ATTR_URL},     /* Obsolete img attribute */
-    {"FILTER", TYPE_STYLE},        /* Opera, SVG inline style */
-    {"FORMACTION", TYPE_ATTR_URL}, /* HTML 5 */
-    {"FOLDER", TYPE_ATTR_URL},     /* Only on A tags, IE-only */
-    {"FROM", TYPE_ATTR_URL},       /* SVG */
-    {"HANDLER", TYPE_ATTR_URL},    /* SVG Tiny, Opera */
-    {"HREF", TYPE_ATTR_URL},
-    {"LOWSRC", TYPE_ATTR_URL}, /* Obsolete img attribute */
-    {"POSTER", TYPE_ATTR_URL}, /* Opera 10,11 */
-    {"SRC", TYPE_ATTR_URL},
-    {"STYLE", TYPE_STYLE},
-    {"TO", TYPE_ATTR_URL},     /* SVG */
-    {"VALUES", TYPE_ATTR_URL}, /* SVG */
-    {"XLINK:HREF", TYPE_ATTR_URL},
-    {NULL, TYPE_NONE}};
-
-/* xmlns */
-/* `xml-stylesheet` > <eval>, <if expr=> */
-
-/*
-  static const char* BLACKATTR[] = {
-  "ATTRIBUTENAME",
-  "BACKGROUND",
-  "DATAFORMATAS",
-  "HREF",
-  "SCROLL",
-  "SRC",
-  "STYLE",
-  "SRCDOC",
-  NULL
-  };
-*/
-
-static const char *BLACKTAG[] = {
-    "APPLET",
-    /*    , "AUDIO" */
-    "BASE", "COMMENT", /* IE http://html5sec.org/#38 */
-    "EMBED",
-    /*   ,  "FORM" */
-    "FRAME", "FRAMESET", "HANDLER", /* Opera SVG, effectively a script tag */
-    "IFRAME", "IMPORT", "ISINDEX", "LINK", "LISTENER",
-    /*    , "MARQUEE" */
-    "META", "NOSCRIPT", "OBJECT", "SCRIPT", "STYLE",
-    /*    , "VIDEO" */
-    "VMLFRAME", "XML", "XSS", NULL};
-
 static int cstrcasecmp_with_null(const char *a, const char *b, size_t n) {
     unsigned int ai = 0, bi = 0;
     char ca;
@@ -892,6 +192,235 @@ static int cstrcasecmp_with_null(const char *a, const char *b, size_t n) {
     }
 }
 
+#ifndef LIBINJECTION_XSS_REFERENCE_MATCH
+/*
+ * FNV-1a and the slot of a hash in a table of libinjection_xss_data.h.
+ *
+ * Must match keyword_hash() and keyword_slot() in sqlparse2c.py
+ */
+#define WORD_HASH_BASIS 2166136261U
+#define WORD_HASH_STEP(h, ch) (((h) ^ (unsigned char)(ch)) * 16777619U)
+
+static size_t word_slot(unsigned int h, unsigned int disp, size_t size) {
+    unsigned int x = h ^ disp;
+    x = (x ^ (x >> 16)) * 0x45d9f3bU;
+    x = (x ^ (x >> 16)) * 0x45d9f3bU;
+    x = x ^ (x >> 16);
+    return x % size;
+}
+
+/*
+ * The tables are laid out by a minimal perfect hash (see
+ * perfect_hash() in sqlparse2c.py), so an upper-cased word with hash
+ * h can only be in one slot.
+ */
+static const xss_word_t *lookup_word(const xss_table_t *table,
+                                     const char *word, size_t len,
+                                     unsigned int h) {
+    const xss_word_t *w =
+        &table->words[word_slot(h, table->disp[h % table->disp_size],
+                                table->size)];
+
+    if (w->len == len && memcmp(w->name, word, len) == 0) {
+        return w;
+    }
+    return NULL;
+}
+
+/*
+ * Upper-cases s into word, leaving out NUL bytes, and hashes it.
+ *
+ * @return the length of word, or XSS_WORD_MAX + 1 if it is longer
+ *         than any tag or attribute name
+ */
+static size_t word_upcase(const char *s, size_t len, char *word,
+                          unsigned int *h) {
+    size_t n = 0;
+    size_t i;
+    char ch;
+
+    *h = WORD_HASH_BASIS;
+    for (i = 0; i < len; ++i) {
+        ch = s[i];
+        if (ch == '\0') {
+            continue;
+        }
+        if (n == XSS_WORD_MAX) {
+            return XSS_WORD_MAX + 1;
+        }
+        if (ch >= 'a' && ch <= 'z') {
+            ch -= 0x20;
+        }
+        word[n++] = ch;
+        *h = WORD_HASH_STEP(*h, ch);
+    }
+    return n;
+}
+
+/*
+ * Does s start with an event name?  s is upper-cased and hashed a byte
+ * at a time, and looked up at each length there is an event name of.
+ * A NUL byte ends it: no event name matches across one.
+ */
+static int is_black_event(const char *s, size_t len) {
+    char word[XSS_EVENT_MAX];
+    unsigned int h = WORD_HASH_BASIS;
+    size_t n;
+    char ch;
+
+    if (len > XSS_EVENT_MAX) {
+        len = XSS_EVENT_MAX;
+    }
+    for (n = 0; n < len; ++n) {
+        ch = s[n];
+        if (ch == '\0') {
+            return 0;
+        }
+        if (ch >= 'a' && ch <= 'z') {
+            ch -= 0x20;
+        }
+        word[n] = ch;
+        h = WORD_HASH_STEP(h, ch);
+        if (xss_event_lens[n + 1] &&
+            lookup_word(&xss_events, word, n + 1, h) != NULL) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int is_black_tag(const char *s, size_t len) {
+    char word[XSS_WORD_MAX];
+    unsigned int h;
+    size_t n;
+
+    if (len < 3) {
+        return 0;
+    }
+
+    n = word_upcase(s, len, word, &h);
+    if (n <= XSS_WORD_MAX && lookup_word(&xss_tags, word, n, h) != NULL) {
+        return 1;
+    }
+
+    /* anything SVG related */
+    if ((s[0] == 's' || s[0] == 'S') && (s[1] == 'v' || s[1] == 'V') &&
+        (s[2] == 'g' || s[2] == 'G')) {
+        return 1;
+    }
+
+    /* Anything XSL(t) related */
+    if ((s[0] == 'x' || s[0] == 'X') && (s[1] == 's' || s[1] == 'S') &&
+        (s[2] == 'l' || s[2] == 'L')) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static attribute_t is_black_attr(const char *s, size_t len) {
+    const xss_word_t *black;
+    char word[XSS_WORD_MAX];
+    unsigned int h;
+    size_t n;
+
+    if (len < 2) {
+        return TYPE_NONE;
+    }
+
+    if (len >= 5) {
+        /* JavaScript on.* event handlers */
+        if ((s[0] == 'o' || s[0] == 'O') && (s[1] == 'n' || s[1] == 'N') &&
+            is_black_event(s + 2, len - 2)) {
+            return TYPE_BLACK;
+        }
+
+        /* XMLNS can be used to create arbitrary tags */
+        if (cstrcasecmp_with_null("XMLNS", s, 5) == 0 ||
+            cstrcasecmp_with_null("XLINK", s, 5) == 0) {
+            return TYPE_BLACK;
+        }
+    }
+
+    n = word_upcase(s, len, word, &h);
+    if (n <= XSS_WORD_MAX) {
+        black = lookup_word(&xss_attrs, word, n, h);
+        if (black != NULL) {
+            return black->atype;
+        }
+    }
+
+    return TYPE_NONE;
+}
+
+/*
+ * Does the value start with a URL scheme of xss_urls?  It is HTML
+ * decoded a character at a time, as htmlencode_startswith() would for
+ * each scheme, and the trie is walked as it goes, so the value is
+ * decoded once and only as far as some scheme starts like it.
+ */
+static int is_black_url(const char *s, size_t len) {
+    const xss_trie_t *node = &xss_urls[0];
+    size_t consumed;
+    size_t i;
+    int first = 1;
+    int cb;
+
+    /* skip whitespace */
+    while (len > 0 && (*s <= 32 || *s >= 127)) {
+        /*
+         * HEY: this is a signed character.
+         *  We are intentionally skipping high-bit characters too
+         *  since they are not ASCII, and Opera sometimes uses UTF-8 whitespace.
+         *
+         * Also in EUC-JP some of the high bytes are just ignored.
+         */
+        ++s;
+        --len;
+    }
+
+    while (len > 0) {
+        cb = html_decode_char_at(s, len, &consumed);
+        s += consumed;
+        len -= consumed;
+
+        if (first && cb <= 32) {
+            /* ignore all leading whitespace and control characters */
+            continue;
+        }
+        first = 0;
+
+        if (cb == 0 || cb == 10) {
+            /* always ignore null and line feed characters in user input */
+            continue;
+        }
+
+        if (cb >= 'a' && cb <= 'z') {
+            /* upcase */
+            cb -= 0x20;
+        }
+
+        for (i = 0; i < node->count; ++i) {
+            if (xss_urls[node->first + i].ch == (char)cb) {
+                break;
+            }
+        }
+        if (i == node->count) {
+            return 0;
+        }
+        node = &xss_urls[node->first + i];
+        if (node->count == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#else
+/*
+ * The linear searches of the generated lists the hashed lookups and
+ * the trie above replace, for test-xss-words.sh
+ */
 /*
  * Does an HTML encoded binary string (const char*, length) start with
  * a all uppercase c-string (null terminated), case insensitive!
@@ -951,7 +480,7 @@ static int htmlencode_startswith(const char *a, const char *b, size_t n) {
 }
 
 static int is_black_tag(const char *s, size_t len) {
-    const char **black;
+    const char *const *black;
 
     if (len < 3) {
         return 0;
@@ -984,7 +513,7 @@ static int is_black_tag(const char *s, size_t len) {
 }
 
 static attribute_t is_black_attr(const char *s, size_t len) {
-    stringtype_t *black;
+    const stringtype_t *black;
 
     if (len < 2) {
         return TYPE_NONE;
@@ -1034,52 +563,91 @@ static attribute_t is_black_attr(const char *s, size_t len) {
 }
 
 static int is_black_url(const char *s, size_t len) {
-
-    static const char *data_url = "DATA";
-    static const char *viewsource_url = "VIEW-SOURCE";
-
-    /* obsolete but interesting signal */
-    static const char *vbscript_url = "VBSCRIPT";
-
-    /* covers JAVA, JAVASCRIPT, + colon */
-    static const char *javascript_url = "JAVA";
+    const char *const *black;
 
     /* skip whitespace */
     while (len > 0 && (*s <= 32 || *s >= 127)) {
-        /*
-         * HEY: this is a signed character.
-         *  We are intentionally skipping high-bit characters too
-         *  since they are not ASCII, and Opera sometimes uses UTF-8 whitespace.
-         *
-         * Also in EUC-JP some of the high bytes are just ignored.
-         */
         ++s;
         --len;
     }
 
-    if (htmlencode_startswith(data_url, s, len)) {
-        return 1;
+    black = BLACKURL;
+    while (*black != NULL) {
+        if (htmlencode_startswith(*black, s, len)) {
+            return 1;
+        }
+        black += 1;
     }
+    return 0;
+}
+#endif
 
-    if (htmlencode_startswith(viewsource_url, s, len)) {
-        return 1;
-    }
+/*
+ * Where a context is between two tokens.  What libinjection_is_xss
+ * makes of the rest of the input depends on nothing else, so once a
+ * context gets to where an earlier one has been, it ends the same way.
+ */
+typedef struct xss_checkpoint {
+    int state;
+    size_t pos;
+    int is_close;
+    attribute_t attr;
+} xss_checkpoint_t;
 
-    if (htmlencode_startswith(javascript_url, s, len)) {
-        return 1;
-    }
+/*
+ * The first checkpoints of the contexts libinjection_xss has run.  The
+ * contexts usually meet at the first tag boundary, so a few are
+ * enough.
+ */
+#define XSS_CHECKPOINTS 32
 
-    if (htmlencode_startswith(vbscript_url, s, len)) {
-        return 1;
+typedef struct xss_memo {
+    xss_checkpoint_t points[XSS_CHECKPOINTS];
+    size_t count;   /* points in use */
+    size_t earlier; /* points of the contexts before this one */
+} xss_memo_t;
+
+/*
+ * TRUE if an earlier context was at the same checkpoint.  Those all
+ * ended FALSE, or libinjection_xss would have stopped.  Otherwise the
+ * checkpoint is kept, if there is room.
+ */
+static int xss_converged(xss_memo_t *memo, const h5_state_t *h5,
+                         attribute_t attr) {
+    xss_checkpoint_t *point;
+    size_t i;
+
+    for (i = 0; i < memo->earlier; ++i) {
+        point = &memo->points[i];
+        if (point->pos == h5->pos && point->state == h5->state &&
+            point->is_close == h5->is_close && point->attr == attr) {
+            return 1;
+        }
+    }
+    if (memo->count < XSS_CHECKPOINTS) {
+        point = &memo->points[memo->count];
+        point->state = h5->state;
+        point->pos = h5->pos;
+        point->is_close = h5->is_close;
+        point->attr = attr;
+        memo->count += 1;
     }
     return 0;
 }
 
-injection_result_t libinjection_is_xss(const char *s, size_t len, int flags) {
+/*
+ * libinjection_is_xss, and with a memo, FALSE as soon as the context
+ * converges with one that was run before
+ */
+static injection_result_t xss_context(const char *s, size_t len, int flags,
+                                      xss_memo_t *memo) {
     h5_state_t h5;
     attribute_t attr = TYPE_NONE;
     injection_result_t parser_result;
 
+    if (memo != NULL) {
+        memo->earlier = memo->count;
+    }
     libinjection_h5_init(&h5, s, len, (enum html5_flags)flags);
     while ((parser_result = libinjection_h5_next(&h5)) ==
            LIBINJECTION_RESULT_TRUE) {
@@ -1163,10 +731,73 @@ injection_result_t libinjection_is_xss(const char *s, size_t len, int flags) {
                 }
             }
         }
+
+        if (memo != NULL && xss_converged(memo, &h5, attr)) {
+            return LIBINJECTION_RESULT_FALSE;
+        }
     }
     return parser_result;
 }
 
+injection_result_t libinjection_is_xss(const char *s, size_t len, int flags) {
+    return xss_context(s, len, flags, NULL);
+}
+
+#ifdef LIBINJECTION_SHAPE_STATS
+static struct libinjection_shape_stats xss_shape_stats;
+#endif
+
+void libinjection_xss_shape_stats(struct libinjection_shape_stats *stats) {
+#ifdef LIBINJECTION_SHAPE_STATS
+    stats->calls = SHAPE_STATS_READ(xss_shape_stats.calls);
+    stats->benign = SHAPE_STATS_READ(xss_shape_stats.benign);
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/*
+ * Without any of these bytes every context is a single token that
+ * libinjection_is_xss doesn't look at: text in DATA_STATE (no '<'),
+ * an attribute name with no value in VALUE_NO_QUOTE (no space, NUL,
+ * '/', '=' or '>' to end it) and an attribute value of no attribute
+ * in the quoted ones (no quote to close it).  test_equivalence.c
+ * checks the verdicts against each context.
+ */
+static int xss_benign_shape(const char *s, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        switch (s[i]) {
+        case 0x00:
+        case 0x09:
+        case 0x0A:
+        case 0x0B:
+        case 0x0C:
+        case 0x0D:
+        case 0x20:
+        case '"':
+        case '\'':
+        case '`':
+        case '/':
+        case '<':
+        case '=':
+        case '>':
+            return 0;
+        default:
+            break;
+        }
+    }
+    return 1;
+}
+
+/*
+ * The contexts of libinjection_xss, in order
+ */
+static const enum html5_flags xss_contexts[] = {
+    DATA_STATE, VALUE_NO_QUOTE, VALUE_SINGLE_QUOTE, VALUE_DOUBLE_QUOTE,
+    VALUE_BACK_QUOTE};
+
 /*
  * wrapper
  *
@@ -1174,29 +805,30 @@ injection_result_t libinjection_is_xss(const char *s, size_t len, int flags) {
  * const char* s: input string, may contain nulls, does not need to be
  * null-terminated. size_t len: input string length.
  *
- *
+ * The same as libinjection_is_xss in each context in turn, but a
+ * context stops once it is where an earlier context has been: the
+ * contexts share one memo of checkpoints.
  */
 injection_result_t libinjection_xss(const char *s, size_t slen) {
     injection_result_t result;
-    if ((result = libinjection_is_xss(s, slen, DATA_STATE)) !=
-        LIBINJECTION_RESULT_FALSE) {
-        return result;
-    }
-    if ((result = libinjection_is_xss(s, slen, VALUE_NO_QUOTE)) !=
-        LIBINJECTION_RESULT_FALSE) {
-        return result;
-    }
-    if ((result = libinjection_is_xss(s, slen, VALUE_SINGLE_QUOTE)) !=
-        LIBINJECTION_RESULT_FALSE) {
-        return result;
-    }
-    if ((result = libinjection_is_xss(s, slen, VALUE_DOUBLE_QUOTE)) !=
-        LIBINJECTION_RESULT_FALSE) {
-        return result;
+    xss_memo_t memo;
+    size_t i;
+
+#ifdef LIBINJECTION_SHAPE_STATS
+    SHAPE_STATS_ADD(xss_shape_stats.calls);
+#endif
+    if (xss_benign_shape(s, slen)) {
+#ifdef LIBINJECTION_SHAPE_STATS
+        SHAPE_STATS_ADD(xss_shape_stats.benign);
+#endif
+        return LIBINJECTION_RESULT_FALSE;
     }
-    if ((result = libinjection_is_xss(s, slen, VALUE_BACK_QUOTE)) !=
-        LIBINJECTION_RESULT_FALSE) {
-        return result;
+    memo.count = 0;
+    for (i = 0; i < sizeof(xss_contexts) / sizeof(xss_contexts[0]); ++i) {
+        result = xss_context(s, slen, (int)xss_contexts[i], &memo);
+        if (result != LIBINJECTION_RESULT_FALSE) {
+            return result;
+        }
     }
 
     return LIBINJECTION_RESULT_FALSE;
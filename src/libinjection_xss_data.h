@@ -0,0 +1,1060 @@
+/**
+ * Generated by xss2c.py from xss_words.txt, do not edit
+ */
+#ifndef LIBINJECTION_XSS_DATA_H
+#define LIBINJECTION_XSS_DATA_H
+
+/* longest tag or attribute name */
+#define XSS_WORD_MAX 13
+
+/* longest event name */
+#define XSS_EVENT_MAX 44
+
+#ifndef LIBINJECTION_XSS_REFERENCE_MATCH
+typedef struct {
+    const char *name;
+    size_t len;
+    attribute_t atype;
+} xss_word_t;
+
+typedef struct {
+    const xss_word_t *words; /* in slot order */
+    size_t size;
+    const unsigned int *disp;
+    size_t disp_size;
+} xss_table_t;
+
+/*
+ * Node 0 is the root.  A node's children are the count nodes from
+ * first, and a node with none ends a word.
+ */
+typedef struct {
+    char ch;
+    unsigned char first;
+    unsigned char count;
+} xss_trie_t;
+
+static const xss_word_t xss_tags_words[] = {
+    {"META", 4, TYPE_BLACK},
+    {"VMLFRAME", 8, TYPE_BLACK},
+    {"STYLE", 5, TYPE_BLACK},
+    {"IMPORT", 6, TYPE_BLACK},
+    {"BASE", 4, TYPE_BLACK},
+    {"IFRAME", 6, TYPE_BLACK},
+    {"SCRIPT", 6, TYPE_BLACK},
+    {"APPLET", 6, TYPE_BLACK},
+    {"XSS", 3, TYPE_BLACK},
+    {"FRAME", 5, TYPE_BLACK},
+    {"COMMENT", 7, TYPE_BLACK},
+    {"LINK", 4, TYPE_BLACK},
+    {"EMBED", 5, TYPE_BLACK},
+    {"FRAMESET", 8, TYPE_BLACK},
+    {"LISTENER", 8, TYPE_BLACK},
+    {"OBJECT", 6, TYPE_BLACK},
+    {"XML", 3, TYPE_BLACK},
+    {"HANDLER", 7, TYPE_BLACK},
+    {"NOSCRIPT", 8, TYPE_BLACK},
+    {"ISINDEX", 7, TYPE_BLACK},
+};
+static const unsigned int xss_tags_disp[] = {
+    0, 0, 23, 3, 425, 18,
+};
+static const xss_table_t xss_tags = {xss_tags_words, 20, xss_tags_disp, 6};
+
+static const xss_word_t xss_attrs_words[] = {
+    {"FILTER", 6, TYPE_STYLE},
+    {"SRC", 3, TYPE_ATTR_URL},
+    {"FROM", 4, TYPE_ATTR_URL},
+    {"BACKGROUND", 10, TYPE_ATTR_URL},
+    {"ATTRIBUTENAME", 13, TYPE_ATTR_INDIRECT},
+    {"HREF", 4, TYPE_ATTR_URL},
+    {"DATASRC", 7, TYPE_BLACK},
+    {"ACTION", 6, TYPE_ATTR_URL},
+    {"POSTER", 6, TYPE_ATTR_URL},
+    {"DATAFORMATAS", 12, TYPE_BLACK},
+    {"FORMACTION", 10, TYPE_ATTR_URL},
+    {"XLINK:HREF", 10, TYPE_ATTR_URL},
+    {"LOWSRC", 6, TYPE_ATTR_URL},
+    {"DYNSRC", 6, TYPE_ATTR_URL},
+    {"VALUES", 6, TYPE_ATTR_URL},
+    {"BY", 2, TYPE_ATTR_URL},
+    {"HANDLER", 7, TYPE_ATTR_URL},
+    {"TO", 2, TYPE_ATTR_URL},
+    {"STYLE", 5, TYPE_STYLE},
+    {"FOLDER", 6, TYPE_ATTR_URL},
+};
+static const unsigned int xss_attrs_disp[] = {
+    7, 47, 0, 2, 6, 44,
+};
+static const xss_table_t xss_attrs = {xss_attrs_words, 20, xss_attrs_disp, 6};
+
+static const xss_word_t xss_events_words[] = {
+    {"ABORT", 5, TYPE_BLACK},
+    {"NEGOTIATIONNEEDED", 17, TYPE_BLACK},
+    {"WEBKITANIMATIONSTART", 20, TYPE_BLACK},
+    {"MOUSEHITTEST", 12, TYPE_BLACK},
+    {"SPEECHSTART", 11, TYPE_BLACK},
+    {"COORDINATORSTATECHANGE", 22, TYPE_BLACK},
+    {"SMILENDEVENT", 12, TYPE_BLACK},
+    {"FORMINVALID", 11, TYPE_BLACK},
+    {"PUSHNOTIFICATION", 16, TYPE_BLACK},
+    {"NOUPDATE", 8, TYPE_BLACK},
+    {"UPGRADENEEDED", 13, TYPE_BLACK},
+    {"DOMNODEREMOVEDFROMDOCUMENT", 26, TYPE_BLACK},
+    {"POPSTATE", 8, TYPE_BLACK},
+    {"DEQUEUE", 7, TYPE_BLACK},
+    {"MOUSEOUT", 8, TYPE_BLACK},
+    {"COMPOSITIONCHANGE", 17, TYPE_BLACK},
+    {"DOMSUBTREEMODIFIED", 18, TYPE_BLACK},
+    {"XULPOPUPSHOWN", 13, TYPE_BLACK},
+    {"CONTROLLERCHANGE", 16, TYPE_BLACK},
+    {"MOZVISUALSCROLL", 15, TYPE_BLACK},
+    {"SOURCEENDED", 11, TYPE_BLACK},
+    {"SELECTIONCHANGE", 15, TYPE_BLACK},
+    {"SLOTCHANGE", 10, TYPE_BLACK},
+    {"TIMEUPDATE", 10, TYPE_BLACK},
+    {"GESTUREEND", 10, TYPE_BLACK},
+    {"LOADING", 7, TYPE_BLACK},
+    {"LEGACYCHARACTERDATAMODIFIED", 27, TYPE_BLACK},
+    {"SOUNDSTART", 10, TYPE_BLACK},
+    {"WEBKITAUTOFILLREQUEST", 21, TYPE_BLACK},
+    {"PROPERTYCHANGE", 14, TYPE_BLACK},
+    {"WAITING", 7, TYPE_BLACK},
+    {"DRAGENTER", 9, TYPE_BLACK},
+    {"POINTERAUXCLICK", 15, TYPE_BLACK},
+    {"ENDEVENT", 8, TYPE_BLACK},
+    {"WEBKITPLAYBACKTARGETAVAILABILITYCHANGED", 39, TYPE_BLACK},
+    {"POINTEROUT", 10, TYPE_BLACK},
+    {"PROGRESS", 8, TYPE_BLACK},
+    {"LEGACYNODEINSERTEDINTODOCUMENT", 30, TYPE_BLACK},
+    {"POINTERMOVE", 11, TYPE_BLACK},
+    {"BACKGROUNDFETCHFAIL", 19, TYPE_BLACK},
+    {"ZOOM", 4, TYPE_BLACK},
+    {"PAYMENTMETHODSELECTED", 21, TYPE_BLACK},
+    {"REMOVESTREAM", 12, TYPE_BLACK},
+    {"SEEKED", 6, TYPE_BLACK},
+    {"AUDIOSTART", 10, TYPE_BLACK},
+    {"GATHERINGSTATECHANGE", 20, TYPE_BLACK},
+    {"UNIDENTIFIEDEVENT", 17, TYPE_BLACK},
+    {"SWIPEGESTURESTART", 17, TYPE_BLACK},
+    {"LEGACYDOMFOCUSIN", 16, TYPE_BLACK},
+    {"MESSAGEERROR", 12, TYPE_BLACK},
+    {"UNHANDLEDREJECTION", 18, TYPE_BLACK},
+    {"BACKGROUNDFETCHCLICK", 20, TYPE_BLACK},
+    {"STATECHANGE", 11, TYPE_BLACK},
+    {"PROCESSORERROR", 14, TYPE_BLACK},
+    {"AUTOCOMPLETEERROR", 17, TYPE_BLACK},
+    {"BEFOREUNLOAD", 12, TYPE_BLACK},
+    {"SECURITYPOLICYVIOLATION", 23, TYPE_BLACK},
+    {"TRANSITIONEND", 13, TYPE_BLACK},
+    {"SHIPPINGCONTACTSELECTED", 23, TYPE_BLACK},
+    {"EXIT", 4, TYPE_BLACK},
+    {"WAITINGFORKEY", 13, TYPE_BLACK},
+    {"POINTERUP", 9, TYPE_BLACK},
+    {"TAPGESTURE", 10, TYPE_BLACK},
+    {"VALIDATEMERCHANT", 16, TYPE_BLACK},
+    {"INSTALL", 7, TYPE_BLACK},
+    {"AFTERPAINT", 10, TYPE_BLACK},
+    {"CONTEXTLOST", 11, TYPE_BLACK},
+    {"GESTURETAP", 10, TYPE_BLACK},
+    {"EDITORINPUT", 11, TYPE_BLACK},
+    {"GESTURESCROLLSTART", 18, TYPE_BLACK},
+    {"WEBKITSOURCEENDED", 17, TYPE_BLACK},
+    {"REPEATEVENT", 11, TYPE_BLACK},
+    {"PLAYING", 7, TYPE_BLACK},
+    {"FULLSCREENERROR", 15, TYPE_BLACK},
+    {"RTCTRANSFORM", 12, TYPE_BLACK},
+    {"ROTATEGESTUREUPDATE", 19, TYPE_BLACK},
+    {"PREVIOUSTRACK", 13, TYPE_BLACK},
+    {"EDGEUISTARTED", 13, TYPE_BLACK},
+    {"CUECHANGE", 9, TYPE_BLACK},
+    {"NAVIGATEERROR", 13, TYPE_BLACK},
+    {"DOMNODEINSERTED", 15, TYPE_BLACK},
+    {"MOUSELEAVE", 10, TYPE_BLACK},
+    {"MEDIARECORDERDATAAVAILABLE", 26, TYPE_BLACK},
+    {"FORMCHANGE", 10, TYPE_BLACK},
+    {"ENCRYPTED", 9, TYPE_BLACK},
+    {"MOUSEOVER", 9, TYPE_BLACK},
+    {"WEBGLCONTEXTRESTORED", 20, TYPE_BLACK},
+    {"SELECTSTART", 11, TYPE_BLACK},
+    {"FORMCHECKBOXSTATECHANGE", 23, TYPE_BLACK},
+    {"GESTURECHANGE", 13, TYPE_BLACK},
+    {"SOURCECLOSE", 11, TYPE_BLACK},
+    {"WEBKITMOUSEFORCEUP", 18, TYPE_BLACK},
+    {"GESTURESTART", 12, TYPE_BLACK},
+    {"POINTERLOSTCAPTURE", 18, TYPE_BLACK},
+    {"SVGLOAD", 7, TYPE_BLACK},
+    {"DATAAVAILABLE", 13, TYPE_BLACK},
+    {"SCROLLEDAREACHANGED", 19, TYPE_BLACK},
+    {"CANPLAYTHROUGH", 14, TYPE_BLACK},
+    {"LOADINGDONE", 11, TYPE_BLACK},
+    {"SMILBEGINEVENT", 14, TYPE_BLACK},
+    {"NOTIFICATIONCLICK", 17, TYPE_BLACK},
+    {"SHOW", 4, TYPE_BLACK},
+    {"CHARGINGCHANGE", 14, TYPE_BLACK},
+    {"DEVICEMOTION", 12, TYPE_BLACK},
+    {"CLICK", 5, TYPE_BLACK},
+    {"WEBKITFULLSCREENERROR", 21, TYPE_BLACK},
+    {"NAVIGATE", 8, TYPE_BLACK},
+    {"BACKGROUNDFETCHABORT", 20, TYPE_BLACK},
+    {"LEGACYMOUSELINEORPAGESCROLL", 27, TYPE_BLACK},
+    {"NOMATCH", 7, TYPE_BLACK},
+    {"MOUSEUP", 7, TYPE_BLACK},
+    {"LEGACYNODEREMOVEDFROMDOCUMENT", 29, TYPE_BLACK},
+    {"GAMEPADBUTTONUP", 15, TYPE_BLACK},
+    {"COMPOSITIONEND", 14, TYPE_BLACK},
+    {"PAYMENTMETHODCHANGE", 19, TYPE_BLACK},
+    {"EDGEUICANCELED", 14, TYPE_BLACK},
+    {"SWIPEGESTURE", 12, TYPE_BLACK},
+    {"WEBKITSOURCECLOSE", 17, TYPE_BLACK},
+    {"TRANSITIONSTART", 15, TYPE_BLACK},
+    {"WEBKITMEDIASESSIONMETADATACHANGED", 33, TYPE_BLACK},
+    {"ANIMATIONSTART", 14, TYPE_BLACK},
+    {"ANIMATIONCANCEL", 15, TYPE_BLACK},
+    {"DATACHANNEL", 11, TYPE_BLACK},
+    {"ENTER", 5, TYPE_BLACK},
+    {"EMPTIED", 7, TYPE_BLACK},
+    {"CONTEXTMENU", 11, TYPE_BLACK},
+    {"WEBKITSOURCEOPEN", 16, TYPE_BLACK},
+    {"ROTATEGESTURESTART", 18, TYPE_BLACK},
+    {"VRDISPLAYDEACTIVATE", 19, TYPE_BLACK},
+    {"XULCOMMANDUPDATE", 16, TYPE_BLACK},
+    {"VRDISPLAYACTIVATE", 17, TYPE_BLACK},
+    {"VISIBILITYCHANGE", 16, TYPE_BLACK},
+    {"MARK", 4, TYPE_BLACK},
+    {"DOMCHARACTERDATAMODIFIED", 24, TYPE_BLACK},
+    {"GAMEPADCONNECTED", 16, TYPE_BLACK},
+    {"TONECHANGE", 10, TYPE_BLACK},
+    {"XULPOPUPHIDDEN", 14, TYPE_BLACK},
+    {"LOAD", 4, TYPE_BLACK},
+    {"CURRENTENTRYCHANGE", 18, TYPE_BLACK},
+    {"BEFOREACTIVATE", 14, TYPE_BLACK},
+    {"LEVELCHANGE", 11, TYPE_BLACK},
+    {"EDITORBEFOREINPUT", 17, TYPE_BLACK},
+    {"BUFFEREDAMOUNTLOW", 17, TYPE_BLACK},
+    {"WEBKITREMOVESOURCEBUFFER", 24, TYPE_BLACK},
+    {"CLOSE", 5, TYPE_BLACK},
+    {"SEEKING", 7, TYPE_BLACK},
+    {"SPEECHEND", 9, TYPE_BLACK},
+    {"SUSPEND", 7, TYPE_BLACK},
+    {"POINTERDOWN", 11, TYPE_BLACK},
+    {"AUDIOCOMPLETE", 13, TYPE_BLACK},
+    {"CANPLAY", 7, TYPE_BLACK},
+    {"MERCHANTVALIDATION", 18, TYPE_BLACK},
+    {"TOUCHFORCECHANGE", 16, TYPE_BLACK},
+    {"AFTERSCRIPTEXECUTE", 18, TYPE_BLACK},
+    {"WEBKITSHADOWROOTATTACHED", 24, TYPE_BLACK},
+    {"FOCUSIN", 7, TYPE_BLACK},
+    {"BLUR", 4, TYPE_BLACK},
+    {"INVALID", 7, TYPE_BLACK},
+    {"UPDATEREADY", 11, TYPE_BLACK},
+    {"BEFOREPASTE", 11, TYPE_BLACK},
+    {"COMPLETE", 8, TYPE_BLACK},
+    {"NOTIFICATIONCLOSE", 17, TYPE_BLACK},
+    {"UPDATEFOUND", 11, TYPE_BLACK},
+    {"XULSYSTEMSTATUSBARCLICK", 23, TYPE_BLACK},
+    {"DEVICECHANGE", 12, TYPE_BLACK},
+    {"VRDISPLAYPRESENTCHANGE", 22, TYPE_BLACK},
+    {"FOCUSOUT", 8, TYPE_BLACK},
+    {"POINTERRAWUPDATE", 16, TYPE_BLACK},
+    {"WRITESTART", 10, TYPE_BLACK},
+    {"GAMEPADAXISMOVE", 15, TYPE_BLACK},
+    {"KEYSTATUSESCHANGE", 17, TYPE_BLACK},
+    {"ADDTRACK", 8, TYPE_BLACK},
+    {"POINTERENTER", 12, TYPE_BLACK},
+    {"WEBKITMOUSEFORCEDOWN", 20, TYPE_BLACK},
+    {"TIMEOUT", 7, TYPE_BLACK},
+    {"NEXTTRACK", 9, TYPE_BLACK},
+    {"BACKGROUNDFETCHSUCCESS", 22, TYPE_BLACK},
+    {"SCROLLSNAPCHANGING", 18, TYPE_BLACK},
+    {"WEBKITENDFULLSCREEN", 19, TYPE_BLACK},
+    {"CONTENTVISIBILITYAUTOSTATECHANGE", 32, TYPE_BLACK},
+    {"ADDSOURCEBUFFER", 15, TYPE_BLACK},
+    {"ICEGATHERINGSTATECHANGE", 23, TYPE_BLACK},
+    {"PAUSE", 5, TYPE_BLACK},
+    {"READYSTATECHANGE", 16, TYPE_BLACK},
+    {"VRDISPLAYDISCONNECT", 19, TYPE_BLACK},
+    {"MAGNIFYGESTUREUPDATE", 20, TYPE_BLACK},
+    {"RESUME", 6, TYPE_BLACK},
+    {"MOUSEEXPLOREBYTOUCH", 19, TYPE_BLACK},
+    {"QUALITYCHANGE", 13, TYPE_BLACK},
+    {"FENCEDTREECLICK", 15, TYPE_BLACK},
+    {"SWIPEGESTUREMAYSTART", 20, TYPE_BLACK},
+    {"CONNECTING", 10, TYPE_BLACK},
+    {"TRANSITIONCANCEL", 16, TYPE_BLACK},
+    {"ACCESSKEYNOTFOUND", 17, TYPE_BLACK},
+    {"LEGACYSUBTREEMODIFIED", 21, TYPE_BLACK},
+    {"BUFFEREDCHANGE", 14, TYPE_BLACK},
+    {"DROP", 4, TYPE_BLACK},
+    {"SORT", 4, TYPE_BLACK},
+    {"STARTED", 7, TYPE_BLACK},
+    {"FULLSCREENCHANGE", 16, TYPE_BLACK},
+    {"MOZPOINTERLOCKCHANGE", 20, TYPE_BLACK},
+    {"WEBKITBEGINFULLSCREEN", 21, TYPE_BLACK},
+    {"STARTSTREAMING", 14, TYPE_BLACK},
+    {"INVOKE", 6, TYPE_BLACK},
+    {"SWIPEGESTUREUPDATE", 18, TYPE_BLACK},
+    {"AUXCLICK", 8, TYPE_BLACK},
+    {"BEFORECOPY", 10, TYPE_BLACK},
+    {"LEGACYNODEREMOVED", 17, TYPE_BLACK},
+    {"SUCCESS", 7, TYPE_BLACK},
+    {"USERPROXIMITY", 13, TYPE_BLACK},
+    {"CLOSING", 7, TYPE_BLACK},
+    {"MEDIARECORDERWARNING", 20, TYPE_BLACK},
+    {"SCROLLPORTOVERFLOW", 18, TYPE_BLACK},
+    {"VOLUMECHANGE", 12, TYPE_BLACK},
+    {"ENDED", 5, TYPE_BLACK},
+    {"FOCUS", 5, TYPE_BLACK},
+    {"SHIPPINGMETHODSELECTED", 22, TYPE_BLACK},
+    {"CUT", 3, TYPE_BLACK},
+    {"SCROLL", 6, TYPE_BLACK},
+    {"START", 5, TYPE_BLACK},
+    {"WEBKITTRANSITIONEND", 19, TYPE_BLACK},
+    {"ROTATEGESTURE", 13, TYPE_BLACK},
+    {"DBLCLICK", 8, TYPE_BLACK},
+    {"MOZFULLSCREENCHANGE", 19, TYPE_BLACK},
+    {"MOUSEWHEEL", 10, TYPE_BLACK},
+    {"POINTERCANCEL", 13, TYPE_BLACK},
+    {"MOZFULLSCREENERROR", 18, TYPE_BLACK},
+    {"TOUCHEND", 8, TYPE_BLACK},
+    {"OVERSCROLL", 10, TYPE_BLACK},
+    {"WEBKITPRESENTATIONMODECHANGED", 29, TYPE_BLACK},
+    {"XULPOPUPHIDING", 14, TYPE_BLACK},
+    {"SVGSCROLL", 9, TYPE_BLACK},
+    {"AFTERPRINT", 10, TYPE_BLACK},
+    {"WEBKITMOUSEFORCECHANGED", 23, TYPE_BLACK},
+    {"BEFORELOAD", 10, TYPE_BLACK},
+    {"WEBGLCONTEXTCREATIONERROR", 25, TYPE_BLACK},
+    {"PAGESWAP", 8, TYPE_BLACK},
+    {"LOADSTART", 9, TYPE_BLACK},
+    {"MOUSEDOUBLECLICK", 16, TYPE_BLACK},
+    {"SCROLLEND", 9, TYPE_BLACK},
+    {"ORIENTATIONCHANGE", 17, TYPE_BLACK},
+    {"BEGINEVENT", 10, TYPE_BLACK},
+    {"POINTERLOCKCHANGE", 17, TYPE_BLACK},
+    {"UNLOAD", 6, TYPE_BLACK},
+    {"LEGACYATTRMODIFIED", 18, TYPE_BLACK},
+    {"SQUEEZEEND", 10, TYPE_BLACK},
+    {"WEBKITNEEDKEY", 13, TYPE_BLACK},
+    {"ENDSTREAMING", 12, TYPE_BLACK},
+    {"DURATIONCHANGE", 14, TYPE_BLACK},
+    {"PAGEREVEAL", 10, TYPE_BLACK},
+    {"ACTIVATE", 8, TYPE_BLACK},
+    {"GESTURETAPDOWN", 14, TYPE_BLACK},
+    {"IMAGEABORT", 10, TYPE_BLACK},
+    {"DRAGLEAVE", 9, TYPE_BLACK},
+    {"MOUSEENTER", 10, TYPE_BLACK},
+    {"POINTERLEAVE", 12, TYPE_BLACK},
+    {"SCROLLSNAPCHANGE", 16, TYPE_BLACK},
+    {"DISCHARGINGTIMECHANGE", 21, TYPE_BLACK},
+    {"AUDIOPROCESS", 12, TYPE_BLACK},
+    {"DRAG", 4, TYPE_BLACK},
+    {"BOUNDARY", 8, TYPE_BLACK},
+    {"POINTERGOTCAPTURE", 17, TYPE_BLACK},
+    {"GESTURESCROLLUPDATE", 19, TYPE_BLACK},
+    {"REMOVETRACK", 11, TYPE_BLACK},
+    {"REMOVESOURCEBUFFER", 18, TYPE_BLACK},
+    {"LEAVEPICTUREINPICTURE", 21, TYPE_BLACK},
+    {"XULBROADCAST", 12, TYPE_BLACK},
+    {"DEVICELIGHT", 11, TYPE_BLACK},
+    {"DRAGOVER", 8, TYPE_BLACK},
+    {"CHANGE", 6, TYPE_BLACK},
+    {"DOMCONTENTLOADED", 16, TYPE_BLACK},
+    {"LANGUAGECHANGE", 14, TYPE_BLACK},
+    {"POINTEROVER", 11, TYPE_BLACK},
+    {"STALLED", 7, TYPE_BLACK},
+    {"INACTIVE", 8, TYPE_BLACK},
+    {"FINISH", 6, TYPE_BLACK},
+    {"TRANSITIONRUN", 13, TYPE_BLACK},
+    {"COMMAND", 7, TYPE_BLACK},
+    {"FORMRADIOSTATECHANGE", 20, TYPE_BLACK},
+    {"SOUNDEND", 8, TYPE_BLACK},
+    {"KEYDOWN", 7, TYPE_BLACK},
+    {"GOTPOINTERCAPTURE", 17, TYPE_BLACK},
+    {"PAGEHIDE", 8, TYPE_BLACK},
+    {"OPEN", 4, TYPE_BLACK},
+    {"COPY", 4, TYPE_BLACK},
+    {"CHARGINGTIMECHANGE", 18, TYPE_BLACK},
+    {"STOP", 4, TYPE_BLACK},
+    {"KEYPRESS", 8, TYPE_BLACK},
+    {"VRDISPLAYCONNECT", 16, TYPE_BLACK},
+    {"MEDIARECORDERSTOP", 17, TYPE_BLACK},
+    {"LEGACYNODEINSERTED", 18, TYPE_BLACK},
+    {"POINTERCLICK", 12, TYPE_BLACK},
+    {"UPDATE", 6, TYPE_BLACK},
+    {"VERSIONCHANGE", 13, TYPE_BLACK},
+    {"LEGACYDOMFOCUSOUT", 17, TYPE_BLACK},
+    {"SQUEEZESTART", 12, TYPE_BLACK},
+    {"UNCAPTUREDERROR", 15, TYPE_BLACK},
+    {"OBSOLETE", 8, TYPE_BLACK},
+    {"HASHCHANGE", 10, TYPE_BLACK},
+    {"SWIPEGESTUREEND", 15, TYPE_BLACK},
+    {"VOICESCHANGED", 13, TYPE_BLACK},
+    {"WEBKITANIMATIONITERATION", 24, TYPE_BLACK},
+    {"MOZPOINTERLOCKERROR", 19, TYPE_BLACK},
+    {"DEVICEORIENTATIONABSOLUTE", 25, TYPE_BLACK},
+    {"PLAY", 4, TYPE_BLACK},
+    {"MOUSELONGTAP", 12, TYPE_BLACK},
+    {"SIGNALINGSTATECHANGE", 20, TYPE_BLACK},
+    {"SOURCEOPEN", 10, TYPE_BLACK},
+    {"GAMEPADBUTTONDOWN", 17, TYPE_BLACK},
+    {"WEBKITKEYMESSAGE", 16, TYPE_BLACK},
+    {"CHECKING", 8, TYPE_BLACK},
+    {"CACHED", 6, TYPE_BLACK},
+    {"SELECTEDCANDIDATEPAIRCHANGE", 27, TYPE_BLACK},
+    {"PUSH", 4, TYPE_BLACK},
+    {"LOADEDMETADATA", 14, TYPE_BLACK},
+    {"UNMUTE", 6, TYPE_BLACK},
+    {"CONNECTIONSTATECHANGE", 21, TYPE_BLACK},
+    {"PAGESHOW", 8, TYPE_BLACK},
+    {"FORMDATA", 8, TYPE_BLACK},
+    {"SCROLLPORTUNDERFLOW", 19, TYPE_BLACK},
+    {"SELECT", 6, TYPE_BLACK},
+    {"TOUCHCANCEL", 11, TYPE_BLACK},
+    {"AUDIOEND", 8, TYPE_BLACK},
+    {"BLOCKED", 7, TYPE_BLACK},
+    {"AUTOCOMPLETE", 12, TYPE_BLACK},
+    {"DRAGEND", 7, TYPE_BLACK},
+    {"COMPOSITIONUPDATE", 17, TYPE_BLACK},
+    {"EDGEUICOMPLETED", 15, TYPE_BLACK},
+    {"ANIMATIONEND", 12, TYPE_BLACK},
+    {"INPUT", 5, TYPE_BLACK},
+    {"LEGACYDOMACTIVATE", 17, TYPE_BLACK},
+    {"WEBKITKEYERROR", 14, TYPE_BLACK},
+    {"POINTERLOCKERROR", 16, TYPE_BLACK},
+    {"LEGACYMOUSEPIXELSCROLL", 22, TYPE_BLACK},
+    {"TRACK", 5, TYPE_BLACK},
+    {"END", 3, TYPE_BLACK},
+    {"WEBKITFULLSCREENCHANGE", 22, TYPE_BLACK},
+    {"DOMNODEREMOVED", 14, TYPE_BLACK},
+    {"KEYUP", 5, TYPE_BLACK},
+    {"ENTERPICTUREINPICTURE", 21, TYPE_BLACK},
+    {"WRITE", 5, TYPE_BLACK},
+    {"CONNECT", 7, TYPE_BLACK},
+    {"TOUCHSTART", 10, TYPE_BLACK},
+    {"REDRAW", 6, TYPE_BLACK},
+    {"RATECHANGE", 10, TYPE_BLACK},
+    {"LOSTPOINTERCAPTURE", 18, TYPE_BLACK},
+    {"SHIPPINGADDRESSCHANGE", 21, TYPE_BLACK},
+    {"WEBKITMOUSEFORCEWILLBEGIN", 25, TYPE_BLACK},
+    {"MOZVISUALRESIZE", 15, TYPE_BLACK},
+    {"STORAGE", 7, TYPE_BLACK},
+    {"COOKIECHANGE", 12, TYPE_BLACK},
+    {"SMILREPEATEVENT", 15, TYPE_BLACK},
+    {"WEBKITNETWORKINFOCHANGE", 23, TYPE_BLACK},
+    {"LOADEDDATA", 10, TYPE_BLACK},
+    {"TOGGLE", 6, TYPE_BLACK},
+    {"WRITEEND", 8, TYPE_BLACK},
+    {"ERROR", 5, TYPE_BLACK},
+    {"GAMEPADDISCONNECTED", 19, TYPE_BLACK},
+    {"FORMRESET", 9, TYPE_BLACK},
+    {"MAGNIFYGESTURESTART", 19, TYPE_BLACK},
+    {"OFFLINE", 7, TYPE_BLACK},
+    {"WEBKITCURRENTPLAYBACKTARGETISWIRELESSCHANGED", 44, TYPE_BLACK},
+    {"DOWNLOADING", 11, TYPE_BLACK},
+    {"ANIMATIONITERATION", 18, TYPE_BLACK},
+    {"XULPOPUPSHOWING", 15, TYPE_BLACK},
+    {"PAYERDETAILCHANGE", 17, TYPE_BLACK},
+    {"RESET", 5, TYPE_BLACK},
+    {"WEBKITBEFORETEXTINSERTED", 24, TYPE_BLACK},
+    {"DISPOSE", 7, TYPE_BLACK},
+    {"LEGACYTEXTINPUT", 15, TYPE_BLACK},
+    {"TEXTINPUT", 9, TYPE_BLACK},
+    {"BEFOREMATCH", 11, TYPE_BLACK},
+    {"UPDATEEND", 9, TYPE_BLACK},
+    {"SEARCH", 6, TYPE_BLACK},
+    {"RESIZE", 6, TYPE_BLACK},
+    {"CONTEXTRESTORED", 15, TYPE_BLACK},
+    {"DEVICEORIENTATION", 17, TYPE_BLACK},
+    {"OVERFLOWCHANGED", 15, TYPE_BLACK},
+    {"LOADEND", 7, TYPE_BLACK},
+    {"MESSAGE", 7, TYPE_BLACK},
+    {"BEFORESCRIPTEXECUTE", 19, TYPE_BLACK},
+    {"MUTE", 4, TYPE_BLACK},
+    {"ICECANDIDATE", 12, TYPE_BLACK},
+    {"BEFOREINPUT", 11, TYPE_BLACK},
+    {"SQUEEZE", 7, TYPE_BLACK},
+    {"RESOURCETIMINGBUFFERFULL", 24, TYPE_BLACK},
+    {"COUPONCODECHANGED", 17, TYPE_BLACK},
+    {"CONFIGURATIONCHANGE", 19, TYPE_BLACK},
+    {"COMPOSITIONSTART", 16, TYPE_BLACK},
+    {"MOUSEMOVE", 9, TYPE_BLACK},
+    {"FORMSELECT", 10, TYPE_BLACK},
+    {"ONLINE", 6, TYPE_BLACK},
+    {"DOMNODEINSERTEDINTODOCUMENT", 27, TYPE_BLACK},
+    {"DRAGEXIT", 8, TYPE_BLACK},
+    {"BEFORETOGGLE", 12, TYPE_BLACK},
+    {"DRAGSTART", 9, TYPE_BLACK},
+    {"REMOVE", 6, TYPE_BLACK},
+    {"MOUSEDOWN", 9, TYPE_BLACK},
+    {"BEFOREPRINT", 11, TYPE_BLACK},
+    {"WEBKITASSOCIATEFORMCONTROLS", 27, TYPE_BLACK},
+    {"ACTIVE", 6, TYPE_BLACK},
+    {"REJECTIONHANDLED", 16, TYPE_BLACK},
+    {"WHEEL", 5, TYPE_BLACK},
+    {"SUBMIT", 6, TYPE_BLACK},
+    {"WEBGLCONTEXTLOST", 16, TYPE_BLACK},
+    {"RELEASE", 7, TYPE_BLACK},
+    {"BEFORECUT", 9, TYPE_BLACK},
+    {"NAVIGATESUCCESS", 15, TYPE_BLACK},
+    {"SELECTEND", 9, TYPE_BLACK},
+    {"TOUCHMOVE", 9, TYPE_BLACK},
+    {"WEBKITANIMATIONEND", 18, TYPE_BLACK},
+    {"SHIPPINGOPTIONCHANGE", 20, TYPE_BLACK},
+    {"DISCONNECT", 10, TYPE_BLACK},
+    {"CANCEL", 6, TYPE_BLACK},
+    {"REPEAT", 6, TYPE_BLACK},
+    {"ADDSTREAM", 9, TYPE_BLACK},
+    {"GESTURESCROLLEND", 16, TYPE_BLACK},
+    {"UPDATESTART", 11, TYPE_BLACK},
+    {"PAYMENTAUTHORIZED", 17, TYPE_BLACK},
+    {"ICECONNECTIONSTATECHANGE", 24, TYPE_BLACK},
+    {"DOMACTIVATE", 11, TYPE_BLACK},
+    {"FETCH", 5, TYPE_BLACK},
+    {"INPUTSOURCESCHANGE", 18, TYPE_BLACK},
+    {"RESULT", 6, TYPE_BLACK},
+    {"PASTE", 5, TYPE_BLACK},
+    {"FORMSUBMIT", 10, TYPE_BLACK},
+    {"LOADINGERROR", 12, TYPE_BLACK},
+    {"WEBKITKEYADDED", 14, TYPE_BLACK},
+    {"PUSHSUBSCRIPTIONCHANGE", 22, TYPE_BLACK},
+    {"ICECANDIDATEERROR", 17, TYPE_BLACK},
+    {"PRESSTAPGESTURE", 15, TYPE_BLACK},
+    {"MAGNIFYGESTURE", 14, TYPE_BLACK},
+};
+static const unsigned int xss_events_disp[] = {
+    56, 0, 21, 1, 1, 10, 0, 7, 46, 5, 0, 0, 6, 0, 62, 1, 30, 39, 35, 2, 0, 18,
+    1, 18, 18, 29, 11, 29, 19, 0, 0, 19, 14, 0, 0, 3, 16, 29, 3, 15, 22, 0, 1,
+    0, 68, 3, 3, 45, 15, 0, 7, 44, 72, 0, 0, 22, 10, 7, 0, 11, 0, 1, 34, 225,
+    33, 11, 27, 9, 48, 82, 21, 0, 39, 25, 27, 0, 73, 20, 12, 12, 1, 146, 3, 15,
+    127, 23, 7, 3, 0, 3, 47, 47, 22, 8, 220, 7, 15, 0, 25, 54, 17, 173, 16, 0,
+    6, 30, 194, 66, 56, 28, 260, 5, 0, 176, 16, 84, 111, 188, 139, 41, 0, 5, 35,
+    87, 109, 14, 120, 58, 17, 1, 0, 179, 0, 500, 166, 48, 71, 0, 380, 151, 314,
+    5, 0, 5,
+};
+static const xss_table_t xss_events = {
+    xss_events_words, 432, xss_events_disp, 144};
+
+/* 1 if there is an event name of that length */
+static const unsigned char xss_event_lens[] = {
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+};
+
+static const xss_trie_t xss_urls[] = {
+    {'\0', 1, 3},
+    {'D', 4, 1},
+    {'J', 5, 1},
+    {'V', 6, 2},
+    {'A', 8, 1},
+    {'A', 9, 1},
+    {'B', 10, 1},
+    {'I', 11, 1},
+    {'T', 12, 1},
+    {'V', 13, 1},
+    {'S', 14, 1},
+    {'E', 15, 1},
+    {'A', 0, 0},
+    {'A', 0, 0},
+    {'C', 16, 1},
+    {'W', 17, 1},
+    {'R', 18, 1},
+    {'-', 19, 1},
+    {'I', 20, 1},
+    {'S', 21, 1},
+    {'P', 22, 1},
+    {'O', 23, 1},
+    {'T', 0, 0},
+    {'U', 24, 1},
+    {'R', 25, 1},
+    {'C', 26, 1},
+    {'E', 0, 0},
+};
+#else
+static const char *const BLACKTAG[] = {
+    "APPLET",
+    "BASE",
+    "COMMENT",
+    "EMBED",
+    "FRAME",
+    "FRAMESET",
+    "HANDLER",
+    "IFRAME",
+    "IMPORT",
+    "ISINDEX",
+    "LINK",
+    "LISTENER",
+    "META",
+    "NOSCRIPT",
+    "OBJECT",
+    "SCRIPT",
+    "STYLE",
+    "VMLFRAME",
+    "XML",
+    "XSS",
+    NULL};
+static const stringtype_t BLACKATTR[] = {
+    {"ACTION", TYPE_ATTR_URL},
+    {"ATTRIBUTENAME", TYPE_ATTR_INDIRECT},
+    {"BACKGROUND", TYPE_ATTR_URL},
+    {"BY", TYPE_ATTR_URL},
+    {"DATAFORMATAS", TYPE_BLACK},
+    {"DATASRC", TYPE_BLACK},
+    {"DYNSRC", TYPE_ATTR_URL},
+    {"FILTER", TYPE_STYLE},
+    {"FOLDER", TYPE_ATTR_URL},
+    {"FORMACTION", TYPE_ATTR_URL},
+    {"FROM", TYPE_ATTR_URL},
+    {"HANDLER", TYPE_ATTR_URL},
+    {"HREF", TYPE_ATTR_URL},
+    {"LOWSRC", TYPE_ATTR_URL},
+    {"POSTER", TYPE_ATTR_URL},
+    {"SRC", TYPE_ATTR_URL},
+    {"STYLE", TYPE_STYLE},
+    {"TO", TYPE_ATTR_URL},
+    {"VALUES", TYPE_ATTR_URL},
+    {"XLINK:HREF", TYPE_ATTR_URL},
+    {NULL, TYPE_NONE}};
+static const stringtype_t BLACKATTREVENT[] = {
+    {"ABORT", TYPE_BLACK},
+    {"ACCESSKEYNOTFOUND", TYPE_BLACK},
+    {"ACTIVATE", TYPE_BLACK},
+    {"ACTIVE", TYPE_BLACK},
+    {"ADDSOURCEBUFFER", TYPE_BLACK},
+    {"ADDSTREAM", TYPE_BLACK},
+    {"ADDTRACK", TYPE_BLACK},
+    {"AFTERPAINT", TYPE_BLACK},
+    {"AFTERPRINT", TYPE_BLACK},
+    {"AFTERSCRIPTEXECUTE", TYPE_BLACK},
+    {"ANIMATIONCANCEL", TYPE_BLACK},
+    {"ANIMATIONEND", TYPE_BLACK},
+    {"ANIMATIONITERATION", TYPE_BLACK},
+    {"ANIMATIONSTART", TYPE_BLACK},
+    {"AUDIOCOMPLETE", TYPE_BLACK},
+    {"AUDIOEND", TYPE_BLACK},
+    {"AUDIOPROCESS", TYPE_BLACK},
+    {"AUDIOSTART", TYPE_BLACK},
+    {"AUTOCOMPLETE", TYPE_BLACK},
+    {"AUTOCOMPLETEERROR", TYPE_BLACK},
+    {"AUXCLICK", TYPE_BLACK},
+    {"BACKGROUNDFETCHABORT", TYPE_BLACK},
+    {"BACKGROUNDFETCHCLICK", TYPE_BLACK},
+    {"BACKGROUNDFETCHFAIL", TYPE_BLACK},
+    {"BACKGROUNDFETCHSUCCESS", TYPE_BLACK},
+    {"BEFOREACTIVATE", TYPE_BLACK},
+    {"BEFORECOPY", TYPE_BLACK},
+    {"BEFORECUT", TYPE_BLACK},
+    {"BEFOREINPUT", TYPE_BLACK},
+    {"BEFORELOAD", TYPE_BLACK},
+    {"BEFOREMATCH", TYPE_BLACK},
+    {"BEFOREPASTE", TYPE_BLACK},
+    {"BEFOREPRINT", TYPE_BLACK},
+    {"BEFORESCRIPTEXECUTE", TYPE_BLACK},
+    {"BEFORETOGGLE", TYPE_BLACK},
+    {"BEFOREUNLOAD", TYPE_BLACK},
+    {"BEGINEVENT", TYPE_BLACK},
+    {"BLOCKED", TYPE_BLACK},
+    {"BLUR", TYPE_BLACK},
+    {"BOUNDARY", TYPE_BLACK},
+    {"BUFFEREDAMOUNTLOW", TYPE_BLACK},
+    {"BUFFEREDCHANGE", TYPE_BLACK},
+    {"CACHED", TYPE_BLACK},
+    {"CANCEL", TYPE_BLACK},
+    {"CANPLAY", TYPE_BLACK},
+    {"CANPLAYTHROUGH", TYPE_BLACK},
+    {"CHANGE", TYPE_BLACK},
+    {"CHARGINGCHANGE", TYPE_BLACK},
+    {"CHARGINGTIMECHANGE", TYPE_BLACK},
+    {"CHECKING", TYPE_BLACK},
+    {"CLICK", TYPE_BLACK},
+    {"CLOSE", TYPE_BLACK},
+    {"CLOSING", TYPE_BLACK},
+    {"COMMAND", TYPE_BLACK},
+    {"COMPLETE", TYPE_BLACK},
+    {"COMPOSITIONCHANGE", TYPE_BLACK},
+    {"COMPOSITIONEND", TYPE_BLACK},
+    {"COMPOSITIONSTART", TYPE_BLACK},
+    {"COMPOSITIONUPDATE", TYPE_BLACK},
+    {"CONFIGURATIONCHANGE", TYPE_BLACK},
+    {"CONNECT", TYPE_BLACK},
+    {"CONNECTING", TYPE_BLACK},
+    {"CONNECTIONSTATECHANGE", TYPE_BLACK},
+    {"CONTENTVISIBILITYAUTOSTATECHANGE", TYPE_BLACK},
+    {"CONTEXTLOST", TYPE_BLACK},
+    {"CONTEXTMENU", TYPE_BLACK},
+    {"CONTEXTRESTORED", TYPE_BLACK},
+    {"CONTROLLERCHANGE", TYPE_BLACK},
+    {"COOKIECHANGE", TYPE_BLACK},
+    {"COORDINATORSTATECHANGE", TYPE_BLACK},
+    {"COPY", TYPE_BLACK},
+    {"COUPONCODECHANGED", TYPE_BLACK},
+    {"CUECHANGE", TYPE_BLACK},
+    {"CURRENTENTRYCHANGE", TYPE_BLACK},
+    {"CUT", TYPE_BLACK},
+    {"DATAAVAILABLE", TYPE_BLACK},
+    {"DATACHANNEL", TYPE_BLACK},
+    {"DBLCLICK", TYPE_BLACK},
+    {"DEQUEUE", TYPE_BLACK},
+    {"DEVICECHANGE", TYPE_BLACK},
+    {"DEVICELIGHT", TYPE_BLACK},
+    {"DEVICEMOTION", TYPE_BLACK},
+    {"DEVICEORIENTATION", TYPE_BLACK},
+    {"DEVICEORIENTATIONABSOLUTE", TYPE_BLACK},
+    {"DISCHARGINGTIMECHANGE", TYPE_BLACK},
+    {"DISCONNECT", TYPE_BLACK},
+    {"DISPOSE", TYPE_BLACK},
+    {"DOMACTIVATE", TYPE_BLACK},
+    {"DOMCHARACTERDATAMODIFIED", TYPE_BLACK},
+    {"DOMCONTENTLOADED", TYPE_BLACK},
+    {"DOMNODEINSERTED", TYPE_BLACK},
+    {"DOMNODEINSERTEDINTODOCUMENT", TYPE_BLACK},
+    {"DOMNODEREMOVED", TYPE_BLACK},
+    {"DOMNODEREMOVEDFROMDOCUMENT", TYPE_BLACK},
+    {"DOMSUBTREEMODIFIED", TYPE_BLACK},
+    {"DOWNLOADING", TYPE_BLACK},
+    {"DRAG", TYPE_BLACK},
+    {"DRAGEND", TYPE_BLACK},
+    {"DRAGENTER", TYPE_BLACK},
+    {"DRAGEXIT", TYPE_BLACK},
+    {"DRAGLEAVE", TYPE_BLACK},
+    {"DRAGOVER", TYPE_BLACK},
+    {"DRAGSTART", TYPE_BLACK},
+    {"DROP", TYPE_BLACK},
+    {"DURATIONCHANGE", TYPE_BLACK},
+    {"EDGEUICANCELED", TYPE_BLACK},
+    {"EDGEUICOMPLETED", TYPE_BLACK},
+    {"EDGEUISTARTED", TYPE_BLACK},
+    {"EDITORBEFOREINPUT", TYPE_BLACK},
+    {"EDITORINPUT", TYPE_BLACK},
+    {"EMPTIED", TYPE_BLACK},
+    {"ENCRYPTED", TYPE_BLACK},
+    {"END", TYPE_BLACK},
+    {"ENDED", TYPE_BLACK},
+    {"ENDEVENT", TYPE_BLACK},
+    {"ENDSTREAMING", TYPE_BLACK},
+    {"ENTER", TYPE_BLACK},
+    {"ENTERPICTUREINPICTURE", TYPE_BLACK},
+    {"ERROR", TYPE_BLACK},
+    {"EXIT", TYPE_BLACK},
+    {"FENCEDTREECLICK", TYPE_BLACK},
+    {"FETCH", TYPE_BLACK},
+    {"FINISH", TYPE_BLACK},
+    {"FOCUS", TYPE_BLACK},
+    {"FOCUSIN", TYPE_BLACK},
+    {"FOCUSOUT", TYPE_BLACK},
+    {"FORMCHANGE", TYPE_BLACK},
+    {"FORMCHECKBOXSTATECHANGE", TYPE_BLACK},
+    {"FORMDATA", TYPE_BLACK},
+    {"FORMINVALID", TYPE_BLACK},
+    {"FORMRADIOSTATECHANGE", TYPE_BLACK},
+    {"FORMRESET", TYPE_BLACK},
+    {"FORMSELECT", TYPE_BLACK},
+    {"FORMSUBMIT", TYPE_BLACK},
+    {"FULLSCREENCHANGE", TYPE_BLACK},
+    {"FULLSCREENERROR", TYPE_BLACK},
+    {"GAMEPADAXISMOVE", TYPE_BLACK},
+    {"GAMEPADBUTTONDOWN", TYPE_BLACK},
+    {"GAMEPADBUTTONUP", TYPE_BLACK},
+    {"GAMEPADCONNECTED", TYPE_BLACK},
+    {"GAMEPADDISCONNECTED", TYPE_BLACK},
+    {"GATHERINGSTATECHANGE", TYPE_BLACK},
+    {"GESTURECHANGE", TYPE_BLACK},
+    {"GESTUREEND", TYPE_BLACK},
+    {"GESTURESCROLLEND", TYPE_BLACK},
+    {"GESTURESCROLLSTART", TYPE_BLACK},
+    {"GESTURESCROLLUPDATE", TYPE_BLACK},
+    {"GESTURESTART", TYPE_BLACK},
+    {"GESTURETAP", TYPE_BLACK},
+    {"GESTURETAPDOWN", TYPE_BLACK},
+    {"GOTPOINTERCAPTURE", TYPE_BLACK},
+    {"HASHCHANGE", TYPE_BLACK},
+    {"ICECANDIDATE", TYPE_BLACK},
+    {"ICECANDIDATEERROR", TYPE_BLACK},
+    {"ICECONNECTIONSTATECHANGE", TYPE_BLACK},
+    {"ICEGATHERINGSTATECHANGE", TYPE_BLACK},
+    {"IMAGEABORT", TYPE_BLACK},
+    {"INACTIVE", TYPE_BLACK},
+    {"INPUT", TYPE_BLACK},
+    {"INPUTSOURCESCHANGE", TYPE_BLACK},
+    {"INSTALL", TYPE_BLACK},
+    {"INVALID", TYPE_BLACK},
+    {"INVOKE", TYPE_BLACK},
+    {"KEYDOWN", TYPE_BLACK},
+    {"KEYPRESS", TYPE_BLACK},
+    {"KEYSTATUSESCHANGE", TYPE_BLACK},
+    {"KEYUP", TYPE_BLACK},
+    {"LANGUAGECHANGE", TYPE_BLACK},
+    {"LEAVEPICTUREINPICTURE", TYPE_BLACK},
+    {"LEGACYATTRMODIFIED", TYPE_BLACK},
+    {"LEGACYCHARACTERDATAMODIFIED", TYPE_BLACK},
+    {"LEGACYDOMACTIVATE", TYPE_BLACK},
+    {"LEGACYDOMFOCUSIN", TYPE_BLACK},
+    {"LEGACYDOMFOCUSOUT", TYPE_BLACK},
+    {"LEGACYMOUSELINEORPAGESCROLL", TYPE_BLACK},
+    {"LEGACYMOUSEPIXELSCROLL", TYPE_BLACK},
+    {"LEGACYNODEINSERTED", TYPE_BLACK},
+    {"LEGACYNODEINSERTEDINTODOCUMENT", TYPE_BLACK},
+    {"LEGACYNODEREMOVED", TYPE_BLACK},
+    {"LEGACYNODEREMOVEDFROMDOCUMENT", TYPE_BLACK},
+    {"LEGACYSUBTREEMODIFIED", TYPE_BLACK},
+    {"LEGACYTEXTINPUT", TYPE_BLACK},
+    {"LEVELCHANGE", TYPE_BLACK},
+    {"LOAD", TYPE_BLACK},
+    {"LOADEDDATA", TYPE_BLACK},
+    {"LOADEDMETADATA", TYPE_BLACK},
+    {"LOADEND", TYPE_BLACK},
+    {"LOADING", TYPE_BLACK},
+    {"LOADINGDONE", TYPE_BLACK},
+    {"LOADINGERROR", TYPE_BLACK},
+    {"LOADSTART", TYPE_BLACK},
+    {"LOSTPOINTERCAPTURE", TYPE_BLACK},
+    {"MAGNIFYGESTURE", TYPE_BLACK},
+    {"MAGNIFYGESTURESTART", TYPE_BLACK},
+    {"MAGNIFYGESTUREUPDATE", TYPE_BLACK},
+    {"MARK", TYPE_BLACK},
+    {"MEDIARECORDERDATAAVAILABLE", TYPE_BLACK},
+    {"MEDIARECORDERSTOP", TYPE_BLACK},
+    {"MEDIARECORDERWARNING", TYPE_BLACK},
+    {"MERCHANTVALIDATION", TYPE_BLACK},
+    {"MESSAGE", TYPE_BLACK},
+    {"MESSAGEERROR", TYPE_BLACK},
+    {"MOUSEDOUBLECLICK", TYPE_BLACK},
+    {"MOUSEDOWN", TYPE_BLACK},
+    {"MOUSEENTER", TYPE_BLACK},
+    {"MOUSEEXPLOREBYTOUCH", TYPE_BLACK},
+    {"MOUSEHITTEST", TYPE_BLACK},
+    {"MOUSELEAVE", TYPE_BLACK},
+    {"MOUSELONGTAP", TYPE_BLACK},
+    {"MOUSEMOVE", TYPE_BLACK},
+    {"MOUSEOUT", TYPE_BLACK},
+    {"MOUSEOVER", TYPE_BLACK},
+    {"MOUSEUP", TYPE_BLACK},
+    {"MOUSEWHEEL", TYPE_BLACK},
+    {"MOZFULLSCREENCHANGE", TYPE_BLACK},
+    {"MOZFULLSCREENERROR", TYPE_BLACK},
+    {"MOZPOINTERLOCKCHANGE", TYPE_BLACK},
+    {"MOZPOINTERLOCKERROR", TYPE_BLACK},
+    {"MOZVISUALRESIZE", TYPE_BLACK},
+    {"MOZVISUALSCROLL", TYPE_BLACK},
+    {"MUTE", TYPE_BLACK},
+    {"NAVIGATE", TYPE_BLACK},
+    {"NAVIGATEERROR", TYPE_BLACK},
+    {"NAVIGATESUCCESS", TYPE_BLACK},
+    {"NEGOTIATIONNEEDED", TYPE_BLACK},
+    {"NEXTTRACK", TYPE_BLACK},
+    {"NOMATCH", TYPE_BLACK},
+    {"NOTIFICATIONCLICK", TYPE_BLACK},
+    {"NOTIFICATIONCLOSE", TYPE_BLACK},
+    {"NOUPDATE", TYPE_BLACK},
+    {"OBSOLETE", TYPE_BLACK},
+    {"OFFLINE", TYPE_BLACK},
+    {"ONLINE", TYPE_BLACK},
+    {"OPEN", TYPE_BLACK},
+    {"ORIENTATIONCHANGE", TYPE_BLACK},
+    {"OVERFLOWCHANGED", TYPE_BLACK},
+    {"OVERSCROLL", TYPE_BLACK},
+    {"PAGEHIDE", TYPE_BLACK},
+    {"PAGEREVEAL", TYPE_BLACK},
+    {"PAGESHOW", TYPE_BLACK},
+    {"PAGESWAP", TYPE_BLACK},
+    {"PASTE", TYPE_BLACK},
+    {"PAUSE", TYPE_BLACK},
+    {"PAYERDETAILCHANGE", TYPE_BLACK},
+    {"PAYMENTAUTHORIZED", TYPE_BLACK},
+    {"PAYMENTMETHODCHANGE", TYPE_BLACK},
+    {"PAYMENTMETHODSELECTED", TYPE_BLACK},
+    {"PLAY", TYPE_BLACK},
+    {"PLAYING", TYPE_BLACK},
+    {"POINTERAUXCLICK", TYPE_BLACK},
+    {"POINTERCANCEL", TYPE_BLACK},
+    {"POINTERCLICK", TYPE_BLACK},
+    {"POINTERDOWN", TYPE_BLACK},
+    {"POINTERENTER", TYPE_BLACK},
+    {"POINTERGOTCAPTURE", TYPE_BLACK},
+    {"POINTERLEAVE", TYPE_BLACK},
+    {"POINTERLOCKCHANGE", TYPE_BLACK},
+    {"POINTERLOCKERROR", TYPE_BLACK},
+    {"POINTERLOSTCAPTURE", TYPE_BLACK},
+    {"POINTERMOVE", TYPE_BLACK},
+    {"POINTEROUT", TYPE_BLACK},
+    {"POINTEROVER", TYPE_BLACK},
+    {"POINTERRAWUPDATE", TYPE_BLACK},
+    {"POINTERUP", TYPE_BLACK},
+    {"POPSTATE", TYPE_BLACK},
+    {"PRESSTAPGESTURE", TYPE_BLACK},
+    {"PREVIOUSTRACK", TYPE_BLACK},
+    {"PROCESSORERROR", TYPE_BLACK},
+    {"PROGRESS", TYPE_BLACK},
+    {"PROPERTYCHANGE", TYPE_BLACK},
+    {"PUSH", TYPE_BLACK},
+    {"PUSHNOTIFICATION", TYPE_BLACK},
+    {"PUSHSUBSCRIPTIONCHANGE", TYPE_BLACK},
+    {"QUALITYCHANGE", TYPE_BLACK},
+    {"RATECHANGE", TYPE_BLACK},
+    {"READYSTATECHANGE", TYPE_BLACK},
+    {"REDRAW", TYPE_BLACK},
+    {"REJECTIONHANDLED", TYPE_BLACK},
+    {"RELEASE", TYPE_BLACK},
+    {"REMOVE", TYPE_BLACK},
+    {"REMOVESOURCEBUFFER", TYPE_BLACK},
+    {"REMOVESTREAM", TYPE_BLACK},
+    {"REMOVETRACK", TYPE_BLACK},
+    {"REPEAT", TYPE_BLACK},
+    {"REPEATEVENT", TYPE_BLACK},
+    {"RESET", TYPE_BLACK},
+    {"RESIZE", TYPE_BLACK},
+    {"RESOURCETIMINGBUFFERFULL", TYPE_BLACK},
+    {"RESULT", TYPE_BLACK},
+    {"RESUME", TYPE_BLACK},
+    {"ROTATEGESTURE", TYPE_BLACK},
+    {"ROTATEGESTURESTART", TYPE_BLACK},
+    {"ROTATEGESTUREUPDATE", TYPE_BLACK},
+    {"RTCTRANSFORM", TYPE_BLACK},
+    {"SCROLL", TYPE_BLACK},
+    {"SCROLLEDAREACHANGED", TYPE_BLACK},
+    {"SCROLLEND", TYPE_BLACK},
+    {"SCROLLPORTOVERFLOW", TYPE_BLACK},
+    {"SCROLLPORTUNDERFLOW", TYPE_BLACK},
+    {"SCROLLSNAPCHANGE", TYPE_BLACK},
+    {"SCROLLSNAPCHANGING", TYPE_BLACK},
+    {"SEARCH", TYPE_BLACK},
+    {"SECURITYPOLICYVIOLATION", TYPE_BLACK},
+    {"SEEKED", TYPE_BLACK},
+    {"SEEKING", TYPE_BLACK},
+    {"SELECT", TYPE_BLACK},
+    {"SELECTEDCANDIDATEPAIRCHANGE", TYPE_BLACK},
+    {"SELECTEND", TYPE_BLACK},
+    {"SELECTIONCHANGE", TYPE_BLACK},
+    {"SELECTSTART", TYPE_BLACK},
+    {"SHIPPINGADDRESSCHANGE", TYPE_BLACK},
+    {"SHIPPINGCONTACTSELECTED", TYPE_BLACK},
+    {"SHIPPINGMETHODSELECTED", TYPE_BLACK},
+    {"SHIPPINGOPTIONCHANGE", TYPE_BLACK},
+    {"SHOW", TYPE_BLACK},
+    {"SIGNALINGSTATECHANGE", TYPE_BLACK},
+    {"SLOTCHANGE", TYPE_BLACK},
+    {"SMILBEGINEVENT", TYPE_BLACK},
+    {"SMILENDEVENT", TYPE_BLACK},
+    {"SMILREPEATEVENT", TYPE_BLACK},
+    {"SORT", TYPE_BLACK},
+    {"SOUNDEND", TYPE_BLACK},
+    {"SOUNDSTART", TYPE_BLACK},
+    {"SOURCECLOSE", TYPE_BLACK},
+    {"SOURCEENDED", TYPE_BLACK},
+    {"SOURCEOPEN", TYPE_BLACK},
+    {"SPEECHEND", TYPE_BLACK},
+    {"SPEECHSTART", TYPE_BLACK},
+    {"SQUEEZE", TYPE_BLACK},
+    {"SQUEEZEEND", TYPE_BLACK},
+    {"SQUEEZESTART", TYPE_BLACK},
+    {"STALLED", TYPE_BLACK},
+    {"START", TYPE_BLACK},
+    {"STARTED", TYPE_BLACK},
+    {"STARTSTREAMING", TYPE_BLACK},
+    {"STATECHANGE", TYPE_BLACK},
+    {"STOP", TYPE_BLACK},
+    {"STORAGE", TYPE_BLACK},
+    {"SUBMIT", TYPE_BLACK},
+    {"SUCCESS", TYPE_BLACK},
+    {"SUSPEND", TYPE_BLACK},
+    {"SVGLOAD", TYPE_BLACK},
+    {"SVGSCROLL", TYPE_BLACK},
+    {"SWIPEGESTURE", TYPE_BLACK},
+    {"SWIPEGESTUREEND", TYPE_BLACK},
+    {"SWIPEGESTUREMAYSTART", TYPE_BLACK},
+    {"SWIPEGESTURESTART", TYPE_BLACK},
+    {"SWIPEGESTUREUPDATE", TYPE_BLACK},
+    {"TAPGESTURE", TYPE_BLACK},
+    {"TEXTINPUT", TYPE_BLACK},
+    {"TIMEOUT", TYPE_BLACK},
+    {"TIMEUPDATE", TYPE_BLACK},
+    {"TOGGLE", TYPE_BLACK},
+    {"TONECHANGE", TYPE_BLACK},
+    {"TOUCHCANCEL", TYPE_BLACK},
+    {"TOUCHEND", TYPE_BLACK},
+    {"TOUCHFORCECHANGE", TYPE_BLACK},
+    {"TOUCHMOVE", TYPE_BLACK},
+    {"TOUCHSTART", TYPE_BLACK},
+    {"TRACK", TYPE_BLACK},
+    {"TRANSITIONCANCEL", TYPE_BLACK},
+    {"TRANSITIONEND", TYPE_BLACK},
+    {"TRANSITIONRUN", TYPE_BLACK},
+    {"TRANSITIONSTART", TYPE_BLACK},
+    {"UNCAPTUREDERROR", TYPE_BLACK},
+    {"UNHANDLEDREJECTION", TYPE_BLACK},
+    {"UNIDENTIFIEDEVENT", TYPE_BLACK},
+    {"UNLOAD", TYPE_BLACK},
+    {"UNMUTE", TYPE_BLACK},
+    {"UPDATE", TYPE_BLACK},
+    {"UPDATEEND", TYPE_BLACK},
+    {"UPDATEFOUND", TYPE_BLACK},
+    {"UPDATEREADY", TYPE_BLACK},
+    {"UPDATESTART", TYPE_BLACK},
+    {"UPGRADENEEDED", TYPE_BLACK},
+    {"USERPROXIMITY", TYPE_BLACK},
+    {"VALIDATEMERCHANT", TYPE_BLACK},
+    {"VERSIONCHANGE", TYPE_BLACK},
+    {"VISIBILITYCHANGE", TYPE_BLACK},
+    {"VOICESCHANGED", TYPE_BLACK},
+    {"VOLUMECHANGE", TYPE_BLACK},
+    {"VRDISPLAYACTIVATE", TYPE_BLACK},
+    {"VRDISPLAYCONNECT", TYPE_BLACK},
+    {"VRDISPLAYDEACTIVATE", TYPE_BLACK},
+    {"VRDISPLAYDISCONNECT", TYPE_BLACK},
+    {"VRDISPLAYPRESENTCHANGE", TYPE_BLACK},
+    {"WAITING", TYPE_BLACK},
+    {"WAITINGFORKEY", TYPE_BLACK},
+    {"WEBGLCONTEXTCREATIONERROR", TYPE_BLACK},
+    {"WEBGLCONTEXTLOST", TYPE_BLACK},
+    {"WEBGLCONTEXTRESTORED", TYPE_BLACK},
+    {"WEBKITANIMATIONEND", TYPE_BLACK},
+    {"WEBKITANIMATIONITERATION", TYPE_BLACK},
+    {"WEBKITANIMATIONSTART", TYPE_BLACK},
+    {"WEBKITASSOCIATEFORMCONTROLS", TYPE_BLACK},
+    {"WEBKITAUTOFILLREQUEST", TYPE_BLACK},
+    {"WEBKITBEFORETEXTINSERTED", TYPE_BLACK},
+    {"WEBKITBEGINFULLSCREEN", TYPE_BLACK},
+    {"WEBKITCURRENTPLAYBACKTARGETISWIRELESSCHANGED", TYPE_BLACK},
+    {"WEBKITENDFULLSCREEN", TYPE_BLACK},
+    {"WEBKITFULLSCREENCHANGE", TYPE_BLACK},
+    {"WEBKITFULLSCREENERROR", TYPE_BLACK},
+    {"WEBKITKEYADDED", TYPE_BLACK},
+    {"WEBKITKEYERROR", TYPE_BLACK},
+    {"WEBKITKEYMESSAGE", TYPE_BLACK},
+    {"WEBKITMEDIASESSIONMETADATACHANGED", TYPE_BLACK},
+    {"WEBKITMOUSEFORCECHANGED", TYPE_BLACK},
+    {"WEBKITMOUSEFORCEDOWN", TYPE_BLACK},
+    {"WEBKITMOUSEFORCEUP", TYPE_BLACK},
+    {"WEBKITMOUSEFORCEWILLBEGIN", TYPE_BLACK},
+    {"WEBKITNEEDKEY", TYPE_BLACK},
+    {"WEBKITNETWORKINFOCHANGE", TYPE_BLACK},
+    {"WEBKITPLAYBACKTARGETAVAILABILITYCHANGED", TYPE_BLACK},
+    {"WEBKITPRESENTATIONMODECHANGED", TYPE_BLACK},
+    {"WEBKITREMOVESOURCEBUFFER", TYPE_BLACK},
+    {"WEBKITSHADOWROOTATTACHED", TYPE_BLACK},
+    {"WEBKITSOURCECLOSE", TYPE_BLACK},
+    {"WEBKITSOURCEENDED", TYPE_BLACK},
+    {"WEBKITSOURCEOPEN", TYPE_BLACK},
+    {"WEBKITTRANSITIONEND", TYPE_BLACK},
+    {"WHEEL", TYPE_BLACK},
+    {"WRITE", TYPE_BLACK},
+    {"WRITEEND", TYPE_BLACK},
+    {"WRITESTART", TYPE_BLACK},
+    {"XULBROADCAST", TYPE_BLACK},
+    {"XULCOMMANDUPDATE", TYPE_BLACK},
+    {"XULPOPUPHIDDEN", TYPE_BLACK},
+    {"XULPOPUPHIDING", TYPE_BLACK},
+    {"XULPOPUPSHOWING", TYPE_BLACK},
+    {"XULPOPUPSHOWN", TYPE_BLACK},
+    {"XULSYSTEMSTATUSBARCLICK", TYPE_BLACK},
+    {"ZOOM", TYPE_BLACK},
+    {NULL, TYPE_NONE}};
+static const char *const BLACKURL[] = {
+    "DATA",
+    "JAVA",
+    "VBSCRIPT",
+    "VIEW-SOURCE",
+    NULL};
+#endif
+
+#endif
@@ -12,6 +12,454 @@ Converts a libinjection JSON data file to a C header (.h) file
 import sys
 
 
+#
+# Must match keyword_hash() and keyword_slot() in libinjection_sqli.c
+#
+FNV_BASIS = 2166136261
+FNV_PRIME = 16777619
+MASK32 = 0xFFFFFFFF
+
+
+def keyword_hash(key):
+    """ 32-bit FNV-1a over the upper-cased key """
+    h = FNV_BASIS
+    for ch in key.upper().encode('latin-1'):
+        h = ((h ^ ch) * FNV_PRIME) & MASK32
+    return h
+
+
+def keyword_slot(h, disp, size):
+    """ final slot of a key given its hash and its bucket displacement """
+    x = h ^ disp
+    x = ((x ^ (x >> 16)) * 0x45d9f3b) & MASK32
+    x = ((x ^ (x >> 16)) * 0x45d9f3b) & MASK32
+    x = x ^ (x >> 16)
+    return x % size
+
+
+def perfect_hash(keys):
+    """
+    Builds a minimal perfect hash over the keywords (hash and displace).
+
+    Keys are grouped into buckets by their hash.  Largest buckets
+    first, each bucket gets the smallest displacement that sends all
+    of its keys to free slots.  Returns the displacement table and the
+    keys in slot order.
+    """
+    size = len(keys)
+    nbuckets = max(1, size // 3)
+    buckets = [[] for _ in range(nbuckets)]
+    hashes = {}
+    for k in keys:
+        h = keyword_hash(k)
+        if h in hashes:
+            sys.stderr.write("ERROR: hash collision %s %s\n" % (k, hashes[h]))
+            sys.exit(1)
+        hashes[h] = k
+        buckets[h % nbuckets].append(h)
+
+    disp = [0] * nbuckets
+    slots = [None] * size
+    order = sorted(range(nbuckets), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if not buckets[b]:
+            continue
+        d = 0
+        while True:
+            pos = [keyword_slot(h, d, size) for h in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                break
+            d += 1
+        disp[b] = d
+        for h, p in zip(buckets[b], pos):
+            slots[p] = hashes[h]
+    return disp, slots
+
+
+def fingerprint_codes(fingerprints):
+    """
+    Fingerprints are matched case-insensitively.  Each upper-cased
+    token type gets a code 1..31, a bit in a 32-bit mask of the DFA
+    below.  0 is left for 'not a token type found in any fingerprint'.
+    """
+    alphabet = sorted(set(''.join(fingerprints).upper()))
+    if len(alphabet) > 31:
+        sys.stderr.write("ERROR: too many fingerprint token types\n")
+        sys.exit(1)
+    return dict((ch, i + 1) for i, ch in enumerate(alphabet))
+
+
+def fingerprint_dfa(fingerprints, codes):
+    """
+    DFA over token types that accepts exactly the fingerprints, case
+    insensitive.  It is the trie of the fingerprints: state n has a bit
+    for each code that leads somewhere in next[n], and bit 0 set if the
+    types so far are a fingerprint (0 is never a code).  States are
+    numbered breadth first, so the states after n are consecutive from
+    child[n], in code order.  A type with no bit is a dead end: no
+    fingerprint starts with the types so far.
+    """
+    fps = set(fp.upper() for fp in fingerprints)
+    for fp in fps:
+        if len(fp) > 5:
+            sys.stderr.write("ERROR: fingerprint %s too long\n" % (fp,))
+            sys.exit(1)
+    states = sorted(set(fp[:k] for fp in fps for k in range(len(fp) + 1)),
+                    key=lambda p: (len(p), [codes[ch] for ch in p]))
+    index = dict((prefix, n) for n, prefix in enumerate(states))
+    if len(states) > 0xFFFF:
+        sys.stderr.write("ERROR: too many fingerprint states\n")
+        sys.exit(1)
+    nexts = []
+    childs = []
+    for prefix in states:
+        bits = 1 if prefix in fps else 0
+        first = 0
+        for ch, code in sorted(codes.items(), key=lambda c: c[1]):
+            if prefix + ch in index:
+                bits |= 1 << code
+                if not first:
+                    first = index[prefix + ch]
+        nexts.append(bits)
+        childs.append(first)
+
+    # every path through the DFA is a prefix, and the accepting ones
+    # are the fingerprints and nothing else
+    accepted = set()
+    todo = [(0, '')]
+    while todo:
+        n, prefix = todo.pop()
+        if prefix != states[n]:
+            sys.stderr.write("ERROR: fingerprint DFA is broken\n")
+            sys.exit(1)
+        if nexts[n] & 1:
+            accepted.add(prefix)
+        k = 0
+        for ch, code in sorted(codes.items(), key=lambda c: c[1]):
+            if nexts[n] & (1 << code):
+                todo.append((childs[n] + k, prefix + ch))
+                k += 1
+    if accepted != fps:
+        sys.stderr.write("ERROR: fingerprint DFA is broken\n")
+        sys.exit(1)
+    return states, nexts, childs
+
+
+#
+# Guards a whitelist rule can use, see whitelist_rules.txt and
+# whitelist_guard() in libinjection_sqli.c.  0 is no guard.
+#
+WHITELIST_GUARDS = ['union', 'pair', 'bareword_comment', 'number_comment',
+                    'string_concat', 'short_logic', 'into']
+WHITELIST_SP_PASSWORD = 0x80
+WHITELIST_CASES = 32  # 1 << the longest fingerprint
+
+
+def whitelist_guards(states, nexts, rules):
+    """
+    The whitelist guards of each DFA state.  The states are upper-cased
+    fingerprints but the rules match types exactly, as the reference
+    whitelist does, so an accepting state has a guard for each way its
+    letters can be cased: bit i of the case is set if type i is lower
+    case.  A guard is that of the first rule matching the fingerprint,
+    with WHITELIST_SP_PASSWORD if the rule says sp_password.  Returns
+    the row of each state in the table of the WHITELIST_CASES guards
+    of each case, row 0 being all 0 for states that aren't accepting
+    or have no guard whatever the case.
+    """
+    for rule in rules:
+        if rule['guard'] is not None and \
+           rule['guard'] not in WHITELIST_GUARDS:
+            sys.stderr.write("ERROR: unknown whitelist guard %s\n" %
+                             (rule['guard'],))
+            sys.exit(1)
+
+    def matches(pattern, ch):
+        if pattern == '*':
+            return True
+        if pattern.startswith('!'):
+            return ch not in pattern[1:]
+        return ch in pattern
+
+    def guard(fingerprint):
+        for rule in rules:
+            if len(rule['tokens']) == len(fingerprint) and \
+               all(matches(p, ch) for p, ch in zip(rule['tokens'],
+                                                    fingerprint)):
+                g = 0
+                if rule['guard'] is not None:
+                    g = WHITELIST_GUARDS.index(rule['guard']) + 1
+                if rule['sp_password']:
+                    g |= WHITELIST_SP_PASSWORD
+                return g
+        return 0
+
+    table = [(0,) * WHITELIST_CASES]
+    rows = {table[0]: 0}
+    index = []
+    for n, prefix in enumerate(states):
+        row = table[0]
+        if nexts[n] & 1:
+            row = tuple(guard(''.join(ch.lower() if case & (1 << i) else ch
+                                      for i, ch in enumerate(prefix)))
+                        for case in range(WHITELIST_CASES))
+        if row not in rows:
+            rows[row] = len(table)
+            table.append(row)
+        index.append(rows[row])
+    if len(table) > 256:
+        sys.stderr.write("ERROR: too many whitelist guard rows\n")
+        sys.exit(1)
+    return index, [g for row in table for g in row]
+
+
+#
+# Byte classes scanned by the tokenizer, see libinjection_charclass.h
+#
+# These were strchr() sets in libinjection_sqli.c.  strchr() also
+# matches the terminating NUL, so '\0' has always been a member of
+# every set; it is added below to keep the token stream identical.
+#
+CHAR_CLASSES = [
+    ('white', ' \t\n\v\f\r\240'),
+    ('word_delim', ' []{}<>:\\?=@!#~+-*/&|^%(),\';\t\n\v\f\r"\240'),
+    ('var_delim', ' <>:\\?=@!#~+-*/&|^%(),\';\t\n\v\f\r\'`"'),
+    ('bin', '01'),
+    ('hex', '0123456789ABCDEFabcdef'),
+    ('money', '0123456789.,'),
+    ('alpha', 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ'),
+]
+
+
+def byte_ranges(members):
+    """ sorted byte values to a list of (lo, hi) inclusive ranges """
+    ranges = []
+    for b in sorted(members):
+        if ranges and ranges[-1][1] + 1 == b:
+            ranges[-1] = (ranges[-1][0], b)
+        else:
+            ranges.append((b, b))
+    return ranges
+
+
+def print_parse_dispatch(parsers):
+    """
+    Same mapping as char_parse_map, as a switch the compiler can turn
+    into a jump table with direct (and inlinable) calls.  The most
+    common parser becomes the default case.
+    """
+    groups = {}
+    order = []
+    for ch, fn in enumerate(parsers):
+        if fn not in groups:
+            groups[fn] = []
+            order.append(fn)
+        groups[fn].append(ch)
+    default = max(order, key=lambda fn: len(groups[fn]))
+
+    print("static size_t parse_dispatch(sfilter *sf, unsigned char ch) {")
+    print("    switch (ch) {")
+    for fn in order:
+        if fn == default:
+            continue
+        for ch in groups[fn]:
+            print("    case %d:" % (ch,))
+        print("        return %s(sf);" % (fn,))
+    print("    default:")
+    print("        return %s(sf);" % (default,))
+    print("    }")
+    print("}")
+
+
+def print_byte_classes(prefix, classes):
+    """
+    lookup table and byte ranges for each (name, set of byte values),
+    as char_class_t prefix_name, eight classes share a table
+    """
+    nmaps = (len(classes) + 7) // 8
+    classmaps = [[0] * 256 for _ in range(nmaps)]
+    mapnames = [prefix + "map"] + \
+        ["%smap%d" % (prefix, n) for n in range(1, nmaps)]
+    for bit, (name, members) in enumerate(classes):
+        for b in members:
+            classmaps[bit // 8][b] |= 1 << (bit % 8)
+
+    for mapname, classmap in zip(mapnames, classmaps):
+        print_uint_array(mapname, classmap, "unsigned char")
+    for bit, (name, members) in enumerate(classes):
+        ranges = byte_ranges(members)
+        print()
+        print("static const char_range_t %s%s_ranges[] = {" % (prefix, name))
+        for lo, hi in ranges:
+            print("    {0x%02X, 0x%02X}," % (lo, hi))
+        print("};")
+        print("static const char_class_t %s%s = {" % (prefix, name))
+        print("    %s, 0x%02X, %s%s_ranges, %d};" %
+              (mapnames[bit // 8], 1 << (bit % 8), prefix, name, len(ranges)))
+
+
+def print_char_classes(classes):
+    """ the tokenizer's classes, each with '\\0' as strchr() had it """
+    print_byte_classes("sql_char_class_",
+                       [(name, set([0] + [ord(ch) for ch in chars]))
+                        for name, chars in classes])
+
+
+#
+# Guards a fold rule can use, see fold_rules.txt and fold_guard() in
+# libinjection_sqli.c
+#
+FOLD_GUARDS = ['unary_op', 'arithmetic_op', 'merge_words', 'word_if',
+               'word_function', 'word_in', 'word_like', 'word_user',
+               'has_underscore', 'is_empty', 'is_cast']
+
+#
+# Flags in sql_keywords for the guards that look at a word, see
+# st_keyword_flags() in libinjection_sqli.c, and for parse_word():
+# dotted_head is what a keyword with a '.' has before one of them.
+#
+KEYWORD_FLAGS = {'word_function': 1, 'word_in': 2, 'word_like': 4,
+                 'word_user': 8, 'dotted_head': 16}
+
+
+def fold_pattern(pattern, classes):
+    """ token type pattern to the set of type classes it matches """
+    everything = set(range(len(classes) + 1))
+    if pattern == '*':
+        return everything
+    if pattern.startswith('!'):
+        return everything - set(classes[ch] for ch in pattern[1:])
+    return set(classes[ch] for ch in pattern)
+
+
+def print_fold_rules(rules):
+    """
+    Compiles the fold rules into a table.  Token types are numbered
+    1..n in the order they appear in the rules; types no rule names
+    share class 0.  For each stage, sql_fold_two and sql_fold_three
+    map the classes of tokenvec[left] and [left + 1] to a 0
+    terminated list of the rules that could match, in order, in
+    sql_fold_cands.  The third token is a bitmask of classes.
+    """
+    classes = {}
+    for rule in rules:
+        for pattern in rule['tokens']:
+            for ch in pattern.lstrip('!'):
+                if ch != '*' and ch not in classes:
+                    classes[ch] = len(classes) + 1
+    nclass = len(classes) + 1
+    if nclass > 32:
+        sys.stderr.write("ERROR: too many token types in fold rules\n")
+        sys.exit(1)
+
+    print("typedef enum {")
+    print("    FOLD_GUARD_NONE,")
+    for guard in FOLD_GUARDS:
+        print("    FOLD_GUARD_%s," % (guard.upper(),))
+    print("} fold_guard_t;")
+    print()
+    print("typedef enum { FOLD_LEFT_KEEP, FOLD_LEFT_ZERO, FOLD_LEFT_BACK } "
+          "fold_left_t;")
+    print()
+    print("typedef enum {")
+    print("    FOLD_NEXT_RESTART,")
+    print("    FOLD_NEXT_STOP,")
+    print("    FOLD_NEXT_EVIL")
+    print("} fold_next_t;")
+    print()
+    print("typedef struct {")
+    print("    unsigned int third; /* classes matching tokenvec[left + 2] */")
+    print("    unsigned char guard;")
+    print("    unsigned char set_at; /* tokenvec[left + set_at].type = "
+          "set_type */")
+    print("    char set_type;")
+    print("    unsigned char copy_to; /* tokenvec[left + copy_to] = "
+          "[left + copy_from] */")
+    print("    unsigned char copy_from;")
+    print("    unsigned char pos;")
+    print("    unsigned char folds;")
+    print("    unsigned char left;")
+    print("    unsigned char next;")
+    print("} fold_rule_t;")
+    print()
+
+    typemap = [0] * 256
+    for ch, cls in classes.items():
+        typemap[ord(ch)] = cls
+    print("#define SQL_FOLD_TYPES %d" % (nclass,))
+    print_uint_array("sql_fold_type", typemap, "unsigned char")
+    print()
+
+    if len(rules) > 255:
+        sys.stderr.write("ERROR: too many fold rules\n")
+        sys.exit(1)
+    print("static const fold_rule_t sql_fold_rules[] = {")
+    print("    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},")
+    for rule in rules:
+        if rule['guard'] is not None and rule['guard'] not in FOLD_GUARDS:
+            sys.stderr.write("ERROR: unknown fold guard %s\n" %
+                             (rule['guard'],))
+            sys.exit(1)
+        third = 0
+        if len(rule['tokens']) == 3:
+            for cls in fold_pattern(rule['tokens'][2], classes):
+                third |= 1 << cls
+        guard = 'FOLD_GUARD_NONE'
+        if rule['guard'] is not None:
+            guard = 'FOLD_GUARD_' + rule['guard'].upper()
+        set_at, set_type = rule['set'] or (0, None)
+        copy_to, copy_from = rule['copy'] or (0, 0)
+        print("    /* %s */" % (' '.join(rule['tokens']),))
+        print("    {0x%08XU, %s, %d, %s, %d, %d, %d, %d, FOLD_LEFT_%s,\n"
+              "     FOLD_NEXT_%s}," %
+              (third, guard, set_at,
+               repr(set_type) if set_type else '0',
+               copy_to, copy_from, rule['pos'], rule['folds'],
+               rule['left'].upper(), rule['next'].upper()))
+    print("};")
+    print()
+
+    cands = [0]
+    offsets = {(): 0}
+    for size, name in ((2, 'sql_fold_two'), (3, 'sql_fold_three')):
+        table = []
+        for c0 in range(nclass):
+            for c1 in range(nclass):
+                match = []
+                for num, rule in enumerate(rules, 1):
+                    if (len(rule['tokens']) == size and
+                            c0 in fold_pattern(rule['tokens'][0], classes) and
+                            c1 in fold_pattern(rule['tokens'][1], classes)):
+                        match.append(num)
+                match = tuple(match)
+                if match not in offsets:
+                    offsets[match] = len(cands)
+                    cands.extend(match + (0,))
+                table.append(offsets[match])
+        print_uint_array(name, table, "unsigned char")
+        print()
+
+    if len(cands) > 256:
+        sys.stderr.write("ERROR: too many fold rule lists\n")
+        sys.exit(1)
+    print_uint_array("sql_fold_cands", cands, "unsigned char")
+
+
+def print_uint_array(name, values, ctype="unsigned int"):
+    """ prints an unsigned int array, wrapped like clang-format would """
+    print("static const %s %s[] = {" % (ctype, name))
+    line = "   "
+    for v in values:
+        item = " %d," % (v,)
+        if len(line) + len(item) > 80:
+            print(line)
+            line = "   "
+        line += item
+    if line.strip():
+        print(line)
+    print("};")
+
+
 def toc(obj):
     """ main routine """
 
@@ -20,13 +468,21 @@ def toc(obj):
 #define LIBINJECTION_SQLI_DATA_H
 
 #include "libinjection.h"
+#include "libinjection_charclass.h"
 #include "libinjection_sqli.h"
 
 typedef struct {
     const char *word;
     char type;
+    unsigned char flags; /* KEYWORD_* */
+    unsigned short phrases; /* sql_phrases offset, 0 if none */
 } keyword_t;
 
+typedef struct {
+    unsigned short next; /* keyword id of what follows */
+    unsigned short phrase; /* keyword id of both together */
+} phrase_t;
+
 static size_t parse_money(sfilter * sf);
 static size_t parse_other(sfilter * sf);
 static size_t parse_white(sfilter * sf);
@@ -87,6 +543,7 @@ static size_t parse_bword(sfilter * sf);
         'CHAR_BWORD': 'parse_bword'
     }
     print()
+    print("#ifndef LIBINJECTION_SQLI_SWITCH_DISPATCH")
     print("typedef size_t (*pt2Function)(sfilter *sf);")
     print("static const pt2Function char_parse_map[] = {")
     pos = 0
@@ -94,16 +551,21 @@ static size_t parse_bword(sfilter * sf);
         print("  &%s, /* %d */" % (fnmap[character], pos))
         pos += 1
     print("};")
+    print("#else")
+    print_parse_dispatch([fnmap[c] for c in obj['charmap']])
+    print("#endif")
+    print()
+
+    # parse_white skips a whole run of the bytes the charmap sends it
+    blank = ''.join([chr(ch) for ch, c in enumerate(obj['charmap'])
+                     if c == 'CHAR_WHITE'])
+    print_char_classes(CHAR_CLASSES + [('blank', blank)])
     print()
 
     # keywords
     #  load them
     keywords = obj['keywords']
 
-    for fingerprint in list(obj['fingerprints']):
-        fingerprint = '0' + fingerprint.upper()
-        keywords[fingerprint] = 'F'
-
     needhelp = []
     for key in keywords.keys():
         if key != key.upper():
@@ -114,15 +576,133 @@ static size_t parse_bword(sfilter * sf);
         del keywords[key]
         keywords[key.upper()] = tmpv
 
-    print("static const keyword_t sql_keywords[] = {")
+    # the phrases, split every way into two parts, each looked up on
+    # its own.  Both parts get an entry, without a type if they are
+    # not keywords, so they are still barewords.
+    splits = []
     for k in sorted(keywords.keys()):
+        words = k.split(' ')
+        for n in range(1, len(words)):
+            splits.append((' '.join(words[:n]), ' '.join(words[n:]), k))
+
+    # flags for the fold guards that look for a word
+    flags = {}
+    for guard, words in obj['fold_words'].items():
+        for word in words:
+            flags[word] = flags.get(word, 0) | KEYWORD_FLAGS[guard]
+
+    # parse_word() gives up on a word once what it has so far can't be
+    # the start of a keyword, which relies on these
+    for k in list(keywords.keys()):
+        if '`' in k:
+            sys.stderr.write("ERROR: keyword with a backtick\n")
+            sys.exit(1)
+        for n, ch in enumerate(k):
+            if ch == '.':
+                head = k[:n]
+                flags[head] = flags.get(head, 0) | KEYWORD_FLAGS['dotted_head']
+
+    for k in [w for split in splits for w in split[:2]] + list(flags.keys()):
+        if k not in keywords:
+            keywords[k] = None
+
+    for k in keywords.keys():
         if len(k) > 31:
             sys.stderr.write("ERROR: keyword greater than 32 chars\n")
             sys.exit(1)
+        # sqli_benign_shape() in libinjection_sqli.c relies on this
+        if keywords[k] == 'X':
+            sys.stderr.write("ERROR: keyword %s is TYPE_EVIL\n" % (k,))
+            sys.exit(1)
 
-        print("    {\"%s\", '%s'}," % (k, keywords[k]))
+    disp, slots = perfect_hash(sorted(keywords.keys()))
+
+    # keyword ids are slot + 1, see st_keyword()
+    ids = dict((k, n + 1) for n, k in enumerate(slots))
+    phrases = [(0, 0)]
+    offsets = {}
+    for first in sorted(set(split[0] for split in splits)):
+        offsets[first] = len(phrases)
+        for head, rest, k in splits:
+            if head == first:
+                phrases.append((ids[rest], ids[k]))
+        phrases.append((0, 0))
+    if len(phrases) > 65535:
+        sys.stderr.write("ERROR: too many phrases\n")
+        sys.exit(1)
+
+    for name, bit in sorted(KEYWORD_FLAGS.items(), key=lambda item: item[1]):
+        print("#define KEYWORD_%s %d" % (name.upper(), bit))
+    print()
+    print("static const keyword_t sql_keywords[] = {")
+    for k in slots:
+        print("    {\"%s\", '%s', %d, %d}," % (k, keywords[k] or '\\0',
+                                              flags.get(k, 0),
+                                              offsets.get(k, 0)))
     print("};")
     print("static const size_t sql_keywords_sz = %d;" % (len(keywords),))
+    print()
+    print_uint_array("sql_keywords_disp", disp)
+    print("static const size_t sql_keywords_disp_sz = %d;" % (len(disp),))
+    print()
+
+    # for each word a phrase starts with, a 0 terminated list of what
+    # can follow it
+    print("static const phrase_t sql_phrases[] = {")
+    for nxt, phrase in phrases:
+        print("    {%d, %d}," % (nxt, phrase))
+    print("};")
+    print()
+
+    # fingerprints
+    #  a DFA over token types, and for LIBINJECTION_SQLI_REFERENCE_MATCH
+    #  the sorted list it was built from
+    codes = fingerprint_codes(obj['fingerprints'])
+    states, nexts, childs = fingerprint_dfa(obj['fingerprints'], codes)
+    guards, guard_rows = whitelist_guards(states, nexts, obj['whitelist'])
+
+    print()
+    charcodes = [0] * 256
+    for ch, code in codes.items():
+        charcodes[ord(ch)] = code
+        charcodes[ord(ch.lower())] = code
+    print_uint_array("sql_fingerprint_codes", charcodes, "unsigned char")
+    print()
+    print("#ifndef LIBINJECTION_SQLI_REFERENCE_MATCH")
+    print_uint_array("sql_fingerprint_next", nexts)
+    print()
+    print_uint_array("sql_fingerprint_child", childs, "unsigned short")
+    print()
+    print("typedef enum {")
+    print("    WHITELIST_NONE,")
+    for guard in WHITELIST_GUARDS:
+        print("    WHITELIST_%s," % (guard.upper(),))
+    print("} whitelist_guard_t;")
+    print()
+    print("#define WHITELIST_SP_PASSWORD 0x%02X" % (WHITELIST_SP_PASSWORD,))
+    print("#define WHITELIST_CASES %d" % (WHITELIST_CASES,))
+    print()
+    print_uint_array("sql_fingerprint_guard", guards, "unsigned char")
+    print()
+    print_uint_array("sql_whitelist_guard", guard_rows, "unsigned char")
+    print("#else")
+    fplist = sorted(set(fp.upper() for fp in obj['fingerprints']))
+    print("static const char *const sql_fingerprint_list[] = {")
+    line = "   "
+    for fp in fplist:
+        item = ' "%s",' % (fp.replace('\\', '\\\\'),)
+        if len(line) + len(item) > 80:
+            print(line)
+            line = "   "
+        line += item
+    print(line)
+    print("};")
+    print("static const size_t sql_fingerprint_list_sz = %d;" %
+          (len(fplist),))
+    print("#endif")
+    print()
+
+    print_fold_rules(obj['folds'])
 
     print("#endif")
     return 0
@@ -1548,16 +1548,131 @@ def get_fingerprints():
 
     return sorted(sqlipat)
 
+def parse_fold_rule(line):
+    """
+    one line of fold_rules.txt to a dict, see that file for the syntax
+    """
+    if '=>' not in line:
+        raise ValueError("missing '=>'")
+    match, actions = line.split('=>')
+    match = match.split()
+    guard = None
+    if 'if' in match:
+        if match.index('if') != len(match) - 2:
+            raise ValueError("'if' takes one guard")
+        guard = match[-1]
+        match = match[:-2]
+    if len(match) not in (2, 3):
+        raise ValueError("rules are for two or three tokens")
+
+    rule = {
+        'tokens': match,
+        'guard': guard,
+        'set': None,
+        'copy': None,
+        'pos': 0,
+        'folds': 0,
+        'left': 'keep',
+        'next': 'restart'
+    }
+    for action in actions.split():
+        if action.startswith('[') and '.type=' in action:
+            rule['set'] = [int(action[1]), action[len('[N].type='):]]
+        elif action.startswith('[') and '=[' in action:
+            rule['copy'] = [int(action[1]), int(action[5])]
+        elif action.startswith('pos-='):
+            rule['pos'] = int(action[len('pos-='):])
+        elif action.startswith('folds+='):
+            rule['folds'] = int(action[len('folds+='):])
+        elif action == 'left=0':
+            rule['left'] = 'zero'
+        elif action == 'left-=1':
+            rule['left'] = 'back'
+        elif action in ('stop', 'evil'):
+            rule['next'] = action
+        else:
+            raise ValueError("unknown action %s" % (action,))
+    return rule
+
+def get_fold_rules():
+    """
+    folding rules are stored in a plain text file, in order, with
+    comments.  Each rule is parsed here so mistakes show up early.
+    The same file lists the words some guards look for.
+    """
+    rules = []
+    words = {}
+    with open('fold_rules.txt', 'r') as lines:
+        for lineno, line in enumerate(lines, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            if line.startswith('word_') and '=>' not in line:
+                guard, word = line.split(None, 1)
+                words.setdefault(guard, []).append(word.upper())
+                continue
+            try:
+                rules.append(parse_fold_rule(line))
+            except ValueError as err:
+                raise ValueError("fold_rules.txt:%d: %s" % (lineno, err))
+    return rules, words
+
+def parse_whitelist_rule(line):
+    """
+    one line of whitelist_rules.txt to a dict, see that file for the
+    syntax
+    """
+    if '=>' not in line:
+        raise ValueError("missing '=>'")
+    match, actions = line.split('=>')
+    match = match.split()
+    if not 1 <= len(match) <= 5:
+        raise ValueError("fingerprints are one to five tokens")
+    rule = {
+        'tokens': match,
+        'sp_password': False,
+        'guard': None
+    }
+    for action in actions.split():
+        if action == 'sp_password':
+            rule['sp_password'] = True
+        elif rule['guard'] is None:
+            rule['guard'] = action
+        else:
+            raise ValueError("a rule has one guard")
+    return rule
+
+def get_whitelist_rules():
+    """
+    whitelist rules are stored in a plain text file, in order, with
+    comments
+    """
+    rules = []
+    with open('whitelist_rules.txt', 'r') as lines:
+        for lineno, line in enumerate(lines, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            try:
+                rules.append(parse_whitelist_rule(line))
+            except ValueError as err:
+                raise ValueError("whitelist_rules.txt:%d: %s" % (lineno, err))
+    return rules
+
 def dump():
     """
     generates a JSON file, sorted keys
     """
+    folds, fold_words = get_fold_rules()
     objs = {
         'keywords': KEYWORDS,
         'charmap': CHARMAP,
-        'fingerprints': get_fingerprints()
+        'fingerprints': get_fingerprints(),
+        'folds': folds,
+        'fold_words': fold_words,
+        'whitelist': get_whitelist_rules()
         }
-    return json.dumps(objs, sort_keys=True, indent=4)
+    return json.dumps(objs, sort_keys=True, indent=4, separators=(', ', ': '))
 
 if __name__ == '__main__':
     import sys
@@ -0,0 +1,7 @@
+#!/bin/sh
+#
+# The entry points that share or skip work against the plain calls,
+# on generated inputs and the sample inputs
+#
+set -e
+${VALGRIND} ./testequivalence ../data/*.txt
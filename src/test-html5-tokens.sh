@@ -0,0 +1,8 @@
+#!/bin/sh
+#
+# The table driven HTML5 tokenizer against the function per state one
+#
+set -e
+${VALGRIND} ./testhtml5tokens ../data/xss-*.txt > testhtml5tokens.log
+${VALGRIND} ./testhtml5tokenstable ../data/xss-*.txt > testhtml5tokenstable.log
+cmp testhtml5tokens.log testhtml5tokenstable.log
@@ -1,3 +1,5 @@
 #!/bin/sh
 set -e
 ${VALGRIND} ./testspeedsqli
+${VALGRIND} ./testspeedsqliswitch
+${VALGRIND} ./testlinearsqli
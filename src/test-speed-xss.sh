@@ -1,3 +1,4 @@
 #!/bin/sh
 set -e
 ${VALGRIND} ./testspeedxss
+${VALGRIND} ./testspeedxsstable
@@ -0,0 +1,8 @@
+#!/bin/sh
+#
+# The generated fingerprint DFA against the reference matcher
+#
+set -e
+${VALGRIND} ./testsqlidfa fingerprints.txt ../data/*.txt > testsqlidfa.log
+${VALGRIND} ./testsqlidfaref fingerprints.txt ../data/*.txt > testsqlidfaref.log
+cmp testsqlidfa.log testsqlidfaref.log
@@ -0,0 +1,8 @@
+#!/bin/sh
+#
+# The generated tag and attribute tables against the linear search
+#
+set -e
+${VALGRIND} ./testxsswords xss_words.txt ../data/*.txt > testxsswords.log
+${VALGRIND} ./testxsswordsref xss_words.txt ../data/*.txt > testxsswordsref.log
+cmp testxsswords.log testxsswordsref.log
@@ -0,0 +1,588 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * The entry points that share or skip work, against the calls they
+ * must agree with.  For random strings of SQL fragments, generated
+ * words and short strings, and every input line of the files given:
+ *
+ *   libinjection_sqli_fingerprint on a state another pass has used
+ *   gives what it gives on a fresh state,
+ *   libinjection_is_sqli gives the verdict and fingerprint of running
+ *   each pass on its own with libinjection_sqli_fingerprint,
+ *   libinjection_sqli_ex(FLAG_NONE) is libinjection_sqli, and its
+ *   match is what the last pass it ran gives alone,
+ *   each context of libinjection_is_sqli_report is what its pass
+ *   gives alone, and the verdict is libinjection_is_sqli's,
+ *   libinjection_sqli_batch gives what libinjection_sqli gives for
+ *   each input, whatever came before it,
+ *   libinjection_sqli_lanes_pack puts each input in its lane, and
+ *   libinjection_sqli_lanes_benign picks the lanes its documented rule
+ *   picks, none of them SQLi.
+ *
+ * For random strings of markup, short strings and the input lines,
+ * libinjection_xss gives what libinjection_is_xss gives in each
+ * context in turn.
+ *
+ * usage: testequivalence [input files...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libinjection.h"
+#include "libinjection_sqli.h"
+#include "libinjection_xss.h"
+#include "test_random.h"
+
+#define MAX_INPUTS 500000
+#define MAX_LINE 8192
+#define MAX_PARTS 12
+
+/*
+ * SQL fragments picked to hit the fold rules, the whitelist, comments
+ * and TYPE_EVIL
+ */
+static const test_piece_t parts[] = {
+    TEST_PIECE("1"), TEST_PIECE("12"), TEST_PIECE("'"), TEST_PIECE("\""),
+    TEST_PIECE("x"), TEST_PIECE("foo"), TEST_PIECE("USER"), TEST_PIECE("("),
+    TEST_PIECE(")"), TEST_PIECE("LIKE"), TEST_PIECE("NOT"), TEST_PIECE("IN"),
+    TEST_PIECE("UNION"), TEST_PIECE("ALL"), TEST_PIECE("SELECT"),
+    TEST_PIECE("{"), TEST_PIECE("}"), TEST_PIECE("``"), TEST_PIECE("`a`"),
+    TEST_PIECE("`"), TEST_PIECE("\\"), TEST_PIECE("::"), TEST_PIECE("-"),
+    TEST_PIECE("+"), TEST_PIECE("!"), TEST_PIECE(","), TEST_PIECE(";"),
+    TEST_PIECE("."), TEST_PIECE("#"), TEST_PIECE("--"), TEST_PIECE("-- "),
+    TEST_PIECE("--x"), TEST_PIECE("/*"), TEST_PIECE("*/"), TEST_PIECE("/*!"),
+    TEST_PIECE("IF"), TEST_PIECE("CHAR"), TEST_PIECE("@a"), TEST_PIECE("@@v"),
+    TEST_PIECE("DATABASE"), TEST_PIECE("_utf8"), TEST_PIECE("COLLATE"),
+    TEST_PIECE("INT"), TEST_PIECE("="), TEST_PIECE("OR"), TEST_PIECE("AND"),
+    TEST_PIECE("$1"), TEST_PIECE("0x1f"), TEST_PIECE("N'a'"), TEST_PIECE("IS"),
+    TEST_PIECE("DISTINCT"), TEST_PIECE("FROM"), TEST_PIECE("ORDER"),
+    TEST_PIECE("BY"), TEST_PIECE("a_b"), TEST_PIECE("LOCK"),
+    TEST_PIECE("SHARE"), TEST_PIECE("MODE"), TEST_PIECE("sp_password"),
+    TEST_PIECE("INTO"), TEST_PIECE("OUTFILE"), TEST_PIECE("%"),
+    TEST_PIECE("*"), TEST_PIECE("&&"), TEST_PIECE("current_user"),
+    TEST_PIECE("WAITFOR"), TEST_PIECE("DELAY"), TEST_PIECE(":"),
+    TEST_PIECE("?"), TEST_PIECE("1.5e3")};
+
+static const test_piece_t seps[] = {
+    TEST_PIECE(" "), TEST_PIECE(""), TEST_PIECE(""), TEST_PIECE("\n"),
+    TEST_PIECE("  "), TEST_PIECE("\t")};
+
+/*
+ * pieces of markup that move the HTML5 tokenizer between states
+ */
+static const test_piece_t markup[] = {
+    TEST_PIECE("<"), TEST_PIECE(">"), TEST_PIECE("/"), TEST_PIECE("="),
+    TEST_PIECE("'"), TEST_PIECE("\""), TEST_PIECE("`"), TEST_PIECE(" "),
+    TEST_PIECE("\t"), TEST_PIECE("\n"), TEST_PIECE("!"), TEST_PIECE("?"),
+    TEST_PIECE("-"), TEST_PIECE("<!--"), TEST_PIECE("-->"),
+    TEST_PIECE("<!DOCTYPE"), TEST_PIECE("<![CDATA["), TEST_PIECE("]]>"),
+    TEST_PIECE("</"), TEST_PIECE("/>"), TEST_PIECE("<?"), TEST_PIECE("a"),
+    TEST_PIECE("x"), TEST_PIECE("b"), TEST_PIECE("script"),
+    TEST_PIECE("onload"), TEST_PIECE("href"), TEST_PIECE("style"),
+    TEST_PIECE("xmlns"), TEST_PIECE("javascript:"), TEST_PIECE("data:"),
+    TEST_PIECE("&#106;"), TEST_PIECE("alert(1)"), TEST_PIECE("[if"),
+    TEST_PIECE("xml"), TEST_PIECE("import")};
+
+/*
+ * words the tokenizer treats specially, and bytes that start strings,
+ * numbers and words
+ */
+static const char *const words[] = {
+    "union", "SELECT", "or",   "AND",  "sleep", "user", "IF",   "IN",
+    "LIKE",  "NOT",    "DIV",  "null", "true",  "1e5",  "0x1F", "1union",
+    "N",     "X",      "U",    "b",    "e",     "q",    "Q",    "sp_password",
+    "_utf8", "a_b",    "1_",   "0b01", "9E9",   "1.5",  "a.b",  "a$b",
+    NULL};
+static const char word_starts[] = "0159aeAEnNqQuUxXbBzZ_.$@'\"`#-/*\\( \n";
+
+/*
+ * bytes the HTML5 tokenizer looks for, and a few that it doesn't
+ */
+static const char markup_bytes[] = "0aAxX<>/=!?-[]\"'`& \t\n\v\f\r\200";
+
+static const int sqli_flags[LIBINJECTION_SQLI_CONTEXTS] = {
+    FLAG_QUOTE_NONE | FLAG_SQL_ANSI, FLAG_QUOTE_NONE | FLAG_SQL_MYSQL,
+    FLAG_QUOTE_SINGLE | FLAG_SQL_ANSI, FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL,
+    FLAG_QUOTE_DOUBLE | FLAG_SQL_MYSQL};
+
+static const int xss_contexts[] = {DATA_STATE, VALUE_NO_QUOTE,
+                                   VALUE_SINGLE_QUOTE, VALUE_DOUBLE_QUOTE,
+                                   VALUE_BACK_QUOTE};
+
+/* the SQLi inputs, as the batch calls take them, and the copies */
+static const char *inputs[MAX_INPUTS];
+static char *copies[MAX_INPUTS];
+static size_t input_lens[MAX_INPUTS];
+static size_t ninputs = 0;
+
+static int failed = 0;
+
+static void add_input(const char *s, size_t len) {
+    if (ninputs == MAX_INPUTS) {
+        return;
+    }
+    copies[ninputs] = (char *)malloc(len + 1);
+    memcpy(copies[ninputs], s, len);
+    copies[ninputs][len] = '\0';
+    inputs[ninputs] = copies[ninputs];
+    input_lens[ninputs] = len;
+    ninputs += 1;
+}
+
+/*
+ * The shape check of libinjection_is_sqli relies on no fingerprint
+ * being a single token type, other than 'X'
+ */
+static void check_single_types(void) {
+    static const char types[] = "&(),.1:;\\{}ABETUXcfknostv?";
+    struct libinjection_sqli_state state;
+    size_t i;
+
+    for (i = 0; types[i] != '\0'; ++i) {
+        libinjection_sqli_init(&state, "1", 1, 0);
+        state.fingerprint[0] = types[i];
+        state.fingerprint[1] = '\0';
+        state.tokenvec[0].type = types[i];
+        if (libinjection_sqli_check_fingerprint(&state) != (types[i] == 'X')) {
+            printf("FAIL: fingerprint %c\n", types[i]);
+            failed = 1;
+        }
+    }
+}
+
+/*
+ * The passes in an order that starts anywhere, each after the one
+ * before it on the same state, against each pass alone on a fresh
+ * state
+ */
+static void check_reset(const char *s, size_t len) {
+    struct libinjection_sqli_state reused;
+    struct libinjection_sqli_state fresh;
+    const stoken_t *a;
+    const stoken_t *b;
+    int start = (int)(test_random() % LIBINJECTION_SQLI_CONTEXTS);
+    int stride = 1 + (int)(test_random() % (LIBINJECTION_SQLI_CONTEXTS - 1));
+    int flags;
+    int issqli;
+    size_t tlen;
+    size_t j;
+    int i;
+
+    libinjection_sqli_init(&reused, s, len, 0);
+    for (i = 0; i < LIBINJECTION_SQLI_CONTEXTS; ++i) {
+        flags = sqli_flags[(start + i * stride) % LIBINJECTION_SQLI_CONTEXTS];
+        libinjection_sqli_fingerprint(&reused, flags);
+        issqli = libinjection_sqli_check_fingerprint(&reused);
+        libinjection_sqli_init(&fresh, s, len, 0);
+        libinjection_sqli_fingerprint(&fresh, flags);
+        if (issqli != libinjection_sqli_check_fingerprint(&fresh) ||
+            strcmp(reused.fingerprint, fresh.fingerprint) != 0 ||
+            reused.reason != fresh.reason ||
+            reused.stats_comment_ddw != fresh.stats_comment_ddw ||
+            reused.stats_comment_ddx != fresh.stats_comment_ddx ||
+            reused.stats_comment_c != fresh.stats_comment_c ||
+            reused.stats_comment_hash != fresh.stats_comment_hash ||
+            reused.stats_folds != fresh.stats_folds ||
+            reused.stats_tokens != fresh.stats_tokens) {
+            printf("FAIL: \"%s\" flags %d: %s, fresh %s\n", s, flags,
+                   reused.fingerprint, fresh.fingerprint);
+            failed = 1;
+            continue;
+        }
+        tlen = strlen(fresh.fingerprint);
+        for (j = 0; j < tlen; ++j) {
+            a = libinjection_sqli_get_token(&reused, (int)j);
+            b = libinjection_sqli_get_token(&fresh, (int)j);
+            if (a->type != b->type || a->pos != b->pos || a->len != b->len ||
+                a->count != b->count || a->str_open != b->str_open ||
+                a->str_close != b->str_close || strcmp(a->val, b->val) != 0) {
+                printf("FAIL: \"%s\" flags %d: token %d\n", s, flags,
+                       (int)j);
+                failed = 1;
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * libinjection_is_sqli the long way, each pass on its own with
+ * libinjection_sqli_fingerprint.  fingerprint is that of the last pass.
+ */
+static int full_is_sqli(const char *s, size_t slen, char *fingerprint) {
+    struct libinjection_sqli_state state;
+    const int quotes[] = {FLAG_QUOTE_NONE, FLAG_QUOTE_SINGLE};
+    const char quote_chars[] = {'\0', '\''};
+    int i;
+
+    fingerprint[0] = '\0';
+    if (slen == 0) {
+        return 0;
+    }
+    libinjection_sqli_init(&state, s, slen, 0);
+    for (i = 0; i < 2; ++i) {
+        if (i > 0 && memchr(s, quote_chars[i], slen) == NULL) {
+            continue;
+        }
+        libinjection_sqli_fingerprint(&state, quotes[i] | FLAG_SQL_ANSI);
+        if (libinjection_sqli_check_fingerprint(&state)) {
+            strcpy(fingerprint, state.fingerprint);
+            return 1;
+        }
+        if (state.stats_comment_ddx || state.stats_comment_hash) {
+            libinjection_sqli_fingerprint(&state, quotes[i] | FLAG_SQL_MYSQL);
+            if (libinjection_sqli_check_fingerprint(&state)) {
+                strcpy(fingerprint, state.fingerprint);
+                return 1;
+            }
+        }
+    }
+    if (memchr(s, '"', slen) != NULL) {
+        libinjection_sqli_fingerprint(&state,
+                                      FLAG_QUOTE_DOUBLE | FLAG_SQL_MYSQL);
+        if (libinjection_sqli_check_fingerprint(&state)) {
+            strcpy(fingerprint, state.fingerprint);
+            return 1;
+        }
+    }
+    strcpy(fingerprint, state.fingerprint);
+    return 0;
+}
+
+static void check_is_sqli(const char *s, size_t len) {
+    struct libinjection_sqli_state state;
+    char fingerprint[LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    int full = full_is_sqli(s, len, fingerprint);
+    int issqli;
+
+    libinjection_sqli_init(&state, s, len, 0);
+    issqli = libinjection_is_sqli(&state);
+    if (issqli != full || strcmp(state.fingerprint, fingerprint) != 0) {
+        printf("FAIL: \"%s\": %d %s, each pass alone %d %s\n", s, issqli,
+               state.fingerprint, full, fingerprint);
+        failed = 1;
+    }
+}
+
+static void check_ex(const char *s, size_t len) {
+    struct libinjection_sqli_state state;
+    struct libinjection_sqli_state single;
+    char fingerprint[LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    injection_result_t expected = libinjection_sqli(s, len, fingerprint);
+    int issqli;
+    int last;
+
+    libinjection_sqli_init(&state, s, len, 0);
+    issqli = libinjection_sqli_ex(&state, FLAG_NONE);
+    if (issqli != (int)expected ||
+        (issqli && strcmp(state.fingerprint, fingerprint) != 0)) {
+        printf("FAIL: \"%s\": ex %d %s, libinjection_sqli %d %s\n", s, issqli,
+               state.fingerprint, (int)expected, fingerprint);
+        failed = 1;
+        return;
+    }
+    if (!issqli) {
+        return;
+    }
+
+    /* passes run in bit order, the match is the highest bit */
+    for (last = LIBINJECTION_SQLI_CONTEXTS - 1;
+         (state.passes & (1 << last)) == 0; --last) {
+    }
+    libinjection_sqli_init(&single, s, len, 0);
+    libinjection_sqli_fingerprint(&single, sqli_flags[last]);
+    if (!libinjection_sqli_check_fingerprint(&single) ||
+        strcmp(single.fingerprint, state.fingerprint) != 0) {
+        printf("FAIL: \"%s\": %s, pass %d alone %s\n", s, state.fingerprint,
+               1 << last, single.fingerprint);
+        failed = 1;
+    }
+}
+
+static void check_report(const char *s, size_t len) {
+    struct libinjection_sqli_state state;
+    struct libinjection_sqli_state single;
+    struct libinjection_sqli_report report;
+    const struct libinjection_sqli_context *context;
+    int issqli, expected;
+    int i;
+
+    libinjection_sqli_init(&state, s, len, 0);
+    issqli = libinjection_is_sqli_report(&state, &report);
+
+    for (i = 0; i < LIBINJECTION_SQLI_CONTEXTS; ++i) {
+        context = &report.contexts[i];
+        libinjection_sqli_init(&single, s, len, 0);
+        libinjection_sqli_fingerprint(&single, context->flags);
+        expected = libinjection_sqli_check_fingerprint(&single);
+        if (context->issqli != expected ||
+            context->reason != single.reason ||
+            strcmp(context->fingerprint, single.fingerprint) != 0) {
+            printf("FAIL: \"%s\" flags %d: %d %s %d, alone %d %s %d\n", s,
+                   context->flags, context->issqli, context->fingerprint,
+                   context->reason, expected, single.fingerprint,
+                   single.reason);
+            failed = 1;
+        }
+    }
+
+    libinjection_sqli_init(&single, s, len, 0);
+    expected = libinjection_is_sqli(&single);
+    if (issqli != expected) {
+        printf("FAIL: \"%s\": report says %d, libinjection_is_sqli %d\n", s,
+               issqli, expected);
+        failed = 1;
+    }
+}
+
+/*
+ * the rule libinjection_sqli_lanes_benign documents
+ */
+static int is_letter(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+static int is_benign_shape(const char *s, size_t len) {
+    int digits = 1;
+    int letters = len > 0 && is_letter(s[0]);
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        if (s[i] < '0' || s[i] > '9') {
+            digits = 0;
+            if (!is_letter(s[i]) && s[i] != '_') {
+                letters = 0;
+            }
+        }
+    }
+    return len > 0 && (digits || letters);
+}
+
+static void check_lanes(size_t first, size_t n) {
+    struct libinjection_sqli_lanes lanes;
+    char fingerprint[LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    unsigned int benign;
+    size_t count;
+    size_t lane, i;
+    const char *s;
+
+    count = libinjection_sqli_lanes_pack(&lanes, inputs + first,
+                                         input_lens + first, n);
+    for (lane = 0; lane < n && lane < LIBINJECTION_SQLI_LANES; ++lane) {
+        if (input_lens[first + lane] > LIBINJECTION_SQLI_LANE_BYTES) {
+            break;
+        }
+    }
+    if (count != lane || lanes.count != count) {
+        printf("FAIL: packed %d of %d, expected %d\n", (int)count, (int)n,
+               (int)lane);
+        failed = 1;
+        return;
+    }
+
+    benign = libinjection_sqli_lanes_benign(&lanes);
+    for (lane = 0; lane < count; ++lane) {
+        s = inputs[first + lane];
+        for (i = 0; i < lanes.width; ++i) {
+            if (lanes.bytes[i][lane] !=
+                (i < input_lens[first + lane] ? (unsigned char)s[i] : '0')) {
+                printf("FAIL: \"%s\" byte %d in lane %d\n", s, (int)i,
+                       (int)lane);
+                failed = 1;
+                break;
+            }
+        }
+        if (((benign >> lane) & 1) !=
+            (unsigned int)is_benign_shape(s, input_lens[first + lane])) {
+            printf("FAIL: \"%s\" lane %d benign %d\n", s, (int)lane,
+                   (int)((benign >> lane) & 1));
+            failed = 1;
+        }
+        if (((benign >> lane) & 1) &&
+            libinjection_sqli(s, input_lens[first + lane], fingerprint)) {
+            printf("FAIL: \"%s\" is benign by shape but SQLi %s\n", s,
+                   fingerprint);
+            failed = 1;
+        }
+    }
+    if (benign >> count) {
+        printf("FAIL: unused lanes are benign: %x\n", benign);
+        failed = 1;
+    }
+}
+
+static void check_batch(size_t first, size_t n) {
+    injection_result_t results[LIBINJECTION_SQLI_LANES + 3];
+    char fingerprints[(LIBINJECTION_SQLI_LANES + 3) *
+                      LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    char fingerprint[LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    injection_result_t issqli;
+    const char *batch_fp;
+    size_t found;
+    size_t expected = 0;
+    size_t i;
+
+    found = libinjection_sqli_batch(inputs + first, input_lens + first, n,
+                                    results, fingerprints);
+    for (i = 0; i < n; ++i) {
+        issqli = libinjection_sqli(inputs[first + i], input_lens[first + i],
+                                   fingerprint);
+        batch_fp = fingerprints + i * LIBINJECTION_SQLI_FINGERPRINT_SIZE;
+        if (issqli == LIBINJECTION_RESULT_TRUE) {
+            expected += 1;
+        }
+        if (results[i] != issqli || strcmp(batch_fp, fingerprint) != 0) {
+            printf("FAIL: \"%s\" after \"%s\": batch %d %s, alone %d %s\n",
+                   inputs[first + i], i > 0 ? inputs[first + i - 1] : "",
+                   (int)results[i], batch_fp, (int)issqli, fingerprint);
+            failed = 1;
+        }
+    }
+    if (found != expected) {
+        printf("FAIL: batch found %d, expected %d\n", (int)found,
+               (int)expected);
+        failed = 1;
+    }
+}
+
+static void check_xss(const char *s, size_t len) {
+    injection_result_t expected = LIBINJECTION_RESULT_FALSE;
+    injection_result_t result;
+    size_t i;
+
+    for (i = 0; i < sizeof(xss_contexts) / sizeof(xss_contexts[0]); ++i) {
+        expected = libinjection_is_xss(s, len, xss_contexts[i]);
+        if (expected != LIBINJECTION_RESULT_FALSE) {
+            break;
+        }
+    }
+    result = libinjection_xss(s, len);
+    if (result != expected) {
+        printf("FAIL: \"%.*s\": xss %d, contexts %d\n", (int)len, s,
+               (int)result, (int)expected);
+        failed = 1;
+    }
+}
+
+/*
+ * every string of up to max bytes from alphabet (all 256 bytes if
+ * alphabet is NULL)
+ */
+static void all_strings(char *buf, size_t len, size_t max,
+                        const char *alphabet, size_t nalphabet,
+                        void (*check)(const char *, size_t)) {
+    size_t i;
+
+    check(buf, len);
+    if (len == max) {
+        return;
+    }
+    for (i = 0; i < nalphabet; ++i) {
+        buf[len] = alphabet != NULL ? alphabet[i] : (char)i;
+        all_strings(buf, len + 1, max, alphabet, nalphabet, check);
+    }
+}
+
+static void generate(void) {
+    static const char word_bytes[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+    char buf[MAX_PARTS * 16];
+    size_t i, j, len;
+
+    for (i = 0; words[i] != NULL; ++i) {
+        add_input(words[i], strlen(words[i]));
+    }
+    all_strings(buf, 0, 2, NULL, 256, add_input);
+    all_strings(buf, 0, 3, word_starts, sizeof(word_starts) - 1, add_input);
+    for (i = 0; i < 20000; ++i) {
+        len = 1 + test_random() % (LIBINJECTION_SQLI_LANE_BYTES + 1);
+        for (j = 0; j < len; ++j) {
+            buf[j] = (i & 1) ? (char)('0' + test_random() % 10)
+                             : word_bytes[test_random() % 63];
+        }
+        add_input(buf, len);
+    }
+    for (i = 0; i < 100000; ++i) {
+        len = test_random_pieces(buf, MAX_PARTS, parts, TEST_PIECES(parts),
+                                 seps, TEST_PIECES(seps));
+        add_input(buf, len);
+    }
+}
+
+static void generate_markup(void) {
+    char buf[512];
+    size_t len;
+    int i;
+
+    all_strings(buf, 0, 2, NULL, 256, check_xss);
+    /* with the '\0' at the end of markup_bytes */
+    all_strings(buf, 0, 3, markup_bytes, sizeof(markup_bytes), check_xss);
+    for (i = 0; i < 300000; ++i) {
+        len = test_random_pieces(buf, 16, markup, TEST_PIECES(markup), NULL,
+                                 0);
+        check_xss(buf, len);
+    }
+}
+
+static int input_lines(const char *fname) {
+    char line[MAX_LINE];
+    size_t len;
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        len = strcspn(line, "\r\n");
+        add_input(line, len);
+        check_xss(line, len);
+    }
+    fclose(fd);
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    size_t i, n;
+    int k;
+
+    test_random_seed(12345);
+    check_single_types();
+    generate();
+    generate_markup();
+    for (k = 1; k < argc; ++k) {
+        if (input_lines(argv[k]) != 0) {
+            return 1;
+        }
+    }
+
+    for (i = 0; i < ninputs; ++i) {
+        check_reset(inputs[i], input_lens[i]);
+        check_is_sqli(inputs[i], input_lens[i]);
+        check_ex(inputs[i], input_lens[i]);
+        check_report(inputs[i], input_lens[i]);
+    }
+
+    /* odd sized groups, so lanes start anywhere and meet long inputs */
+    for (i = 0; i < ninputs; i += n) {
+        n = 1 + test_random() % (LIBINJECTION_SQLI_LANES + 3);
+        if (n > ninputs - i) {
+            n = ninputs - i;
+        }
+        check_lanes(i, n);
+        check_batch(i, n);
+    }
+
+    for (i = 0; i < ninputs; ++i) {
+        free(copies[i]);
+    }
+    if (failed) {
+        return 1;
+    }
+    fprintf(stderr, "%lu SQLi inputs\n", (unsigned long)ninputs);
+    printf("OK\n");
+    return 0;
+}
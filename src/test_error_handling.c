@@ -99,6 +99,30 @@ static void test_edge_cases(void) {
     TEST_END(result != LIBINJECTION_RESULT_ERROR);
 }
 
+/**
+ * Test the batch call's optional arguments
+ */
+static void test_sqli_batch(void) {
+    injection_result_t results[2];
+    const char *ptrs[2];
+    size_t lens[2];
+    size_t found;
+
+    ptrs[0] = "1' OR '1'='1";
+    lens[0] = strlen(ptrs[0]);
+    ptrs[1] = "hello";
+    lens[1] = strlen(ptrs[1]);
+
+    TEST_START("SQLi batch without fingerprints");
+    found = libinjection_sqli_batch(ptrs, lens, 2, results, NULL);
+    TEST_END(found == 1 && results[0] == LIBINJECTION_RESULT_TRUE &&
+             results[1] == LIBINJECTION_RESULT_FALSE);
+
+    TEST_START("Empty SQLi batch does nothing");
+    found = libinjection_sqli_batch(NULL, NULL, 0, NULL, NULL);
+    TEST_END(found == 0);
+}
+
 /**
  * Test HTML5 parser state handling
  */
@@ -115,6 +139,17 @@ static void test_html5_state_handling(void) {
     result = libinjection_h5_next(&hs);
     TEST_END(result != LIBINJECTION_RESULT_ERROR);
 
+    TEST_START("HTML5 parser rejects an uninitialized state");
+    memset(&hs, 0, sizeof(hs));
+    result = libinjection_h5_next(&hs);
+    TEST_END(result == LIBINJECTION_RESULT_ERROR);
+
+    TEST_START("HTML5 parser rejects a state out of range");
+    libinjection_h5_init(&hs, html, strlen(html), DATA_STATE);
+    hs.state = 1000;
+    result = libinjection_h5_next(&hs);
+    TEST_END(result == LIBINJECTION_RESULT_ERROR);
+
     TEST_START("HTML5 parser handles malformed tags");
     malformed = "<div<div>";
     libinjection_h5_init(&hs, malformed, strlen(malformed), DATA_STATE);
@@ -218,6 +253,7 @@ int main(void) {
 
     test_normal_inputs();
     test_edge_cases();
+    test_sqli_batch();
     test_html5_state_handling();
     test_no_abort_on_error();
     test_backward_compatibility();
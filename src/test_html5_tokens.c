@@ -0,0 +1,154 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * Prints the tokens the HTML5 tokenizer gives in each context.  It is
+ * built twice, as testhtml5tokens with the function per state core and
+ * as testhtml5tokenstable with the table driven core
+ * (LIBINJECTION_HTML5_STATE_TABLE), and test-html5-tokens.sh checks
+ * that both print the same thing.
+ *
+ * usage: testhtml5tokens [input files...]
+ *
+ * The inputs are every string of up to three bytes from the bytes the
+ * states decide on, every string of two and three markup pieces, and
+ * every input line of the files given.  Each token is printed with its
+ * type, offset and length and where the tokenizer is after it,
+ * position and state, then what the last call returned and what one
+ * more call returns.
+ * Last comes what libinjection_h5_next returns for a zeroed state and
+ * for states out of range, which must be LIBINJECTION_RESULT_ERROR.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libinjection.h"
+#include "libinjection_html5.h"
+#include "test_random.h"
+
+#define MAX_LINE 8192
+
+/*
+ * bytes of each class of html5_states.txt, and 0xFF
+ */
+static const char bytes[] = "<>/=!?-%[]\"'` \t\v\naD\377";
+
+/*
+ * pieces of markup that move the tokenizer between states, some with
+ * NULs in them
+ */
+static const test_piece_t pieces[] = {
+    TEST_PIECE("<"), TEST_PIECE(">"), TEST_PIECE("/"), TEST_PIECE("="),
+    TEST_PIECE("'"), TEST_PIECE("\""), TEST_PIECE("`"), TEST_PIECE(" "),
+    TEST_PIECE("\t"), TEST_PIECE("\n"), TEST_PIECE("!"), TEST_PIECE("?"),
+    TEST_PIECE("-"), TEST_PIECE("%"), TEST_PIECE("]"), TEST_PIECE("<!--"),
+    TEST_PIECE("-->"), TEST_PIECE("--!>"), TEST_PIECE("-\0->"),
+    TEST_PIECE("<!DOCTYPE"), TEST_PIECE("<!doctype"), TEST_PIECE("<![CDATA["),
+    TEST_PIECE("]]>"), TEST_PIECE("</"), TEST_PIECE("/>"), TEST_PIECE("<?"),
+    TEST_PIECE("<%"), TEST_PIECE("%>"), TEST_PIECE("a"), TEST_PIECE("x"),
+    TEST_PIECE("D"), TEST_PIECE("script"), TEST_PIECE("onload"),
+    TEST_PIECE("href"), TEST_PIECE("\0"), TEST_PIECE("\377"), TEST_PIECE("<a>"),
+    TEST_PIECE("</a "), TEST_PIECE("<a b=c>")};
+
+static const enum html5_flags contexts[] = {
+    DATA_STATE, VALUE_NO_QUOTE, VALUE_SINGLE_QUOTE, VALUE_DOUBLE_QUOTE,
+    VALUE_BACK_QUOTE};
+
+static unsigned long inputs = 0;
+
+static void print_tokens(const char *s, size_t len) {
+    h5_state_t h5;
+    injection_result_t result;
+    size_t i;
+
+    for (i = 0; i < sizeof(contexts) / sizeof(contexts[0]); ++i) {
+        libinjection_h5_init(&h5, s, len, contexts[i]);
+        while ((result = libinjection_h5_next(&h5)) ==
+               LIBINJECTION_RESULT_TRUE) {
+            printf(" %d:%lu+%lu@%lu/%d", (int)h5.token_type,
+                   (unsigned long)(h5.token_start - s),
+                   (unsigned long)h5.token_len, (unsigned long)h5.pos,
+                   h5.state);
+        }
+        printf(" %d", (int)result);
+        printf(" %d@%lu |", (int)libinjection_h5_next(&h5),
+               (unsigned long)h5.pos);
+    }
+    printf("\n");
+    inputs += 1;
+}
+
+static void all_strings(char *buf, size_t len, size_t max) {
+    size_t i;
+
+    print_tokens(buf, len);
+    if (len == max) {
+        return;
+    }
+    for (i = 0; i < sizeof(bytes); ++i) {
+        /* with the '\0' at the end of bytes */
+        buf[len] = bytes[i];
+        all_strings(buf, len + 1, max);
+    }
+}
+
+static void all_pieces(char *buf, size_t len, int depth) {
+    size_t i;
+
+    if (depth == 0) {
+        print_tokens(buf, len);
+        return;
+    }
+    for (i = 0; i < TEST_PIECES(pieces); ++i) {
+        memcpy(buf + len, pieces[i].s, pieces[i].len);
+        all_pieces(buf, len + pieces[i].len, depth - 1);
+    }
+}
+
+static int input_lines(const char *fname) {
+    char line[MAX_LINE];
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        print_tokens(line, strcspn(line, "\r\n"));
+    }
+    fclose(fd);
+    return 0;
+}
+
+static void bad_states(void) {
+    h5_state_t h5;
+    const int states[] = {-1, 1000};
+    size_t i;
+
+    memset(&h5, 0, sizeof(h5));
+    printf("zeroed %d\n", (int)libinjection_h5_next(&h5));
+    for (i = 0; i < sizeof(states) / sizeof(states[0]); ++i) {
+        libinjection_h5_init(&h5, "<a>", 3, DATA_STATE);
+        h5.state = states[i];
+        printf("state %d %d\n", states[i], (int)libinjection_h5_next(&h5));
+    }
+}
+
+int main(int argc, const char *argv[]) {
+    char buf[64];
+    int i;
+
+    all_strings(buf, 0, 3);
+    for (i = 2; i <= 3; ++i) {
+        all_pieces(buf, 0, i);
+    }
+    for (i = 1; i < argc; ++i) {
+        if (input_lines(argv[i]) != 0) {
+            return 1;
+        }
+    }
+    bad_states();
+    fprintf(stderr, "%lu inputs\n", inputs);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * Adversarial inputs for the string scanner: a quote, then runs of
+ * backslashes and quotes that keep that one string open to the end,
+ * so the scanner reads the whole input.  Prints how long one input 16
+ * times longer takes next to 16 copies of the short one; a linear scan
+ * gives a ratio near 1, a quadratic one near 16.  This is a benchmark,
+ * run by test-speed-sqli.sh; the tests/test-tokens-string-*.txt cases
+ * check what the scanner reads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libinjection.h"
+#include "libinjection_sqli.h"
+
+#define SMALL 32768
+#define GROWTH 16
+
+static char *make_input(const char *prefix, const char *pattern,
+                        size_t len) {
+    const size_t plen = strlen(prefix);
+    const size_t patlen = strlen(pattern);
+    char *s = (char *)malloc(len + 1);
+    size_t i;
+
+    if (s == NULL) {
+        return NULL;
+    }
+    memcpy(s, prefix, plen);
+    for (i = plen; i < len; ++i) {
+        s[i] = pattern[(i - plen) % patlen];
+    }
+    s[len] = '\0';
+    return s;
+}
+
+static double time_is_sqli(const char *s, size_t len, int times) {
+    sfilter sf;
+    clock_t t0;
+    int i;
+
+    t0 = clock();
+    for (i = 0; i < times; ++i) {
+        libinjection_sqli_init(&sf, s, len, FLAG_NONE);
+        libinjection_is_sqli(&sf);
+    }
+    return (double)(clock() - t0) / (double)CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    /*
+     * The prefix opens a string and every repeat of its pattern has
+     * an escaped or doubled quote, never one that closes it
+     */
+    const char *const prefixes[] = {"'", "'", "'", "'", "\"", "\"", "\"",
+                                    NULL};
+    const char *const patterns[] = {"\\'", "''", "\\\\\\'",
+                                    "\\\"\\'", "\\\"", "\"\"",
+                                    "\\\\\\\"", NULL};
+    const size_t large = SMALL * GROWTH;
+    double t_small;
+    double t_large;
+    double ratio;
+    char *small_input;
+    char *large_input;
+    int i;
+
+    for (i = 0; patterns[i] != NULL; ++i) {
+        small_input = make_input(prefixes[i], patterns[i], SMALL);
+        large_input = make_input(prefixes[i], patterns[i], large);
+        if (small_input == NULL || large_input == NULL) {
+            printf("FAIL: out of memory\n");
+            return 1;
+        }
+
+        t_small = time_is_sqli(small_input, SMALL, GROWTH);
+        t_large = time_is_sqli(large_input, large, 1);
+
+        /* 0 if too fast to measure */
+        ratio = (t_small > 0.0) ? t_large / t_small : 0.0;
+        printf("%-4s %-14s %8.4fs %8.4fs  x%.2f\n", prefixes[i], patterns[i],
+               t_small, t_large, ratio);
+
+        free(small_input);
+        free(large_input);
+    }
+
+    return 0;
+}
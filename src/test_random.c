@@ -0,0 +1,39 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ */
+
+#include <string.h>
+
+#include "test_random.h"
+
+static unsigned int seed = 1;
+
+void test_random_seed(unsigned int s) { seed = s; }
+
+unsigned int test_random(void) {
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static size_t append(char *buf, size_t len, const test_piece_t *piece) {
+    memcpy(buf + len, piece->s, piece->len);
+    return len + piece->len;
+}
+
+size_t test_random_pieces(char *buf, unsigned int max_count,
+                          const test_piece_t *pieces, size_t npieces,
+                          const test_piece_t *seps, size_t nseps) {
+    unsigned int count = 1 + test_random() % max_count;
+    unsigned int i;
+    size_t len = 0;
+
+    for (i = 0; i < count; ++i) {
+        len = append(buf, len, &pieces[test_random() % npieces]);
+        if (nseps != 0) {
+            len = append(buf, len, &seps[test_random() % nseps]);
+        }
+    }
+    buf[len] = '\0';
+    return len;
+}
@@ -0,0 +1,43 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * Random inputs for the tests.  The generator is a small LCG rather
+ * than rand() so each test sees the same inputs on every platform.
+ */
+
+#ifndef TEST_RANDOM_H
+#define TEST_RANDOM_H
+
+#include <stddef.h>
+
+/*
+ * A piece of input.  len is given, so pieces may hold NULs.
+ */
+typedef struct {
+    const char *s;
+    size_t len;
+} test_piece_t;
+
+#define TEST_PIECE(s) {s, sizeof(s) - 1}
+#define TEST_PIECES(a) (sizeof(a) / sizeof((a)[0]))
+
+void test_random_seed(unsigned int seed);
+
+/*
+ * 0 to 0x7FFF
+ */
+unsigned int test_random(void);
+
+/*
+ * Writes 1 to max_count pieces picked at random into buf, each
+ * followed by one of seps if nseps isn't 0, and a NUL.  buf must hold
+ * max_count of the longest piece and separator, and the NUL.
+ *
+ * Returns the length, without the NUL.
+ */
+size_t test_random_pieces(char *buf, unsigned int max_count,
+                          const test_piece_t *pieces, size_t npieces,
+                          const test_piece_t *seps, size_t nseps);
+
+#endif
@@ -10,18 +10,65 @@
 #include "libinjection.h"
 #include "libinjection_sqli.h"
 int testIsSQL(void);
+int testTokenize(void);
+int testBatch(const char *const *inputs);
+
+/*
+ * The tokenizer dispatch is picked at build time, see
+ * LIBINJECTION_SQLI_SWITCH_DISPATCH in libinjection_sqli.c.  Build
+ * this file both ways (testspeedsqli and testspeedsqliswitch) to
+ * compare them.
+ */
+#ifdef LIBINJECTION_SQLI_SWITCH_DISPATCH
+#define DISPATCH_NAME "switch"
+#else
+#define DISPATCH_NAME "table"
+#endif
+
+static const char *const s[] = {
+    "123 LIKE -1234.5678E+2;",
+    "APPLE 19.123 'FOO' \"BAR\"",
+    "/* BAR */ UNION ALL SELECT (2,3,4)",
+    "1 || COS(+0X04) --FOOBAR",
+    "dog apple @cat banana bar",
+    "dog apple cat \"banana \'bar",
+    "102 TABLE CLOTH",
+    "(1001-'1') union select 1,2,3,4 from credit_cards",
+    NULL};
+
+/*
+ * Tokenizer only, no folding or fingerprint lookup, so the cost of
+ * dispatching on the first character of each token is not diluted.
+ */
+int testTokenize(void) {
+    const int imax = 1000000;
+    int i, j;
+    size_t slen;
+    sfilter sf;
+    clock_t t0, t1;
+    double total;
+    int tps;
+
+    t0 = clock();
+    for (i = imax, j = 0; i != 0; --i, ++j) {
+        if (s[j] == NULL) {
+            j = 0;
+        }
+
+        slen = strlen(s[j]);
+        libinjection_sqli_init(&sf, s[j], slen,
+                               FLAG_QUOTE_NONE | FLAG_SQL_ANSI);
+        while (libinjection_sqli_tokenize(&sf)) {
+        }
+    }
+
+    t1 = clock();
+    total = (double)(t1 - t0) / (double)CLOCKS_PER_SEC;
+    tps = (int)((double)imax / total);
+    return tps;
+}
 
 int testIsSQL(void) {
-    const char *const s[] = {
-        "123 LIKE -1234.5678E+2;",
-        "APPLE 19.123 'FOO' \"BAR\"",
-        "/* BAR */ UNION ALL SELECT (2,3,4)",
-        "1 || COS(+0X04) --FOOBAR",
-        "dog apple @cat banana bar",
-        "dog apple cat \"banana \'bar",
-        "102 TABLE CLOTH",
-        "(1001-'1') union select 1,2,3,4 from credit_cards",
-        NULL};
     const int imax = 1000000;
     int i, j;
     size_t slen;
@@ -48,11 +95,61 @@ int testIsSQL(void) {
     return tps;
 }
 
+/*
+ * Short parameters, ids and words, most of which the batch lanes
+ * settle without tokenizing
+ */
+static const char *const short_inputs[] = {
+    "12345", "abc",    "user_name", "42", "true", "en",  "page2",
+    "0",     "a1b2c3", "999999",    "id", "desc", "1-2", "x'y", NULL};
+
+/*
+ * The inputs BATCH at a time through libinjection_sqli_batch, like
+ * the parameters of one request
+ */
+#define BATCH 32
+int testBatch(const char *const *inputs) {
+    const int imax = 1000000;
+    const char *ptrs[BATCH];
+    size_t lens[BATCH];
+    injection_result_t results[BATCH];
+    char fingerprints[BATCH * LIBINJECTION_SQLI_FINGERPRINT_SIZE];
+    int i, j, k;
+    clock_t t0, t1;
+    double total;
+    int tps;
+
+    for (k = 0, j = 0; k < BATCH; ++k, ++j) {
+        if (inputs[j] == NULL) {
+            j = 0;
+        }
+        ptrs[k] = inputs[j];
+        lens[k] = strlen(inputs[j]);
+    }
+
+    t0 = clock();
+    for (i = imax; i > 0; i -= BATCH) {
+        libinjection_sqli_batch(ptrs, lens, BATCH, results, fingerprints);
+    }
+
+    t1 = clock();
+    total = (double)(t1 - t0) / (double)CLOCKS_PER_SEC;
+    tps = (int)((double)imax / total);
+    return tps;
+}
+
 int main(void) {
     const int mintps = 450000;
     int tps = testIsSQL();
+    int tokenize_tps = testTokenize();
+    int batch_tps = testBatch(s);
+    int short_batch_tps = testBatch(short_inputs);
 
-    printf("\nTPS : %d\n\n", tps);
+    printf("\nDispatch : %s\n", DISPATCH_NAME);
+    printf("Tokenize TPS : %d\n", tokenize_tps);
+    printf("TPS : %d\n", tps);
+    printf("Batch TPS : %d\n", batch_tps);
+    printf("Short batch TPS : %d\n\n", short_batch_tps);
 
     if (tps < mintps) {
         printf("FAIL: %d < %d\n", tps, mintps);
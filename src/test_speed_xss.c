@@ -8,7 +8,70 @@
 #include <time.h>
 
 #include "libinjection.h"
+#include "libinjection_html5.h"
 int testIsSQL(void);
+int testTokenize(void);
+
+/*
+ * The HTML5 tokenizer core is picked at build time, see
+ * LIBINJECTION_HTML5_STATE_TABLE in libinjection_html5.c.  Build this
+ * file both ways (testspeedxss and testspeedxsstable) to compare them.
+ */
+#ifdef LIBINJECTION_HTML5_STATE_TABLE
+#define HTML5_CORE_NAME "state table"
+#else
+#define HTML5_CORE_NAME "function per state"
+#endif
+
+/*
+ * Page-like markup: long tag and attribute names, unquoted values and
+ * runs of white space, which the HTML5 tokenizer states skip with
+ * char_class_find()
+ */
+static const char *const markup[] = {
+    "<div class=container-fluid data-toggle=collapse "
+    "data-target=navbar-collapse-primary aria-expanded=false>",
+    "<input type=text name=search-query-string "
+    "placeholder=Search-the-documentation autocomplete=off>",
+    "<img src=/static/images/products/thumbnails/large/item-12345.png "
+    "width=640 height=480 loading=lazy>",
+    "<a href=https://www.example.com/catalog/category/subcategory/page "
+    "rel=noopener target=_blank>",
+    "<customelementwithaverylongname     attributewithaverylongname    "
+    "=    valuewithaverylongnametoo     />",
+    "<link rel=stylesheet href=/assets/css/application-0123456789abcdef.css"
+    " media=all>",
+    NULL};
+
+/*
+ * HTML5 tokenizer only, every token of each input in the data state
+ */
+int testTokenize(void) {
+    const int imax = 1000000;
+    int i, j;
+    size_t slen;
+    h5_state_t h5;
+    clock_t t0, t1;
+    double total;
+    int tps;
+
+    t0 = clock();
+    for (i = imax, j = 0; i != 0; --i, ++j) {
+        if (markup[j] == NULL) {
+            j = 0;
+        }
+
+        slen = strlen(markup[j]);
+        libinjection_h5_init(&h5, markup[j], slen, DATA_STATE);
+        while (libinjection_h5_next(&h5) == LIBINJECTION_RESULT_TRUE) {
+        }
+    }
+
+    t1 = clock();
+    total = (double)(t1 - t0) / (double)CLOCKS_PER_SEC;
+    tps = (int)((double)imax / total);
+    return tps;
+}
 
 int testIsSQL(void) {
     const char *const s[] = {
@@ -66,8 +129,11 @@ int testIsSQL(void) {
 int main(void) {
     const int mintps = 500000;
     int tps = testIsSQL();
+    int tokenize_tps = testTokenize();
 
-    printf("\nTPS : %d\n\n", tps);
+    printf("\nHTML5 core : %s\n", HTML5_CORE_NAME);
+    printf("HTML5 tokenize TPS : %d\n", tokenize_tps);
+    printf("TPS : %d\n\n", tps);
 
     if (tps < 500000) {
         printf("FAIL: %d < %d\n", tps, mintps);
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * Prints what the SQLi detector says about token type sequences and
+ * input lines.  It is built twice, as testsqlidfa with the generated
+ * fingerprint DFA and as testsqlidfaref with the reference matcher
+ * (LIBINJECTION_SQLI_REFERENCE_MATCH), and test-sqli-dfa.sh checks
+ * that both print the same thing.
+ *
+ * usage: testsqlidfa fingerprints.txt [input files...]
+ *
+ * The type sequences are every sequence of up to four types and every
+ * four type prefix of a fingerprint followed by each type, in both
+ * cases.  A sequence is printed if check_fingerprint says it is SQLi.
+ * Each input line is printed with its is_sqli verdict and fingerprint.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libinjection.h"
+#include "libinjection_sqli.h"
+
+/*
+ * every token type, both cases, and a byte that is not a type
+ */
+static const char types[] = "&(),.1:;\\{}ABCEFKNOSTUVXabcefknostuvx?";
+
+static unsigned long matched = 0;
+
+static void check_types(const char *fp, size_t len) {
+    struct libinjection_sqli_state state;
+    size_t i;
+
+    libinjection_sqli_init(&state, "1", 1, 0);
+    for (i = 0; i < len; ++i) {
+        state.fingerprint[i] = fp[i];
+        state.tokenvec[i].type = fp[i];
+    }
+    state.fingerprint[len] = '\0';
+    if (libinjection_sqli_check_fingerprint(&state)) {
+        printf("%s\n", state.fingerprint);
+        matched += 1;
+    }
+}
+
+static void all_types(char *fp, size_t len, size_t max) {
+    size_t i;
+
+    if (len > 0) {
+        check_types(fp, len);
+    }
+    if (len == max) {
+        return;
+    }
+    for (i = 0; types[i] != '\0'; ++i) {
+        fp[len] = types[i];
+        all_types(fp, len + 1, max);
+    }
+}
+
+static int fingerprint_tails(const char *fname) {
+    char line[64];
+    char fp[8];
+    size_t len;
+    size_t i;
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        len = strcspn(line, "\r\n");
+        if (len < 4) {
+            continue;
+        }
+        memcpy(fp, line, 4);
+        for (i = 0; types[i] != '\0'; ++i) {
+            fp[4] = types[i];
+            check_types(fp, 5);
+        }
+    }
+    fclose(fd);
+    return 0;
+}
+
+static int input_lines(const char *fname) {
+    struct libinjection_sqli_state state;
+    char line[8192];
+    size_t len;
+    int issqli;
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        len = strcspn(line, "\r\n");
+        libinjection_sqli_init(&state, line, len, 0);
+        issqli = libinjection_is_sqli(&state);
+        printf("%d %s\n", issqli, issqli ? state.fingerprint : "");
+    }
+    fclose(fd);
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    char fp[8];
+    int i;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s fingerprints.txt [input files...]\n",
+                argv[0]);
+        return 1;
+    }
+
+    all_types(fp, 0, 4);
+    if (fingerprint_tails(argv[1]) != 0) {
+        return 1;
+    }
+    for (i = 2; i < argc; ++i) {
+        if (input_lines(argv[i]) != 0) {
+            return 1;
+        }
+    }
+    fprintf(stderr, "%lu type sequences matched\n", matched);
+    return 0;
+}
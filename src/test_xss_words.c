@@ -0,0 +1,314 @@
+/**
+ * Copyright 2026 LibInjection Project
+ * BSD License -- see COPYING.txt for details
+ *
+ * Prints what the XSS detector says about tag and attribute names, URLs
+ * and input lines.  It is built twice, as testxsswords with the
+ * generated perfect hash tables and URL trie and as testxsswordsref
+ * with the linear searches (LIBINJECTION_XSS_REFERENCE_MATCH), and
+ * test-xss-words.sh checks that both print the same thing.
+ *
+ * usage: testxsswords xss_words.txt [input files...]
+ *
+ * Each name of xss_words.txt is tried as it is, in other cases, cut
+ * short, run on, with a changed byte and with a NUL byte anywhere in
+ * it, and after "on", as a tag, as an attribute with a few values and
+ * as the value of an attribute that names another.  So is every name
+ * of up to three bytes from the bytes the names start with.  A name
+ * is printed with what it gave in each place, if any of it was XSS.
+ *
+ * Each URL is tried as an href, in other cases, cut short, with each
+ * character HTML encoded in the ways html_decode_char_at() reads, and
+ * with bytes and entities that are skipped before it and inside it.
+ * So is every value of up to four bytes from the bytes entities are
+ * made of.  A URL is printed if it was XSS.
+ *
+ * Each input line is printed with its libinjection_xss verdict.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libinjection.h"
+#include "libinjection_xss.h"
+
+#define MAX_LINE 8192
+#define MAX_NAME 128
+#define MAX_URL 1024
+
+/*
+ * bytes names start and end with, and a few they don't
+ */
+static const char name_bytes[] = "aAbBlLnNoOsSvVgGxXmMhHkK:-1";
+
+/*
+ * bytes of entities and of the start of URLs (and '\0')
+ */
+static const char url_bytes[] = "&#xX0169;aAdDjJ \t\n";
+
+/*
+ * skipped before a URL, and some of them inside it
+ */
+static const char *const url_skipped[] = {
+    " ",     "\t",     "\n",     "\001",  "\177",    "\200",  "\377",
+    "&#32;", "&#0;",   "&#10;",  "&#9;",  "&#x0a",  "&#1",   NULL};
+
+static unsigned long printed = 0;
+
+static int is_xss(const char *prefix, const char *name, size_t len,
+                  const char *suffix) {
+    char buf[MAX_URL + 32];
+    size_t plen = strlen(prefix);
+    size_t slen = strlen(suffix);
+
+    memcpy(buf, prefix, plen);
+    memcpy(buf + plen, name, len);
+    memcpy(buf + plen + len, suffix, slen);
+    return libinjection_is_xss(buf, plen + len + slen, DATA_STATE) ==
+           LIBINJECTION_RESULT_TRUE;
+}
+
+static void print_escaped(const char *s, size_t len) {
+    size_t i;
+
+    printf(" ");
+    for (i = 0; i < len; ++i) {
+        if (s[i] > ' ' && s[i] < 127) {
+            printf("%c", s[i]);
+        } else {
+            printf("\\x%02x", (unsigned char)s[i]);
+        }
+    }
+    printf("\n");
+    printed += 1;
+}
+
+static void check_name(const char *name, size_t len) {
+    int places[6];
+    size_t i;
+
+    places[0] = is_xss("<", name, len, ">");
+    places[1] = is_xss("<a ", name, len, "=x>");
+    places[2] = is_xss("<a ", name, len, "=javascript:x>");
+    places[3] = is_xss("<a ", name, len, "=href>");
+    places[4] = is_xss("<a on", name, len, "=x>");
+    places[5] = is_xss("<a attributename=", name, len, ">");
+
+    for (i = 0; i < 6 && !places[i]; ++i) {
+    }
+    if (i == 6) {
+        return;
+    }
+    for (i = 0; i < 6; ++i) {
+        printf("%d", places[i]);
+    }
+    print_escaped(name, len);
+}
+
+static void check_url(const char *url, size_t len) {
+    if (is_xss("<a href=\"", url, len, "\">")) {
+        printf("url");
+        print_escaped(url, len);
+    }
+}
+
+static void variants(const char *word, size_t len) {
+    char name[MAX_NAME];
+    size_t i;
+
+    memcpy(name, word, len);
+    check_name(name, len);
+    for (i = 0; i < len; ++i) {
+        if (name[i] >= 'A' && name[i] <= 'Z') {
+            name[i] += 0x20;
+        }
+    }
+    check_name(name, len);
+    for (i = 0; i < len; i += 2) {
+        name[i] = word[i];
+    }
+    check_name(name, len);
+
+    memcpy(name, word, len);
+    check_name(name, len - 1);
+    check_name(name + 1, len - 1);
+    name[len] = 'x';
+    check_name(name, len + 1);
+
+    for (i = 0; i < len; ++i) {
+        name[i] = (char)(word[i] + 1);
+        check_name(name, len);
+        name[i] = word[i];
+    }
+    for (i = 0; i <= len; ++i) {
+        memcpy(name, word, i);
+        name[i] = '\0';
+        memcpy(name + i + 1, word + i, len - i);
+        check_name(name, len + 1);
+    }
+}
+
+/*
+ * url with its n-th character replaced by entity, or left out if
+ * entity is NULL, and what
+ */
+static void url_with(const char *url, size_t len, size_t n,
+                     const char *entity, const char *before) {
+    char buf[MAX_URL];
+    size_t blen = strlen(before);
+    size_t elen = entity != NULL ? strlen(entity) : 0;
+
+    memcpy(buf, before, blen);
+    memcpy(buf + blen, url, n);
+    memcpy(buf + blen + n, entity, elen);
+    memcpy(buf + blen + n + elen, url + n + 1, len - n - 1);
+    check_url(buf, blen + len - 1 + elen);
+}
+
+static void url_variants(const char *word, size_t len) {
+    char url[MAX_NAME];
+    char entity[32];
+    unsigned int ch;
+    size_t i;
+    size_t j;
+
+    memcpy(url, word, len);
+    url[len] = ':';
+    len += 1;
+    check_url(url, len);
+    check_url(url, len - 2);
+    for (i = 0; i < len; ++i) {
+        if (url[i] >= 'A' && url[i] <= 'Z') {
+            url[i] += 0x20;
+        }
+    }
+    check_url(url, len);
+    memcpy(url, word, len - 1);
+
+    for (i = 0; i < len; ++i) {
+        ch = (unsigned char)url[i];
+        sprintf(entity, "&#%u;", ch);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#%u", ch);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#x%x;", ch);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#X%X", ch);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#x%x;", ch + 0x20);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#%u;", ch + 0x100);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#x%x;", ch + 0x100000);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&#00%u;", ch);
+        url_with(url, len, i, entity, "");
+        sprintf(entity, "&%c", url[i]);
+        url_with(url, len, i, entity, "");
+        url_with(url, len, i, NULL, "");
+        for (j = 0; url_skipped[j] != NULL; ++j) {
+            sprintf(entity, "%s%c", url_skipped[j], url[i]);
+            url_with(url, len, i, entity, "");
+            sprintf(entity, "%c", url[i]);
+            url_with(url, len, i, entity, url_skipped[j]);
+        }
+    }
+}
+
+static int words(const char *fname) {
+    char line[MAX_LINE];
+    char kind[MAX_LINE];
+    char word[MAX_LINE];
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        if (line[0] == '#' || sscanf(line, "%s %s", kind, word) != 2) {
+            continue;
+        }
+        if (strlen(word) + 2 > MAX_NAME) {
+            fprintf(stderr, "%s is too long\n", word);
+            fclose(fd);
+            return 1;
+        }
+        if (strcmp(kind, "url") == 0) {
+            url_variants(word, strlen(word));
+        } else {
+            variants(word, strlen(word));
+        }
+    }
+    fclose(fd);
+    return 0;
+}
+
+static void all_names(char *name, size_t len, size_t max) {
+    size_t i;
+
+    check_name(name, len);
+    if (len == max) {
+        return;
+    }
+    for (i = 0; i < sizeof(name_bytes); ++i) {
+        /* with the '\0' at the end of name_bytes */
+        name[len] = name_bytes[i];
+        all_names(name, len + 1, max);
+    }
+}
+
+static void all_urls(char *url, size_t len, size_t max) {
+    size_t i;
+
+    check_url(url, len);
+    if (len == max) {
+        return;
+    }
+    for (i = 0; i < sizeof(url_bytes); ++i) {
+        /* with the '\0' at the end of url_bytes */
+        url[len] = url_bytes[i];
+        all_urls(url, len + 1, max);
+    }
+}
+
+static int input_lines(const char *fname) {
+    char line[MAX_LINE];
+    size_t len;
+    FILE *fd = fopen(fname, "r");
+
+    if (fd == NULL) {
+        fprintf(stderr, "Unable to open %s\n", fname);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        len = strcspn(line, "\r\n");
+        printf("%d %.*s\n", (int)libinjection_xss(line, len), (int)len, line);
+    }
+    fclose(fd);
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    char name[4];
+    char url[5];
+    int i;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s xss_words.txt [input files...]\n",
+                argv[0]);
+        return 1;
+    }
+    if (words(argv[1]) != 0) {
+        return 1;
+    }
+    all_names(name, 0, 3);
+    all_urls(url, 0, 4);
+    for (i = 2; i < argc; ++i) {
+        if (input_lines(argv[i]) != 0) {
+            return 1;
+        }
+    }
+    fprintf(stderr, "%lu names and URLs printed\n", printed);
+    return 0;
+}
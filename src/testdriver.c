@@ -8,6 +8,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+/*
+ * the contexts test-contexts- files run libinjection_sqli_ex with
+ */
+static const int g_contexts[] = {FLAG_NONE,
+                                 FLAG_QUOTE_NONE,
+                                 FLAG_QUOTE_NONE | FLAG_SQL_MYSQL,
+                                 FLAG_QUOTE_SINGLE,
+                                 FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL,
+                                 FLAG_QUOTE_DOUBLE,
+                                 FLAG_QUOTE_DOUBLE | FLAG_SQL_ANSI,
+                                 FLAG_SQL_MYSQL};
+
 static char g_test[8096];
 static char g_input[8096];
 static char g_expected[8096];
@@ -155,6 +167,7 @@ static int read_file(const char *fname, int flags, int testtype) {
     sfilter sf;
     int ok = 1;
     int num_tokens;
+    size_t actual_len;
     int issqli;
     int i;
 
@@ -227,6 +240,28 @@ static int read_file(const char *fname, int flags, int testtype) {
         if (issqli) {
             sprintf(g_actual, "%s", buf);
         }
+    } else if (testtype == 5) {
+        /*
+         * test the fingerprint libinjection_is_sqli leaves behind,
+         * whatever the verdict
+         */
+        libinjection_sqli_init(&sf, copy, slen, flags);
+        libinjection_is_sqli(&sf);
+        sprintf(g_actual, "%s", sf.fingerprint);
+    } else if (testtype == 6) {
+        /*
+         * test the verdict and passes of libinjection_sqli_ex in each
+         * of g_contexts, and the fingerprint if SQLi
+         */
+        for (i = 0; i < (int)(sizeof(g_contexts) / sizeof(g_contexts[0]));
+             ++i) {
+            libinjection_sqli_init(&sf, copy, slen, 0);
+            issqli = libinjection_sqli_ex(&sf, g_contexts[i]);
+            actual_len = strlen(g_actual);
+            sprintf(g_actual + actual_len, "flags %d: %d passes %d%s%s\n",
+                    g_contexts[i], issqli, sf.passes, issqli ? " " : "",
+                    issqli ? sf.fingerprint : "");
+        }
     } else if (testtype == 3) {
         /*
          * test HTML 5 tokenization only
@@ -296,6 +331,12 @@ int main(int argc, char **argv) {
         } else if (strstr(fname, "test-sqli-")) {
             flags = FLAG_NONE;
             testtype = 2;
+        } else if (strstr(fname, "test-fingerprint-")) {
+            flags = FLAG_NONE;
+            testtype = 5;
+        } else if (strstr(fname, "test-contexts-")) {
+            flags = FLAG_NONE;
+            testtype = 6;
         } else if (strstr(fname, "test-html5-")) {
             flags = FLAG_NONE;
             testtype = 3;
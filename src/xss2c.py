@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+#  Copyright 2026 LibInjection Project
+#  BSD License -- see COPYING.txt for details
+#
+
+"""
+Converts xss_words.txt to a C header (.h) file for libinjection_xss.c
+"""
+
+import sys
+
+from sqlparse2c import perfect_hash, print_uint_array
+
+# attribute_t in libinjection_xss.c
+ATTRIBUTE_TYPES = ('BLACK', 'ATTR_URL', 'STYLE', 'ATTR_INDIRECT')
+
+
+def read_words(lines):
+    """
+    xss_words.txt to a dict of kind -> {name: attribute type}, see
+    that file for the syntax
+    """
+    words = {'tag': {}, 'attr': {}, 'event': {}, 'url': {}}
+    for lineno, line in enumerate(lines, 1):
+        line = line.split('#', 1)[0].split()
+        if not line:
+            continue
+        kind, name, atype = line[0], line[1] if len(line) > 1 else '', None
+        if kind == 'attr' and len(line) == 3:
+            atype = line[2]
+        elif kind in ('tag', 'event', 'url') and len(line) == 2:
+            atype = 'BLACK'
+        if atype not in ATTRIBUTE_TYPES or not name:
+            sys.stderr.write("ERROR: xss_words.txt:%d: bad line\n" % (lineno,))
+            sys.exit(1)
+        if name != name.upper() or '\0' in name:
+            sys.stderr.write("ERROR: %s is not upper case\n" % (name,))
+            sys.exit(1)
+        if name in words[kind]:
+            sys.stderr.write("ERROR: %s %s listed twice\n" % (kind, name))
+            sys.exit(1)
+        words[kind][name] = atype
+    return words
+
+
+def print_table(name, words):
+    """ a perfect hash table over words, see lookup_word() """
+    disp, slots = perfect_hash(sorted(words.keys()))
+    print("static const xss_word_t %s_words[] = {" % (name,))
+    for k in slots:
+        print("    {\"%s\", %d, TYPE_%s}," % (k, len(k), words[k]))
+    print("};")
+    print_uint_array("%s_disp" % (name,), disp)
+    line = "static const xss_table_t %s = {%s_words, %d, %s_disp, %d};" % (
+        name, name, len(slots), name, len(disp))
+    if len(line) > 80:
+        head, tail = line.split(' = ')
+        line = "%s = {\n    %s" % (head, tail[1:])
+    print(line)
+
+
+def print_trie(name, words):
+    """
+    a trie over words, see is_black_url().  Nodes are numbered breadth
+    first so the children of a node are consecutive.
+    """
+    keys = sorted(words.keys())
+    for k in keys:
+        for other in keys:
+            if other != k and k.startswith(other):
+                sys.stderr.write("ERROR: %s starts with %s\n" % (k, other))
+                sys.exit(1)
+    nodes = sorted(set(k[:n] for k in keys for n in range(len(k) + 1)),
+                   key=lambda p: (len(p), p))
+    if len(nodes) > 255:
+        sys.stderr.write("ERROR: too many trie nodes\n")
+        sys.exit(1)
+    index = dict((prefix, n) for n, prefix in enumerate(nodes))
+    print("static const xss_trie_t %s[] = {" % (name,))
+    for prefix in nodes:
+        children = [index[c] for c in nodes if len(c) == len(prefix) + 1 and
+                    c.startswith(prefix)]
+        print("    {'%s', %d, %d}," % (prefix[-1:] or '\\0',
+                                     children[0] if children else 0,
+                                     len(children)))
+    print("};")
+
+
+def print_list(name, words, ctype):
+    """ a NULL terminated list for LIBINJECTION_XSS_REFERENCE_MATCH """
+    print("static const %s %s[] = {" % (ctype, name))
+    for k in sorted(words.keys()):
+        if ctype == 'stringtype_t':
+            print("    {\"%s\", TYPE_%s}," % (k, words[k]))
+        else:
+            print("    \"%s\"," % (k,))
+    if ctype == 'stringtype_t':
+        print("    {NULL, TYPE_NONE}};")
+    else:
+        print("    NULL};")
+
+
+def main():
+    """ main routine """
+    words = read_words(sys.stdin)
+
+    # is_black_tag() and is_black_attr() rely on these
+    names = list(words['tag'].keys()) + list(words['attr'].keys())
+    word_max = max(len(k) for k in names)
+    event_max = max(len(k) for k in words['event'].keys())
+    event_lens = [0] * (event_max + 1)
+    for k in words['event'].keys():
+        event_lens[len(k)] = 1
+
+    print("""/**
+ * Generated by xss2c.py from xss_words.txt, do not edit
+ */
+#ifndef LIBINJECTION_XSS_DATA_H
+#define LIBINJECTION_XSS_DATA_H
+
+/* longest tag or attribute name */
+#define XSS_WORD_MAX %d
+
+/* longest event name */
+#define XSS_EVENT_MAX %d
+
+#ifndef LIBINJECTION_XSS_REFERENCE_MATCH
+typedef struct {
+    const char *name;
+    size_t len;
+    attribute_t atype;
+} xss_word_t;
+
+typedef struct {
+    const xss_word_t *words; /* in slot order */
+    size_t size;
+    const unsigned int *disp;
+    size_t disp_size;
+} xss_table_t;
+
+/*
+ * Node 0 is the root.  A node's children are the count nodes from
+ * first, and a node with none ends a word.
+ */
+typedef struct {
+    char ch;
+    unsigned char first;
+    unsigned char count;
+} xss_trie_t;
+""" % (word_max, event_max))
+    print_table("xss_tags", words['tag'])
+    print()
+    print_table("xss_attrs", words['attr'])
+    print()
+    print_table("xss_events", words['event'])
+    print()
+    print("/* 1 if there is an event name of that length */")
+    print_uint_array("xss_event_lens", event_lens, "unsigned char")
+    print()
+    print_trie("xss_urls", words['url'])
+    print("#else")
+    print_list("BLACKTAG", words['tag'], "char *const")
+    print_list("BLACKATTR", words['attr'], "stringtype_t")
+    print_list("BLACKATTREVENT", words['event'], "stringtype_t")
+    print_list("BLACKURL", words['url'], "char *const")
+    print("#endif")
+    print()
+    print("#endif")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())